@@ -321,7 +321,19 @@ typedef  CPU_INT32U                 CPU_SR;                     /* Defines   CPU
 #define  CPU_INT_EN()               CPU_IntEn()                         /* Enable  interrupts.                          */
 
 
-#ifdef   CPU_CFG_INT_DIS_MEAS_EN
+#if     (defined(CPU_CFG_INT_DIS_MEAS_EN) && \
+         defined(CPU_CFG_INT_DIS_MEAS_HIST_EN))
+                                                                        /* Disable interrupts, save the site ...        */
+                                                                        /* & start interrupts disabled time measurement.*/
+#define  CPU_CRITICAL_ENTER()  do { CPU_INT_DIS();                                 \
+                                    CPU_IntDisMeasSiteSet(__FILE__, __LINE__);     \
+                                    CPU_IntDisMeasStart();                         } while (0)
+                                                                        /* Stop & measure   interrupts disabled time,   */
+                                                                        /* ...  & re-enable interrupts.                 */
+#define  CPU_CRITICAL_EXIT()   do { CPU_IntDisMeasStop();  \
+                                    CPU_INT_EN();          } while (0)
+
+#elif    defined(CPU_CFG_INT_DIS_MEAS_EN)
                                                                         /* Disable interrupts, ...                      */
                                                                         /* & start interrupts disabled time measurement.*/
 #define  CPU_CRITICAL_ENTER()  do { CPU_INT_DIS();         \
@@ -159,6 +159,10 @@ static  void        CPU_IntDisMeasInit   (void);
 static  CPU_TS_TMR  CPU_IntDisMeasMaxCalc(CPU_TS_TMR  time_tot_cnts);
 #endif
 
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+static  void        CPU_IntDisMeasSiteUpdate(CPU_TS_TMR  time_tot_cnts);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1037,7 +1041,145 @@ void  CPU_IntDisMeasStop (void)
         if (CPU_IntDisMeasMax_cnts    < time_ints_disd_cnts) {
             CPU_IntDisMeasMax_cnts    = time_ints_disd_cnts;
         }
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+        CPU_IntDisMeasSiteUpdate(time_ints_disd_cnts);              /* Update hist of cur site.                         */
+#endif
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       CPU_IntDisMeasSiteSet()
+*
+* Description : Set the critical section site of the interrupts disabled time measurement.
+*
+* Argument(s) : p_file      Pointer to the source file name of the site.
+*
+*               line        Source line of the site.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_CRITICAL_ENTER().
+*
+*               This function is an INTERNAL CPU module function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) Only the site of the outermost critical section is kept : nested critical sections
+*                   are charged to the site which disabled interrupts.
+*
+*               (2) This function is called before CPU_IntDisMeasStart() so that its time is NOT
+*                   measured.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+void  CPU_IntDisMeasSiteSet (const  CPU_CHAR    *p_file,
+                                    CPU_INT32U   line)
+{
+    if (CPU_IntDisNestCtr == 0u) {                                  /* If ints NOT yet dis'd (see Note #1), ...         */
+        CPU_IntDisMeasSiteFilePtr = p_file;                         /* ... save site.                                   */
+        CPU_IntDisMeasSiteLine    = line;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       CPU_IntDisMeasSiteGet()
+*
+* Description : Get the interrupts disabled time histogram of a critical section site.
+*
+* Argument(s) : ix          Index of the site in the table, from 0 to (CPU_CFG_INT_DIS_MEAS_SITE_NBR - 1).
+*
+*               p_site      Pointer to a variable that will receive a copy of the site.
+*
+* Return(s)   : DEF_YES, if the site has measurements.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) Site 0 collects the critical sections which did NOT fit in the table; its 'FilePtr'
+*                   is NULL.
+*
+*               (2) 'CPU_IntDisMeasSiteTbl' MUST ALWAYS be accessed exclusively with interrupts disabled
+*                   -- but NOT with critical sections.
+*
+*               (3) Times are adjusted by the interrupts disabled time measurement overhead.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+CPU_BOOLEAN  CPU_IntDisMeasSiteGet (CPU_INT16U              ix,
+                                    CPU_INT_DIS_MEAS_SITE  *p_site)
+{
+    CPU_SR_ALLOC();
+
+
+    if (p_site == (CPU_INT_DIS_MEAS_SITE *)0) {
+        return (DEF_NO);
     }
+    if (ix >= CPU_CFG_INT_DIS_MEAS_SITE_NBR) {
+        return (DEF_NO);
+    }
+
+    CPU_INT_DIS();                                                  /* See Note #2.                                     */
+   *p_site = CPU_IntDisMeasSiteTbl[ix];
+    CPU_INT_EN();
+
+    return ((p_site->Ctr > 0u) ? DEF_YES : DEF_NO);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      CPU_IntDisMeasSiteReset()
+*
+* Description : Clear the interrupts disabled time histograms of all the critical section sites.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_IntDisMeasInit(),
+*               Application.
+*
+*               This function is a CPU module application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) 'CPU_IntDisMeasSiteTbl' MUST ALWAYS be accessed exclusively with interrupts disabled
+*                   -- but NOT with critical sections.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+void  CPU_IntDisMeasSiteReset (void)
+{
+    CPU_INT_DIS_MEAS_SITE  *p_site;
+    CPU_INT16U              i;
+    CPU_INT16U              j;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();                                                  /* See Note #1.                                     */
+    for (i = 0u; i < CPU_CFG_INT_DIS_MEAS_SITE_NBR; i++) {
+        p_site           = &CPU_IntDisMeasSiteTbl[i];
+        p_site->FilePtr  = (const CPU_CHAR *)0;
+        p_site->Line     = 0u;
+        p_site->Ctr      = 0u;
+        p_site->Max_cnts = 0u;
+        for (j = 0u; j < CPU_CFG_INT_DIS_MEAS_HIST_NBR; j++) {
+            p_site->Hist[j] = 0u;
+        }
+    }
+    CPU_INT_EN();
 }
 #endif
 
@@ -2290,6 +2432,12 @@ static  void  CPU_IntDisMeasInit (void)
     CPU_IntDisMeasMaxCur_cnts =  0u;                            /* Reset max ints dis'd times.                          */
     CPU_IntDisMeasMax_cnts    =  0u;
     CPU_INT_EN();
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+    CPU_IntDisMeasSiteFilePtr = (const CPU_CHAR *)0;
+    CPU_IntDisMeasSiteLine    =  0u;
+    CPU_IntDisMeasSiteReset();                                  /* Forget the ovrhd meas's.                             */
+#endif
 }
 #endif
 
@@ -2409,3 +2557,75 @@ static  CPU_TS_TMR  CPU_IntDisMeasMaxCalc (CPU_TS_TMR  time_tot_cnts)
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*                                      CPU_IntDisMeasSiteUpdate()
+*
+* Description : Add an interrupts disabled time to the histogram of the current critical section site.
+*
+* Argument(s) : time_tot_cnts   Total interrupt disabled time, in timer counts.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_IntDisMeasStop().
+*
+* Note(s)     : (1) Sites are found by hashing the source file pointer & line into the table, with linear
+*                   probing.  A site which finds the table full is charged to entry 0.
+*
+*               (2) Interrupts are still disabled, but the stop time has already been read : the time of
+*                   this function is NOT measured.
+*
+*               (3) See 'cpu_core.h  CPU INTERRUPTS DISABLED TIME HISTOGRAM DATA TYPE  Note #2'.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+static  void  CPU_IntDisMeasSiteUpdate (CPU_TS_TMR  time_tot_cnts)
+{
+           CPU_INT_DIS_MEAS_SITE  *p_site;
+           CPU_INT_DIS_MEAS_SITE  *p_entry;
+    const  CPU_CHAR               *p_file;
+           CPU_INT32U              line;
+           CPU_INT16U              ix;
+           CPU_INT16U              i;
+
+
+    p_file = CPU_IntDisMeasSiteFilePtr;
+    line   = CPU_IntDisMeasSiteLine;
+    p_site = &CPU_IntDisMeasSiteTbl[0];
+    if (p_file != (const CPU_CHAR *)0) {                        /* Find site (see Note #1).                             */
+        ix = (CPU_INT16U)((((CPU_ADDR)p_file >> 2u) + (line * 31u)) % (CPU_CFG_INT_DIS_MEAS_SITE_NBR - 1u));
+        for (i = 1u; i < CPU_CFG_INT_DIS_MEAS_SITE_NBR; i++) {
+            p_entry = &CPU_IntDisMeasSiteTbl[ix + 1u];
+            if (p_entry->FilePtr == (const CPU_CHAR *)0) {      /* Claim free entry.                                    */
+                p_entry->FilePtr = p_file;
+                p_entry->Line    = line;
+            }
+            if ((p_entry->FilePtr == p_file) &&
+                (p_entry->Line    == line)) {
+                p_site = p_entry;
+                break;
+            }
+            ix++;
+            if (ix >= (CPU_CFG_INT_DIS_MEAS_SITE_NBR - 1u)) {
+                ix = 0u;
+            }
+        }
+    }
+
+    time_tot_cnts = CPU_IntDisMeasMaxCalc(time_tot_cnts);      /* Adj by ovrhd.                                        */
+    ix            = 0u;                                         /* Find bucket (see Note #3).                           */
+    while ((ix < (CPU_CFG_INT_DIS_MEAS_HIST_NBR - 1u)) &&
+           ((time_tot_cnts >> ix) != 0u)) {
+        ix++;
+    }
+
+    p_site->Ctr++;
+    p_site->Hist[ix]++;
+    if (p_site->Max_cnts < time_tot_cnts) {
+        p_site->Max_cnts = time_tot_cnts;
+    }
+}
+#endif
+
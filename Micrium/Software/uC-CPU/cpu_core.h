@@ -245,6 +245,31 @@ typedef  CPU_INT32U  CPU_TS_TMR;
 typedef  CPU_INT32U  CPU_TS_TMR_FREQ;
 
 
+/*
+*********************************************************************************************************
+*                          CPU INTERRUPTS DISABLED TIME HISTOGRAM DATA TYPE
+*
+* Note(s) : (1) Interrupts disabled times are kept per critical section site, i.e. per expansion of
+*               CPU_CRITICAL_ENTER() in the source code, in a table of CPU_CFG_INT_DIS_MEAS_SITE_NBR
+*               entries.  Entry 0 collects the sites which do NOT fit in the table.
+*
+*           (2) Histogram bucket 0 counts the times of 0 timer counts & bucket N (N > 0) counts the
+*               times from 2^(N - 1) to (2^N - 1) timer counts.  The last bucket also counts all the
+*               longer times.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+typedef  struct  cpu_int_dis_meas_site {
+    const  CPU_CHAR    *FilePtr;                                /* Src file of the site (NULL for entry 0).             */
+           CPU_INT32U   Line;                                   /* Src line of the site.                                */
+           CPU_INT32U   Ctr;                                    /* Nbr of meas's.                                       */
+           CPU_TS_TMR   Max_cnts;                               /* Max ints dis'd time (in ts tmr cnts).                */
+           CPU_INT32U   Hist[CPU_CFG_INT_DIS_MEAS_HIST_NBR];    /* Nbr of meas's per bucket (see Note #2).              */
+} CPU_INT_DIS_MEAS_SITE;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -284,6 +309,12 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMaxCur_cnts;       /* ...     reset
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ... non-resetable max time dis'd.                    */
 #endif
 
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN                            /* Ints dis'd time per site :                           */
+CPU_CORE_EXT  const  CPU_CHAR               *CPU_IntDisMeasSiteFilePtr;     /* ... src file of cur site.            */
+CPU_CORE_EXT         CPU_INT32U              CPU_IntDisMeasSiteLine;        /* ... src line of cur site.            */
+CPU_CORE_EXT         CPU_INT_DIS_MEAS_SITE   CPU_IntDisMeasSiteTbl[CPU_CFG_INT_DIS_MEAS_SITE_NBR];
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -581,6 +612,17 @@ void             CPU_IntDisMeasStart      (void);
 void             CPU_IntDisMeasStop       (void);
 #endif
 
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+CPU_BOOLEAN      CPU_IntDisMeasSiteGet    (CPU_INT16U              ix,
+                                           CPU_INT_DIS_MEAS_SITE  *p_site);
+
+void             CPU_IntDisMeasSiteReset  (void);
+
+
+void             CPU_IntDisMeasSiteSet    (const  CPU_CHAR        *p_file,
+                                                  CPU_INT32U       line);
+#endif
+
 
 
                                                                         /* ----------- CPU CNT ZEROS FNCTS ------------ */
@@ -1005,6 +1047,39 @@ CPU_INT64U  CPU_TS64_to_uSec(CPU_TS64  ts_cnts);
 
 
 
+#ifdef   CPU_CFG_INT_DIS_MEAS_HIST_EN
+
+#ifndef  CPU_CFG_INT_DIS_MEAS_EN
+#error  "CPU_CFG_INT_DIS_MEAS_HIST_EN          #define'd in 'cpu_cfg.h'  "
+#error  "                                [MUST #define CPU_CFG_INT_DIS_MEAS_EN]"
+#endif
+
+#ifndef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+#error  "CPU_CFG_INT_DIS_MEAS_SITE_NBR         not #define'd in 'cpu_cfg.h' "
+#error  "                                [MUST be  >=    2]"
+#error  "                                [     ||  <= 1024]"
+
+#elif   (DEF_CHK_VAL(CPU_CFG_INT_DIS_MEAS_SITE_NBR, 2, 1024) != DEF_OK)
+#error  "CPU_CFG_INT_DIS_MEAS_SITE_NBR   illegally #define'd in 'cpu_cfg.h' "
+#error  "                                [MUST be  >=    2]"
+#error  "                                [     ||  <= 1024]"
+#endif
+
+#ifndef  CPU_CFG_INT_DIS_MEAS_HIST_NBR
+#error  "CPU_CFG_INT_DIS_MEAS_HIST_NBR         not #define'd in 'cpu_cfg.h' "
+#error  "                                [MUST be  >=  2]"
+#error  "                                [     ||  <= 33]"
+
+#elif   (DEF_CHK_VAL(CPU_CFG_INT_DIS_MEAS_HIST_NBR, 2, 33) != DEF_OK)
+#error  "CPU_CFG_INT_DIS_MEAS_HIST_NBR   illegally #define'd in 'cpu_cfg.h' "
+#error  "                                [MUST be  >=  2]"
+#error  "                                [     ||  <= 33]"
+#endif
+
+#endif
+
+
+
 
 #ifndef  CPU_CFG_LEAD_ZEROS_ASM_PRESENT
 #if 0                                                           /* Optionally configured in 'cpu_cfg.h'; DO NOT MODIFY. */
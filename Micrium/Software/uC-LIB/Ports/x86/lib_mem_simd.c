@@ -0,0 +1,1133 @@
+/*
+*********************************************************************************************************
+*                                                uC/LIB
+*                                        CUSTOM LIBRARY MODULES
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  STANDARD MEMORY OPERATIONS : SIMD
+*
+*                                                 x86
+*                                   Visual Studio / GNU C Compiler
+*
+* Filename      : lib_mem_simd.c
+* Version       : V1.38.02
+*********************************************************************************************************
+* Note(s)       : (1) SSE2 & AVX2 versions of Mem_Set(), Mem_Copy(), Mem_Move(), Mem_Cmp() & Mem_ZeroLen(),
+*                     called by 'lib_mem.c' for buffers of LIB_MEM_CFG_SIMD_SIZE_MIN octets or more.
+*
+*                 (2) The level used is detected on the first call from the CPUID instruction & from the
+*                     registers the OS saves on a context switch (XGETBV), & may be lowered at run time by
+*                     Mem_SIMD_LvlSet(), e.g. to benchmark the 'CPU_ALIGN'-sized word loops.
+*
+*                 (3) Every function has the same layout :
+*
+*                     (a) Octets up to the first vector-aligned destination address.
+*
+*                     (b) Vectors, loaded from the source with unaligned loads & stored to the destination
+*                         with aligned stores, four at a time then one at a time.
+*
+*                     (c) Remaining octets.
+*
+*                     The buffers are never accessed outside of [p, p + size).
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <lib_mem.h>
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+
+#if   (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)))
+#include  <intrin.h>
+#include  <immintrin.h>
+#elif (defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)))
+#include  <immintrin.h>
+#else
+#error  "lib_mem_simd.c  only supports x86 CPUs : #define LIB_MEM_CFG_SIMD_EN to DEF_DISABLED in 'lib_cfg.h'"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*
+* Note(s) : (1) GCC only emits vector instructions in functions compiled for the matching target; Visual
+*               Studio emits the instructions of any intrinsic.
+*********************************************************************************************************
+*/
+
+#if defined(__GNUC__)                                           /* See Note #1.                                         */
+#define  MEM_SIMD_TARGET_SSE2           __attribute__((target("sse2")))
+#define  MEM_SIMD_TARGET_AVX2           __attribute__((target("avx2")))
+#else
+#define  MEM_SIMD_TARGET_SSE2
+#define  MEM_SIMD_TARGET_AVX2
+#endif
+
+#define  MEM_SIMD_LVL_UNKNOWN                          0xFFu    /* Level not detected yet.                              */
+
+#define  MEM_SIMD_SSE2_SIZE                              16u    /* Vector sizes, in octets.                             */
+#define  MEM_SIMD_AVX2_SIZE                              32u
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  mem_simd_fncts {                               /* Functions of one SIMD level.                         */
+    void         (*Set) (      CPU_INT08U  *p_mem,
+                               CPU_INT08U   data_val,
+                               CPU_SIZE_T   size);
+
+    void         (*Copy)(      CPU_INT08U  *p_dest,
+                         const CPU_INT08U  *p_src,
+                               CPU_SIZE_T   size);
+
+    void         (*Move)(      CPU_INT08U  *p_dest,
+                         const CPU_INT08U  *p_src,
+                               CPU_SIZE_T   size);
+
+    CPU_BOOLEAN  (*Cmp) (const CPU_INT08U  *p1_mem,
+                         const CPU_INT08U  *p2_mem,
+                               CPU_SIZE_T   size);
+
+    CPU_SIZE_T   (*ZeroLen)(const CPU_INT08U  *p_mem,
+                                  CPU_SIZE_T   size);
+} MEM_SIMD_FNCTS;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U   Mem_SIMD_LvlDetect(void);
+
+static  void         Mem_SIMD_Set_SSE2 (      CPU_INT08U  *p_mem,
+                                              CPU_INT08U   data_val,
+                                              CPU_SIZE_T   size);
+
+static  void         Mem_SIMD_Copy_SSE2(      CPU_INT08U  *p_dest,
+                                        const CPU_INT08U  *p_src,
+                                              CPU_SIZE_T   size);
+
+static  void         Mem_SIMD_Move_SSE2(      CPU_INT08U  *p_dest,
+                                        const CPU_INT08U  *p_src,
+                                              CPU_SIZE_T   size);
+
+static  CPU_BOOLEAN  Mem_SIMD_Cmp_SSE2 (const CPU_INT08U  *p1_mem,
+                                        const CPU_INT08U  *p2_mem,
+                                              CPU_SIZE_T   size);
+
+static  CPU_SIZE_T   Mem_SIMD_ZeroLen_SSE2(const CPU_INT08U  *p_mem,
+                                                 CPU_SIZE_T   size);
+
+static  void         Mem_SIMD_Set_AVX2 (      CPU_INT08U  *p_mem,
+                                              CPU_INT08U   data_val,
+                                              CPU_SIZE_T   size);
+
+static  void         Mem_SIMD_Copy_AVX2(      CPU_INT08U  *p_dest,
+                                        const CPU_INT08U  *p_src,
+                                              CPU_SIZE_T   size);
+
+static  void         Mem_SIMD_Move_AVX2(      CPU_INT08U  *p_dest,
+                                        const CPU_INT08U  *p_src,
+                                              CPU_SIZE_T   size);
+
+static  CPU_BOOLEAN  Mem_SIMD_Cmp_AVX2 (const CPU_INT08U  *p1_mem,
+                                        const CPU_INT08U  *p2_mem,
+                                              CPU_SIZE_T   size);
+
+static  CPU_SIZE_T   Mem_SIMD_ZeroLen_AVX2(const CPU_INT08U  *p_mem,
+                                                 CPU_SIZE_T   size);
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  MEM_SIMD_FNCTS  Mem_SIMD_FnctsTbl[] = {          /* Indexed by LIB_MEM_SIMD_LVL_xxx.                     */
+    { 0,                  0,                   0,                   0,                  0                     },
+    { Mem_SIMD_Set_SSE2,  Mem_SIMD_Copy_SSE2,  Mem_SIMD_Move_SSE2,  Mem_SIMD_Cmp_SSE2,  Mem_SIMD_ZeroLen_SSE2 },
+    { Mem_SIMD_Set_AVX2,  Mem_SIMD_Copy_AVX2,  Mem_SIMD_Move_AVX2,  Mem_SIMD_Cmp_AVX2,  Mem_SIMD_ZeroLen_AVX2 }
+};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*
+* Note(s) : (1) Written once by the first caller of Mem_SIMD_LvlGet(); concurrent first callers detect
+*               & write the same values.
+*
+*           (2) The level in use is the index of 'Mem_SIMD_FnctsPtr' in Mem_SIMD_FnctsTbl[], NULL until it is
+*               detected.  It is published by a single pointer write, so a concurrent first caller never sees
+*               a level with the function table of another.
+*********************************************************************************************************
+*/
+
+static           CPU_INT08U       Mem_SIMD_LvlMax  = MEM_SIMD_LVL_UNKNOWN;  /* Highest level the CPU & OS support.    */
+static  const    MEM_SIMD_FNCTS  *Mem_SIMD_FnctsPtr = (MEM_SIMD_FNCTS *)0;  /* Level in use, see Note #2.             */
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_SIMD_LvlGet()
+*
+* Description : Get the SIMD level used by the memory functions.
+*
+* Argument(s) : none.
+*
+* Return(s)   : LIB_MEM_SIMD_LVL_NONE, LIB_MEM_SIMD_LVL_SSE2 or LIB_MEM_SIMD_LVL_AVX2.
+*
+* Caller(s)   : Mem_Set(),
+*               Mem_Copy(),
+*               Mem_Move(),
+*               Mem_Cmp(),
+*               Mem_ZeroLen(),
+*               Application.
+*
+* Note(s)     : (1) The level is detected on the first call (see 'lib_mem_simd.c  Note #2').
+*********************************************************************************************************
+*/
+
+CPU_INT08U  Mem_SIMD_LvlGet (void)
+{
+    const  MEM_SIMD_FNCTS  *p_fncts;
+
+
+    p_fncts = Mem_SIMD_FnctsPtr;
+    if (p_fncts == (const MEM_SIMD_FNCTS *)0) {                 /* See Note #1.                                         */
+        (void)Mem_SIMD_LvlSet(LIB_MEM_SIMD_LVL_AVX2);           /* Highest level supported.                             */
+        p_fncts = Mem_SIMD_FnctsPtr;
+    }
+
+    return ((CPU_INT08U)(p_fncts - &Mem_SIMD_FnctsTbl[0]));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_SIMD_LvlSet()
+*
+* Description : Set the SIMD level used by the memory functions.
+*
+* Argument(s) : lvl         Level to use :
+*
+*                               LIB_MEM_SIMD_LVL_NONE       'CPU_ALIGN'-sized word loops only.
+*                               LIB_MEM_SIMD_LVL_SSE2       SSE2 vectors.
+*                               LIB_MEM_SIMD_LVL_AVX2       AVX2 vectors.
+*
+* Return(s)   : Level in use, i.e. 'lvl' or the highest level supported if lower.
+*
+* Caller(s)   : Mem_SIMD_LvlGet(),
+*               Application.
+*
+* Note(s)     : (1) MUST NOT be called while other tasks or threads use the memory functions.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  Mem_SIMD_LvlSet (CPU_INT08U  lvl)
+{
+    if (Mem_SIMD_LvlMax == MEM_SIMD_LVL_UNKNOWN) {
+        Mem_SIMD_LvlMax = Mem_SIMD_LvlDetect();
+    }
+    if (lvl > Mem_SIMD_LvlMax) {
+        lvl = Mem_SIMD_LvlMax;
+    }
+
+    Mem_SIMD_FnctsPtr = &Mem_SIMD_FnctsTbl[lvl];                /* See 'LOCAL GLOBAL VARIABLES  Note #2'.               */
+
+    return (lvl);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_SIMD_Set()
+*
+* Description : Fill data buffer with specified data octet, using the SIMD level in use.
+*
+* Argument(s) : pmem        Pointer to memory buffer to fill with specified data octet.
+*
+*               data_val    Data fill octet value.
+*
+*               size        Number of data buffer octets to fill.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Set().
+*
+* Note(s)     : (1) The SIMD level MUST NOT be LIB_MEM_SIMD_LVL_NONE, i.e. Mem_SIMD_LvlGet() MUST have returned
+*                   another level.
+*********************************************************************************************************
+*/
+
+void  Mem_SIMD_Set (void        *pmem,
+                    CPU_INT08U   data_val,
+                    CPU_SIZE_T   size)
+{
+    Mem_SIMD_FnctsPtr->Set((CPU_INT08U *)pmem, data_val, size);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_SIMD_Copy()
+*
+* Description : Copy data octets from one memory buffer to another memory buffer, using the SIMD level
+*               in use.
+*
+* Argument(s) : pdest       Pointer to destination memory buffer.
+*
+*               psrc        Pointer to source      memory buffer.
+*
+*               size        Number of octets to copy.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Copy().
+*
+* Note(s)     : (1) See 'Mem_SIMD_Set()  Note #1'.
+*
+*               (2) Octets are copied from the lowest address up, & every vector is loaded before it is
+*                   stored.  So, like Mem_Copy(), overlapping buffers are copied correctly as long as the
+*                   source buffer is at a higher address value than the destination buffer.
+*********************************************************************************************************
+*/
+
+void  Mem_SIMD_Copy (       void        *pdest,
+                     const  void        *psrc,
+                            CPU_SIZE_T   size)
+{
+    Mem_SIMD_FnctsPtr->Copy((CPU_INT08U *)pdest, (const CPU_INT08U *)psrc, size);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_SIMD_Move()
+*
+* Description : Copy data octets from one memory buffer to another memory buffer from the highest address
+*               down, using the SIMD level in use.
+*
+* Argument(s) : pdest       Pointer to destination memory buffer.
+*
+*               psrc        Pointer to source      memory buffer.
+*
+*               size        Number of octets to move.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_Move().
+*
+* Note(s)     : (1) See 'Mem_SIMD_Set()  Note #1'.
+*
+*               (2) Overlapping buffers are moved correctly as long as the destination buffer is at a higher
+*                   or equal address value than the source buffer; Mem_Move() hands the other case to
+*                   Mem_Copy().
+*********************************************************************************************************
+*/
+
+void  Mem_SIMD_Move (       void        *pdest,
+                     const  void        *psrc,
+                            CPU_SIZE_T   size)
+{
+    Mem_SIMD_FnctsPtr->Move((CPU_INT08U *)pdest, (const CPU_INT08U *)psrc, size);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_SIMD_Cmp()
+*
+* Description : Verify that ALL data octets in two memory buffers are identical in sequence, using the
+*               SIMD level in use.
+*
+* Argument(s) : p1_mem      Pointer to first  memory buffer.
+*
+*               p2_mem      Pointer to second memory buffer.
+*
+*               size        Number of data buffer octets to compare.
+*
+* Return(s)   : DEF_YES, if 'size' number of data octets are identical in both memory buffers.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Mem_Cmp().
+*
+* Note(s)     : (1) See 'Mem_SIMD_Set()  Note #1'.
+*
+*               (2) Like Mem_Cmp(), the comparison starts from the end of the memory buffers (see
+*                   'lib_mem.c  Mem_Cmp()  Note #2').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  Mem_SIMD_Cmp (const  void        *p1_mem,
+                           const  void        *p2_mem,
+                                  CPU_SIZE_T   size)
+{
+    return (Mem_SIMD_FnctsPtr->Cmp((const CPU_INT08U *)p1_mem, (const CPU_INT08U *)p2_mem, size));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_SIMD_ZeroLen()
+*
+* Description : Count the data octets equal to zero at the start of a memory buffer, using the SIMD level
+*               in use.
+*
+* Argument(s) : pmem        Pointer to memory buffer to scan.
+*
+*               size        Number of data buffer octets to scan.
+*
+* Return(s)   : Number of octets equal to zero before the first non-zero octet, or 'size' if ALL octets
+*               are equal to zero.
+*
+* Caller(s)   : Mem_ZeroLen().
+*
+* Note(s)     : (1) See 'Mem_SIMD_Set()  Note #1'.
+*
+*               (2) Vectors are read with aligned loads only, so no octet past the vector holding the first
+*                   non-zero octet is accessed, & none past the end of the buffer.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Mem_SIMD_ZeroLen (const  void        *pmem,
+                                     CPU_SIZE_T   size)
+{
+    return (Mem_SIMD_FnctsPtr->ZeroLen((const CPU_INT08U *)pmem, size));
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_LvlDetect()
+*
+* Description : Detect the highest SIMD level supported by the CPU & the OS.
+*
+* Argument(s) : none.
+*
+* Return(s)   : LIB_MEM_SIMD_LVL_xxx.
+*
+* Caller(s)   : Mem_SIMD_LvlGet(),
+*               Mem_SIMD_LvlSet().
+*
+* Note(s)     : (1) AVX2 requires CPUID.(EAX=07H,ECX=0):EBX[bit 5], & the OS to save the YMM registers,
+*                   i.e. CPUID.1:ECX.OSXSAVE[bit 27] & XCR0[bits 2:1] both set.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  Mem_SIMD_LvlDetect (void)
+{
+#if defined(_MSC_VER)
+    int         regs[4];
+    int         leaf_max;
+    CPU_INT08U  lvl;
+
+
+    __cpuid(regs, 0);
+    leaf_max = regs[0];
+    __cpuid(regs, 1);
+    if ((regs[3] & (1 << 26)) == 0) {                           /* EDX.SSE2.                                            */
+        return (LIB_MEM_SIMD_LVL_NONE);
+    }
+    lvl = LIB_MEM_SIMD_LVL_SSE2;
+
+    if ((leaf_max          >= 7)          &&                    /* See Note #1.                                         */
+        ((regs[2] & (1 << 27)) != 0)      &&                    /* ECX.OSXSAVE.                                         */
+        ((regs[2] & (1 << 28)) != 0)      &&                    /* ECX.AVX.                                             */
+        ((_xgetbv(0) & 0x6u) == 0x6u)) {                        /* XCR0.SSE & XCR0.AVX.                                 */
+        __cpuidex(regs, 7, 0);
+        if ((regs[1] & (1 << 5)) != 0) {                        /* EBX.AVX2.                                            */
+            lvl = LIB_MEM_SIMD_LVL_AVX2;
+        }
+    }
+
+    return (lvl);
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {                       /* Also checks XCR0 (see Note #1).                      */
+        return (LIB_MEM_SIMD_LVL_AVX2);
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return (LIB_MEM_SIMD_LVL_SSE2);
+    }
+
+    return (LIB_MEM_SIMD_LVL_NONE);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Set_SSE2()
+*
+* Description : SSE2 version of Mem_SIMD_Set().
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_SSE2
+static  void  Mem_SIMD_Set_SSE2 (CPU_INT08U  *p_mem,
+                                 CPU_INT08U   data_val,
+                                 CPU_SIZE_T   size)
+{
+    __m128i     v;
+    CPU_SIZE_T  head;
+
+
+    head = (CPU_SIZE_T)(0u - (CPU_ADDR)p_mem) & (MEM_SIMD_SSE2_SIZE - 1u);
+    if (head > size) {
+        head = size;
+    }
+    size -= head;
+    while (head > 0u) {                                         /* See 'lib_mem_simd.c  Note #3a'.                      */
+       *p_mem++ = data_val;
+        head--;
+    }
+
+    v = _mm_set1_epi8((char)data_val);
+    while (size >= (4u * MEM_SIMD_SSE2_SIZE)) {                 /* See 'lib_mem_simd.c  Note #3b'.                      */
+        _mm_store_si128((__m128i *)(p_mem +  0u), v);
+        _mm_store_si128((__m128i *)(p_mem + 16u), v);
+        _mm_store_si128((__m128i *)(p_mem + 32u), v);
+        _mm_store_si128((__m128i *)(p_mem + 48u), v);
+        p_mem += 4u * MEM_SIMD_SSE2_SIZE;
+        size  -= 4u * MEM_SIMD_SSE2_SIZE;
+    }
+    while (size >= MEM_SIMD_SSE2_SIZE) {
+        _mm_store_si128((__m128i *)p_mem, v);
+        p_mem += MEM_SIMD_SSE2_SIZE;
+        size  -= MEM_SIMD_SSE2_SIZE;
+    }
+
+    while (size > 0u) {                                         /* See 'lib_mem_simd.c  Note #3c'.                      */
+       *p_mem++ = data_val;
+        size--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Copy_SSE2()
+*
+* Description : SSE2 version of Mem_SIMD_Copy().
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_SSE2
+static  void  Mem_SIMD_Copy_SSE2 (      CPU_INT08U  *p_dest,
+                                  const CPU_INT08U  *p_src,
+                                        CPU_SIZE_T   size)
+{
+    __m128i     v0;
+    __m128i     v1;
+    __m128i     v2;
+    __m128i     v3;
+    CPU_SIZE_T  head;
+
+
+    head = (CPU_SIZE_T)(0u - (CPU_ADDR)p_dest) & (MEM_SIMD_SSE2_SIZE - 1u);
+    if (head > size) {
+        head = size;
+    }
+    size -= head;
+    while (head > 0u) {
+       *p_dest++ = *p_src++;
+        head--;
+    }
+
+    while (size >= (4u * MEM_SIMD_SSE2_SIZE)) {                 /* See 'Mem_SIMD_Copy()  Note #2'.                      */
+        v0 = _mm_loadu_si128((const __m128i *)(p_src +  0u));
+        v1 = _mm_loadu_si128((const __m128i *)(p_src + 16u));
+        v2 = _mm_loadu_si128((const __m128i *)(p_src + 32u));
+        v3 = _mm_loadu_si128((const __m128i *)(p_src + 48u));
+        _mm_store_si128((__m128i *)(p_dest +  0u), v0);
+        _mm_store_si128((__m128i *)(p_dest + 16u), v1);
+        _mm_store_si128((__m128i *)(p_dest + 32u), v2);
+        _mm_store_si128((__m128i *)(p_dest + 48u), v3);
+        p_src  += 4u * MEM_SIMD_SSE2_SIZE;
+        p_dest += 4u * MEM_SIMD_SSE2_SIZE;
+        size   -= 4u * MEM_SIMD_SSE2_SIZE;
+    }
+    while (size >= MEM_SIMD_SSE2_SIZE) {
+        v0 = _mm_loadu_si128((const __m128i *)p_src);
+        _mm_store_si128((__m128i *)p_dest, v0);
+        p_src  += MEM_SIMD_SSE2_SIZE;
+        p_dest += MEM_SIMD_SSE2_SIZE;
+        size   -= MEM_SIMD_SSE2_SIZE;
+    }
+
+    while (size > 0u) {
+       *p_dest++ = *p_src++;
+        size--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Move_SSE2()
+*
+* Description : SSE2 version of Mem_SIMD_Move().
+*
+* Note(s)     : (1) Mirror image of Mem_SIMD_Copy_SSE2() : starts from the end of the buffers, with the
+*                   octets after the last vector-aligned destination address.
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_SSE2
+static  void  Mem_SIMD_Move_SSE2 (      CPU_INT08U  *p_dest,
+                                  const CPU_INT08U  *p_src,
+                                        CPU_SIZE_T   size)
+{
+    __m128i     v0;
+    __m128i     v1;
+    __m128i     v2;
+    __m128i     v3;
+    CPU_SIZE_T  tail;
+
+
+    p_dest += size;                                             /* See Note #1.                                         */
+    p_src  += size;
+    tail    = (CPU_SIZE_T)((CPU_ADDR)p_dest & (MEM_SIMD_SSE2_SIZE - 1u));
+    if (tail > size) {
+        tail = size;
+    }
+    size -= tail;
+    while (tail > 0u) {
+       *--p_dest = *--p_src;
+        tail--;
+    }
+
+    while (size >= (4u * MEM_SIMD_SSE2_SIZE)) {                 /* See 'Mem_SIMD_Move()  Note #2'.                      */
+        p_src  -= 4u * MEM_SIMD_SSE2_SIZE;
+        p_dest -= 4u * MEM_SIMD_SSE2_SIZE;
+        v3 = _mm_loadu_si128((const __m128i *)(p_src + 48u));
+        v2 = _mm_loadu_si128((const __m128i *)(p_src + 32u));
+        v1 = _mm_loadu_si128((const __m128i *)(p_src + 16u));
+        v0 = _mm_loadu_si128((const __m128i *)(p_src +  0u));
+        _mm_store_si128((__m128i *)(p_dest + 48u), v3);
+        _mm_store_si128((__m128i *)(p_dest + 32u), v2);
+        _mm_store_si128((__m128i *)(p_dest + 16u), v1);
+        _mm_store_si128((__m128i *)(p_dest +  0u), v0);
+        size   -= 4u * MEM_SIMD_SSE2_SIZE;
+    }
+    while (size >= MEM_SIMD_SSE2_SIZE) {
+        p_src  -= MEM_SIMD_SSE2_SIZE;
+        p_dest -= MEM_SIMD_SSE2_SIZE;
+        v0 = _mm_loadu_si128((const __m128i *)p_src);
+        _mm_store_si128((__m128i *)p_dest, v0);
+        size   -= MEM_SIMD_SSE2_SIZE;
+    }
+
+    while (size > 0u) {
+       *--p_dest = *--p_src;
+        size--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Cmp_SSE2()
+*
+* Description : SSE2 version of Mem_SIMD_Cmp().
+*
+* Note(s)     : (1) Starts from the end of the buffers, aligned on the first buffer.
+*
+*               (2) Four vectors are compared before testing the result, so a difference is found up to
+*                   63 octets later than with octet compares.
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_SSE2
+static  CPU_BOOLEAN  Mem_SIMD_Cmp_SSE2 (const CPU_INT08U  *p1_mem,
+                                        const CPU_INT08U  *p2_mem,
+                                              CPU_SIZE_T   size)
+{
+    __m128i     eq;
+    CPU_SIZE_T  tail;
+
+
+    p1_mem += size;                                             /* See Note #1.                                         */
+    p2_mem += size;
+    tail    = (CPU_SIZE_T)((CPU_ADDR)p1_mem & (MEM_SIMD_SSE2_SIZE - 1u));
+    if (tail > size) {
+        tail = size;
+    }
+    size -= tail;
+    while (tail > 0u) {
+        if (*--p1_mem != *--p2_mem) {
+            return (DEF_NO);
+        }
+        tail--;
+    }
+
+    while (size >= (4u * MEM_SIMD_SSE2_SIZE)) {                 /* See Note #2.                                         */
+        p1_mem -= 4u * MEM_SIMD_SSE2_SIZE;
+        p2_mem -= 4u * MEM_SIMD_SSE2_SIZE;
+        eq = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(_mm_load_si128 ((const __m128i *)(p1_mem + 48u)),
+                                                        _mm_loadu_si128((const __m128i *)(p2_mem + 48u))),
+                                         _mm_cmpeq_epi8(_mm_load_si128 ((const __m128i *)(p1_mem + 32u)),
+                                                        _mm_loadu_si128((const __m128i *)(p2_mem + 32u)))),
+                           _mm_and_si128(_mm_cmpeq_epi8(_mm_load_si128 ((const __m128i *)(p1_mem + 16u)),
+                                                        _mm_loadu_si128((const __m128i *)(p2_mem + 16u))),
+                                         _mm_cmpeq_epi8(_mm_load_si128 ((const __m128i *)(p1_mem +  0u)),
+                                                        _mm_loadu_si128((const __m128i *)(p2_mem +  0u)))));
+        if (_mm_movemask_epi8(eq) != 0xFFFF) {
+            return (DEF_NO);
+        }
+        size -= 4u * MEM_SIMD_SSE2_SIZE;
+    }
+    while (size >= MEM_SIMD_SSE2_SIZE) {
+        p1_mem -= MEM_SIMD_SSE2_SIZE;
+        p2_mem -= MEM_SIMD_SSE2_SIZE;
+        eq = _mm_cmpeq_epi8(_mm_load_si128 ((const __m128i *)p1_mem),
+                            _mm_loadu_si128((const __m128i *)p2_mem));
+        if (_mm_movemask_epi8(eq) != 0xFFFF) {
+            return (DEF_NO);
+        }
+        size -= MEM_SIMD_SSE2_SIZE;
+    }
+
+    while (size > 0u) {
+        if (*--p1_mem != *--p2_mem) {
+            return (DEF_NO);
+        }
+        size--;
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_SIMD_ZeroLen_SSE2()
+*
+* Description : SSE2 version of Mem_SIMD_ZeroLen().
+*
+* Note(s)     : (1) Four vectors are OR'ed & tested at once; the vector holding the first non-zero octet is
+*                   then searched one vector at a time.
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_SSE2
+static  CPU_SIZE_T  Mem_SIMD_ZeroLen_SSE2 (const CPU_INT08U  *p_mem,
+                                                 CPU_SIZE_T   size)
+{
+    const  CPU_INT08U  *p_start;
+           __m128i      zero;
+           __m128i      v;
+           CPU_INT32U   mask;
+           CPU_SIZE_T   head;
+
+
+    p_start = p_mem;
+    head    = (CPU_SIZE_T)(0u - (CPU_ADDR)p_mem) & (MEM_SIMD_SSE2_SIZE - 1u);
+    if (head > size) {
+        head = size;
+    }
+    size -= head;
+    while (head > 0u) {                                         /* See 'lib_mem_simd.c  Note #3a'.                      */
+        if (*p_mem != 0u) {
+            return ((CPU_SIZE_T)(p_mem - p_start));
+        }
+        p_mem++;
+        head--;
+    }
+
+    zero = _mm_setzero_si128();
+    while (size >= (4u * MEM_SIMD_SSE2_SIZE)) {                 /* See Note #1.                                         */
+        v = _mm_or_si128(_mm_or_si128(_mm_load_si128((const __m128i *)(p_mem +  0u)),
+                                      _mm_load_si128((const __m128i *)(p_mem + 16u))),
+                         _mm_or_si128(_mm_load_si128((const __m128i *)(p_mem + 32u)),
+                                      _mm_load_si128((const __m128i *)(p_mem + 48u))));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) != 0xFFFF) {
+            break;
+        }
+        p_mem += 4u * MEM_SIMD_SSE2_SIZE;
+        size  -= 4u * MEM_SIMD_SSE2_SIZE;
+    }
+    while (size >= MEM_SIMD_SSE2_SIZE) {
+        mask = (CPU_INT32U)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p_mem), zero)) ^ 0xFFFFu;
+        if (mask != 0u) {                                       /* Lowest set bit is the first non-zero octet.          */
+            return ((CPU_SIZE_T)(p_mem - p_start) + (CPU_SIZE_T)CPU_CntTrailZeros32(mask));
+        }
+        p_mem += MEM_SIMD_SSE2_SIZE;
+        size  -= MEM_SIMD_SSE2_SIZE;
+    }
+
+    while ((size   > 0u) &&                                     /* See 'lib_mem_simd.c  Note #3c'.                      */
+           (*p_mem == 0u)) {
+        p_mem++;
+        size--;
+    }
+
+    return ((CPU_SIZE_T)(p_mem - p_start));
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Set_AVX2()
+*
+* Description : AVX2 version of Mem_SIMD_Set().
+*
+* Note(s)     : (1) The upper halves of the YMM registers are cleared before returning, to avoid the
+*                   SSE/AVX transition penalty in the caller.
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_AVX2
+static  void  Mem_SIMD_Set_AVX2 (CPU_INT08U  *p_mem,
+                                 CPU_INT08U   data_val,
+                                 CPU_SIZE_T   size)
+{
+    __m256i     v;
+    CPU_SIZE_T  head;
+
+
+    head = (CPU_SIZE_T)(0u - (CPU_ADDR)p_mem) & (MEM_SIMD_AVX2_SIZE - 1u);
+    if (head > size) {
+        head = size;
+    }
+    size -= head;
+    while (head > 0u) {
+       *p_mem++ = data_val;
+        head--;
+    }
+
+    v = _mm256_set1_epi8((char)data_val);
+    while (size >= (4u * MEM_SIMD_AVX2_SIZE)) {
+        _mm256_store_si256((__m256i *)(p_mem +  0u), v);
+        _mm256_store_si256((__m256i *)(p_mem + 32u), v);
+        _mm256_store_si256((__m256i *)(p_mem + 64u), v);
+        _mm256_store_si256((__m256i *)(p_mem + 96u), v);
+        p_mem += 4u * MEM_SIMD_AVX2_SIZE;
+        size  -= 4u * MEM_SIMD_AVX2_SIZE;
+    }
+    while (size >= MEM_SIMD_AVX2_SIZE) {
+        _mm256_store_si256((__m256i *)p_mem, v);
+        p_mem += MEM_SIMD_AVX2_SIZE;
+        size  -= MEM_SIMD_AVX2_SIZE;
+    }
+    _mm256_zeroupper();                                         /* See Note #1.                                         */
+
+    while (size > 0u) {
+       *p_mem++ = data_val;
+        size--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Copy_AVX2()
+*
+* Description : AVX2 version of Mem_SIMD_Copy().
+*
+* Note(s)     : (1) See 'Mem_SIMD_Set_AVX2()  Note #1'.
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_AVX2
+static  void  Mem_SIMD_Copy_AVX2 (      CPU_INT08U  *p_dest,
+                                  const CPU_INT08U  *p_src,
+                                        CPU_SIZE_T   size)
+{
+    __m256i     v0;
+    __m256i     v1;
+    __m256i     v2;
+    __m256i     v3;
+    CPU_SIZE_T  head;
+
+
+    head = (CPU_SIZE_T)(0u - (CPU_ADDR)p_dest) & (MEM_SIMD_AVX2_SIZE - 1u);
+    if (head > size) {
+        head = size;
+    }
+    size -= head;
+    while (head > 0u) {
+       *p_dest++ = *p_src++;
+        head--;
+    }
+
+    while (size >= (4u * MEM_SIMD_AVX2_SIZE)) {                 /* See 'Mem_SIMD_Copy()  Note #2'.                      */
+        v0 = _mm256_loadu_si256((const __m256i *)(p_src +  0u));
+        v1 = _mm256_loadu_si256((const __m256i *)(p_src + 32u));
+        v2 = _mm256_loadu_si256((const __m256i *)(p_src + 64u));
+        v3 = _mm256_loadu_si256((const __m256i *)(p_src + 96u));
+        _mm256_store_si256((__m256i *)(p_dest +  0u), v0);
+        _mm256_store_si256((__m256i *)(p_dest + 32u), v1);
+        _mm256_store_si256((__m256i *)(p_dest + 64u), v2);
+        _mm256_store_si256((__m256i *)(p_dest + 96u), v3);
+        p_src  += 4u * MEM_SIMD_AVX2_SIZE;
+        p_dest += 4u * MEM_SIMD_AVX2_SIZE;
+        size   -= 4u * MEM_SIMD_AVX2_SIZE;
+    }
+    while (size >= MEM_SIMD_AVX2_SIZE) {
+        v0 = _mm256_loadu_si256((const __m256i *)p_src);
+        _mm256_store_si256((__m256i *)p_dest, v0);
+        p_src  += MEM_SIMD_AVX2_SIZE;
+        p_dest += MEM_SIMD_AVX2_SIZE;
+        size   -= MEM_SIMD_AVX2_SIZE;
+    }
+    _mm256_zeroupper();                                         /* See Note #1.                                         */
+
+    while (size > 0u) {
+       *p_dest++ = *p_src++;
+        size--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Move_AVX2()
+*
+* Description : AVX2 version of Mem_SIMD_Move().
+*
+* Note(s)     : (1) See 'Mem_SIMD_Move_SSE2()  Note #1'.
+*
+*               (2) See 'Mem_SIMD_Set_AVX2()  Note #1'.
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_AVX2
+static  void  Mem_SIMD_Move_AVX2 (      CPU_INT08U  *p_dest,
+                                  const CPU_INT08U  *p_src,
+                                        CPU_SIZE_T   size)
+{
+    __m256i     v0;
+    __m256i     v1;
+    __m256i     v2;
+    __m256i     v3;
+    CPU_SIZE_T  tail;
+
+
+    p_dest += size;                                             /* See Note #1.                                         */
+    p_src  += size;
+    tail    = (CPU_SIZE_T)((CPU_ADDR)p_dest & (MEM_SIMD_AVX2_SIZE - 1u));
+    if (tail > size) {
+        tail = size;
+    }
+    size -= tail;
+    while (tail > 0u) {
+       *--p_dest = *--p_src;
+        tail--;
+    }
+
+    while (size >= (4u * MEM_SIMD_AVX2_SIZE)) {                 /* See 'Mem_SIMD_Move()  Note #2'.                      */
+        p_src  -= 4u * MEM_SIMD_AVX2_SIZE;
+        p_dest -= 4u * MEM_SIMD_AVX2_SIZE;
+        v3 = _mm256_loadu_si256((const __m256i *)(p_src + 96u));
+        v2 = _mm256_loadu_si256((const __m256i *)(p_src + 64u));
+        v1 = _mm256_loadu_si256((const __m256i *)(p_src + 32u));
+        v0 = _mm256_loadu_si256((const __m256i *)(p_src +  0u));
+        _mm256_store_si256((__m256i *)(p_dest + 96u), v3);
+        _mm256_store_si256((__m256i *)(p_dest + 64u), v2);
+        _mm256_store_si256((__m256i *)(p_dest + 32u), v1);
+        _mm256_store_si256((__m256i *)(p_dest +  0u), v0);
+        size   -= 4u * MEM_SIMD_AVX2_SIZE;
+    }
+    while (size >= MEM_SIMD_AVX2_SIZE) {
+        p_src  -= MEM_SIMD_AVX2_SIZE;
+        p_dest -= MEM_SIMD_AVX2_SIZE;
+        v0 = _mm256_loadu_si256((const __m256i *)p_src);
+        _mm256_store_si256((__m256i *)p_dest, v0);
+        size   -= MEM_SIMD_AVX2_SIZE;
+    }
+    _mm256_zeroupper();                                         /* See Note #2.                                         */
+
+    while (size > 0u) {
+       *--p_dest = *--p_src;
+        size--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_SIMD_Cmp_AVX2()
+*
+* Description : AVX2 version of Mem_SIMD_Cmp().
+*
+* Note(s)     : (1) See 'Mem_SIMD_Cmp_SSE2()  Note #1'.
+*
+*               (2) Four vectors are compared before testing the result, so a difference is found up to
+*                   127 octets later than with octet compares.
+*
+*               (3) See 'Mem_SIMD_Set_AVX2()  Note #1'.
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_AVX2
+static  CPU_BOOLEAN  Mem_SIMD_Cmp_AVX2 (const CPU_INT08U  *p1_mem,
+                                        const CPU_INT08U  *p2_mem,
+                                              CPU_SIZE_T   size)
+{
+    __m256i      eq;
+    CPU_BOOLEAN  mem_cmp;
+    CPU_SIZE_T   tail;
+
+
+    p1_mem += size;                                             /* See Note #1.                                         */
+    p2_mem += size;
+    tail    = (CPU_SIZE_T)((CPU_ADDR)p1_mem & (MEM_SIMD_AVX2_SIZE - 1u));
+    if (tail > size) {
+        tail = size;
+    }
+    size -= tail;
+    while (tail > 0u) {
+        if (*--p1_mem != *--p2_mem) {
+            return (DEF_NO);
+        }
+        tail--;
+    }
+
+    mem_cmp = DEF_YES;
+    while ((mem_cmp == DEF_YES) &&                              /* See Note #2.                                         */
+           (size    >= (4u * MEM_SIMD_AVX2_SIZE))) {
+        p1_mem -= 4u * MEM_SIMD_AVX2_SIZE;
+        p2_mem -= 4u * MEM_SIMD_AVX2_SIZE;
+        eq = _mm256_and_si256(_mm256_and_si256(_mm256_cmpeq_epi8(_mm256_load_si256 ((const __m256i *)(p1_mem + 96u)),
+                                                                 _mm256_loadu_si256((const __m256i *)(p2_mem + 96u))),
+                                               _mm256_cmpeq_epi8(_mm256_load_si256 ((const __m256i *)(p1_mem + 64u)),
+                                                                 _mm256_loadu_si256((const __m256i *)(p2_mem + 64u)))),
+                              _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_load_si256 ((const __m256i *)(p1_mem + 32u)),
+                                                                 _mm256_loadu_si256((const __m256i *)(p2_mem + 32u))),
+                                               _mm256_cmpeq_epi8(_mm256_load_si256 ((const __m256i *)(p1_mem +  0u)),
+                                                                 _mm256_loadu_si256((const __m256i *)(p2_mem +  0u)))));
+        if ((CPU_INT32U)_mm256_movemask_epi8(eq) != 0xFFFFFFFFu) {
+            mem_cmp = DEF_NO;
+        }
+        size -= 4u * MEM_SIMD_AVX2_SIZE;
+    }
+    while ((mem_cmp == DEF_YES) &&
+           (size    >= MEM_SIMD_AVX2_SIZE)) {
+        p1_mem -= MEM_SIMD_AVX2_SIZE;
+        p2_mem -= MEM_SIMD_AVX2_SIZE;
+        eq = _mm256_cmpeq_epi8(_mm256_load_si256 ((const __m256i *)p1_mem),
+                               _mm256_loadu_si256((const __m256i *)p2_mem));
+        if ((CPU_INT32U)_mm256_movemask_epi8(eq) != 0xFFFFFFFFu) {
+            mem_cmp = DEF_NO;
+        }
+        size -= MEM_SIMD_AVX2_SIZE;
+    }
+    _mm256_zeroupper();                                         /* See Note #3.                                         */
+
+    while ((mem_cmp == DEF_YES) &&
+           (size    >  0u)) {
+        if (*--p1_mem != *--p2_mem) {
+            mem_cmp = DEF_NO;
+        }
+        size--;
+    }
+
+    return (mem_cmp);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_SIMD_ZeroLen_AVX2()
+*
+* Description : AVX2 version of Mem_SIMD_ZeroLen().
+*
+* Note(s)     : (1) See 'Mem_SIMD_ZeroLen_SSE2()  Note #1'.
+*
+*               (2) See 'Mem_SIMD_Set_AVX2()  Note #1'.
+*********************************************************************************************************
+*/
+
+MEM_SIMD_TARGET_AVX2
+static  CPU_SIZE_T  Mem_SIMD_ZeroLen_AVX2 (const CPU_INT08U  *p_mem,
+                                                 CPU_SIZE_T   size)
+{
+    const  CPU_INT08U  *p_start;
+           __m256i      zero;
+           __m256i      v;
+           CPU_INT32U   mask;
+           CPU_SIZE_T   head;
+
+
+    p_start = p_mem;
+    head    = (CPU_SIZE_T)(0u - (CPU_ADDR)p_mem) & (MEM_SIMD_AVX2_SIZE - 1u);
+    if (head > size) {
+        head = size;
+    }
+    size -= head;
+    while (head > 0u) {
+        if (*p_mem != 0u) {
+            return ((CPU_SIZE_T)(p_mem - p_start));
+        }
+        p_mem++;
+        head--;
+    }
+
+    mask = 0u;
+    zero = _mm256_setzero_si256();
+    while (size >= (4u * MEM_SIMD_AVX2_SIZE)) {                 /* See Note #1.                                         */
+        v = _mm256_or_si256(_mm256_or_si256(_mm256_load_si256((const __m256i *)(p_mem +  0u)),
+                                            _mm256_load_si256((const __m256i *)(p_mem + 32u))),
+                            _mm256_or_si256(_mm256_load_si256((const __m256i *)(p_mem + 64u)),
+                                            _mm256_load_si256((const __m256i *)(p_mem + 96u))));
+        if ((CPU_INT32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero)) != 0xFFFFFFFFu) {
+            break;
+        }
+        p_mem += 4u * MEM_SIMD_AVX2_SIZE;
+        size  -= 4u * MEM_SIMD_AVX2_SIZE;
+    }
+    while (size >= MEM_SIMD_AVX2_SIZE) {
+        mask = ~(CPU_INT32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p_mem), zero));
+        if (mask != 0u) {
+            break;
+        }
+        p_mem += MEM_SIMD_AVX2_SIZE;
+        size  -= MEM_SIMD_AVX2_SIZE;
+    }
+    _mm256_zeroupper();                                         /* See Note #2.                                         */
+
+    if (mask != 0u) {                                           /* Lowest set bit is the first non-zero octet.          */
+        return ((CPU_SIZE_T)(p_mem - p_start) + (CPU_SIZE_T)CPU_CntTrailZeros32(mask));
+    }
+
+    while ((size   > 0u) &&
+           (*p_mem == 0u)) {
+        p_mem++;
+        size--;
+    }
+
+    return ((CPU_SIZE_T)(p_mem - p_start));
+}
+
+#endif                                                          /* End of LIB_MEM_CFG_SIMD_EN.                          */
@@ -155,6 +155,12 @@ static  void          Mem_DynPoolCreateInternal(const  CPU_CHAR      *p_name,
                                                        CPU_SIZE_T     blk_qty_max,
                                                        LIB_ERR       *p_err);
 
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  void          Mem_DynPoolMagDrain      (       MEM_DYN_POOL_MAG  *p_mag,
+                                                       CPU_SIZE_T         blk_qty,
+                                                       LIB_ERR           *p_err);
+#endif
+
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
 static  void          Mem_SegAllocTrackCritical(const  CPU_CHAR      *p_name,
                                                        MEM_SEG       *p_seg,
@@ -299,6 +305,9 @@ void  Mem_Clr (void        *pmem,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (4) Buffers of LIB_MEM_CFG_SIMD_SIZE_MIN octets or more are filled by Mem_SIMD_Set(), if a
+*                   SIMD level is available (see 'lib_mem.h  MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION').
 *********************************************************************************************************
 */
 
@@ -323,6 +332,14 @@ void  Mem_Set (void        *pmem,
     }
 #endif
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size              >= LIB_MEM_CFG_SIMD_SIZE_MIN) &&     /* See Note #4.                                         */
+        (Mem_SIMD_LvlGet() != LIB_MEM_SIMD_LVL_NONE)) {
+        Mem_SIMD_Set(pmem, data_val, size);
+        return;
+    }
+#endif
+
 
     data_align = 0u;
     for (i = 0u; i < sizeof(CPU_ALIGN); i++) {                  /* Fill each data_align octet with data val.            */
@@ -406,6 +423,11 @@ void  Mem_Set (void        *pmem,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) Buffers of LIB_MEM_CFG_SIMD_SIZE_MIN octets or more are copied by Mem_SIMD_Copy(), if a
+*                   SIMD level is available, unless the destination buffer overlaps a source buffer at a
+*                   lower address value.  Such copies are left to the octet loop so that their result is
+*                   the same with or without SIMD (see Note #2).
 *********************************************************************************************************
 */
 
@@ -444,6 +466,16 @@ void  Mem_Copy (       void        *pdest,
     pmem_08_dest       = (      CPU_INT08U *)pdest;
     pmem_08_src        = (const CPU_INT08U *)psrc;
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size              >= LIB_MEM_CFG_SIMD_SIZE_MIN) &&     /* See Note #5.                                         */
+        ((pmem_08_src      >= pmem_08_dest) ||
+         (pmem_08_dest     >= pmem_08_src + size))        &&
+        (Mem_SIMD_LvlGet() != LIB_MEM_SIMD_LVL_NONE)) {
+        Mem_SIMD_Copy(pdest, psrc, size);
+        return;
+    }
+#endif
+
     mem_gap_octets     = (CPU_SIZE_T)(pmem_08_src - pmem_08_dest);
 
 
@@ -518,6 +550,9 @@ void  Mem_Copy (       void        *pdest,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) Buffers of LIB_MEM_CFG_SIMD_SIZE_MIN octets or more are moved by Mem_SIMD_Move(), if a
+*                   SIMD level is available.
 *********************************************************************************************************
 */
 
@@ -556,6 +591,14 @@ void  Mem_Move (       void        *pdest,
         return;
     }
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size              >= LIB_MEM_CFG_SIMD_SIZE_MIN) &&     /* See Note #5.                                         */
+        (Mem_SIMD_LvlGet() != LIB_MEM_SIMD_LVL_NONE)) {
+        Mem_SIMD_Move(pdest, psrc, size);
+        return;
+    }
+#endif
+
     size_rem           =  size;
 
     pmem_08_dest       = (      CPU_INT08U *)pdest + size - 1;
@@ -642,6 +685,9 @@ void  Mem_Move (       void        *pdest,
 *                   Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values.  Thus
 *                   address values MUST be cast to an appropriately-sized integer value PRIOR to any
 *                  'mem_align_mod' arithmetic operation.
+*
+*               (5) Buffers of LIB_MEM_CFG_SIMD_SIZE_MIN octets or more are compared by Mem_SIMD_Cmp(), if a
+*                   SIMD level is available.
 *********************************************************************************************************
 */
 
@@ -671,6 +717,13 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
         return (DEF_NO);
     }
 
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size              >= LIB_MEM_CFG_SIMD_SIZE_MIN) &&     /* See Note #5.                                         */
+        (Mem_SIMD_LvlGet() != LIB_MEM_SIMD_LVL_NONE)) {
+        return (Mem_SIMD_Cmp(p1_mem, p2_mem, size));
+    }
+#endif
+
 
     mem_cmp         =  DEF_YES;                                 /* Assume mem bufs are identical until cmp fails.       */
     size_rem        =  size;
@@ -733,6 +786,93 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
 }
 
 
+/*
+*********************************************************************************************************
+*                                            Mem_ZeroLen()
+*
+* Description : Count the data octets equal to zero at the start of a memory buffer.
+*
+* Argument(s) : pmem        Pointer to memory buffer to scan.
+*
+*               size        Number of data buffer octets to scan (see Note #1).
+*
+* Return(s)   : Number of octets equal to zero before the first non-zero octet, or 'size' if ALL octets
+*               are equal to zero.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Null scans allowed (i.e. zero-length scans); 0 returned.
+*
+*               (2) Typically used to find the high-water mark of a buffer that was cleared before use, e.g.
+*                   a task stack growing towards lower addresses.  The buffer is scanned from its start
+*                   until the first non-zero octet; the rest of the buffer is NOT accessed.
+*
+*               (3) See 'Mem_Cmp()  Notes #3 & #4'.
+*
+*               (4) Buffers of LIB_MEM_CFG_SIMD_SIZE_MIN octets or more are scanned by Mem_SIMD_ZeroLen(), if
+*                   a SIMD level is available.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Mem_ZeroLen (const  void        *pmem,
+                                CPU_SIZE_T   size)
+{
+           CPU_SIZE_T    size_rem;
+    const  CPU_ALIGN    *pmem_align;
+    const  CPU_INT08U   *pmem_08;
+           CPU_DATA      mem_align_mod;
+
+
+    if (size < 1) {                                             /* See Note #1.                                         */
+        return (0u);
+    }
+    if (pmem == (void *)0) {
+        return (0u);
+    }
+
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    if ((size              >= LIB_MEM_CFG_SIMD_SIZE_MIN) &&     /* See Note #4.                                         */
+        (Mem_SIMD_LvlGet() != LIB_MEM_SIMD_LVL_NONE)) {
+        return (Mem_SIMD_ZeroLen(pmem, size));
+    }
+#endif
+
+
+    size_rem      =  size;
+    pmem_08       = (const CPU_INT08U *)pmem;
+                                                                /* See Note #3.                                         */
+    mem_align_mod = (CPU_INT08U)((CPU_ADDR)pmem_08 % sizeof(CPU_ALIGN));
+
+    if (mem_align_mod != 0u) {                                  /* If leading octets avail,                   ...       */
+        while ((size_rem      > 0) &&                           /* ... scan leading octets                    ...       */
+               (mem_align_mod < sizeof(CPU_ALIGN))) {           /* ... until next CPU_ALIGN word boundary.              */
+            if (*pmem_08 != 0u) {
+                return (size - size_rem);
+            }
+            pmem_08++;
+            size_rem -= sizeof(CPU_INT08U);
+            mem_align_mod++;
+        }
+    }
+
+    pmem_align = (const CPU_ALIGN *)pmem_08;
+    while ((size_rem    >= sizeof(CPU_ALIGN)) &&                /* Scan aligned words while zero.                       */
+           (*pmem_align == 0u)) {
+        pmem_align++;
+        size_rem -= sizeof(CPU_ALIGN);
+    }
+
+    pmem_08 = (const CPU_INT08U *)pmem_align;
+    while ((size_rem > 0) &&                                    /* Find first non-zero octet in word or trailing octets.*/
+           (*pmem_08 == 0u)) {
+        pmem_08++;
+        size_rem -= sizeof(CPU_INT08U);
+    }
+
+    return (size - size_rem);
+}
+
+
 /*
 *********************************************************************************************************
 *                                           Mem_HeapAlloc()
@@ -2134,14 +2274,19 @@ void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : None.
+* Note(s)     : (1) Blocks cached by the magazines of the pool are counted as available, although only the
+*                   thread owning a magazine can get them (see 'lib_mem.h  DYNAMIC MEMORY POOL MAGAZINE
+*                   DATA TYPE  Note #3').
 *********************************************************************************************************
 */
 
 CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
                                        LIB_ERR       *p_err)
 {
-    CPU_SIZE_T  blk_nbr_avail;
+    CPU_SIZE_T         blk_nbr_avail;
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+    MEM_DYN_POOL_MAG  *p_mag;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -2159,6 +2304,13 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
     if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
         CPU_CRITICAL_ENTER();
         blk_nbr_avail = p_pool->BlkQtyMax - p_pool->BlkAllocCnt;
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+        p_mag = p_pool->MagListPtr;                             /* Add blks cached by magazines (see Note #1).          */
+        while (p_mag != DEF_NULL) {
+            blk_nbr_avail += p_mag->BlkCnt;
+            p_mag          = p_mag->NextPtr;
+        }
+#endif
         CPU_CRITICAL_EXIT();
 
        *p_err = LIB_MEM_ERR_NONE;
@@ -2171,6 +2323,308 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolMagCreate()
+*
+* Description : Creates a magazine, i.e. a cache of free blocks of a dynamic memory pool for one thread.
+*
+* Argument(s) : p_pool          Pointer to pool data.
+*
+*               p_mag           Pointer to magazine data.
+*
+*               blk_cnt_max     Maximum number of blocks cached by the magazine.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            'p_pool' or 'p_mag' pointer passed is NULL.
+*                                   LIB_MEM_ERR_INVALID_BLK_NBR     Invalid number of blocks specified.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The magazine starts empty; it is refilled by the first call to Mem_DynPoolMagBlkGet().
+*
+*               (2) The magazine must only be used by the thread that owns it & must be deleted with
+*                   Mem_DynPoolMagDel() before its memory is reused.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+void  Mem_DynPoolMagCreate (MEM_DYN_POOL      *p_pool,
+                            MEM_DYN_POOL_MAG  *p_mag,
+                            CPU_SIZE_T         blk_cnt_max,
+                            LIB_ERR           *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_pool == DEF_NULL) ||                                 /* Chk for NULL pool or magazine data ptr.              */
+        (p_mag  == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (blk_cnt_max < 1u) {                                     /* Chk for inv blk nbr.                                 */
+       *p_err = LIB_MEM_ERR_INVALID_BLK_NBR;
+        return;
+    }
+#endif
+
+    p_mag->PoolPtr    = p_pool;
+    p_mag->BlkFreePtr = DEF_NULL;
+    p_mag->BlkCnt     = 0u;
+    p_mag->BlkCntMax  = blk_cnt_max;
+
+    CPU_CRITICAL_ENTER();                                       /* Link magazine to pool.                               */
+    p_mag->NextPtr     = p_pool->MagListPtr;
+    p_pool->MagListPtr = p_mag;
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_DynPoolMagDel()
+*
+* Description : Gives every block cached by a magazine back to its pool & unlinks the magazine from the pool.
+*
+* Argument(s) : p_mag   Pointer to magazine data.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR    'p_mag' pointer passed is NULL.
+*
+*                           -----------------------RETURNED BY Mem_DynPoolMagDrain()-----------------------
+*                           LIB_MEM_ERR_POOL_FULL   Pool is full.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+void  Mem_DynPoolMagDel (MEM_DYN_POOL_MAG  *p_mag,
+                         LIB_ERR           *p_err)
+{
+    MEM_DYN_POOL_MAG  **pp_mag;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_mag == DEF_NULL) {                                    /* Chk for NULL magazine data ptr.                      */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (p_mag->BlkCnt != 0u) {                                  /* Give every cached blk back to pool.                  */
+        Mem_DynPoolMagDrain(p_mag, p_mag->BlkCnt, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* Unlink magazine from pool.                           */
+    pp_mag = &p_mag->PoolPtr->MagListPtr;
+    while ((*pp_mag != DEF_NULL) &&
+           (*pp_mag != p_mag)) {
+        pp_mag = &(*pp_mag)->NextPtr;
+    }
+    if (*pp_mag == p_mag) {
+       *pp_mag = p_mag->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+
+    p_mag->NextPtr = DEF_NULL;
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolMagBlkGet()
+*
+* Description : Gets a memory block from a magazine, refilling it from its pool if it is empty.
+*
+* Argument(s) : p_mag   Pointer to magazine data.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                    Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                'p_mag' pointer passed is NULL.
+*
+*                           ----------------------RETURNED BY Mem_DynPoolBlkGet()-------------------------
+*                           LIB_MEM_ERR_POOL_EMPTY              Pools is empty.
+*                           LIB_MEM_ERR_INVALID_MEM_ALIGN       Invalid memory block alignment requested.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE        Invalid memory block size specified.
+*                           LIB_MEM_ERR_SEG_OVF                 Allocation would overflow memory segment.
+*
+* Return(s)   : Pointer to memory block, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) An empty magazine takes up to half its capacity from the free list of the pool in a
+*                   single critical section (see 'lib_mem.h  DYNAMIC MEMORY POOL MAGAZINE DATA TYPE  Note #2').
+*                   If the free list is empty, a single block is taken with Mem_DynPoolBlkGet(), which grows
+*                   the pool.
+*
+*               (2) The count of the magazine is set in the same critical section as the pool, so that
+*                   Mem_DynPoolBlkNbrAvailGet() never misses the blocks taken.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+void  *Mem_DynPoolMagBlkGet (MEM_DYN_POOL_MAG  *p_mag,
+                             LIB_ERR           *p_err)
+{
+    MEM_DYN_POOL  *p_pool;
+    void          *p_blk;
+    void          *p_blk_last;
+    CPU_SIZE_T     blk_qty;
+    CPU_SIZE_T     blk_cnt;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_mag == DEF_NULL) {                                    /* Chk for NULL magazine data ptr.                      */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+#endif
+
+    if (p_mag->BlkCnt == 0u) {                                  /* ----------------- REFILL MAGAZINE ------------------ */
+        p_pool  = p_mag->PoolPtr;
+        blk_qty = DEF_MAX(p_mag->BlkCntMax / 2u, 1u);           /* See Note #1.                                         */
+        blk_cnt = 0u;
+
+        CPU_CRITICAL_ENTER();
+        if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
+            blk_qty = DEF_MIN(blk_qty, p_pool->BlkQtyMax - p_pool->BlkAllocCnt);
+        }
+        p_blk      = p_pool->BlkFreePtr;
+        p_blk_last = DEF_NULL;
+        while ((blk_cnt < blk_qty) &&
+               (p_blk   != DEF_NULL)) {
+            p_blk_last = p_blk;
+            p_blk      = *((void **)p_blk);
+            blk_cnt++;
+        }
+        if (blk_cnt != 0u) {                                    /* Unlink the blks from the pool free list.             */
+            p_mag->BlkFreePtr  = p_pool->BlkFreePtr;
+            p_mag->BlkCnt      = blk_cnt;                       /* See Note #2.                                         */
+            p_pool->BlkFreePtr = p_blk;
+            if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
+                p_pool->BlkAllocCnt += blk_cnt;
+            }
+        }
+        CPU_CRITICAL_EXIT();
+
+        if (blk_cnt == 0u) {                                    /* Free list empty, grow pool by one blk.               */
+            return (Mem_DynPoolBlkGet(p_pool, p_err));
+        }
+
+       *((void **)p_blk_last) = DEF_NULL;
+    }
+
+                                                                /* ---------------- GET BLK FROM MAGAZINE ------------- */
+    p_blk             = p_mag->BlkFreePtr;
+    p_mag->BlkFreePtr = *((void **)p_blk);
+    p_mag->BlkCnt--;
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_blk);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolMagBlkFree()
+*
+* Description : Frees a memory block to a magazine, giving half of the magazine back to its pool if it is full.
+*
+* Argument(s) : p_mag   Pointer to magazine data.
+*
+*               p_blk   Pointer to first byte of memory block.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR    'p_mag' or 'p_blk' pointer passed is NULL.
+*
+*                           -----------------------RETURNED BY Mem_DynPoolMagDrain()-----------------------
+*                           LIB_MEM_ERR_POOL_FULL   Pool is full.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The block must come from the pool of the magazine, through any magazine of the pool or
+*                   Mem_DynPoolBlkGet().
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+void  Mem_DynPoolMagBlkFree (MEM_DYN_POOL_MAG  *p_mag,
+                             void              *p_blk,
+                             LIB_ERR           *p_err)
+{
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_mag == DEF_NULL) ||                                  /* Chk for NULL magazine data or blk ptr.               */
+        (p_blk == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (p_mag->BlkCnt >= p_mag->BlkCntMax) {                    /* Magazine full, give half back to pool.               */
+        Mem_DynPoolMagDrain(p_mag, DEF_MAX(p_mag->BlkCntMax / 2u, 1u), p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+    }
+
+   *((void **)p_blk)  = p_mag->BlkFreePtr;
+    p_mag->BlkFreePtr = p_blk;
+    p_mag->BlkCnt++;
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           Mem_OutputUsage()
@@ -2798,6 +3252,9 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
     p_pool->BlkPaddingAlign =   blk_padding_align;
     p_pool->BlkQtyMax       =   blk_qty_max;
     p_pool->BlkAllocCnt     =   0u;
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+    p_pool->MagListPtr      =   DEF_NULL;
+#endif
 
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     p_pool->NamePtr = p_name;
@@ -2807,6 +3264,75 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolMagDrain()
+*
+* Description : Gives blocks cached by a magazine back to its pool.
+*
+* Argument(s) : p_mag       Pointer to magazine data.
+*               -----       Argument validated by caller.
+*
+*               blk_qty     Number of blocks to give back, between 1 & the number of cached blocks.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE        Operation was successful.
+*                               LIB_MEM_ERR_POOL_FULL   Pool is full.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_DynPoolMagDel(),
+*               Mem_DynPoolMagBlkFree().
+*
+* Note(s)     : (1) The blocks are found outside of the critical section; the whole chain is then linked at
+*                   the head of the pool free list at once.
+*
+*               (2) The count of the magazine is updated in the same critical section as the pool, so that
+*                   Mem_DynPoolBlkNbrAvailGet() never counts the blocks given back twice.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  void  Mem_DynPoolMagDrain (MEM_DYN_POOL_MAG  *p_mag,
+                                   CPU_SIZE_T         blk_qty,
+                                   LIB_ERR           *p_err)
+{
+    MEM_DYN_POOL  *p_pool;
+    void          *p_blk_first;
+    void          *p_blk_last;
+    CPU_SIZE_T     i;
+    CPU_SR_ALLOC();
+
+
+    p_pool      = p_mag->PoolPtr;
+    p_blk_first = p_mag->BlkFreePtr;
+    p_blk_last  = p_blk_first;
+    for (i = 1u; i < blk_qty; i++) {                            /* See Note #1.                                         */
+        p_blk_last = *((void **)p_blk_last);
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {
+        if (p_pool->BlkAllocCnt < blk_qty) {
+            CPU_CRITICAL_EXIT();
+
+           *p_err = LIB_MEM_ERR_POOL_FULL;
+            return;
+        }
+        p_pool->BlkAllocCnt -= blk_qty;
+    }
+    p_mag->BlkFreePtr      = *((void **)p_blk_last);
+   *((void **)p_blk_last)  = p_pool->BlkFreePtr;
+    p_pool->BlkFreePtr     = p_blk_first;
+    p_mag->BlkCnt         -= blk_qty;                           /* See Note #2.                                         */
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      Mem_PoolBlkIsValidAddr()
@@ -137,6 +137,11 @@
 
 #define  LIB_MEM_BLK_QTY_UNLIMITED                        0u
 
+                                                                /* ------------------- SIMD LEVELS -------------------- */
+#define  LIB_MEM_SIMD_LVL_NONE                            0u    /* 'CPU_ALIGN'-sized word loops of 'lib_mem.c'.         */
+#define  LIB_MEM_SIMD_LVL_SSE2                            1u    /* 128-bit vectors.                                     */
+#define  LIB_MEM_SIMD_LVL_AVX2                            2u    /* 256-bit vectors.                                     */
+
 
 /*
 *********************************************************************************************************
@@ -184,6 +189,49 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                           MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SIMD_EN to enable/disable the SIMD versions of Mem_Set(), Mem_Copy(),
+*               Mem_Move(), Mem_Cmp() & Mem_ZeroLen() implemented in
+*               '\<Custom Library Directory>\Ports\<cpu>\lib_mem_simd.c'.
+*
+*           (2) Configure LIB_MEM_CFG_SIMD_SIZE_MIN with the smallest buffer size (in octets) handed to the
+*               SIMD versions; smaller buffers are handled by the 'CPU_ALIGN'-sized word loops.
+*********************************************************************************************************
+*/
+
+                                                                /* Cfg SIMD-optimized function(s) [see Note #1] :       */
+#ifndef  LIB_MEM_CFG_SIMD_EN
+#define  LIB_MEM_CFG_SIMD_EN            DEF_DISABLED
+                                                                /* DEF_DISABLED     SIMD-optimized fnct(s) DISABLED     */
+                                                                /* DEF_ENABLED      SIMD-optimized fnct(s) ENABLED      */
+#endif
+
+#ifndef  LIB_MEM_CFG_SIMD_SIZE_MIN
+#define  LIB_MEM_CFG_SIMD_SIZE_MIN                      64u     /* See Note #2.                                         */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                            DYNAMIC MEMORY POOL MAGAZINE CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_DYN_POOL_MAG_EN to enable/disable the magazines of dynamic memory
+*               pools, i.e. small caches of free blocks owned by one thread (see 'DYNAMIC MEMORY POOL
+*               MAGAZINE DATA TYPE').
+*********************************************************************************************************
+*/
+
+                                                                /* Cfg dyn mem pool magazines [see Note #1] :           */
+#ifndef  LIB_MEM_CFG_DYN_POOL_MAG_EN
+#define  LIB_MEM_CFG_DYN_POOL_MAG_EN    DEF_DISABLED
+                                                                /* DEF_DISABLED     Magazines DISABLED                  */
+                                                                /* DEF_ENABLED      Magazines ENABLED                   */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                          MEMORY ALLOCATION DEBUG INFORMATION CONFIGURATION
@@ -365,12 +413,45 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
            CPU_SIZE_T   BlkQtyMax;                              /* Max qty of blk in dyn mem pool. 0 = unlimited.       */
            CPU_SIZE_T   BlkAllocCnt;                            /* Cnt of alloc blk.                                    */
 
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+    struct mem_dyn_pool_mag  *MagListPtr;                       /* Ptr to first magazine of the pool.                   */
+#endif
+
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     const  CPU_CHAR    *NamePtr;                                /* Ptr to mem pool name.                                */
 #endif
 } MEM_DYN_POOL;
 
 
+/*
+*********************************************************************************************************
+*                                DYNAMIC MEMORY POOL MAGAZINE DATA TYPE
+*
+* Note(s) : (1) A magazine is a cache of free blocks of one dynamic memory pool, owned by a single thread
+*               (or CPU) & accessed without any critical section.  Blocks are linked as in the pool free
+*               list (see 'DYNAMIC MEMORY POOL DATA TYPE  Note #2').
+*
+*           (2) An empty magazine is refilled with up to half its capacity from the pool, & a full magazine
+*               gives half its capacity back to the pool, each in a single critical section; so a thread
+*               alternating get & free around the threshold does not hit the pool on every call.
+*
+*           (3) Blocks held by a magazine are counted as allocated in the pool's 'BlkAllocCnt'.  The pool
+*               keeps a list of its magazines so that Mem_DynPoolBlkNbrAvailGet() adds them back & stays
+*               exact.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+typedef  struct  mem_dyn_pool_mag {                             /* ------------ DYN MEM POOL MAGAZINE DATA ------------ */
+    MEM_DYN_POOL             *PoolPtr;                          /* Ptr to pool the blks come from.                      */
+    void                     *BlkFreePtr;                       /* Ptr to first cached blk.                             */
+    CPU_SIZE_T                BlkCnt;                           /* Nbr of cached blks.                                  */
+    CPU_SIZE_T                BlkCntMax;                        /* Max nbr of cached blks.                              */
+    struct mem_dyn_pool_mag  *NextPtr;                          /* Ptr to next magazine of the pool.                    */
+} MEM_DYN_POOL_MAG;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -1222,6 +1303,36 @@ CPU_BOOLEAN        Mem_Cmp                  (const  void              *p1_mem,
                                              const  void              *p2_mem,
                                                     CPU_SIZE_T         size);
 
+CPU_SIZE_T         Mem_ZeroLen              (const  void              *pmem,
+                                                    CPU_SIZE_T         size);
+
+
+                                                                /* ------------------ MEM SIMD FNCTS ------------------ */
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+CPU_INT08U         Mem_SIMD_LvlGet          (       void);
+
+CPU_INT08U         Mem_SIMD_LvlSet          (       CPU_INT08U         lvl);
+
+void               Mem_SIMD_Set             (       void              *pmem,
+                                                    CPU_INT08U         data_val,
+                                                    CPU_SIZE_T         size);
+
+void               Mem_SIMD_Copy            (       void              *pdest,
+                                             const  void              *psrc,
+                                                    CPU_SIZE_T         size);
+
+void               Mem_SIMD_Move            (       void              *pdest,
+                                             const  void              *psrc,
+                                                    CPU_SIZE_T         size);
+
+CPU_BOOLEAN        Mem_SIMD_Cmp             (const  void              *p1_mem,
+                                             const  void              *p2_mem,
+                                                    CPU_SIZE_T         size);
+
+CPU_SIZE_T         Mem_SIMD_ZeroLen         (const  void              *pmem,
+                                                    CPU_SIZE_T         size);
+#endif
+
 
                                                                 /* ----------- MEM HEAP FNCTS (DEPRECATED) ------------ */
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
@@ -1327,6 +1438,23 @@ void               Mem_DynPoolBlkFree       (       MEM_DYN_POOL      *p_pool,
 CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
                                                     LIB_ERR           *p_err);
 
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+void               Mem_DynPoolMagCreate     (       MEM_DYN_POOL      *p_pool,
+                                                    MEM_DYN_POOL_MAG  *p_mag,
+                                                    CPU_SIZE_T         blk_cnt_max,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_DynPoolMagDel        (       MEM_DYN_POOL_MAG  *p_mag,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_DynPoolMagBlkGet     (       MEM_DYN_POOL_MAG  *p_mag,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_DynPoolMagBlkFree    (       MEM_DYN_POOL_MAG  *p_mag,
+                                                    void              *p_blk,
+                                                    LIB_ERR           *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1361,6 +1489,26 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_SIMD_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_SIMD_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_SIMD_EN          illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+
+#elif   (LIB_MEM_CFG_SIMD_SIZE_MIN < 1u)
+#error  "LIB_MEM_CFG_SIMD_SIZE_MIN    illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  >= 1]                   "
+#endif
+
+
+#if    ((LIB_MEM_CFG_DYN_POOL_MAG_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_DYN_POOL_MAG_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_DYN_POOL_MAG_EN  illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+#endif
+
+
 #ifndef  LIB_MEM_CFG_HEAP_SIZE
 #error  "LIB_MEM_CFG_HEAP_SIZE              not #define'd in 'lib_cfg.h'"
 #error  "                                   [MUST be  >= 0]             "
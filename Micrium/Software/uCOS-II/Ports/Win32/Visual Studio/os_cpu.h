@@ -24,6 +24,7 @@
 #define  OS_CPU_H
 
 #include  <cpu.h>
+#include  <lib_mem.h>
 
 #ifdef    OS_CPU_GLOBALS
 #define   OS_CPU_EXT
@@ -45,6 +46,7 @@ typedef  CPU_INT16U     INT16U;                                         /* Unsig
 typedef  CPU_INT16S     INT16S;                                         /* Signed   16 bit quantity                                 */
 typedef  CPU_INT32U     INT32U;                                         /* Unsigned 32 bit quantity                                 */
 typedef  CPU_INT32S     INT32S;                                         /* Signed   32 bit quantity                                 */
+typedef  CPU_INT64U     INT64U;                                         /* Unsigned 64 bit quantity                                 */
 typedef  CPU_FP32       FP32;                                           /* Single precision floating point                          */
 typedef  CPU_FP64       FP64;                                           /* Double precision floating point                          */
 
@@ -73,6 +75,14 @@ typedef  CPU_SR         OS_CPU_SR;                                      /* Defin
 
 #define  OS_TASK_SW()         { OSCtxSw(); }                            /* Perform task switch                                      */
 
+#define  OS_TS_GET()          ((INT64U)CPU_TS_TmrRd())                  /* Timestamp for task profiling, see 'bsp_cpu.c'            */
+
+                                                                        /* Kernel memory primitives, see 'os_core.c  OS_MemClr()'   */
+#define  OS_CPU_MEM_CLR(pdest, size)          Mem_Clr((void *)(pdest), (CPU_SIZE_T)(size))
+#define  OS_CPU_MEM_COPY(pdest, psrc, size)   Mem_Copy((void *)(pdest), (const void *)(psrc), (CPU_SIZE_T)(size))
+                                                                        /* Stack scan, see 'os_task.c  OSTaskStkChk()  Note #1'     */
+#define  OS_CPU_STK_ZERO_LEN(pchk, n)         ((INT32U)(Mem_ZeroLen((const void *)(pchk), (CPU_SIZE_T)(n) * sizeof(OS_STK)) / sizeof(OS_STK)))
+
 /*
 **********************************************************************************************************
 *                                         Function Prototypes
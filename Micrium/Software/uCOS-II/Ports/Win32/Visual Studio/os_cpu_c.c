@@ -43,6 +43,7 @@
 *********************************************************************************************************
 */
 
+#include  <cpu_core.h>
 #include  <lib_def.h>
 #include  <ucos_ii.h>
 
@@ -548,11 +549,35 @@ OS_STK  *OSTaskStkInit (void  (*task)(void  *pd), void  *p_arg, OS_STK  *ptos, I
 *              2) It is assumed that the global pointer 'OSTCBHighRdy' points to the TCB of the task that
 *                 will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCur' points to the
 *                 task being switched out (i.e. the preempted task).
+*              3) The task switched out is charged the cycles since it was switched in, including the
+*                 ISRs that interrupted it.  Both start stamps are reset so that a call without a switch
+*                 (or the first one, from OSStartHighRdy()) does not count a slice twice.
+*              4) The stack of the task switched out is cleared ahead of its stack pointer, see
+*                 'os_task.c  OS_TaskStkClrPage()'.  Tasks run on their Win32 thread stack on this port,
+*                 so only the task's OS_TASK_STK at the top of its uC/OS-II stack is ever used.
 *********************************************************************************************************
 */
 #if (OS_CPU_HOOKS_EN > 0u) && (OS_TASK_SW_HOOK_EN > 0u)
 void  OSTaskSwHook (void)
 {
+#if (OS_TASK_PROFILE_EN > 0u)
+    INT64U  ts;
+
+
+    ts = OS_TS_GET();                                                   /* See Note #3.                                             */
+    if (OSRunning == OS_TRUE) {
+        OSTCBCur->OSTCBCyclesTot += ts - OSTCBCur->OSTCBCyclesStart;
+    }
+    OSTCBCur->OSTCBCyclesStart     = ts;
+    OSTCBHighRdy->OSTCBCyclesStart = ts;
+#endif
+
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u) && (OS_TASK_STK_CLR_PAGE_SIZE > 0u)
+    if (OSRunning == OS_TRUE) {                                         /* See Note #4.                                             */
+        OS_TaskStkClrPage(OSTCBCur);
+    }
+#endif
+
 #if (OS_APP_HOOKS_EN > 0u)
     App_TaskSwHook();
 #endif
@@ -88,6 +88,12 @@ static  void  OS_InitTCBList(void);
 
 static  void  OS_SchedNew(void);
 
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+static  BOOLEAN  OS_EventSetAvail(OS_EVENT *pevent);
+
+static  INT16U   OS_EventSetGet(OS_EVENT *pset, OS_EVENT **pevents_rdy, INT16U n);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -153,6 +159,9 @@ INT8U  OSEventNameGet (OS_EVENT   *pevent,
         case OS_EVENT_TYPE_MUTEX:
         case OS_EVENT_TYPE_MBOX:
         case OS_EVENT_TYPE_Q:
+#if (OS_EVENT_SET_EN > 0u)
+        case OS_EVENT_TYPE_SET:
+#endif
              break;
 
         default:
@@ -232,6 +241,9 @@ void  OSEventNameSet (OS_EVENT  *pevent,
         case OS_EVENT_TYPE_MUTEX:
         case OS_EVENT_TYPE_MBOX:
         case OS_EVENT_TYPE_Q:
+#if (OS_EVENT_SET_EN > 0u)
+        case OS_EVENT_TYPE_SET:
+#endif
              break;
 
         default:
@@ -568,6 +580,434 @@ INT16U  OSEventPendMulti (OS_EVENT  **pevents_pend,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                         CREATE AN EVENT SET
+*
+* Description: This function creates an event set, a group of semaphores, mailboxes and queues that a task
+*              waits on as a whole with OSEventSetPend().
+*
+* Arguments  : perr          is a pointer to an error code that will be returned to your application:
+*                               OS_ERR_NONE                     If the call was successful.
+*                               OS_ERR_CREATE_ISR               If you attempted to create an event set from
+*                                                               an ISR.
+*                               OS_ERR_ILLEGAL_CREATE_RUN_TIME  If you tried to create an event set after
+*                                                               safety critical operation started.
+*                               OS_ERR_PEVENT_NULL              No more event control blocks available.
+*
+* Returns    : != (OS_EVENT *)0  is a pointer to the event control block (ECB) allocated to the event set.
+*              == (OS_EVENT *)0  if no ECB was available or an error occurred.
+*
+* Note(s)    : 1) Unlike OSEventPendMulti(), the task is not added to the wait list of every event each time
+*                 it waits.  Events are added to the set once (see OSEventSetAdd()) and a post to an event
+*                 of the set appends the event to the list of ready events of the set, in constant time.
+*
+*              2) The event control block of a set is used as follows :
+*
+*                     OSEventPtr       First event of the list of ready events
+*                     OSEventSetNext   Last  event of the list of ready events
+*                     OSEventCnt       Number of events in the set
+*                     OSEventTbl[]     Tasks waiting on the set
+*********************************************************************************************************
+*/
+
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+OS_EVENT  *OSEventSetCreate (INT8U  *perr)
+{
+    OS_EVENT  *pset;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        *perr = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+    if (OSIntNesting > 0u) {                               /* See if called from ISR ...               */
+        *perr = OS_ERR_CREATE_ISR;                         /* ... can't CREATE from an ISR             */
+        return ((OS_EVENT *)0);
+    }
+    OS_ENTER_CRITICAL();
+    pset = OSEventFreeList;                                /* Get next free event control block        */
+    if (pset == (OS_EVENT *)0) {                           /* See if an ECB was available              */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_PEVENT_NULL;
+        return ((OS_EVENT *)0);
+    }
+    OSEventFreeList      = (OS_EVENT *)OSEventFreeList->OSEventPtr;
+    pset->OSEventType    = OS_EVENT_TYPE_SET;
+    pset->OSEventPtr     = (void *)0;                      /* No ready event, see Note #2              */
+    pset->OSEventSetNext = (OS_EVENT *)0;
+    pset->OSEventSetPtr  = (OS_EVENT *)0;
+    pset->OSEventSetRdy  = OS_FALSE;
+    pset->OSEventCnt     = 0u;                             /* No event in the set                      */
+#if OS_EVENT_NAME_EN > 0u
+    pset->OSEventName    = (INT8U *)(void *)"?";
+#endif
+    OS_EventWaitListInit(pset);
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (pset);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DELETE AN EVENT SET
+*
+* Description: This function deletes an event set.
+*
+* Arguments  : pset          is a pointer to the event control block of the event set.
+*
+*              perr          is a pointer to an error code that can contain one of the following values:
+*                            OS_ERR_NONE                  The call was successful and the set was deleted.
+*                            OS_ERR_DEL_ISR               If you attempted to delete the set from an ISR.
+*                            OS_ERR_PEVENT_NULL           If 'pset' is a NULL pointer.
+*                            OS_ERR_EVENT_TYPE            If you didn't pass a pointer to an event set.
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME  If you tried to delete the set after safety
+*                                                         critical operation started.
+*                            OS_ERR_EVENT_SET_NOT_EMPTY   If events are still in the set.
+*                            OS_ERR_TASK_WAITING          If one or more tasks are waiting on the set.
+*
+* Returns    : pset          upon error
+*              (OS_EVENT *)0 if the event set was successfully deleted.
+*
+* Note(s)    : The events of the set must be removed with OSEventSetRemove() first.
+*********************************************************************************************************
+*/
+
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+OS_EVENT  *OSEventSetDel (OS_EVENT  *pset,
+                          INT8U     *perr)
+{
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        *perr = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return ((OS_EVENT *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pset == (OS_EVENT *)0) {                           /* Validate 'pset'                          */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (pset);
+    }
+#endif
+    if (pset->OSEventType != OS_EVENT_TYPE_SET) {          /* Validate event block type                */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (pset);
+    }
+    if (OSIntNesting > 0u) {                               /* See if called from ISR ...               */
+        *perr = OS_ERR_DEL_ISR;                            /* ... can't DELETE from an ISR             */
+        return (pset);
+    }
+    OS_ENTER_CRITICAL();
+    if (pset->OSEventCnt > 0u) {                           /* See if events are still in the set       */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_EVENT_SET_NOT_EMPTY;
+        return (pset);
+    }
+    if (pset->OSEventGrp != 0u) {                          /* See if any task waiting on the set       */
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_TASK_WAITING;
+        return (pset);
+    }
+#if OS_EVENT_NAME_EN > 0u
+    pset->OSEventName    = (INT8U *)(void *)"?";
+#endif
+    pset->OSEventType    = OS_EVENT_TYPE_UNUSED;
+    pset->OSEventSetNext = (OS_EVENT *)0;
+    pset->OSEventPtr     = OSEventFreeList;                /* Return Event Control Block to free list  */
+    OSEventFreeList      = pset;
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return ((OS_EVENT *)0);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       ADD AN EVENT TO AN EVENT SET
+*
+* Description: This function adds a semaphore, a mailbox or a queue to an event set.
+*
+* Arguments  : pset          is a pointer to the event control block of the event set.
+*
+*              pevent        is a pointer to the event control block of the semaphore, mailbox or queue.
+*
+* Returns    : OS_ERR_NONE               The call was successful.
+*              OS_ERR_PEVENT_NULL        If 'pset' or 'pevent' is a NULL pointer.
+*              OS_ERR_EVENT_TYPE         If 'pset' is not an event set or 'pevent' is not a semaphore, a
+*                                        mailbox or a queue.
+*              OS_ERR_EVENT_SET_MEMBER   If 'pevent' is already in an event set.
+*
+* Note(s)    : 1) An event belongs to one event set at most.
+*
+*              2) If the event is available (a semaphore with a count, a mailbox with a message or a queue
+*                 with messages), it is readily placed in the list of ready events of the set.
+*********************************************************************************************************
+*/
+
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+INT8U  OSEventSetAdd (OS_EVENT  *pset,
+                      OS_EVENT  *pevent)
+{
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if ((pset   == (OS_EVENT *)0) ||                       /* Validate 'pset' & 'pevent'               */
+        (pevent == (OS_EVENT *)0)) {
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pset->OSEventType != OS_EVENT_TYPE_SET) {          /* Validate event block types               */
+        return (OS_ERR_EVENT_TYPE);
+    }
+    switch (pevent->OSEventType) {
+        case OS_EVENT_TYPE_SEM:
+        case OS_EVENT_TYPE_MBOX:
+        case OS_EVENT_TYPE_Q:
+             break;
+
+        default:
+             return (OS_ERR_EVENT_TYPE);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventSetPtr != (OS_EVENT *)0) {          /* See Note #1                              */
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_EVENT_SET_MEMBER);
+    }
+    pevent->OSEventSetPtr  = pset;
+    pevent->OSEventSetNext = (OS_EVENT *)0;
+    pevent->OSEventSetRdy  = OS_FALSE;
+    pset->OSEventCnt++;
+    OS_EXIT_CRITICAL();
+    OS_EventSetSignal(pevent);                             /* See Note #2                              */
+    return (OS_ERR_NONE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    REMOVE AN EVENT FROM AN EVENT SET
+*
+* Description: This function removes a semaphore, a mailbox or a queue from its event set.
+*
+* Arguments  : pset          is a pointer to the event control block of the event set.
+*
+*              pevent        is a pointer to the event control block of the semaphore, mailbox or queue.
+*
+* Returns    : OS_ERR_NONE                   The call was successful.
+*              OS_ERR_PEVENT_NULL            If 'pset' or 'pevent' is a NULL pointer.
+*              OS_ERR_EVENT_TYPE             If 'pset' is not an event set.
+*              OS_ERR_EVENT_SET_NOT_MEMBER   If 'pevent' is not in the event set.
+*
+* Note(s)    : Deleting a semaphore, a mailbox or a queue also removes it from its event set.
+*********************************************************************************************************
+*/
+
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+INT8U  OSEventSetRemove (OS_EVENT  *pset,
+                         OS_EVENT  *pevent)
+{
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#if OS_ARG_CHK_EN > 0u
+    if ((pset   == (OS_EVENT *)0) ||                       /* Validate 'pset' & 'pevent'               */
+        (pevent == (OS_EVENT *)0)) {
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pset->OSEventType != OS_EVENT_TYPE_SET) {          /* Validate event block type                */
+        return (OS_ERR_EVENT_TYPE);
+    }
+    OS_ENTER_CRITICAL();
+    if (pevent->OSEventSetPtr != pset) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_EVENT_SET_NOT_MEMBER);
+    }
+    OS_EventSetUnlink(pevent);
+    OS_EXIT_CRITICAL();
+    return (OS_ERR_NONE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        PEND ON AN EVENT SET
+*
+* Description: This function waits for events of an event set to be posted and returns the events that are
+*              ready.
+*
+* Arguments  : pset          is a pointer to the event control block of the event set.
+*
+*              pevents_rdy   is a pointer to an array where the ready events are returned, in the order they
+*                            became ready.
+*
+*              n             is the number of entries of 'pevents_rdy' (must be > 0).
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will
+*                            wait for events up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever for events to be posted.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE         The call was successful, check 'pevents_rdy' for the
+*                                                events that are ready.
+*                            OS_ERR_PEND_ABORT   The wait on the set was aborted.
+*                            OS_ERR_TIMEOUT      No event was posted within the specified 'timeout'.
+*                            OS_ERR_PEVENT_NULL  If 'pset' or 'pevents_rdy' is a NULL pointer or 'n' is 0.
+*                            OS_ERR_EVENT_TYPE   If you didn't pass a pointer to an event set.
+*                            OS_ERR_PEND_ISR     If you called this function from an ISR.
+*                            OS_ERR_PEND_LOCKED  If you called this function when the scheduler is locked.
+*
+* Returns    : >  0          the number of events returned in 'pevents_rdy'.
+*              == 0          upon timeout or error.
+*
+* Note(s)    : 1) Events are returned, and leave the list of ready events of the set, without being
+*                 accepted : the task then calls OSSemAccept(), OSMboxAccept() or OSQAccept() on each
+*                 returned event.  An event is placed again in the list by the next post that finds no task
+*                 waiting on the event itself, so a task should accept from a returned event until it is
+*                 empty (i.e. as an edge-triggered notification).
+*
+*              2) Events that were accepted by another task while in the list are skipped.  If that leaves
+*                 no event to return after a wait, the task waits again, with a new 'timeout'.
+*
+*              3) The time spent, including interrupts disabled, does not depend on the number of events
+*                 in the set.
+*********************************************************************************************************
+*/
+
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+INT16U  OSEventSetPend (OS_EVENT   *pset,
+                        OS_EVENT  **pevents_rdy,
+                        INT16U      n,
+                        INT32U      timeout,
+                        INT8U      *perr)
+{
+    INT16U     nbr;
+    INT8U      pend_stat;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if ((pset        == (OS_EVENT  *)0) ||                 /* Validate arguments                       */
+        (pevents_rdy == (OS_EVENT **)0) ||
+        (n           == 0u)) {
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+#endif
+    if (pset->OSEventType != OS_EVENT_TYPE_SET) {          /* Validate event block type                */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (0u);
+    }
+    if (OSIntNesting > 0u) {                               /* See if called from ISR ...               */
+        *perr = OS_ERR_PEND_ISR;                           /* ... can't PEND from an ISR               */
+        return (0u);
+    }
+    if (OSLockNesting > 0u) {                              /* See if called with scheduler locked ...  */
+        *perr = OS_ERR_PEND_LOCKED;                        /* ... can't PEND when locked               */
+        return (0u);
+    }
+
+    OS_ENTER_CRITICAL();
+    nbr       = OS_EventSetGet(pset, pevents_rdy, n);      /* Return the events already ready, if any  */
+    pend_stat = OS_STAT_PEND_OK;
+    while ((nbr       == 0u) &&                            /* Otherwise, wait until an event is posted */
+           (pend_stat == OS_STAT_PEND_OK)) {
+        OSTCBCur->OSTCBStat     |= OS_STAT_SET;
+        OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
+        OSTCBCur->OSTCBDly       = timeout;                /* Store pend timeout in TCB                */
+        OS_EventTaskWait(pset);                            /* Suspend task until event or timeout      */
+        OS_EXIT_CRITICAL();
+        OS_Sched();                                        /* Find next highest priority task ready    */
+        OS_ENTER_CRITICAL();
+        pend_stat = OSTCBCur->OSTCBStatPend;
+        if (pend_stat == OS_STAT_PEND_TO) {
+            OS_EventTaskRemove(OSTCBCur, pset);
+        }
+        OSTCBCur->OSTCBStat      =  OS_STAT_RDY;           /* Set   task  status to ready              */
+        OSTCBCur->OSTCBStatPend  =  OS_STAT_PEND_OK;       /* Clear pend  status                       */
+        OSTCBCur->OSTCBEventPtr  = (OS_EVENT *)0;          /* Clear event pointer                      */
+#if ((OS_MBOX_EN > 0u) ||                 \
+    ((OS_Q_EN    > 0u) && (OS_MAX_QS > 0u)))
+        OSTCBCur->OSTCBMsg       = (void     *)0;          /* Clear task  message                      */
+#endif
+        if (pend_stat == OS_STAT_PEND_OK) {
+            nbr = OS_EventSetGet(pset, pevents_rdy, n);    /* See Note #2                              */
+        }
+    }
+    OS_EXIT_CRITICAL();
+    switch (pend_stat) {
+        case OS_STAT_PEND_OK:
+             *perr = OS_ERR_NONE;
+             break;
+
+        case OS_STAT_PEND_ABORT:
+             *perr = OS_ERR_PEND_ABORT;                    /* Indicate that we aborted                 */
+             break;
+
+        case OS_STAT_PEND_TO:
+        default:
+             *perr = OS_ERR_TIMEOUT;                       /* Indicate that no event was posted in TO  */
+             break;
+    }
+    return (nbr);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           INITIALIZATION
@@ -1373,6 +1813,228 @@ void  OS_EventTaskRemoveMulti (OS_TCB    *ptcb,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  SEE IF AN EVENT OF AN EVENT SET IS AVAILABLE
+*
+* Description: This function is called by the event set services to see if a semaphore has a count, a
+*              mailbox has a message or a queue has messages.
+*
+* Arguments  : pevent    is a pointer to the event control block of the semaphore, mailbox or queue.
+*
+* Returns    : OS_TRUE   if the event is available.
+*              OS_FALSE  otherwise.
+*
+* Note       : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+static  BOOLEAN  OS_EventSetAvail (OS_EVENT  *pevent)
+{
+    BOOLEAN  avail;
+
+
+    switch (pevent->OSEventType) {
+#if (OS_SEM_EN > 0u)
+        case OS_EVENT_TYPE_SEM:
+             avail = (pevent->OSEventCnt > 0u) ? OS_TRUE : OS_FALSE;
+             break;
+#endif
+
+#if (OS_MBOX_EN > 0u)
+        case OS_EVENT_TYPE_MBOX:
+             avail = (pevent->OSEventPtr != (void *)0) ? OS_TRUE : OS_FALSE;
+             break;
+#endif
+
+#if ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u))
+        case OS_EVENT_TYPE_Q:
+             avail = (((OS_Q *)pevent->OSEventPtr)->OSQEntries > 0u) ? OS_TRUE : OS_FALSE;
+             break;
+#endif
+
+        default:
+             avail = OS_FALSE;
+             break;
+    }
+    return (avail);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 GET THE READY EVENTS OF AN EVENT SET
+*
+* Description: This function is called by OSEventSetPend() to take up to 'n' events from the list of ready
+*              events of an event set.
+*
+* Arguments  : pset          is a pointer to the event control block of the event set.
+*
+*              pevents_rdy   is a pointer to the array where the ready events are returned.
+*
+*              n             is the number of entries of 'pevents_rdy'.
+*
+* Returns    : The number of events returned.
+*
+* Note       : 1) Events taken from the list that are no longer available are skipped (see
+*                 'OSEventSetPend()  Note #2').
+*
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.  It must
+*                 be called with interrupts disabled.
+*********************************************************************************************************
+*/
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+static  INT16U  OS_EventSetGet (OS_EVENT   *pset,
+                                OS_EVENT  **pevents_rdy,
+                                INT16U      n)
+{
+    OS_EVENT  *pevent;
+    OS_EVENT  *pevent_next;
+    INT16U     nbr;
+
+
+    nbr    = 0u;
+    pevent = (OS_EVENT *)pset->OSEventPtr;
+    while ((nbr    <  n) &&
+           (pevent != (OS_EVENT *)0)) {
+        pevent_next            = pevent->OSEventSetNext;
+        pevent->OSEventSetNext = (OS_EVENT *)0;            /* Take event from the list of ready events */
+        pevent->OSEventSetRdy  = OS_FALSE;
+        if (OS_EventSetAvail(pevent) == OS_TRUE) {         /* See Note #1                              */
+            pevents_rdy[nbr++] = pevent;
+        }
+        pevent = pevent_next;
+    }
+    pset->OSEventPtr = (void *)pevent;
+    if (pevent == (OS_EVENT *)0) {                         /* List is now empty                        */
+        pset->OSEventSetNext = (OS_EVENT *)0;
+    }
+    return (nbr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  SIGNAL AN EVENT SET THAT AN EVENT IS READY
+*
+* Description: This function is called by the post services of semaphores, mailboxes and queues, after a
+*              post that did not find any task waiting on the event itself.  If the event is in an event
+*              set, it is appended to the list of ready events of the set & the highest priority task
+*              waiting on the set, if any, is readied.
+*
+* Arguments  : pevent    is a pointer to the event control block of the semaphore, mailbox or queue.
+*
+* Returns    : none.
+*
+* Note       : 1) This function runs in constant time.  It returns immediately if the event is not in a set.
+*
+*              2) The event is checked again for availability with interrupts disabled since it may have
+*                 been accepted between the post & this call.
+*
+*              3) This function is INTERNAL to uC/OS-II and your application should not call it.  It must
+*                 be called with interrupts enabled, from a task or an ISR.
+*
+*              4) A post service that has also readied tasks waiting on the event itself (OSSemPostN(),
+*                 OSQPostN()) calls it before its own OS_Sched(), so that the highest priority task readied
+*                 by the event or by the set runs first.
+*********************************************************************************************************
+*/
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+void  OS_EventSetSignal (OS_EVENT  *pevent)
+{
+    OS_EVENT  *pset;
+    BOOLEAN    sched;
+#if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+
+    if (pevent->OSEventSetPtr == (OS_EVENT *)0) {          /* See if event is in a set                 */
+        return;
+    }
+    sched = OS_FALSE;
+    OS_ENTER_CRITICAL();
+    pset  = pevent->OSEventSetPtr;
+    if ((pset                  != (OS_EVENT *)0) &&
+        (pevent->OSEventSetRdy == OS_FALSE)      &&        /* See if not already in the ready list ... */
+        (OS_EventSetAvail(pevent) == OS_TRUE)) {           /* ... & still available, see Note #2       */
+        pevent->OSEventSetRdy  = OS_TRUE;
+        pevent->OSEventSetNext = (OS_EVENT *)0;
+        if (pset->OSEventPtr == (void *)0) {               /* Append event to the list of ready events */
+            pset->OSEventPtr                    = (void *)pevent;
+        } else {
+            pset->OSEventSetNext->OSEventSetNext = pevent;
+        }
+        pset->OSEventSetNext = pevent;
+        if (pset->OSEventGrp != 0u) {                      /* Ready HPT waiting on the set             */
+            (void)OS_EventTaskRdy(pset, (void *)pevent, OS_STAT_SET, OS_STAT_PEND_OK);
+            sched = OS_TRUE;
+        }
+    }
+    OS_EXIT_CRITICAL();
+    if (sched == OS_TRUE) {
+        OS_Sched();                                        /* Find HPT ready to run                    */
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  REMOVE AN EVENT FROM ITS EVENT SET
+*
+* Description: This function is called by OSEventSetRemove() and when a semaphore, a mailbox or a queue is
+*              deleted, to remove the event from its event set, if any.
+*
+* Arguments  : pevent    is a pointer to the event control block of the semaphore, mailbox or queue.
+*
+* Returns    : none.
+*
+* Note       : 1) If the event is in the list of ready events of the set, the list is walked to unlink it.
+*
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.  It must
+*                 be called with interrupts disabled.
+*********************************************************************************************************
+*/
+#if (OS_EVENT_EN) && (OS_EVENT_SET_EN > 0u)
+void  OS_EventSetUnlink (OS_EVENT  *pevent)
+{
+    OS_EVENT  *pset;
+    OS_EVENT  *pevent_prev;
+    OS_EVENT  *pevent_cur;
+
+
+    pset = pevent->OSEventSetPtr;
+    if (pset == (OS_EVENT *)0) {                           /* See if event is in a set                 */
+        return;
+    }
+    if (pevent->OSEventSetRdy == OS_TRUE) {                /* Unlink from list of ready events, Note #1*/
+        pevent_prev = (OS_EVENT *)0;
+        pevent_cur  = (OS_EVENT *)pset->OSEventPtr;
+        while (pevent_cur != pevent) {
+            pevent_prev = pevent_cur;
+            pevent_cur  = pevent_cur->OSEventSetNext;
+        }
+        if (pevent_prev == (OS_EVENT *)0) {
+            pset->OSEventPtr            = (void *)pevent->OSEventSetNext;
+        } else {
+            pevent_prev->OSEventSetNext = pevent->OSEventSetNext;
+        }
+        if (pset->OSEventSetNext == pevent) {              /* Was it the last ready event?             */
+            pset->OSEventSetNext        = pevent_prev;
+        }
+    }
+    pevent->OSEventSetPtr  = (OS_EVENT *)0;
+    pevent->OSEventSetNext = (OS_EVENT *)0;
+    pevent->OSEventSetRdy  = OS_FALSE;
+    pset->OSEventCnt--;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                             INITIALIZE EVENT CONTROL BLOCK'S WAIT LIST
@@ -1711,20 +2373,38 @@ static  void  OS_InitTCBList (void)
 * Returns    : none
 *
 * Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
-*              2) Note that we can only clear up to 64K bytes of RAM.  This is not an issue because none
-*                 of the uses of this function gets close to this limit.
-*              3) The clear is done one byte at a time since this will work on any processor irrespective
-*                 of the alignment of the destination.
+*              2) 'size' is 32 bits wide so that task stacks (see OS_TaskStkClr()) can be cleared too.
+*              3) A port may supply an optimized clear (e.g. vector wide) by defining OS_CPU_MEM_CLR() in
+*                 OS_CPU.H.  Otherwise, the bytes up to the first INT32U boundary are cleared one at a time,
+*                 then whole INT32U words, then the remaining bytes.
 *********************************************************************************************************
 */
 
 void  OS_MemClr (INT8U  *pdest,
-                 INT16U  size)
+                 INT32U  size)
 {
-    while (size > 0u) {
+#ifdef OS_CPU_MEM_CLR
+    OS_CPU_MEM_CLR(pdest, size);                           /* See Note #3                              */
+#else
+    INT32U  *pdest32;
+
+
+    while ((size > 0u) &&                                  /* Clear bytes up to a word boundary        */
+           (((INT32U)pdest & (sizeof(INT32U) - 1u)) != 0u)) {
         *pdest++ = (INT8U)0;
         size--;
     }
+    pdest32 = (INT32U *)pdest;
+    while (size >= sizeof(INT32U)) {                       /* Clear whole words                        */
+        *pdest32++ = 0u;
+        size      -= sizeof(INT32U);
+    }
+    pdest = (INT8U *)pdest32;
+    while (size > 0u) {                                    /* Clear the remaining bytes                */
+        *pdest++ = (INT8U)0;
+        size--;
+    }
+#endif
 }
 
 
@@ -1746,20 +2426,44 @@ void  OS_MemClr (INT8U  *pdest,
 * Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.  There is
 *                 no provision to handle overlapping memory copy.  However, that's not a problem since this
 *                 is not a situation that will happen.
-*              2) Note that we can only copy up to 64K bytes of RAM
-*              3) The copy is done one byte at a time since this will work on any processor irrespective
-*                 of the alignment of the source and destination.
+*              2) 'size' is 32 bits wide, see OS_MemClr().
+*              3) A port may supply an optimized copy by defining OS_CPU_MEM_COPY() in OS_CPU.H.  Otherwise,
+*                 whole INT32U words are copied when the source and destination have the same alignment
+*                 (after the leading bytes), & bytes are copied one at a time otherwise.
 *********************************************************************************************************
 */
 
 void  OS_MemCopy (INT8U  *pdest,
                   INT8U  *psrc,
-                  INT16U  size)
+                  INT32U  size)
 {
-    while (size > 0u) {
+#ifdef OS_CPU_MEM_COPY
+    OS_CPU_MEM_COPY(pdest, psrc, size);                    /* See Note #3                              */
+#else
+    INT32U  *pdest32;
+    INT32U  *psrc32;
+
+
+    if ((((INT32U)pdest ^ (INT32U)psrc) & (sizeof(INT32U) - 1u)) == 0u) {
+        while ((size > 0u) &&                              /* Same alignment: copy bytes up to a ...   */
+               (((INT32U)pdest & (sizeof(INT32U) - 1u)) != 0u)) {
+            *pdest++ = *psrc++;
+            size--;
+        }
+        pdest32 = (INT32U *)pdest;                         /* ... word boundary, then whole words      */
+        psrc32  = (INT32U *)psrc;
+        while (size >= sizeof(INT32U)) {
+            *pdest32++ = *psrc32++;
+            size      -= sizeof(INT32U);
+        }
+        pdest = (INT8U *)pdest32;
+        psrc  = (INT8U *)psrc32;
+    }
+    while (size > 0u) {                                    /* Remaining (or misaligned) bytes          */
         *pdest++ = *psrc++;
         size--;
     }
+#endif
 }
 
 
@@ -2134,6 +2838,25 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBStkBottom     = pbos;                   /* Store pointer to bottom of stack         */
         ptcb->OSTCBOpt           = opt;                    /* Store task options                       */
         ptcb->OSTCBId            = id;                     /* Store task ID                            */
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_STK_CLR_PAGE_SIZE > 0u)
+        ptcb->OSTCBStkClrPtr     = pbos;                   /* Top page cleared by OS_TaskStkClr()      */
+        if (((opt & OS_TASK_OPT_STK_CHK) != 0u) &&
+            ((opt & OS_TASK_OPT_STK_CLR) != 0u) &&
+            (stk_size > OS_TASK_STK_CLR_PAGE_SIZE)) {
+#if OS_STK_GROWTH == 1u
+            ptcb->OSTCBStkClrPtr = pbos + (stk_size - OS_TASK_STK_CLR_PAGE_SIZE);
+#else
+            ptcb->OSTCBStkClrPtr = pbos - (stk_size - OS_TASK_STK_CLR_PAGE_SIZE);
+#endif
+        }
+#endif
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_STK_CHK_INCR_EN > 0u)
+#if OS_STK_GROWTH == 1u
+        ptcb->OSTCBStkChkPtr     = pbos + stk_size;        /* No entry found in use yet                */
+#else
+        ptcb->OSTCBStkChkPtr     = pbos - stk_size;
+#endif
+#endif
 #else
         pext                     = pext;                   /* Prevent compiler warning if not used     */
         stk_size                 = stk_size;
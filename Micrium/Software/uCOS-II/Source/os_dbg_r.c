@@ -125,7 +125,11 @@ INT16U  const  OS_TLS_TblSize        = 0u;
 INT16U  const  OSTmrEn               = OS_TMR_EN;
 INT16U  const  OSTmrCfgMax           = OS_TMR_CFG_MAX;
 INT16U  const  OSTmrCfgNameEn        = OS_TMR_CFG_NAME_EN;
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WHEEL_HIER_EN > 0u)
+INT16U  const  OSTmrCfgWheelSize     = OS_TMR_WHEEL_TBL_SIZE;   /* Spokes of all the wheel levels  */
+#else
 INT16U  const  OSTmrCfgWheelSize     = OS_TMR_CFG_WHEEL_SIZE;
+#endif
 INT16U  const  OSTmrCfgTicksPerSec   = OS_TMR_CFG_TICKS_PER_SEC;
 
 #if (OS_TMR_EN > 0u) && (OS_TMR_CFG_MAX > 0u)
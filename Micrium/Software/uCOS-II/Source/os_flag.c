@@ -46,6 +46,14 @@
 static  void     OS_FlagBlock(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode, OS_FLAGS flags, INT8U wait_type, INT32U timeout);
 static  BOOLEAN  OS_FlagTaskRdy(OS_FLAG_NODE *pnode, OS_FLAGS flags_rdy, INT8U pend_stat);
 
+#if OS_FLAG_WAIT_IX_EN > 0u
+static  INT8U    OS_FlagIxBit(OS_FLAGS flags);
+static  void     OS_FlagIxLink(OS_FLAG_GRP *pgrp, OS_FLAG_NODE *pnode);
+static  void     OS_FlagIxUnlink(OS_FLAG_NODE *pnode);
+static  BOOLEAN  OS_FlagIxRdy(OS_FLAG_GRP *pgrp, OS_FLAG_IX *pix, OS_FLAGS flags_chg, OS_FLAGS flags_cur);
+static  BOOLEAN  OS_FlagIxPost(OS_FLAG_GRP *pgrp, OS_FLAGS flags_set, OS_FLAGS flags_clr);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -108,6 +116,9 @@ OS_FLAGS  OSFlagAccept (OS_FLAG_GRP  *pgrp,
     OS_FLAGS      flags_rdy;
     INT8U         result;
     BOOLEAN       consume;
+#if OS_FLAG_WAIT_IX_EN > 0u
+    BOOLEAN       sched;
+#endif
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
     OS_CPU_SR     cpu_sr = 0u;
 #endif
@@ -140,6 +151,9 @@ OS_FLAGS  OSFlagAccept (OS_FLAG_GRP  *pgrp,
     }
 
     *perr = OS_ERR_NONE;                                   /* Assume NO error until proven otherwise.  */
+#if OS_FLAG_WAIT_IX_EN > 0u
+    sched = OS_FALSE;
+#endif
     OS_ENTER_CRITICAL();
     switch (wait_type) {
         case OS_FLAG_WAIT_SET_ALL:                         /* See if all required flags are set        */
@@ -147,6 +161,9 @@ OS_FLAGS  OSFlagAccept (OS_FLAG_GRP  *pgrp,
              if (flags_rdy == flags) {                     /* Must match ALL the bits that we want     */
                  if (consume == OS_TRUE) {                 /* See if we need to consume the flags      */
                      pgrp->OSFlagFlags &= (OS_FLAGS)~flags_rdy;     /* Clear ONLY the flags we wanted  */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                     sched = OS_FlagIxPost(pgrp, (OS_FLAGS)0, flags_rdy);
+#endif
                  }
              } else {
                  *perr = OS_ERR_FLAG_NOT_RDY;
@@ -159,6 +176,9 @@ OS_FLAGS  OSFlagAccept (OS_FLAG_GRP  *pgrp,
              if (flags_rdy != (OS_FLAGS)0) {               /* See if any flag set                      */
                  if (consume == OS_TRUE) {                 /* See if we need to consume the flags      */
                      pgrp->OSFlagFlags &= (OS_FLAGS)~flags_rdy;     /* Clear ONLY the flags we got     */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                     sched = OS_FlagIxPost(pgrp, (OS_FLAGS)0, flags_rdy);
+#endif
                  }
              } else {
                  *perr = OS_ERR_FLAG_NOT_RDY;
@@ -172,6 +192,9 @@ OS_FLAGS  OSFlagAccept (OS_FLAG_GRP  *pgrp,
              if (flags_rdy == flags) {                     /* Must match ALL the bits that we want     */
                  if (consume == OS_TRUE) {                 /* See if we need to consume the flags      */
                      pgrp->OSFlagFlags |= flags_rdy;       /* Set ONLY the flags that we wanted        */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                     sched = OS_FlagIxPost(pgrp, flags_rdy, (OS_FLAGS)0);
+#endif
                  }
              } else {
                  *perr = OS_ERR_FLAG_NOT_RDY;
@@ -184,6 +207,9 @@ OS_FLAGS  OSFlagAccept (OS_FLAG_GRP  *pgrp,
              if (flags_rdy != (OS_FLAGS)0) {               /* See if any flag cleared                  */
                  if (consume == OS_TRUE) {                 /* See if we need to consume the flags      */
                      pgrp->OSFlagFlags |= flags_rdy;       /* Set ONLY the flags that we got           */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                     sched = OS_FlagIxPost(pgrp, flags_rdy, (OS_FLAGS)0);
+#endif
                  }
              } else {
                  *perr = OS_ERR_FLAG_NOT_RDY;
@@ -198,6 +224,11 @@ OS_FLAGS  OSFlagAccept (OS_FLAG_GRP  *pgrp,
              *perr     = OS_ERR_FLAG_WAIT_TYPE;
              break;
     }
+#if OS_FLAG_WAIT_IX_EN > 0u
+    if (sched == OS_TRUE) {                                /* Consumed flags may have readied tasks    */
+        OS_Sched();
+    }
+#endif
     return (flags_rdy);
 }
 #endif
@@ -264,6 +295,12 @@ OS_FLAG_GRP  *OSFlagCreate (OS_FLAGS  flags,
         pgrp->OSFlagWaitList = (void *)0;           /* Clear list of tasks waiting on flags            */
 #if OS_FLAG_NAME_EN > 0u
         pgrp->OSFlagName     = (INT8U *)(void *)"?";
+#endif
+#if OS_FLAG_WAIT_IX_EN > 0u
+        OS_MemClr((INT8U *)&pgrp->OSFlagIxSet, sizeof(OS_FLAG_IX));    /* Clear index of waiting tasks */
+#if OS_FLAG_WAIT_CLR_EN > 0u
+        OS_MemClr((INT8U *)&pgrp->OSFlagIxClr, sizeof(OS_FLAG_IX));
+#endif
 #endif
         OS_TRACE_FLAG_CREATE(pgrp, pgrp->OSFlagName);
         OS_EXIT_CRITICAL();
@@ -630,6 +667,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
     INT8U         result;
     INT8U         pend_stat;
     BOOLEAN       consume;
+#if OS_FLAG_WAIT_IX_EN > 0u
+    BOOLEAN       sched;
+#endif
 #if OS_CRITICAL_METHOD == 3u                               /* Allocate storage for CPU status register */
     OS_CPU_SR     cpu_sr = 0u;
 #endif
@@ -674,6 +714,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
         consume    = OS_FALSE;
     }
 
+#if OS_FLAG_WAIT_IX_EN > 0u
+    sched = OS_FALSE;
+#endif
     OS_ENTER_CRITICAL();
     switch (wait_type) {
         case OS_FLAG_WAIT_SET_ALL:                         /* See if all required flags are set        */
@@ -681,9 +724,17 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
              if (flags_rdy == flags) {                     /* Must match ALL the bits that we want     */
                  if (consume == OS_TRUE) {                 /* See if we need to consume the flags      */
                      pgrp->OSFlagFlags &= (OS_FLAGS)~flags_rdy;   /* Clear ONLY the flags we wanted    */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                     sched = OS_FlagIxPost(pgrp, (OS_FLAGS)0, flags_rdy);
+#endif
                  }
                  OSTCBCur->OSTCBFlagsRdy = flags_rdy;      /* Save flags that were ready               */
                  OS_EXIT_CRITICAL();                       /* Yes, condition met, return to caller     */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                 if (sched == OS_TRUE) {                   /* Consumed flags may have readied tasks    */
+                     OS_Sched();
+                 }
+#endif
                  *perr                   = OS_ERR_NONE;
                  OS_TRACE_FLAG_PEND_EXIT(*perr);
                  return (flags_rdy);
@@ -698,9 +749,17 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
              if (flags_rdy != (OS_FLAGS)0) {               /* See if any flag set                      */
                  if (consume == OS_TRUE) {                 /* See if we need to consume the flags      */
                      pgrp->OSFlagFlags &= (OS_FLAGS)~flags_rdy;    /* Clear ONLY the flags that we got */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                     sched = OS_FlagIxPost(pgrp, (OS_FLAGS)0, flags_rdy);
+#endif
                  }
                  OSTCBCur->OSTCBFlagsRdy = flags_rdy;      /* Save flags that were ready               */
                  OS_EXIT_CRITICAL();                       /* Yes, condition met, return to caller     */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                 if (sched == OS_TRUE) {                   /* Consumed flags may have readied tasks    */
+                     OS_Sched();
+                 }
+#endif
                  *perr                   = OS_ERR_NONE;
                  OS_TRACE_FLAG_PEND_EXIT(*perr);
                  return (flags_rdy);
@@ -716,9 +775,17 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
              if (flags_rdy == flags) {                     /* Must match ALL the bits that we want     */
                  if (consume == OS_TRUE) {                 /* See if we need to consume the flags      */
                      pgrp->OSFlagFlags |= flags_rdy;       /* Set ONLY the flags that we wanted        */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                     sched = OS_FlagIxPost(pgrp, flags_rdy, (OS_FLAGS)0);
+#endif
                  }
                  OSTCBCur->OSTCBFlagsRdy = flags_rdy;      /* Save flags that were ready               */
                  OS_EXIT_CRITICAL();                       /* Yes, condition met, return to caller     */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                 if (sched == OS_TRUE) {                   /* Consumed flags may have readied tasks    */
+                     OS_Sched();
+                 }
+#endif
                  *perr                   = OS_ERR_NONE;
                  OS_TRACE_FLAG_PEND_EXIT(*perr);
                  return (flags_rdy);
@@ -733,9 +800,17 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
              if (flags_rdy != (OS_FLAGS)0) {               /* See if any flag cleared                  */
                  if (consume == OS_TRUE) {                 /* See if we need to consume the flags      */
                      pgrp->OSFlagFlags |= flags_rdy;       /* Set ONLY the flags that we got           */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                     sched = OS_FlagIxPost(pgrp, flags_rdy, (OS_FLAGS)0);
+#endif
                  }
                  OSTCBCur->OSTCBFlagsRdy = flags_rdy;      /* Save flags that were ready               */
                  OS_EXIT_CRITICAL();                       /* Yes, condition met, return to caller     */
+#if OS_FLAG_WAIT_IX_EN > 0u
+                 if (sched == OS_TRUE) {                   /* Consumed flags may have readied tasks    */
+                     OS_Sched();
+                 }
+#endif
                  *perr                   = OS_ERR_NONE;
                  OS_TRACE_FLAG_PEND_EXIT(*perr);
                  return (flags_rdy);
@@ -782,12 +857,18 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
             case OS_FLAG_WAIT_SET_ALL:
             case OS_FLAG_WAIT_SET_ANY:                     /* Clear ONLY the flags we got              */
                  pgrp->OSFlagFlags &= (OS_FLAGS)~flags_rdy;
+#if OS_FLAG_WAIT_IX_EN > 0u
+                 sched = OS_FlagIxPost(pgrp, (OS_FLAGS)0, flags_rdy);
+#endif
                  break;
 
 #if OS_FLAG_WAIT_CLR_EN > 0u
             case OS_FLAG_WAIT_CLR_ALL:
             case OS_FLAG_WAIT_CLR_ANY:                     /* Set   ONLY the flags we got              */
                  pgrp->OSFlagFlags |=  flags_rdy;
+#if OS_FLAG_WAIT_IX_EN > 0u
+                 sched = OS_FlagIxPost(pgrp, flags_rdy, (OS_FLAGS)0);
+#endif
                  break;
 #endif
             default:
@@ -798,6 +879,11 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *pgrp,
         }
     }
     OS_EXIT_CRITICAL();
+#if OS_FLAG_WAIT_IX_EN > 0u
+    if (sched == OS_TRUE) {                                /* Consumed flags may have readied tasks    */
+        OS_Sched();
+    }
+#endif
     *perr = OS_ERR_NONE;                                   /* Event(s) must have occurred              */
     OS_TRACE_FLAG_PEND_EXIT(*perr);
     return (flags_rdy);
@@ -871,9 +957,10 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (void)
 * Called From: Task or ISR
 *
 * WARNING(s) : 1) The execution time of this function depends on the number of tasks waiting on the event
-*                 flag group.
+*                 flag group.  With OS_FLAG_WAIT_IX_EN, it only depends on the number of tasks waiting for
+*                 the bits that changed (see OS_FlagIxPost()).
 *              2) The amount of time interrupts are DISABLED depends on the number of tasks waiting on
-*                 the event flag group.
+*                 the event flag group (or waiting for the bits that changed, with OS_FLAG_WAIT_IX_EN).
 *********************************************************************************************************
 */
 OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
@@ -881,11 +968,15 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
                       INT8U         opt,
                       INT8U        *perr)
 {
+#if OS_FLAG_WAIT_IX_EN > 0u
+    OS_FLAGS      flags_old;
+#else
     OS_FLAG_NODE *pnode;
-    BOOLEAN       sched;
-    OS_FLAGS      flags_cur;
     OS_FLAGS      flags_rdy;
     BOOLEAN       rdy;
+#endif
+    BOOLEAN       sched;
+    OS_FLAGS      flags_cur;
 #if OS_CRITICAL_METHOD == 3u                         /* Allocate storage for CPU status register       */
     OS_CPU_SR     cpu_sr = 0u;
 #endif
@@ -914,6 +1005,9 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
     }
 
     OS_ENTER_CRITICAL();
+#if OS_FLAG_WAIT_IX_EN > 0u
+    flags_old = pgrp->OSFlagFlags;
+#endif
     switch (opt) {
         case OS_FLAG_CLR:
              pgrp->OSFlagFlags &= (OS_FLAGS)~flags;  /* Clear the flags specified in the group         */
@@ -929,6 +1023,11 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
              OS_TRACE_FLAG_POST_EXIT(*perr);
              return ((OS_FLAGS)0);
     }
+#if OS_FLAG_WAIT_IX_EN > 0u
+    sched = OS_FlagIxPost(pgrp,                      /* Only check the tasks watching changed bits     */
+                          (OS_FLAGS)(pgrp->OSFlagFlags & ~flags_old),
+                          (OS_FLAGS)(flags_old & ~pgrp->OSFlagFlags));
+#else
     sched = OS_FALSE;                                /* Indicate that we don't need rescheduling       */
     pnode = (OS_FLAG_NODE *)pgrp->OSFlagWaitList;
     while (pnode != (OS_FLAG_NODE *)0) {             /* Go through all tasks waiting on event flag(s)  */
@@ -982,6 +1081,7 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *pgrp,
         }
         pnode = (OS_FLAG_NODE *)pnode->OSFlagNodeNext; /* Point to next task waiting for event flag(s) */
     }
+#endif
     OS_EXIT_CRITICAL();
     if (sched == OS_TRUE) {
         OS_Sched();
@@ -1116,6 +1216,9 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
         pnode_next->OSFlagNodePrev = pnode;           /* No, link in doubly linked list                */
     }
     pgrp->OSFlagWaitList = (void *)pnode;
+#if OS_FLAG_WAIT_IX_EN > 0u
+    OS_FlagIxLink(pgrp, pnode);                       /* Watch the bits that can ready the task        */
+#endif
 
     y            =  OSTCBCur->OSTCBY;                 /* Suspend current task until flag(s) received   */
     OSRdyTbl[y] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
@@ -1279,9 +1382,343 @@ void  OS_FlagUnlink (OS_FLAG_NODE *pnode)
             pnode_next->OSFlagNodePrev = pnode_prev;            /*      No, Link around current node   */
         }
     }
+#if OS_FLAG_WAIT_IX_EN > 0u
+    OS_FlagIxUnlink(pnode);                                     /* Remove node from wait index         */
+#endif
 #if OS_TASK_DEL_EN > 0u
     ptcb                = (OS_TCB *)pnode->OSFlagNodeTCB;
     ptcb->OSTCBFlagNode = (OS_FLAG_NODE *)0;
 #endif
 }
+
+
+/*
+*********************************************************************************************************
+*                                  FIND LOWEST BIT SET IN EVENT FLAGS
+*
+* Description: This function is internal to uC/OS-II and is used to find the number of the lowest bit set
+*              in a set of event flags.
+*
+* Arguments  : flags         is the set of event flags (must not be 0).
+*
+* Returns    : The number of the lowest bit set, 0 for the least significant bit.
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_WAIT_IX_EN > 0u
+static  INT8U  OS_FlagIxBit (OS_FLAGS  flags)
+{
+    INT8U  bit;
+
+
+    bit = 0u;
+    while ((flags & 0xFFu) == 0u) {                         /* Skip the octets without any bit set      */
+        flags = (OS_FLAGS)(flags >> 8u);
+        bit  += 8u;
+    }
+    return ((INT8U)(bit + OSUnMapTbl[flags & 0xFFu]));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  LINK EVENT FLAG NODE IN WAIT INDEX
+*
+* Description: This function is internal to uC/OS-II and is used to place an event flag node in the index
+*              of the tasks waiting on its event flag group.
+*
+* Arguments  : pgrp          is a pointer to the event flag group.
+*
+*              pnode         is a pointer to the event flag node, which condition is not met.
+*
+* Returns    : none
+*
+* Called by  : OS_FlagBlock()    OS_FLAG.C
+*              OS_FlagIxRdy()    OS_FLAG.C
+*
+* Note(s)    : 1) A node only needs to be checked when one of the bits it waits for changes to the desired
+*                 state (set for OS_FLAG_WAIT_SET_*, cleared for OS_FLAG_WAIT_CLR_*).  The node is thus
+*                 placed in the list of a single 'watched' bit of its flag group :
+*
+*                 (a) A node waiting for ALL its bits watches the lowest of its bits NOT yet in the desired
+*                     state : its condition can not be met before this bit changes.  When the bit changes
+*                     the node is either readied or moved to its next missing bit.
+*
+*                 (b) A node waiting for ANY of a single bit watches this bit.
+*
+*                 (c) A node waiting for ANY of several bits is placed in a separate list, checked when
+*                     one of the bits waited for by the list (see 'OSFlagIxAnyFlags') changes.
+*
+*              2) This function assumes that interrupts are disabled.
+*
+*              3) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_WAIT_IX_EN > 0u
+static  void  OS_FlagIxLink (OS_FLAG_GRP   *pgrp,
+                             OS_FLAG_NODE  *pnode)
+{
+    OS_FLAG_IX     *pix;
+    OS_FLAG_NODE   *pnode_next;
+    void          **phead;
+    OS_FLAGS        flags_watch;
+    BOOLEAN         single;
+
+
+    switch (pnode->OSFlagNodeWaitType) {
+#if OS_FLAG_WAIT_CLR_EN > 0u
+        case OS_FLAG_WAIT_CLR_ALL:                          /* Watch the lowest bit still set           */
+             pix         = &pgrp->OSFlagIxClr;
+             flags_watch = (OS_FLAGS)(pnode->OSFlagNodeFlags & pgrp->OSFlagFlags);
+             single      = OS_TRUE;
+             break;
+
+        case OS_FLAG_WAIT_CLR_ANY:
+             pix         = &pgrp->OSFlagIxClr;
+             flags_watch = pnode->OSFlagNodeFlags;
+             single      = ((flags_watch & (OS_FLAGS)(flags_watch - 1u)) == (OS_FLAGS)0) ? OS_TRUE : OS_FALSE;
+             break;
+#endif
+
+        case OS_FLAG_WAIT_SET_ALL:                          /* Watch the lowest bit still cleared       */
+             pix         = &pgrp->OSFlagIxSet;
+             flags_watch = (OS_FLAGS)(pnode->OSFlagNodeFlags & ~pgrp->OSFlagFlags);
+             single      = OS_TRUE;
+             break;
+
+        case OS_FLAG_WAIT_SET_ANY:
+        default:
+             pix         = &pgrp->OSFlagIxSet;
+             flags_watch = pnode->OSFlagNodeFlags;
+             single      = ((flags_watch & (OS_FLAGS)(flags_watch - 1u)) == (OS_FLAGS)0) ? OS_TRUE : OS_FALSE;
+             break;
+    }
+    if ((single      == OS_TRUE) &&                         /* Watch a single bit, see Note #1a & #1b   */
+        (flags_watch != (OS_FLAGS)0)) {
+        phead = &pix->OSFlagIxTbl[OS_FlagIxBit(flags_watch)];
+    } else {                                                /* Watch several bits, see Note #1c         */
+        phead                  = &pix->OSFlagIxAnyList;
+        pix->OSFlagIxAnyFlags |= pnode->OSFlagNodeFlags;
+    }
+    pnode_next              = (OS_FLAG_NODE *)*phead;       /* Add node at beginning of the index list  */
+    pnode->OSFlagNodeIxNext = (void *)pnode_next;
+    pnode->OSFlagNodeIxPrev = (void *)0;
+    pnode->OSFlagNodeIxHead = phead;
+    if (pnode_next != (OS_FLAG_NODE *)0) {
+        pnode_next->OSFlagNodeIxPrev = (void *)pnode;
+    }
+    *phead = (void *)pnode;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 UNLINK EVENT FLAG NODE FROM WAIT INDEX
+*
+* Description: This function is internal to uC/OS-II and is used to remove an event flag node from the
+*              index of the tasks waiting on its event flag group.
+*
+* Arguments  : pnode         is a pointer to the event flag node.
+*
+* Returns    : none
+*
+* Called by  : OS_FlagUnlink()   OS_FLAG.C
+*              OS_FlagIxRdy()    OS_FLAG.C
+*
+* Note(s)    : 1) 'OSFlagIxAnyFlags' is left unchanged when a node leaves the list of the nodes waiting for
+*                 ANY of several bits : the union may hold bits no longer waited for until the list is
+*                 checked again, which only costs a check of the list.
+*
+*              2) This function assumes that interrupts are disabled.
+*
+*              3) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_WAIT_IX_EN > 0u
+static  void  OS_FlagIxUnlink (OS_FLAG_NODE  *pnode)
+{
+    OS_FLAG_NODE  *pnode_prev;
+    OS_FLAG_NODE  *pnode_next;
+
+
+    pnode_prev = (OS_FLAG_NODE *)pnode->OSFlagNodeIxPrev;
+    pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeIxNext;
+    if (pnode_prev == (OS_FLAG_NODE *)0) {                  /* Is it first node in index list?          */
+        *pnode->OSFlagNodeIxHead = (void *)pnode_next;
+    } else {
+        pnode_prev->OSFlagNodeIxNext = (void *)pnode_next;
+    }
+    if (pnode_next != (OS_FLAG_NODE *)0) {
+        pnode_next->OSFlagNodeIxPrev = (void *)pnode_prev;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                              READY TASKS WATCHING CHANGED EVENT FLAGS
+*
+* Description: This function is internal to uC/OS-II and is used to check the nodes of a wait index that
+*              watch event flags which changed to the state desired by the index.
+*
+* Arguments  : pgrp          is a pointer to the event flag group.
+*
+*              pix           is a pointer to the index to check, 'OSFlagIxSet' or 'OSFlagIxClr'.
+*
+*              flags_chg     are the bits that changed to the desired state (set or cleared).
+*
+*              flags_cur     are the bits now in the desired state.
+*
+* Returns    : OS_TRUE       If a task has been placed in the ready list and thus needs scheduling
+*              OS_FALSE      If no task needs scheduling
+*
+* Called by  : OS_FlagIxPost()   OS_FLAG.C
+*
+* Note(s)    : 1) Nodes of the bit lists which condition is met are readied, the others are moved to the
+*                 list of their next missing bit (see OS_FlagIxLink()).  This bit is not in 'flags_chg'
+*                 so a node is never checked twice.
+*
+*              2) The union of the bits waited for by the nodes left in the ANY list is computed again
+*                 while the list is checked.
+*
+*              3) This function assumes that interrupts are disabled.
+*
+*              4) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_WAIT_IX_EN > 0u
+static  BOOLEAN  OS_FlagIxRdy (OS_FLAG_GRP  *pgrp,
+                               OS_FLAG_IX   *pix,
+                               OS_FLAGS      flags_chg,
+                               OS_FLAGS      flags_cur)
+{
+    OS_FLAG_NODE  *pnode;
+    OS_FLAG_NODE  *pnode_next;
+    OS_FLAGS       flags_any;
+    OS_FLAGS       flags_rdy;
+    BOOLEAN        rdy;
+    BOOLEAN        sched;
+    INT8U          bit;
+
+
+    sched     = OS_FALSE;
+    flags_any = (OS_FLAGS)(pix->OSFlagIxAnyFlags & flags_chg);
+    if (flags_any != (OS_FLAGS)0) {                         /* Check nodes waiting for ANY of several   */
+        pix->OSFlagIxAnyFlags = (OS_FLAGS)0;                /* ... bits, see Note #2                    */
+        pnode                 = (OS_FLAG_NODE *)pix->OSFlagIxAnyList;
+        while (pnode != (OS_FLAG_NODE *)0) {
+            pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeIxNext;
+            flags_rdy  = (OS_FLAGS)(flags_cur & pnode->OSFlagNodeFlags);
+            if (flags_rdy != (OS_FLAGS)0) {                 /* Make task RTR, event(s) Rx'd             */
+                rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
+                if (rdy == OS_TRUE) {
+                    sched = OS_TRUE;
+                }
+            } else {                                        /* Still waiting                            */
+                pix->OSFlagIxAnyFlags |= pnode->OSFlagNodeFlags;
+            }
+            pnode = pnode_next;
+        }
+    }
+    while (flags_chg != (OS_FLAGS)0) {                      /* Go through the nodes watching the bits   */
+        bit        = OS_FlagIxBit(flags_chg);
+        flags_chg &= (OS_FLAGS)~((OS_FLAGS)1u << bit);
+        pnode      = (OS_FLAG_NODE *)pix->OSFlagIxTbl[bit];
+        while (pnode != (OS_FLAG_NODE *)0) {
+            pnode_next = (OS_FLAG_NODE *)pnode->OSFlagNodeIxNext;
+            flags_rdy  = (OS_FLAGS)(flags_cur & pnode->OSFlagNodeFlags);
+            switch (pnode->OSFlagNodeWaitType) {
+                case OS_FLAG_WAIT_SET_ANY:
+#if OS_FLAG_WAIT_CLR_EN > 0u
+                case OS_FLAG_WAIT_CLR_ANY:
+#endif
+                     rdy = OS_TRUE;                         /* The only bit waited for changed          */
+                     break;
+
+                default:
+                     rdy = (flags_rdy == pnode->OSFlagNodeFlags) ? OS_TRUE : OS_FALSE;
+                     break;
+            }
+            if (rdy == OS_TRUE) {                           /* Make task RTR, event(s) Rx'd             */
+                rdy = OS_FlagTaskRdy(pnode, flags_rdy, OS_STAT_PEND_OK);
+                if (rdy == OS_TRUE) {
+                    sched = OS_TRUE;
+                }
+            } else {                                        /* Watch the next missing bit, see Note #1  */
+                OS_FlagIxUnlink(pnode);
+                OS_FlagIxLink(pgrp, pnode);
+            }
+            pnode = pnode_next;
+        }
+    }
+    return (sched);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                              READY TASKS AFTER A CHANGE OF EVENT FLAGS
+*
+* Description: This function is internal to uC/OS-II and is used to ready the tasks which condition has
+*              been met by a change of the event flags of a group.
+*
+* Arguments  : pgrp          is a pointer to the event flag group, which flags have already been changed.
+*
+*              flags_set     are the bits that have just been set.
+*
+*              flags_clr     are the bits that have just been cleared.
+*
+* Returns    : OS_TRUE       If a task has been placed in the ready list and thus needs scheduling
+*              OS_FALSE      If no task needs scheduling
+*
+* Called by  : OSFlagAccept()    OS_FLAG.C
+*              OSFlagPend()      OS_FLAG.C
+*              OSFlagPost()      OS_FLAG.C
+*
+* Note(s)    : 1) Only the nodes watching a changed bit are checked : the time spent depends on the number
+*                 of tasks waiting for the bits that changed, not on the number of tasks waiting on the
+*                 group.
+*
+*              2) This function must be called every time the flags change, including when flags are
+*                 consumed by OSFlagAccept() or OSFlagPend(), since no other node is ever checked.
+*
+*              3) This function assumes that interrupts are disabled.
+*
+*              4) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_FLAG_WAIT_IX_EN > 0u
+static  BOOLEAN  OS_FlagIxPost (OS_FLAG_GRP  *pgrp,
+                                OS_FLAGS      flags_set,
+                                OS_FLAGS      flags_clr)
+{
+    BOOLEAN  sched;
+
+
+    sched = OS_FALSE;
+    if (flags_set != (OS_FLAGS)0) {
+        sched = OS_FlagIxRdy(pgrp, &pgrp->OSFlagIxSet, flags_set, pgrp->OSFlagFlags);
+    }
+#if OS_FLAG_WAIT_CLR_EN > 0u
+    if (flags_clr != (OS_FLAGS)0) {
+        if (OS_FlagIxRdy(pgrp, &pgrp->OSFlagIxClr, flags_clr, (OS_FLAGS)~pgrp->OSFlagFlags) == OS_TRUE) {
+            sched = OS_TRUE;
+        }
+    }
+#else
+    (void)flags_clr;
+#endif
+    return (sched);
+}
+#endif
 #endif
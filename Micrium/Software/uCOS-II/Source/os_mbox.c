@@ -235,6 +235,9 @@ OS_EVENT  *OSMboxDel (OS_EVENT  *pevent,
              if (tasks_waiting == OS_FALSE) {
 #if OS_EVENT_NAME_EN > 0u
                  pevent->OSEventName = (INT8U *)(void *)"?";
+#endif
+#if (OS_EVENT_SET_EN > 0u)
+                 OS_EventSetUnlink(pevent);                /* Remove event from its event set, if any  */
 #endif
                  pevent->OSEventType = OS_EVENT_TYPE_UNUSED;
                  pevent->OSEventPtr  = OSEventFreeList;    /* Return Event Control Block to free list  */
@@ -256,6 +259,9 @@ OS_EVENT  *OSMboxDel (OS_EVENT  *pevent,
              }
 #if OS_EVENT_NAME_EN > 0u
              pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+#if (OS_EVENT_SET_EN > 0u)
+             OS_EventSetUnlink(pevent);                    /* Remove event from its event set, if any  */
 #endif
              pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
              pevent->OSEventPtr     = OSEventFreeList;     /* Return Event Control Block to free list  */
@@ -558,6 +564,9 @@ INT8U  OSMboxPost (OS_EVENT  *pevent,
     }
     pevent->OSEventPtr = pmsg;                        /* Place message in mailbox                      */
     OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+    OS_EventSetSignal(pevent);                        /* Signal the event set of the mailbox, if any   */
+#endif
     OS_TRACE_MBOX_POST_EXIT(OS_ERR_NONE);
     return (OS_ERR_NONE);
 }
@@ -645,6 +654,9 @@ INT8U  OSMboxPostOpt (OS_EVENT  *pevent,
     }
     pevent->OSEventPtr = pmsg;                        /* Place message in mailbox                      */
     OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+    OS_EventSetSignal(pevent);                        /* Signal the event set of the mailbox, if any   */
+#endif
     OS_TRACE_MBOX_POST_OPT_EXIT(OS_ERR_NONE);
     return (OS_ERR_NONE);
 }
@@ -37,6 +37,18 @@
 #endif
 
 #if (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
+/*
+*********************************************************************************************************
+*                                          LOCAL PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if OS_MEM_SLAB_EN > 0u
+static  INT8U   OS_MemSlabClass(INT32U size);
+static  INT32U  OS_MemSlabClassSize(INT8U ix);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      CREATE A MEMORY PARTITION
@@ -440,6 +452,520 @@ INT8U  OSMemQuery (OS_MEM       *pmem,
 #endif                                           /* OS_MEM_QUERY_EN                                    */
 
 
+/*
+*********************************************************************************************************
+*                                      CREATE A SLAB ALLOCATOR
+*
+* Description : Initialize a slab allocator, i.e. a set of memory partitions of increasing block sizes
+*               from which blocks of any size up to 2^OS_MEM_SLAB_SHIFT_MAX bytes are allocated.
+*
+* Arguments   : pslab    is a pointer to the slab allocator to initialize.  Its storage is provided by the
+*                        application.
+*
+*               opt      OS_MEM_SLAB_OPT_NONE      to serve a request from its class only
+*                        OS_MEM_SLAB_OPT_FALLBACK  to try the next larger classes when the class of a
+*                                                  request has no free block left
+*
+*               perr     is a pointer to a variable containing an error message which will be set by
+*                        this function to either:
+*
+*                        OS_ERR_NONE               if the slab allocator has been initialized
+*                        OS_ERR_MEM_INVALID_PMEM   if you passed a NULL pointer for 'pslab'
+*                        OS_ERR_INVALID_OPT        if you specified an invalid option
+*
+* Returns     : none
+*
+* Notes       : 1) The sizes are split in OS_MEM_SLAB_CLASS_NBR classes:
+*
+*                     Class 0                  2^OS_MEM_SLAB_SHIFT_MIN bytes and less
+*                     Next classes             2^OS_MEM_SLAB_SUB_BITS classes per power of two, i.e. with
+*                                              OS_MEM_SLAB_SUB_BITS set to 2 and 2^5 bytes as class 0:
+*                                              40, 48, 56, 64, 80, 96, 112, 128, 160 ... bytes (x1.25,
+*                                              x1.5, x1.75 & x2 of the previous power of two).  With
+*                                              OS_MEM_SLAB_SUB_BITS set to 0, one class per power of two.
+*
+*                  The class of a size is found in constant time from the position of the highest bit of
+*                  the size.  A request wastes at most 20% of its block (x1.25 classes) or 50% (x2 classes).
+*
+*               2) Classes are given a partition with OSMemSlabAdd().  A request is served by the smallest
+*                  class, at or above its own, that has a partition; classes the application has no use
+*                  for thus cost nothing.
+*********************************************************************************************************
+*/
+
+#if OS_MEM_SLAB_EN > 0u
+void  OSMemSlabCreate (OS_MEM_SLAB  *pslab,
+                       INT8U         opt,
+                       INT8U        *perr)
+{
+    OS_MEM_SLAB_CLASS  *pclass;
+    INT8U               ix;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pslab == (OS_MEM_SLAB *)0) {                  /* Must point to a valid slab allocator          */
+        *perr = OS_ERR_MEM_INVALID_PMEM;
+        return;
+    }
+    if ((opt & ~OS_MEM_SLAB_OPT_FALLBACK) != 0u) {    /* Validate option                               */
+        *perr = OS_ERR_INVALID_OPT;
+        return;
+    }
+#endif
+    for (ix = 0u; ix < OS_MEM_SLAB_CLASS_NBR; ix++) {
+        pclass                     = &pslab->OSMemSlabClassTbl[ix];
+        pclass->OSMemSlabPart      = (OS_MEM *)0;     /* No partition yet                              */
+        pclass->OSMemSlabNUsedMax  = 0u;
+        pclass->OSMemSlabNGet      = 0u;
+        pclass->OSMemSlabNFallback = 0u;
+        pclass->OSMemSlabNFail     = 0u;
+        pclass->OSMemSlabNext      = OS_MEM_SLAB_CLASS_NONE;
+    }
+    pslab->OSMemSlabOpt = opt;
+    *perr               = OS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                  ADD A PARTITION TO A SLAB ALLOCATOR
+*
+* Description : Create a memory partition for the class of a block size & add it to a slab allocator.
+*
+* Arguments   : pslab    is a pointer to the slab allocator.
+*
+*               addr     is the starting address of the storage of the partition.
+*
+*               size     is the size (in bytes) of the storage of the partition.
+*
+*               blksize  is the size (in bytes) of the blocks wanted.  It is rounded up to the size of its
+*                        class (see OSMemSlabBlkSize()), and the partition holds as many such blocks as
+*                        fit in 'size' bytes.
+*
+*               perr     is a pointer to a variable containing an error message which will be set by
+*                        this function to either:
+*
+*                        OS_ERR_NONE               if the partition has been created & added
+*                        OS_ERR_MEM_INVALID_PMEM   if you passed a NULL pointer for 'pslab'
+*                        OS_ERR_MEM_INVALID_SIZE   if 'blksize' is 0 or larger than the largest class, or
+*                                                  its class already has a partition
+*                        any error of OSMemCreate() otherwise
+*
+* Returns     : != (OS_MEM *)0  is the partition created
+*               == (OS_MEM *)0  if no partition was created
+*
+* Notes       : 1) A partition is taken from the OS_MAX_MEM_PART partitions of uC/OS-II for every class
+*                  added.  There is no way to remove a class, as partitions cannot be deleted.
+*********************************************************************************************************
+*/
+
+OS_MEM  *OSMemSlabAdd (OS_MEM_SLAB  *pslab,
+                       void         *addr,
+                       INT32U        size,
+                       INT32U        blksize,
+                       INT8U        *perr)
+{
+    OS_MEM     *pmem;
+    INT8U       ix;
+    INT8U       i;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_MEM *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pslab == (OS_MEM_SLAB *)0) {                  /* Must point to a valid slab allocator          */
+        *perr = OS_ERR_MEM_INVALID_PMEM;
+        return ((OS_MEM *)0);
+    }
+#endif
+    if ((blksize == 0u) ||                            /* Block size must fall in a class               */
+        (blksize > ((INT32U)1u << OS_MEM_SLAB_SHIFT_MAX))) {
+        *perr = OS_ERR_MEM_INVALID_SIZE;
+        return ((OS_MEM *)0);
+    }
+    ix = OS_MemSlabClass(blksize);
+    if (pslab->OSMemSlabClassTbl[ix].OSMemSlabPart != (OS_MEM *)0) {
+        *perr = OS_ERR_MEM_INVALID_SIZE;              /* Class already has a partition                 */
+        return ((OS_MEM *)0);
+    }
+    blksize = OS_MemSlabClassSize(ix);
+    pmem    = OSMemCreate(addr, size / blksize, blksize, perr);
+    if (pmem == (OS_MEM *)0) {
+        return ((OS_MEM *)0);
+    }
+    OS_ENTER_CRITICAL();
+    pslab->OSMemSlabClassTbl[ix].OSMemSlabPart = pmem;
+    i = ix + 1u;
+    while (i > 0u) {                                  /* Smaller classes without partition map to 'ix' */
+        i--;
+        if (pslab->OSMemSlabClassTbl[i].OSMemSlabNext < ix) {
+            break;                                    /* ... up to the next class with a partition     */
+        }
+        pslab->OSMemSlabClassTbl[i].OSMemSlabNext = ix;
+    }
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (pmem);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   GET THE BLOCK SIZE OF A SIZE CLASS
+*
+* Description : Get the size of the blocks of the class a size falls in, e.g. to size the storage given
+*               to OSMemSlabAdd().
+*
+* Arguments   : size     is a size (in bytes).
+*
+* Returns     : The block size (in bytes) of the class of 'size', or 0 if 'size' is 0 or larger than the
+*               largest class.
+*********************************************************************************************************
+*/
+
+INT32U  OSMemSlabBlkSize (INT32U  size)
+{
+    if ((size == 0u) ||
+        (size > ((INT32U)1u << OS_MEM_SLAB_SHIFT_MAX))) {
+        return (0u);
+    }
+    return (OS_MemSlabClassSize(OS_MemSlabClass(size)));
+}
+
+
+/*
+*********************************************************************************************************
+*                                  GET A BLOCK FROM A SLAB ALLOCATOR
+*
+* Description : Get a memory block of at least 'size' bytes from a slab allocator.
+*
+* Arguments   : pslab    is a pointer to the slab allocator.
+*
+*               size     is the number of bytes needed.
+*
+*               perr     is a pointer to a variable containing an error message which will be set by this
+*                        function to either:
+*
+*                        OS_ERR_NONE               if a block was allocated
+*                        OS_ERR_MEM_NO_FREE_BLKS   if no class that may serve 'size' has a free block
+*                        OS_ERR_MEM_INVALID_PMEM   if you passed a NULL pointer for 'pslab'
+*                        OS_ERR_MEM_INVALID_SIZE   if 'size' is 0 or larger than the largest class
+*
+* Returns     : A pointer to a memory block if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Notes       : 1) The block comes from the smallest class, at or above the class of 'size', that has a
+*                  partition (see OSMemSlabCreate() Note #2).  If that partition is empty & the
+*                  allocator was created with OS_MEM_SLAB_OPT_FALLBACK, the next classes with a partition
+*                  are tried in increasing size.  Without fallback the time taken does not depend on the
+*                  size or on the state of the allocator.
+*              2) The statistics are kept in the class of 'size'; the high-water mark is kept in the
+*                 class that served the request.
+*********************************************************************************************************
+*/
+
+void  *OSMemSlabGet (OS_MEM_SLAB  *pslab,
+                     INT32U        size,
+                     INT8U        *perr)
+{
+    OS_MEM_SLAB_CLASS  *pclass;
+    OS_MEM_SLAB_CLASS  *pclass_srv;
+    OS_MEM             *pmem;
+    void               *pblk;
+    INT32U              nused;
+    INT8U               ix;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR           cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pslab == (OS_MEM_SLAB *)0) {                  /* Must point to a valid slab allocator          */
+        *perr = OS_ERR_MEM_INVALID_PMEM;
+        return ((void *)0);
+    }
+#endif
+    if ((size == 0u) ||                               /* Size must fall in a class                     */
+        (size > ((INT32U)1u << OS_MEM_SLAB_SHIFT_MAX))) {
+        *perr = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+    pclass = &pslab->OSMemSlabClassTbl[OS_MemSlabClass(size)];
+    pblk   = (void *)0;
+    OS_ENTER_CRITICAL();
+    ix     = pclass->OSMemSlabNext;                   /* Smallest class that may serve the request     */
+    while (ix != OS_MEM_SLAB_CLASS_NONE) {
+        pclass_srv = &pslab->OSMemSlabClassTbl[ix];
+        pmem       = pclass_srv->OSMemSlabPart;
+        if (pmem->OSMemNFree > 0u) {                  /* Take a block, as OSMemGet() does              */
+            pblk                = pmem->OSMemFreeList;
+            pmem->OSMemFreeList = *(void **)pblk;
+            pmem->OSMemNFree--;
+            nused = pmem->OSMemNBlks - pmem->OSMemNFree;
+            if (nused > pclass_srv->OSMemSlabNUsedMax) {
+                pclass_srv->OSMemSlabNUsedMax = nused;
+            }
+            if (ix != pclass->OSMemSlabNext) {
+                pclass->OSMemSlabNFallback++;
+            }
+            pclass->OSMemSlabNGet++;
+            break;
+        }
+        if (((pslab->OSMemSlabOpt & OS_MEM_SLAB_OPT_FALLBACK) == 0u) ||
+            ((ix + 1u) >= OS_MEM_SLAB_CLASS_NBR)) {   /* See Note #1                                   */
+            break;
+        }
+        ix = pslab->OSMemSlabClassTbl[ix + 1u].OSMemSlabNext;
+    }
+    if (pblk == (void *)0) {
+        pclass->OSMemSlabNFail++;
+        OS_EXIT_CRITICAL();
+        *perr = OS_ERR_MEM_NO_FREE_BLKS;
+        return ((void *)0);
+    }
+    OS_EXIT_CRITICAL();
+    *perr = OS_ERR_NONE;
+    return (pblk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                RELEASE A BLOCK TO A SLAB ALLOCATOR
+*
+* Description : Returns a memory block obtained from OSMemSlabGet() to the partition it came from.
+*
+* Arguments   : pslab    is a pointer to the slab allocator.
+*
+*               pblk     is a pointer to the memory block being released.
+*
+* Returns     : OS_ERR_NONE              if the memory block was returned
+*               OS_ERR_MEM_INVALID_PMEM  if you passed a NULL pointer for 'pslab'
+*               OS_ERR_MEM_INVALID_PBLK  if 'pblk' is not a block of any partition of the allocator
+*               OS_ERR_MEM_FULL          if the partition is already full (see OSMemPut())
+*
+* Notes       : 1) The partition is found from the address of the block, so the caller does not need to
+*                  remember the size it asked for or which class served it.  At most one address test
+*                  is done per class that has a partition.
+*********************************************************************************************************
+*/
+
+INT8U  OSMemSlabPut (OS_MEM_SLAB  *pslab,
+                     void         *pblk)
+{
+    OS_MEM     *pmem;
+    INT8U      *paddr;
+    INT8U       ix;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR   cpu_sr = 0u;
+#endif
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pslab == (OS_MEM_SLAB *)0) {                  /* Must point to a valid slab allocator          */
+        return (OS_ERR_MEM_INVALID_PMEM);
+    }
+    if (pblk == (void *)0) {                          /* Must release a valid block                    */
+        return (OS_ERR_MEM_INVALID_PBLK);
+    }
+#endif
+    pmem  = (OS_MEM *)0;
+    paddr = (INT8U *)0;
+    OS_ENTER_CRITICAL();
+    ix    = pslab->OSMemSlabClassTbl[0].OSMemSlabNext;
+    while (ix != OS_MEM_SLAB_CLASS_NONE) {            /* See Note #1                                   */
+        pmem  = pslab->OSMemSlabClassTbl[ix].OSMemSlabPart;
+        paddr = (INT8U *)pmem->OSMemAddr;
+        if (((INT8U *)pblk >= paddr) &&
+            ((INT8U *)pblk <  paddr + (pmem->OSMemNBlks * pmem->OSMemBlkSize))) {
+            break;
+        }
+        pmem = (OS_MEM *)0;
+        ix   = ((ix + 1u) < OS_MEM_SLAB_CLASS_NBR) ? pslab->OSMemSlabClassTbl[ix + 1u].OSMemSlabNext
+                                                   : OS_MEM_SLAB_CLASS_NONE;
+    }
+    OS_EXIT_CRITICAL();
+    if (pmem == (OS_MEM *)0) {
+        return (OS_ERR_MEM_INVALID_PBLK);
+    }
+    if (((INT32U)((INT8U *)pblk - paddr) % pmem->OSMemBlkSize) != 0u) {
+        return (OS_ERR_MEM_INVALID_PBLK);             /* Must point to the start of a block            */
+    }
+    return (OSMemPut(pmem, pblk));
+}
+
+
+/*
+*********************************************************************************************************
+*                                     QUERY A SLAB ALLOCATOR CLASS
+*
+* Description : This function is used to obtain the usage & the statistics of one class of a slab
+*               allocator.
+*
+* Arguments   : pslab        is a pointer to the slab allocator.
+*
+*               ix           is the index of the class, 0 to OS_MEM_SLAB_CLASS_NBR - 1.
+*
+*               p_slab_data  is a pointer to a structure that will contain information about the class.
+*
+* Returns     : OS_ERR_NONE               if no errors were found.
+*               OS_ERR_MEM_INVALID_PMEM   if you passed a NULL pointer for 'pslab'
+*               OS_ERR_MEM_INVALID_PDATA  if you passed a NULL pointer to the data recipient.
+*               OS_ERR_MEM_INVALID_PART   if 'ix' is not a valid class index
+*********************************************************************************************************
+*/
+
+#if OS_MEM_QUERY_EN > 0u
+INT8U  OSMemSlabQuery (OS_MEM_SLAB       *pslab,
+                       INT8U              ix,
+                       OS_MEM_SLAB_DATA  *p_slab_data)
+{
+    OS_MEM_SLAB_CLASS  *pclass;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR           cpu_sr = 0u;
+#endif
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pslab == (OS_MEM_SLAB *)0) {                  /* Must point to a valid slab allocator          */
+        return (OS_ERR_MEM_INVALID_PMEM);
+    }
+    if (p_slab_data == (OS_MEM_SLAB_DATA *)0) {       /* Must release a valid storage area for the data*/
+        return (OS_ERR_MEM_INVALID_PDATA);
+    }
+#endif
+    if (ix >= OS_MEM_SLAB_CLASS_NBR) {
+        return (OS_ERR_MEM_INVALID_PART);
+    }
+    pclass                   = &pslab->OSMemSlabClassTbl[ix];
+    p_slab_data->OSBlkSize   = OS_MemSlabClassSize(ix);
+    p_slab_data->OSNBlks     = 0u;
+    p_slab_data->OSNFree     = 0u;
+    OS_ENTER_CRITICAL();
+    if (pclass->OSMemSlabPart != (OS_MEM *)0) {
+        p_slab_data->OSNBlks = pclass->OSMemSlabPart->OSMemNBlks;
+        p_slab_data->OSNFree = pclass->OSMemSlabPart->OSMemNFree;
+    }
+    p_slab_data->OSNUsedMax  = pclass->OSMemSlabNUsedMax;
+    p_slab_data->OSNGet      = pclass->OSMemSlabNGet;
+    p_slab_data->OSNFallback = pclass->OSMemSlabNFallback;
+    p_slab_data->OSNFail     = pclass->OSMemSlabNFail;
+    OS_EXIT_CRITICAL();
+    p_slab_data->OSNUsed     = p_slab_data->OSNBlks - p_slab_data->OSNFree;
+    return (OS_ERR_NONE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     FIND THE CLASS OF A SIZE
+*
+* Description : This function returns the index of the size class of a slab allocator a size falls in.
+*
+* Arguments   : size     is the size (in bytes), 1 to 2^OS_MEM_SLAB_SHIFT_MAX.
+*
+* Returns     : The index of the class, 0 to OS_MEM_SLAB_CLASS_NBR - 1.
+*
+* Notes       : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*              2) The highest bit of 'size - 1' is found with a fixed number of tests (binary search) so
+*                 that the time taken does not depend on the size.  The OS_MEM_SLAB_SUB_BITS bits below
+*                 it give the class within that power of two.
+*********************************************************************************************************
+*/
+
+static  INT8U  OS_MemSlabClass (INT32U  size)
+{
+    INT32U  n;
+    INT8U   msb;
+
+
+    if (size <= ((INT32U)1u << OS_MEM_SLAB_SHIFT_MIN)) {
+        return (0u);
+    }
+    size--;
+    n   = size;
+    msb = 0u;                                         /* See Note #2                                   */
+    if (n >= 0x10000u) {
+        n   >>= 16u;
+        msb  += 16u;
+    }
+    if (n >= 0x100u) {
+        n   >>= 8u;
+        msb  += 8u;
+    }
+    if (n >= 0x10u) {
+        n   >>= 4u;
+        msb  += 4u;
+    }
+    if (n >= 0x4u) {
+        n   >>= 2u;
+        msb  += 2u;
+    }
+    if (n >= 0x2u) {
+        msb  += 1u;
+    }
+    return ((INT8U)(((INT32U)(msb - OS_MEM_SLAB_SHIFT_MIN) << OS_MEM_SLAB_SUB_BITS) +
+                    ((size >> (msb - OS_MEM_SLAB_SUB_BITS)) & ((1u << OS_MEM_SLAB_SUB_BITS) - 1u)) + 1u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                     GET THE SIZE OF A CLASS
+*
+* Description : This function returns the block size of a size class of a slab allocator.
+*
+* Arguments   : ix       is the index of the class, 0 to OS_MEM_SLAB_CLASS_NBR - 1.
+*
+* Returns     : The largest size (in bytes) that falls in the class, rounded up to a multiple of the size
+*               of a pointer as OSMemCreate() links the free blocks through their first word.
+*
+* Notes       : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+static  INT32U  OS_MemSlabClassSize (INT8U  ix)
+{
+    INT32U  size;
+    INT8U   shift;
+
+
+    if (ix == 0u) {
+        size  = (INT32U)1u << OS_MEM_SLAB_SHIFT_MIN;
+    } else {
+        ix--;
+        shift = (INT8U)(OS_MEM_SLAB_SHIFT_MIN + (ix >> OS_MEM_SLAB_SUB_BITS));
+        size  = ((INT32U)1u << shift) +
+                ((INT32U)((ix & ((1u << OS_MEM_SLAB_SUB_BITS) - 1u)) + 1u) << (shift - OS_MEM_SLAB_SUB_BITS));
+    }
+    return ((size + (sizeof(void *) - 1u)) & ~(INT32U)(sizeof(void *) - 1u));
+}
+#endif                                                /* OS_MEM_SLAB_EN                                */
+
+
 /*
 *********************************************************************************************************
 *                                 INITIALIZE MEMORY PARTITION MANAGER
@@ -301,6 +301,9 @@ OS_EVENT  *OSQDel (OS_EVENT  *pevent,
                  pq                     = (OS_Q *)pevent->OSEventPtr;  /* Return OS_Q to free list     */
                  pq->OSQPtr             = OSQFreeList;
                  OSQFreeList            = pq;
+#if (OS_EVENT_SET_EN > 0u)
+                 OS_EventSetUnlink(pevent);                /* Remove event from its event set, if any  */
+#endif
                  pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
                  pevent->OSEventPtr     = OSEventFreeList; /* Return Event Control Block to free list  */
                  pevent->OSEventCnt     = 0u;
@@ -325,6 +328,9 @@ OS_EVENT  *OSQDel (OS_EVENT  *pevent,
              pq                     = (OS_Q *)pevent->OSEventPtr;   /* Return OS_Q to free list        */
              pq->OSQPtr             = OSQFreeList;
              OSQFreeList            = pq;
+#if (OS_EVENT_SET_EN > 0u)
+             OS_EventSetUnlink(pevent);                    /* Remove event from its event set, if any  */
+#endif
              pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
              pevent->OSEventPtr     = OSEventFreeList;     /* Return Event Control Block to free list  */
              pevent->OSEventCnt     = 0u;
@@ -619,6 +625,141 @@ INT8U  OSQPendAbort (OS_EVENT  *pevent,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  EXTRACT MESSAGES FROM A QUEUE
+*
+* Description: This function moves up to 'n' of the oldest messages of a queue to a table.
+*
+* Arguments  : pq            is a pointer to the queue control block.
+*
+*              pmsg_tbl      is a pointer to the table that receives the messages.
+*
+*              n             is the number of entries of 'pmsg_tbl'.
+*
+* Returns    : The number of messages extracted.
+*
+* Note(s)    : This function is INTERNAL to uC/OS-II and your application should not call it.  It must be
+*              called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+#if OS_Q_PEND_N_EN > 0u
+static  INT16U  OS_QGetN (OS_Q    *pq,
+                          void   **pmsg_tbl,
+                          INT16U   n)
+{
+    INT16U  nbr;
+
+
+    nbr = 0u;
+    while ((nbr < n) && (pq->OSQEntries > 0u)) {
+        pmsg_tbl[nbr++] = *pq->OSQOut++;         /* Extract oldest message from the queue              */
+        pq->OSQEntries--;
+        if (pq->OSQOut == pq->OSQEnd) {          /* Wrap OUT pointer if we are at the end of the queue */
+            pq->OSQOut = pq->OSQStart;
+        }
+    }
+    return (nbr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                PEND ON A QUEUE FOR SEVERAL MESSAGES
+*
+* Description: This function waits for messages to be sent to a queue and returns up to 'n' of them at
+*              once.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              pmsg_tbl      is a pointer to a table where the messages received will be deposited, oldest
+*                            first.
+*
+*              n             is the number of entries of 'pmsg_tbl' (must be > 0).
+*
+*              timeout       is an optional timeout period (in clock ticks), 0 to wait forever (see
+*                            OSQPend()).
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are those of OSQPend() and:
+*
+*                            OS_ERR_PDATA_NULL   If 'pmsg_tbl' is a NULL pointer or 'n' is 0.
+*
+* Returns    : The number of messages received (0 if an error occurred).
+*
+* Note(s)    : 1) If the queue holds messages, they are all taken, up to 'n', in a single critical section
+*                 and the task does not pend.
+*
+*              2) Otherwise the task pends as with OSQPend() for the first message, then takes the messages
+*                 posted meanwhile, up to 'n' in total.
+*********************************************************************************************************
+*/
+
+#if OS_Q_PEND_N_EN > 0u
+INT16U  OSQPendN (OS_EVENT  *pevent,
+                  void     **pmsg_tbl,
+                  INT16U     n,
+                  INT32U     timeout,
+                  INT8U     *perr)
+{
+    INT16U     nbr;
+    OS_Q      *pq;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {               /* Validate 'pevent'                                  */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+    if ((pmsg_tbl == (void **)0) || (n == 0u)) { /* Validate 'pmsg_tbl'                                */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_Q) {/* Validate event block type                          */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (0u);
+    }
+    if (OSIntNesting > 0u) {                     /* See if called from ISR ...                         */
+        *perr = OS_ERR_PEND_ISR;                 /* ... can't PEND from an ISR                         */
+        return (0u);
+    }
+    if (OSLockNesting > 0u) {                    /* See if called with scheduler locked ...            */
+        *perr = OS_ERR_PEND_LOCKED;              /* ... can't PEND when locked                         */
+        return (0u);
+    }
+    pq = (OS_Q *)pevent->OSEventPtr;             /* Point at queue control block                       */
+    OS_ENTER_CRITICAL();
+    nbr = OS_QGetN(pq, pmsg_tbl, n);             /* See Note #1                                        */
+    OS_EXIT_CRITICAL();
+    if (nbr > 0u) {
+        *perr = OS_ERR_NONE;
+        return (nbr);
+    }
+    pmsg_tbl[0] = OSQPend(pevent, timeout, perr);/* See Note #2                                        */
+    if (*perr != OS_ERR_NONE) {
+        return (0u);
+    }
+    OS_ENTER_CRITICAL();
+    nbr = OS_QGetN(pq, &pmsg_tbl[1], n - 1u) + 1u;
+    OS_EXIT_CRITICAL();
+    return (nbr);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       POST MESSAGE TO A QUEUE
@@ -681,6 +822,9 @@ INT8U  OSQPost (OS_EVENT  *pevent,
         pq->OSQIn = pq->OSQStart;
     }
     OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+    OS_EventSetSignal(pevent);                         /* Signal the event set of the queue, if any     */
+#endif
     OS_TRACE_Q_POST_EXIT(OS_ERR_NONE);
 
     return (OS_ERR_NONE);
@@ -688,6 +832,109 @@ INT8U  OSQPost (OS_EVENT  *pevent,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  POST SEVERAL MESSAGES TO A QUEUE
+*
+* Description: This function sends 'n' messages to a queue in a single critical section, with at most one
+*              call to the scheduler.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              pmsg_tbl      is a pointer to the table of messages to send, in order.
+*
+*              n             is the number of messages in 'pmsg_tbl'.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE           All the messages were sent.
+*                            OS_ERR_Q_FULL         The queue filled up, check the return value for the
+*                                                  number of messages sent.
+*                            OS_ERR_EVENT_TYPE     If you didn't pass a pointer to a queue.
+*                            OS_ERR_PEVENT_NULL    If 'pevent' is a NULL pointer.
+*                            OS_ERR_PDATA_NULL     If 'pmsg_tbl' is a NULL pointer.
+*
+* Returns    : The number of messages sent, the first ones of 'pmsg_tbl'.
+*
+* Note(s)    : 1) The result is the same as 'n' calls to OSQPost() made with the scheduler locked: the
+*                 messages go, in order, to the tasks waiting on the queue by decreasing priority, one
+*                 message per task, and the rest are queued in order until the queue is full.
+*
+*              2) Tasks are only waiting when the queue is empty, so no message is queued ahead of a
+*                 message handed to a task.
+*********************************************************************************************************
+*/
+
+#if OS_Q_POST_N_EN > 0u
+INT16U  OSQPostN (OS_EVENT  *pevent,
+                  void     **pmsg_tbl,
+                  INT16U     n,
+                  INT8U     *perr)
+{
+    OS_Q      *pq;
+    INT16U     nbr;
+    BOOLEAN    sched;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                     /* Validate 'pevent'                            */
+        *perr = OS_ERR_PEVENT_NULL;
+        return (0u);
+    }
+    if (pmsg_tbl == (void **)0) {                      /* Validate 'pmsg_tbl'                          */
+        *perr = OS_ERR_PDATA_NULL;
+        return (0u);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_Q) {      /* Validate event block type                    */
+        *perr = OS_ERR_EVENT_TYPE;
+        return (0u);
+    }
+    nbr   = 0u;
+    sched = OS_FALSE;
+    pq    = (OS_Q *)pevent->OSEventPtr;                /* Point to queue control block                 */
+    OS_ENTER_CRITICAL();
+    while ((nbr < n) && (pevent->OSEventGrp != 0u)) {  /* Ready waiting tasks by priority, see Note #1 */
+        (void)OS_EventTaskRdy(pevent, pmsg_tbl[nbr], OS_STAT_Q, OS_STAT_PEND_OK);
+        nbr++;
+        sched = OS_TRUE;
+    }
+    while ((nbr < n) && (pq->OSQEntries < pq->OSQSize)) {
+        *pq->OSQIn++ = pmsg_tbl[nbr];                  /* Insert message into queue, see Note #2       */
+        pq->OSQEntries++;
+        if (pq->OSQIn == pq->OSQEnd) {                 /* Wrap IN ptr if we are at end of queue        */
+            pq->OSQIn = pq->OSQStart;
+        }
+        nbr++;
+    }
+    OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+    OS_EventSetSignal(pevent);                         /* Signal the event set of the queue, if any     */
+#endif
+    if (sched == OS_TRUE) {
+        OS_Sched();                                    /* Find highest priority task ready to run      */
+    }
+    if (nbr < n) {
+        *perr = OS_ERR_Q_FULL;
+    } else {
+        *perr = OS_ERR_NONE;
+    }
+    return (nbr);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                POST MESSAGE TO THE FRONT OF A QUEUE
@@ -754,6 +1001,9 @@ INT8U  OSQPostFront (OS_EVENT  *pevent,
     *pq->OSQOut = pmsg;                               /* Insert message into queue                     */
     pq->OSQEntries++;                                 /* Update the nbr of entries in the queue        */
     OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+    OS_EventSetSignal(pevent);                        /* Signal the event set of the queue, if any     */
+#endif
     OS_TRACE_Q_POST_FRONT_EXIT(OS_ERR_NONE);
     return (OS_ERR_NONE);
 }
@@ -849,6 +1099,9 @@ INT8U  OSQPostOpt (OS_EVENT  *pevent,
     }
     pq->OSQEntries++;                                 /* Update the nbr of entries in the queue        */
     OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+    OS_EventSetSignal(pevent);                        /* Signal the event set of the queue, if any     */
+#endif
     OS_TRACE_Q_POST_OPT_EXIT(OS_ERR_NONE);
     return (OS_ERR_NONE);
 }
@@ -919,6 +1172,374 @@ INT8U  OSQQuery (OS_EVENT  *pevent,
 #endif                                                 /* OS_Q_QUERY_EN                                */
 
 
+/*
+*********************************************************************************************************
+*                                     GET A ZERO-COPY MESSAGE BUFFER
+*
+* Description: This function takes a block from a memory partition to be sent as a zero-copy message with
+*              OSQBufPost().  The block starts with a header (OS_Q_BUF) recording the partition, the task
+*              that owns the message, its length and a reference count; the pointer returned is just past
+*              the header.
+*
+* Arguments  : pmem          is a pointer to the memory partition control block.  The blocks of the
+*                            partition must be OS_Q_BUF_HDR_SIZE bytes larger than the largest message.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                            OS_ERR_NONE               A buffer was taken from the partition.
+*                            OS_ERR_MEM_INVALID_PMEM   If you passed a NULL pointer for 'pmem'.
+*                            OS_ERR_MEM_INVALID_SIZE   If the blocks of the partition have no room past the
+*                                                      header.
+*                            OS_ERR_MEM_NO_FREE_BLKS   If the partition has no free block.
+*
+* Returns    : A pointer to the message area of the buffer if no error is detected, (void *)0 otherwise.
+*
+* Note(s)    : 1) The caller owns the buffer, with one reference.  It is given to the pending task by
+*                 OSQBufPost() or returned to the partition by OSQBufRelease().
+*
+*              2) OS_Q_BUF_HDR_SIZE is a multiple of 8 so that the message keeps the alignment of the
+*                 block.
+*********************************************************************************************************
+*/
+
+#if OS_Q_BUF_EN > 0u
+void  *OSQBufGet (OS_MEM  *pmem,
+                  INT8U   *perr)
+{
+    OS_Q_BUF  *phdr;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (perr == (INT8U *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if OS_ARG_CHK_EN > 0u
+    if (pmem == (OS_MEM *)0) {                       /* Must point to a valid memory partition         */
+        *perr = OS_ERR_MEM_INVALID_PMEM;
+        return ((void *)0);
+    }
+#endif
+    if (pmem->OSMemBlkSize <= OS_Q_BUF_HDR_SIZE) {   /* Make sure there is room for a message          */
+        *perr = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+    phdr = (OS_Q_BUF *)OSMemGet(pmem, perr);
+    if (phdr == (OS_Q_BUF *)0) {
+        return ((void *)0);
+    }
+    phdr->OSQBufMemPtr   = pmem;
+    phdr->OSQBufLen      = 0u;
+    phdr->OSQBufRefCtr   = 1u;
+    if (OSIntNesting > 0u) {                         /* An ISR owns no buffer, it can only post it     */
+        phdr->OSQBufOwnerPtr = (OS_TCB *)0;
+    } else {
+        phdr->OSQBufOwnerPtr = OSTCBCur;
+    }
+    return ((void *)((INT8U *)phdr + OS_Q_BUF_HDR_SIZE));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 VALIDATE A ZERO-COPY MESSAGE BUFFER
+*
+* Description: This function returns the header of a buffer obtained from OSQBufGet().
+*
+* Arguments  : pbuf          is the pointer returned by OSQBufGet() or OSQBufPend().
+*
+* Returns    : A pointer to the header of the buffer, or (OS_Q_BUF *)0 if 'pbuf' is not the message area of
+*              a block of the partition recorded in the header or if the buffer is not referenced.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-II and your application should not call it.
+*
+*              2) The check is only done when OS_ARG_CHK_EN is set.  It catches buffers already released and
+*                 pointers into the middle of a buffer; it relies on the header, so it cannot detect every
+*                 pointer that never came from OSQBufGet().
+*********************************************************************************************************
+*/
+
+#if OS_Q_BUF_EN > 0u
+static  OS_Q_BUF  *OS_QBufHdr (void  *pbuf)
+{
+    OS_Q_BUF  *phdr;
+#if OS_ARG_CHK_EN > 0u
+    OS_MEM    *pmem;
+    INT32U     offset;
+#endif
+
+
+    if (pbuf == (void *)0) {
+        return ((OS_Q_BUF *)0);
+    }
+    phdr = (OS_Q_BUF *)((INT8U *)pbuf - OS_Q_BUF_HDR_SIZE);
+#if OS_ARG_CHK_EN > 0u
+    pmem = phdr->OSQBufMemPtr;
+    if (pmem == (OS_MEM *)0) {
+        return ((OS_Q_BUF *)0);
+    }
+    if ((INT8U *)phdr < (INT8U *)pmem->OSMemAddr) {  /* Must be the start of a block of the partition  */
+        return ((OS_Q_BUF *)0);
+    }
+    offset = (INT32U)((INT8U *)phdr - (INT8U *)pmem->OSMemAddr);
+    if ((offset >= pmem->OSMemBlkSize * pmem->OSMemNBlks) ||
+        ((offset % pmem->OSMemBlkSize) != 0u)) {
+        return ((OS_Q_BUF *)0);
+    }
+    if (phdr->OSQBufRefCtr == 0u) {                  /* Must not have been released                    */
+        return ((OS_Q_BUF *)0);
+    }
+#endif
+    return (phdr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                PEND FOR A ZERO-COPY MESSAGE ON A QUEUE
+*
+* Description: This function waits for a message posted with OSQBufPost() and takes ownership of it.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              timeout       is an optional timeout period (in clock ticks), 0 to wait forever (see
+*                            OSQPend()).
+*
+*              plen          is a pointer to where the length of the message will be deposited, or a NULL
+*                            pointer if you don't need it.
+*
+*              perr          is a pointer to where an error message will be deposited.  Possible error
+*                            messages are those of OSQPend() and:
+*
+*                            OS_ERR_Q_BUF_INVALID  If the message received is not a buffer from OSQBufGet().
+*
+* Returns    : A pointer to the message, (void *)0 if no message was received.
+*
+* Note(s)    : 1) The calling task owns the message and the reference it was posted with.  It must pass the
+*                 message on with OSQBufPost() or release it with OSQBufRelease(), nothing is copied.
+*
+*              2) A queue used for zero-copy messages must only be posted to with OSQBufPost().
+*********************************************************************************************************
+*/
+
+#if OS_Q_BUF_EN > 0u
+void  *OSQBufPend (OS_EVENT  *pevent,
+                   INT32U     timeout,
+                   INT32U    *plen,
+                   INT8U     *perr)
+{
+    void      *pbuf;
+    OS_Q_BUF  *phdr;
+#if OS_CRITICAL_METHOD == 3u                     /* Allocate storage for CPU status register           */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    if (plen != (INT32U *)0) {
+        *plen = 0u;
+    }
+    pbuf = OSQPend(pevent, timeout, perr);
+    if (*perr != OS_ERR_NONE) {
+        return ((void *)0);
+    }
+    phdr = OS_QBufHdr(pbuf);
+    if (phdr == (OS_Q_BUF *)0) {
+        *perr = OS_ERR_Q_BUF_INVALID;
+        return ((void *)0);
+    }
+    OS_ENTER_CRITICAL();
+    phdr->OSQBufOwnerPtr = OSTCBCur;             /* Ownership is transferred to the receiving task     */
+    OS_EXIT_CRITICAL();
+    if (plen != (INT32U *)0) {
+        *plen = phdr->OSQBufLen;
+    }
+    return (pbuf);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 POST A ZERO-COPY MESSAGE TO A QUEUE
+*
+* Description: This function sends a buffer obtained from OSQBufGet() or OSQBufPend() to a queue without
+*              copying it.  Ownership of the message goes with it.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired queue
+*
+*              pbuf          is the pointer returned by OSQBufGet() or OSQBufPend().
+*
+*              len           is the length of the message (in bytes).
+*
+* Returns    : OS_ERR_NONE             The call was successful and the message was sent.
+*              OS_ERR_Q_FULL           If the queue cannot accept any more messages because it is full.
+*              OS_ERR_EVENT_TYPE       If you didn't pass a pointer to a queue.
+*              OS_ERR_PEVENT_NULL      If 'pevent' is a NULL pointer.
+*              OS_ERR_Q_BUF_INVALID    If 'pbuf' is not a buffer from OSQBufGet().
+*              OS_ERR_Q_BUF_SIZE       If 'len' does not fit in the block.
+*              OS_ERR_Q_BUF_NOT_OWNER  If the calling task gave the buffer away already (see Note #1).
+*
+* Note(s)    : 1) A task may post a buffer it owns, or a buffer it holds one of several references to (see
+*                 OSQBufRetain()).  ISRs may post any buffer.
+*
+*              2) The buffer is marked as queued before it is posted, since the receiving task may run
+*                 before OSQPost() returns.  The caller owns the buffer again if the post fails.
+*********************************************************************************************************
+*/
+
+#if OS_Q_BUF_EN > 0u
+INT8U  OSQBufPost (OS_EVENT  *pevent,
+                   void      *pbuf,
+                   INT32U     len)
+{
+    OS_Q_BUF  *phdr;
+    OS_TCB    *powner;
+    INT8U      err;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    phdr = OS_QBufHdr(pbuf);
+    if (phdr == (OS_Q_BUF *)0) {
+        return (OS_ERR_Q_BUF_INVALID);
+    }
+    if (len > (phdr->OSQBufMemPtr->OSMemBlkSize - OS_Q_BUF_HDR_SIZE)) {
+        return (OS_ERR_Q_BUF_SIZE);
+    }
+    OS_ENTER_CRITICAL();
+    powner = phdr->OSQBufOwnerPtr;
+    if ((OSIntNesting        == 0u)       &&          /* See Note #1                                  */
+        (phdr->OSQBufRefCtr  == 1u)       &&
+        (powner              != OSTCBCur)) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_Q_BUF_NOT_OWNER);
+    }
+    phdr->OSQBufLen      = len;
+    phdr->OSQBufOwnerPtr = (OS_TCB *)0;                /* See Note #2                                  */
+    OS_EXIT_CRITICAL();
+    err = OSQPost(pevent, pbuf);
+    if (err != OS_ERR_NONE) {
+        OS_ENTER_CRITICAL();
+        phdr->OSQBufOwnerPtr = powner;
+        OS_EXIT_CRITICAL();
+    }
+    return (err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 RELEASE A ZERO-COPY MESSAGE BUFFER
+*
+* Description: This function drops a reference to a buffer; the block is returned to its partition when
+*              the last reference is dropped.
+*
+* Arguments  : pbuf          is the pointer returned by OSQBufGet() or OSQBufPend().
+*
+* Returns    : OS_ERR_NONE             The reference was dropped.
+*              OS_ERR_Q_BUF_INVALID    If 'pbuf' is not a buffer from OSQBufGet() or was already released.
+*              OS_ERR_Q_BUF_NOT_OWNER  If the calling task gave the buffer away already (see Note #2).
+*              OS_ERR_MEM_FULL         If the partition could not accept the block (see OSMemPut()).
+*
+* Note(s)    : 1) This function may be called from an ISR.
+*
+*              2) As for OSQBufPost(), a task may only drop the last reference to a buffer it owns.  A buffer
+*                 that was posted is owned by no task until it is pended on, so releasing it would return
+*                 a block to the partition while it is still in the queue.
+*********************************************************************************************************
+*/
+
+#if OS_Q_BUF_EN > 0u
+INT8U  OSQBufRelease (void  *pbuf)
+{
+    OS_Q_BUF  *phdr;
+    INT16U     ref_ctr;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    phdr = OS_QBufHdr(pbuf);
+    if (phdr == (OS_Q_BUF *)0) {
+        return (OS_ERR_Q_BUF_INVALID);
+    }
+    OS_ENTER_CRITICAL();
+    ref_ctr = phdr->OSQBufRefCtr;
+    if ((OSIntNesting          == 0u)       &&        /* See Note #2                                  */
+        (ref_ctr               == 1u)       &&
+        (phdr->OSQBufOwnerPtr  != OSTCBCur)) {
+        OS_EXIT_CRITICAL();
+        return (OS_ERR_Q_BUF_NOT_OWNER);
+    }
+    if (ref_ctr > 0u) {
+        phdr->OSQBufRefCtr = ref_ctr - 1u;
+    }
+    OS_EXIT_CRITICAL();
+    if (ref_ctr == 0u) {
+        return (OS_ERR_Q_BUF_INVALID);
+    }
+    if (ref_ctr > 1u) {                                /* Other references remain                      */
+        return (OS_ERR_NONE);
+    }
+    phdr->OSQBufOwnerPtr = (OS_TCB *)0;
+    return (OSMemPut(phdr->OSQBufMemPtr, (void *)phdr));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 RETAIN A ZERO-COPY MESSAGE BUFFER
+*
+* Description: This function adds a reference to a buffer, e.g. to post the same message to several queues.
+*              Each reference is dropped with OSQBufRelease().
+*
+* Arguments  : pbuf          is the pointer returned by OSQBufGet() or OSQBufPend().
+*
+* Returns    : OS_ERR_NONE             The reference was added.
+*              OS_ERR_Q_BUF_INVALID    If 'pbuf' is not a buffer from OSQBufGet() or was already released.
+*              OS_ERR_Q_BUF_REF_OVF    If the buffer already has 65535 references.
+*
+* Note(s)    : A shared message must be treated as read-only by the tasks that receive it.
+*********************************************************************************************************
+*/
+
+#if OS_Q_BUF_EN > 0u
+INT8U  OSQBufRetain (void  *pbuf)
+{
+    OS_Q_BUF  *phdr;
+    INT8U      err;
+#if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+    phdr = OS_QBufHdr(pbuf);
+    if (phdr == (OS_Q_BUF *)0) {
+        return (OS_ERR_Q_BUF_INVALID);
+    }
+    OS_ENTER_CRITICAL();
+    if (phdr->OSQBufRefCtr == 0u) {
+        err = OS_ERR_Q_BUF_INVALID;
+    } else if (phdr->OSQBufRefCtr == 65535u) {
+        err = OS_ERR_Q_BUF_REF_OVF;
+    } else {
+        phdr->OSQBufRefCtr++;
+        err = OS_ERR_NONE;
+    }
+    OS_EXIT_CRITICAL();
+    return (err);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     QUEUE MODULE INITIALIZATION
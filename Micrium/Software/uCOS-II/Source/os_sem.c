@@ -240,6 +240,9 @@ OS_EVENT  *OSSemDel (OS_EVENT  *pevent,
              if (tasks_waiting == OS_FALSE) {
 #if OS_EVENT_NAME_EN > 0u
                  pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+#if (OS_EVENT_SET_EN > 0u)
+                 OS_EventSetUnlink(pevent);                /* Remove event from its event set, if any  */
 #endif
                  pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
                  pevent->OSEventPtr     = OSEventFreeList; /* Return Event Control Block to free list  */
@@ -261,6 +264,9 @@ OS_EVENT  *OSSemDel (OS_EVENT  *pevent,
              }
 #if OS_EVENT_NAME_EN > 0u
              pevent->OSEventName    = (INT8U *)(void *)"?";
+#endif
+#if (OS_EVENT_SET_EN > 0u)
+             OS_EventSetUnlink(pevent);                    /* Remove event from its event set, if any  */
 #endif
              pevent->OSEventType    = OS_EVENT_TYPE_UNUSED;
              pevent->OSEventPtr     = OSEventFreeList;     /* Return Event Control Block to free list  */
@@ -542,6 +548,9 @@ INT8U  OSSemPost (OS_EVENT *pevent)
     if (pevent->OSEventCnt < 65535u) {                /* Make sure semaphore will not overflow         */
         pevent->OSEventCnt++;                         /* Increment semaphore count to register event   */
         OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+        OS_EventSetSignal(pevent);                    /* Signal the event set of the semaphore, if any */
+#endif
         OS_TRACE_SEM_POST_EXIT(OS_ERR_NONE);
         return (OS_ERR_NONE);
     }
@@ -552,6 +561,72 @@ INT8U  OSSemPost (OS_EVENT *pevent)
 }
 
 
+/*
+*********************************************************************************************************
+*                                  POST SEVERAL COUNTS TO A SEMAPHORE
+*
+* Description: This function signals a semaphore 'cnt' times in a single critical section, with at most one
+*              call to the scheduler.
+*
+* Arguments  : pevent        is a pointer to the event control block associated with the desired semaphore.
+*
+*              cnt           is the number of times the semaphore is signaled.
+*
+* Returns    : OS_ERR_NONE         The call was successful and the semaphore was signaled 'cnt' times.
+*              OS_ERR_SEM_OVF      If the semaphore count reached its limit; the count is set to 65535.
+*              OS_ERR_EVENT_TYPE   If you didn't pass a pointer to a semaphore.
+*              OS_ERR_PEVENT_NULL  If 'pevent' is a NULL pointer.
+*
+* Note(s)    : The result is the same as 'cnt' calls to OSSemPost() made with the scheduler locked: up to
+*              'cnt' waiting tasks are readied by decreasing priority and the rest is added to the count.
+*********************************************************************************************************
+*/
+
+#if OS_SEM_POST_N_EN > 0u
+INT8U  OSSemPostN (OS_EVENT  *pevent,
+                   INT16U     cnt)
+{
+    BOOLEAN    sched;
+    INT8U      err;
+#if OS_CRITICAL_METHOD == 3u                          /* Allocate storage for CPU status register      */
+    OS_CPU_SR  cpu_sr = 0u;
+#endif
+
+
+#if OS_ARG_CHK_EN > 0u
+    if (pevent == (OS_EVENT *)0) {                    /* Validate 'pevent'                             */
+        return (OS_ERR_PEVENT_NULL);
+    }
+#endif
+    if (pevent->OSEventType != OS_EVENT_TYPE_SEM) {   /* Validate event block type                     */
+        return (OS_ERR_EVENT_TYPE);
+    }
+    sched = OS_FALSE;
+    err   = OS_ERR_NONE;
+    OS_ENTER_CRITICAL();
+    while ((cnt > 0u) && (pevent->OSEventGrp != 0u)) {/* Ready waiting tasks by priority               */
+        (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_SEM, OS_STAT_PEND_OK);
+        cnt--;
+        sched = OS_TRUE;
+    }
+    if (cnt > (65535u - pevent->OSEventCnt)) {        /* Make sure semaphore will not overflow         */
+        pevent->OSEventCnt = 65535u;
+        err                = OS_ERR_SEM_OVF;
+    } else {
+        pevent->OSEventCnt += cnt;                    /* Add the rest to the semaphore count           */
+    }
+    OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+    OS_EventSetSignal(pevent);                        /* Signal the event set of the semaphore, if any */
+#endif
+    if (sched == OS_TRUE) {
+        OS_Sched();                                   /* Find HPT ready to run                         */
+    }
+    return (err);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          QUERY A SEMAPHORE
@@ -673,6 +748,9 @@ void  OSSemSet (OS_EVENT  *pevent,
         }
     }
     OS_EXIT_CRITICAL();
+#if (OS_EVENT_SET_EN > 0u)
+    OS_EventSetSignal(pevent);                        /* Signal the event set of the semaphore, if any */
+#endif
 }
 #endif
 
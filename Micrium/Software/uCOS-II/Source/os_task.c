@@ -912,6 +912,23 @@ INT8U  OSTaskResume (INT8U prio)
 *              OS_ERR_TASK_NOT_EXIST  if the desired task has not been created or is assigned to a Mutex PIP
 *              OS_ERR_TASK_OPT        if you did NOT specified OS_TASK_OPT_STK_CHK when the task was created
 *              OS_ERR_PDATA_NULL      if 'p_stk_data' is a NULL pointer
+*
+* Notes      : 1) The stack is scanned from its bottom for the first non-zero entry.  A port may supply an
+*                 optimized (e.g. vector wide) scan by defining OS_CPU_STK_ZERO_LEN() in OS_CPU.H; it returns
+*                 the number of zero entries from 'pchk' towards the top of the stack, out of 'n'.  It scans
+*                 upwards in memory, so it is only used when the stack grows from high to low memory
+*                 (OS_STK_GROWTH == 1); the other direction keeps the scalar scan.
+*              2) Only the part of the stack that may have been used since the last check is scanned:
+*                 a) If OS_TASK_STK_CLR_PAGE_SIZE is not 0, the entries not cleared yet were never used (see
+*                    OS_TaskStkClr()) & are counted as free without being scanned.
+*                 b) If OS_TASK_STK_CHK_INCR_EN is not 0, the deepest entry found in use (the high-water
+*                    mark) is kept in the TCB.  The entries above it are counted as used, & the entries
+*                    below it are probed from the mark towards the bottom of the stack; the probe stops
+*                    after OS_TASK_STK_CHK_INCR_GAP zero entries in a row.  A check thus costs O(1) when
+*                    the stack did not grow & O(growth) otherwise, instead of O(free entries).  The number
+*                    of entries used never decreases, & growth past a run of more than
+*                    OS_TASK_STK_CHK_INCR_GAP zero entries (e.g. a large local array that was never
+*                    written) is not seen until the task writes into that run.
 *********************************************************************************************************
 */
 #if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
@@ -919,7 +936,13 @@ INT8U  OSTaskStkChk (INT8U         prio,
                      OS_STK_DATA  *p_stk_data)
 {
     OS_TCB    *ptcb;
+    OS_STK    *pbos;
     OS_STK    *pchk;
+    OS_STK    *pend;
+#if OS_TASK_STK_CHK_INCR_EN > 0u
+    OS_STK    *pmark;
+    INT32U     ngap;
+#endif
     INT32U     nfree;
     INT32U     size;
 #if OS_CRITICAL_METHOD == 3u                           /* Allocate storage for CPU status register     */
@@ -957,18 +980,81 @@ INT8U  OSTaskStkChk (INT8U         prio,
         OS_EXIT_CRITICAL();
         return (OS_ERR_TASK_OPT);
     }
-    nfree = 0u;
     size  = ptcb->OSTCBStkSize;
-    pchk  = ptcb->OSTCBStkBottom;
+    pbos  = ptcb->OSTCBStkBottom;
+    pchk  = pbos;
+#if OS_TASK_STK_CLR_PAGE_SIZE > 0u
+    pchk  = ptcb->OSTCBStkClrPtr;                      /* See Note #2a                                  */
+#endif
+#if OS_TASK_STK_CHK_INCR_EN > 0u
+    pend  = pchk;                                      /* Probe from the mark down to here, Note #2b    */
+    pmark = ptcb->OSTCBStkChkPtr;
     OS_EXIT_CRITICAL();
+    pchk  = pmark;
+    ngap  = 0u;
 #if OS_STK_GROWTH == 1u
-    while (*pchk++ == (OS_STK)0) {                    /* Compute the number of zero entries on the stk */
-        nfree++;
+    while ((pchk > pend) && (ngap < OS_TASK_STK_CHK_INCR_GAP)) {
+        pchk--;
+        if (*pchk != (OS_STK)0) {                      /* In use, the mark moves down to this entry     */
+            pmark = pchk;
+            ngap  = 0u;
+        } else {
+            ngap++;
+        }
     }
+    pchk  = pmark;
+    nfree = (INT32U)(pchk - pbos);
 #else
-    while (*pchk-- == (OS_STK)0) {
-        nfree++;
+    while ((pchk < pend) && (ngap < OS_TASK_STK_CHK_INCR_GAP)) {
+        pchk++;
+        if (*pchk != (OS_STK)0) {
+            pmark = pchk;
+            ngap  = 0u;
+        } else {
+            ngap++;
+        }
     }
+    pchk  = pmark;
+    nfree = (INT32U)(pbos - pchk);
+#endif
+#else
+#if OS_STK_GROWTH == 1u
+    pend  = pbos + size;
+#else
+    pend  = pbos - size;
+#endif
+    OS_EXIT_CRITICAL();
+#if OS_STK_GROWTH == 1u
+    if (pchk < pend) {                                 /* Count the zero entries, see Note #1           */
+#ifdef OS_CPU_STK_ZERO_LEN
+        pchk += OS_CPU_STK_ZERO_LEN(pchk, (INT32U)(pend - pchk));
+#else
+        while ((pchk < pend) && (*pchk == (OS_STK)0)) {
+            pchk++;
+        }
+#endif
+    }
+    nfree = (INT32U)(pchk - pbos);
+#else
+    while ((pchk > pend) && (*pchk == (OS_STK)0)) {    /* Scans downwards, see Note #1                */
+        pchk--;
+    }
+    nfree = (INT32U)(pbos - pchk);
+#endif
+#endif
+#if OS_TASK_STK_CHK_INCR_EN > 0u
+    OS_ENTER_CRITICAL();
+    if ((OSTCBPrioTbl[prio]   == ptcb) &&             /* Make sure the task still owns the stack       */
+        (ptcb->OSTCBStkBottom == pbos)) {
+#if OS_STK_GROWTH == 1u
+        if (pchk < ptcb->OSTCBStkChkPtr) {             /* Store the new high-water mark                 */
+#else
+        if (pchk > ptcb->OSTCBStkChkPtr) {
+#endif
+            ptcb->OSTCBStkChkPtr = pchk;
+        }
+    }
+    OS_EXIT_CRITICAL();
 #endif
     p_stk_data->OSFree = nfree;                       /* Store   number of free entries on the stk     */
     p_stk_data->OSUsed = size - nfree;                /* Compute number of entries used on the stk     */
@@ -1360,6 +1446,11 @@ void  OS_TaskReturn (void)
 *                       specific.  See OS_TASK_OPT_??? in uCOS-II.H.
 *
 * Returns    : none
+*
+* Notes      : 1) If OS_TASK_STK_CLR_PAGE_SIZE is not 0, only the OS_TASK_STK_CLR_PAGE_SIZE entries at the top
+*                 of the stack (i.e. where the task starts using it) are cleared here.  The rest is cleared
+*                 one page at a time as the task's stack pointer gets near it (see OS_TaskStkClrPage()), so
+*                 creating a task with a large stack does not write the whole stack.
 *********************************************************************************************************
 */
 #if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
@@ -1367,21 +1458,88 @@ void  OS_TaskStkClr (OS_STK  *pbos,
                      INT32U   size,
                      INT16U   opt)
 {
+    OS_STK  *pclr;
+    INT32U   nclr;
+
+
     if ((opt & OS_TASK_OPT_STK_CHK) != 0x0000u) {      /* See if stack checking has been enabled       */
         if ((opt & OS_TASK_OPT_STK_CLR) != 0x0000u) {  /* See if stack needs to be cleared             */
-#if OS_STK_GROWTH == 1u
-            while (size > 0u) {                        /* Stack grows from HIGH to LOW memory          */
-                size--;
-                *pbos++ = (OS_STK)0;                   /* Clear from bottom of stack and up!           */
+            nclr = size;
+#if OS_TASK_STK_CLR_PAGE_SIZE > 0u
+            if (nclr > OS_TASK_STK_CLR_PAGE_SIZE) {    /* See Note #1                                  */
+                nclr = OS_TASK_STK_CLR_PAGE_SIZE;
             }
+#endif
+#if OS_STK_GROWTH == 1u
+            pclr = pbos + (size - nclr);               /* Stack grows from HIGH to LOW memory          */
 #else
-            while (size > 0u) {                        /* Stack grows from LOW to HIGH memory          */
-                size--;
-                *pbos-- = (OS_STK)0;                   /* Clear from bottom of stack and down          */
-            }
+            pclr = pbos - (size - 1u);                 /* Stack grows from LOW to HIGH memory          */
 #endif
+            OS_MemClr((INT8U *)pclr, nclr * sizeof(OS_STK));
         }
     }
 }
 
 #endif
+
+
+/*
+*********************************************************************************************************
+*                                       CLEAR TASK STACK AHEAD OF USE
+*
+* Description: This function clears the next page(s) of a task's stack when the task's stack pointer gets
+*              within OS_TASK_STK_CLR_PAGE_SIZE entries of the part not cleared yet (see OS_TaskStkClr()).
+*
+* Arguments  : ptcb     is a pointer to the TCB of the task.  Its stack pointer MUST have been saved, i.e.
+*                       the task is being switched out or is not running.
+*
+* Returns    : none
+*
+* Notes      : 1) This function is INTERNAL to uC/OS-II and your application should not call it.  The port
+*                 calls it from OSTaskSwHook() for the task being switched out.
+*              2) This keeps at least one cleared page beyond the stack pointer of a task each time it is
+*                 switched out; entries between the stack pointer & the cleared part are in use & are left
+*                 as they are.  A task that grows its stack by more than OS_TASK_STK_CLR_PAGE_SIZE entries
+*                 & shrinks it back between two context switches has used entries that were never
+*                 cleared, which OSTaskStkChk() then counts as free.  Use a larger page, or 0 to clear the
+*                 whole stack when the task is created, for such tasks.
+*********************************************************************************************************
+*/
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u) && (OS_TASK_STK_CLR_PAGE_SIZE > 0u)
+void  OS_TaskStkClrPage (OS_TCB  *ptcb)
+{
+    OS_STK  *pclr;
+    INT32U   nclr;
+
+
+    pclr = ptcb->OSTCBStkClrPtr;
+#if OS_STK_GROWTH == 1u
+    if (ptcb->OSTCBStkPtr < pclr) {                    /* Entries in use are not cleared (see Note #2) */
+        pclr = (ptcb->OSTCBStkPtr > ptcb->OSTCBStkBottom) ? ptcb->OSTCBStkPtr : ptcb->OSTCBStkBottom;
+    }
+    while ((pclr > ptcb->OSTCBStkBottom) &&            /* Until the whole stack is cleared ...         */
+           ((INT32U)(ptcb->OSTCBStkPtr - pclr) < OS_TASK_STK_CLR_PAGE_SIZE)) { /* ... or a page below SP */
+        nclr = (INT32U)(pclr - ptcb->OSTCBStkBottom);
+        if (nclr > OS_TASK_STK_CLR_PAGE_SIZE) {
+            nclr = OS_TASK_STK_CLR_PAGE_SIZE;
+        }
+        pclr -= nclr;
+        OS_MemClr((INT8U *)pclr, nclr * sizeof(OS_STK));
+    }
+#else
+    if (ptcb->OSTCBStkPtr > pclr) {                    /* Entries in use are not cleared (see Note #2) */
+        pclr = (ptcb->OSTCBStkPtr < ptcb->OSTCBStkBottom) ? ptcb->OSTCBStkPtr : ptcb->OSTCBStkBottom;
+    }
+    while ((pclr < ptcb->OSTCBStkBottom) &&            /* Until the whole stack is cleared ...         */
+           ((INT32U)(pclr - ptcb->OSTCBStkPtr) < OS_TASK_STK_CLR_PAGE_SIZE)) { /* ... or a page above SP */
+        nclr = (INT32U)(ptcb->OSTCBStkBottom - pclr);
+        if (nclr > OS_TASK_STK_CLR_PAGE_SIZE) {
+            nclr = OS_TASK_STK_CLR_PAGE_SIZE;
+        }
+        OS_MemClr((INT8U *)(pclr + 1u), nclr * sizeof(OS_STK));
+        pclr += nclr;
+    }
+#endif
+    ptcb->OSTCBStkClrPtr = pclr;
+}
+#endif
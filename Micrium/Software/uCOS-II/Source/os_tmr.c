@@ -46,6 +46,14 @@
 *    OS_TASK_TMR_STK_SIZE      The size     of the Timer management task's stack
 *
 * 2) You must call OSTmrSignal() to notify the Timer management task that it's time to update the timers.
+*
+* 3) When OS_TMR_CFG_WHEEL_HIER_EN is set, the timers are kept in a hierarchical timer wheel of
+*    OS_TMR_WHEEL_LEVELS levels of 2^OS_TMR_CFG_WHEEL_BITS spokes each instead of the flat wheel of
+*    OS_TMR_CFG_WHEEL_SIZE spokes.  Level 'n' is indexed by digit 'n' (OS_TMR_CFG_WHEEL_BITS wide) of the
+*    match time.  A timer is linked at the level of the most significant digit in which its match time
+*    differs from OSTmrTime and is moved down (cascaded) when OSTmrTime reaches its spoke.  Starting and
+*    stopping a timer don't depend on the number of timers and OSTmr_Task() only visits the timers that
+*    expire or cascade at each update, instead of every timer of a spoke.
 *********************************************************************************************************
 */
 
@@ -71,6 +79,11 @@ static  void     OSTmr_InitTask      (void);
 static  void     OSTmr_Link          (OS_TMR *ptmr, INT8U type);
 static  void     OSTmr_Unlink        (OS_TMR *ptmr);
 static  void     OSTmr_Task          (void   *p_arg);
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+static  void     OSTmr_Cascade       (void);
+static  INT8U    OSTmr_WheelLevel    (INT32U  match);
+static  void     OSTmr_WheelPut      (OS_TMR *ptmr, INT8U level);
+#endif
 #endif
 
 
@@ -1006,9 +1019,13 @@ static  void  OSTmr_InitTask (void)
 static  void  OSTmr_Link (OS_TMR  *ptmr,
                           INT8U    type)
 {
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    INT8U         level;
+#else
     OS_TMR       *ptmr1;
     OS_TMR_WHEEL *pspoke;
     INT16U        spoke;
+#endif
 
 
     ptmr->OSTmrState = OS_TMR_STATE_RUNNING;
@@ -1021,6 +1038,14 @@ static  void  OSTmr_Link (OS_TMR  *ptmr,
             ptmr->OSTmrMatch = ptmr->OSTmrDly    + OSTmrTime;
         }
     }
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    if (ptmr->OSTmrMatch == OSTmrTime) {                           /* Timer expires in 2^32 updates ...               */
+        level = OS_TMR_WHEEL_LEVELS - 1u;                          /* ... it will cascade down when time wraps around */
+    } else {
+        level = OSTmr_WheelLevel(ptmr->OSTmrMatch);
+    }
+    OSTmr_WheelPut(ptmr, level);                                   /* Link into hierarchical timer wheel              */
+#else
     spoke  = (INT16U)(ptmr->OSTmrMatch % OS_TMR_CFG_WHEEL_SIZE);
     pspoke = &OSTmrWheelTbl[spoke];
 
@@ -1036,6 +1061,7 @@ static  void  OSTmr_Link (OS_TMR  *ptmr,
         pspoke->OSTmrEntries++;
     }
     ptmr->OSTmrPrev = (void *)0;                                   /* Timer always inserted as first node in list     */
+#endif
 }
 #endif
 
@@ -1058,11 +1084,18 @@ static  void  OSTmr_Unlink (OS_TMR *ptmr)
     OS_TMR        *ptmr1;
     OS_TMR        *ptmr2;
     OS_TMR_WHEEL  *pspoke;
+#if OS_TMR_CFG_WHEEL_HIER_EN == 0u
     INT16U         spoke;
+#endif
 
 
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    pspoke = ptmr->OSTmrSpoke;                              /* Spoke depends on the time the timer was linked         */
+    ptmr->OSTmrSpoke = (OS_TMR_WHEEL *)0;
+#else
     spoke  = (INT16U)(ptmr->OSTmrMatch % OS_TMR_CFG_WHEEL_SIZE);
     pspoke = &OSTmrWheelTbl[spoke];
+#endif
 
     if (pspoke->OSTmrFirst == ptmr) {                       /* See if timer to remove is at the beginning of list     */
         ptmr1              = (OS_TMR *)ptmr->OSTmrNext;
@@ -1103,10 +1136,12 @@ static  void  OSTmr_Task (void *p_arg)
 {
     INT8U            err;
     OS_TMR          *ptmr;
+#if OS_TMR_CFG_WHEEL_HIER_EN == 0u
     OS_TMR          *ptmr_next;
+    INT16U           spoke;
+#endif
     OS_TMR_CALLBACK  pfnct;
     OS_TMR_WHEEL    *pspoke;
-    INT16U           spoke;
 
 
     p_arg = p_arg;                                               /* Prevent compiler warning for not using 'p_arg'    */
@@ -1114,6 +1149,30 @@ static  void  OSTmr_Task (void *p_arg)
         OSSemPend(OSTmrSemSignal, 0u, &err);                     /* Wait for signal indicating time to update timers  */
         OSSchedLock();
         OSTmrTime++;                                             /* Increment the current time                        */
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+        OSTmr_Cascade();                                         /* Move timers of the upper levels down              */
+        pspoke = &OSTmrWheelTbl[OSTmrTime & (OS_TMR_WHEEL_SPOKES - 1u)];
+        ptmr   = pspoke->OSTmrFirst;
+        while (ptmr != (OS_TMR *)0) {                            /* All timers of the spoke are due, see Note #3      */
+            OSTmr_Unlink(ptmr);                                  /* Remove from current wheel spoke                   */
+            if (ptmr->OSTmrMatch != OSTmrTime) {                 /* Match time wrapped around, link it again          */
+                ptmr->OSTmrState = OS_TMR_STATE_RUNNING;
+                OSTmr_WheelPut(ptmr, OSTmr_WheelLevel(ptmr->OSTmrMatch));
+            } else {
+                OS_TRACE_TMR_EXPIRED(ptmr);
+                if (ptmr->OSTmrOpt == OS_TMR_OPT_PERIODIC) {
+                    OSTmr_Link(ptmr, OS_TMR_LINK_PERIODIC);      /* Recalculate new position of timer in wheel        */
+                } else {
+                    ptmr->OSTmrState = OS_TMR_STATE_COMPLETED;   /* Indicate that the timer has completed             */
+                }
+                pfnct = ptmr->OSTmrCallback;                     /* Execute callback function if available            */
+                if (pfnct != (OS_TMR_CALLBACK)0) {
+                    (*pfnct)((void *)ptmr, ptmr->OSTmrCallbackArg);
+                }
+            }
+            ptmr = pspoke->OSTmrFirst;                           /* Callback may have stopped other timers of spoke   */
+        }
+#else
         spoke  = (INT16U)(OSTmrTime % OS_TMR_CFG_WHEEL_SIZE);    /* Position on current timer wheel entry             */
         pspoke = &OSTmrWheelTbl[spoke];
         ptmr   = pspoke->OSTmrFirst;
@@ -1135,7 +1194,134 @@ static  void  OSTmr_Task (void *p_arg)
             }
             ptmr = ptmr_next;
         }
+#endif
         OSSchedUnlock();
     }
 }
 #endif
+
+
+/*
+*********************************************************************************************************
+*                           FIND THE LEVEL OF THE HIERARCHICAL TIMER WHEEL
+*
+* Description: This function is called to determine the level of the hierarchical timer wheel in which a
+*              timer must be linked.  The level is the one of the most significant digit in which the
+*              match time differs from 'OSTmrTime'.
+*
+* Arguments  : match         Is the match time of the timer.
+*
+* Returns    : The level, 0 if 'match' is equal to 'OSTmrTime'.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WHEEL_HIER_EN > 0u)
+static  INT8U  OSTmr_WheelLevel (INT32U  match)
+{
+    INT32U  diff;
+    INT8U   level;
+
+
+    diff  = (match ^ OSTmrTime) >> OS_TMR_CFG_WHEEL_BITS;
+    level = 0u;
+    while (diff != 0u) {
+        diff >>= OS_TMR_CFG_WHEEL_BITS;
+        level++;
+    }
+    return (level);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                          INSERT A TIMER INTO THE HIERARCHICAL TIMER WHEEL
+*
+* Description: This function is called to link a running timer in a level of the hierarchical timer wheel.
+*              The spoke is the digit of the match time for that level.  The timer is always inserted at
+*              the beginning of the list.
+*
+* Arguments  : ptmr          Is a pointer to the timer to insert.
+*
+*              level         Is the level, normally given by OSTmr_WheelLevel().
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WHEEL_HIER_EN > 0u)
+static  void  OSTmr_WheelPut (OS_TMR  *ptmr,
+                              INT8U    level)
+{
+    OS_TMR        *ptmr1;
+    OS_TMR_WHEEL  *pspoke;
+    INT32U         spoke;
+
+
+    spoke  = (ptmr->OSTmrMatch >> (level * OS_TMR_CFG_WHEEL_BITS)) & (OS_TMR_WHEEL_SPOKES - 1u);
+    pspoke = &OSTmrWheelTbl[(level * OS_TMR_WHEEL_SPOKES) + spoke];
+
+    ptmr1              = pspoke->OSTmrFirst;                /* Link at the beginning of the spoke                     */
+    ptmr->OSTmrNext    = (void *)ptmr1;
+    ptmr->OSTmrPrev    = (void *)0;
+    if (ptmr1 != (OS_TMR *)0) {
+        ptmr1->OSTmrPrev = (void *)ptmr;
+    }
+    pspoke->OSTmrFirst = ptmr;
+    pspoke->OSTmrEntries++;
+    ptmr->OSTmrSpoke   = pspoke;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                               CASCADE TIMERS OF THE HIERARCHICAL TIMER WHEEL
+*
+* Description: This function is called by OSTmr_Task() after 'OSTmrTime' is incremented.  For every level
+*              'n' whose lower digits of 'OSTmrTime' are all zero, the timers of the current spoke of level
+*              'n' are linked again, which moves them to a lower level.  Levels are processed from the
+*              highest to the lowest since a timer may cascade down more than one level at once.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u) && (OS_TMR_CFG_WHEEL_HIER_EN > 0u)
+static  void  OSTmr_Cascade (void)
+{
+    OS_TMR        *ptmr;
+    OS_TMR        *ptmr_next;
+    OS_TMR_WHEEL  *pspoke;
+    INT32U         mask;
+    INT32U         spoke;
+    INT8U          level;
+    INT8U          level_top;
+
+
+    level_top = 0u;
+    mask      = 0u;
+    for (level = 1u; level < OS_TMR_WHEEL_LEVELS; level++) {/* Find highest level that reached a new spoke            */
+        mask = (mask << OS_TMR_CFG_WHEEL_BITS) | (OS_TMR_WHEEL_SPOKES - 1u);
+        if ((OSTmrTime & mask) != 0u) {
+            break;
+        }
+        level_top = level;
+    }
+
+    for (level = level_top; level > 0u; level--) {
+        spoke  = (OSTmrTime >> (level * OS_TMR_CFG_WHEEL_BITS)) & (OS_TMR_WHEEL_SPOKES - 1u);
+        pspoke = &OSTmrWheelTbl[(level * OS_TMR_WHEEL_SPOKES) + spoke];
+        ptmr   = pspoke->OSTmrFirst;
+        pspoke->OSTmrFirst   = (OS_TMR *)0;                 /* Empty the spoke ...                                    */
+        pspoke->OSTmrEntries = 0u;
+        while (ptmr != (OS_TMR *)0) {                       /* ... and link its timers again in lower levels          */
+            ptmr_next = (OS_TMR *)ptmr->OSTmrNext;
+            OSTmr_WheelPut(ptmr, OSTmr_WheelLevel(ptmr->OSTmrMatch));
+            ptmr      = ptmr_next;
+        }
+    }
+}
+#endif
@@ -164,9 +164,10 @@ task_para_set TaskParameter[OS_MAX_TASKS];
 #define  OS_STAT_SUSPEND             0x08u  /* Task is suspended                                       */
 #define  OS_STAT_MUTEX               0x10u  /* Pending on mutual exclusion semaphore                   */
 #define  OS_STAT_FLAG                0x20u  /* Pending on event flag group                             */
+#define  OS_STAT_SET                 0x40u  /* Pending on event set                                    */
 #define  OS_STAT_MULTI               0x80u  /* Pending on multiple events                              */
 
-#define  OS_STAT_PEND_ANY         (OS_STAT_SEM | OS_STAT_MBOX | OS_STAT_Q | OS_STAT_MUTEX | OS_STAT_FLAG)
+#define  OS_STAT_PEND_ANY         (OS_STAT_SEM | OS_STAT_MBOX | OS_STAT_Q | OS_STAT_MUTEX | OS_STAT_FLAG | OS_STAT_SET)
 
 /*
 *********************************************************************************************************
@@ -188,6 +189,7 @@ task_para_set TaskParameter[OS_MAX_TASKS];
 #define  OS_EVENT_TYPE_SEM              3u
 #define  OS_EVENT_TYPE_MUTEX            4u
 #define  OS_EVENT_TYPE_FLAG             5u
+#define  OS_EVENT_TYPE_SET              6u
 
 #define  OS_TMR_TYPE                  100u  /* Used to identify Timers ...                             */
                                             /* ... (Must be different value than OS_EVENT_TYPE_xxx)    */
@@ -327,6 +329,10 @@ task_para_set TaskParameter[OS_MAX_TASKS];
 
 #define OS_ERR_Q_FULL                  30u
 #define OS_ERR_Q_EMPTY                 31u
+#define OS_ERR_Q_BUF_INVALID           32u
+#define OS_ERR_Q_BUF_SIZE              33u
+#define OS_ERR_Q_BUF_NOT_OWNER         34u
+#define OS_ERR_Q_BUF_REF_OVF           35u
 
 #define OS_ERR_PRIO_EXIST              40u
 #define OS_ERR_PRIO                    41u
@@ -402,6 +408,10 @@ task_para_set TaskParameter[OS_MAX_TASKS];
 #define OS_ERR_TLS_DESTRUCT_ASSIGNED  163u
 #define OS_ERR_OS_NOT_RUNNING         164u
 
+#define OS_ERR_EVENT_SET_MEMBER       170u
+#define OS_ERR_EVENT_SET_NOT_MEMBER   171u
+#define OS_ERR_EVENT_SET_NOT_EMPTY    172u
+
 
 /*
 *********************************************************************************************************
@@ -440,6 +450,11 @@ typedef struct os_event {
 #if OS_EVENT_NAME_EN > 0u
     INT8U   *OSEventName;
 #endif
+#if OS_EVENT_SET_EN > 0u
+    struct os_event *OSEventSetPtr;         /* Pointer to event set the event belongs to               */
+    struct os_event *OSEventSetNext;        /* Next ready event of the set (last one for the set)      */
+    BOOLEAN  OSEventSetRdy;                 /* Event is in the list of ready events of its set         */
+#endif
 } OS_EVENT;
 #endif
 
@@ -465,6 +480,15 @@ typedef  INT32U   OS_FLAGS;
 #endif
 
 
+#if OS_FLAG_WAIT_IX_EN > 0u
+typedef struct os_flag_ix {                 /* Index of the waiters of one sense (set or clear)        */
+    void         *OSFlagIxTbl[OS_FLAGS_NBITS];  /* Per bit, list of NODEs watching that bit            */
+    void         *OSFlagIxAnyList;          /* List of NODEs waiting for ANY of several bits           */
+    OS_FLAGS      OSFlagIxAnyFlags;         /* Union of the bits waited for by 'OSFlagIxAnyList'       */
+} OS_FLAG_IX;
+#endif
+
+
 typedef struct os_flag_grp {                /* Event Flag Group                                        */
     INT8U         OSFlagType;               /* Should be set to OS_EVENT_TYPE_FLAG                     */
     void         *OSFlagWaitList;           /* Pointer to first NODE of task waiting on event flag     */
@@ -472,6 +496,12 @@ typedef struct os_flag_grp {                /* Event Flag Group
 #if OS_FLAG_NAME_EN > 0u
     INT8U        *OSFlagName;
 #endif
+#if OS_FLAG_WAIT_IX_EN > 0u
+    OS_FLAG_IX    OSFlagIxSet;              /* Index of the tasks waiting for bits to be set           */
+#if OS_FLAG_WAIT_CLR_EN > 0u
+    OS_FLAG_IX    OSFlagIxClr;              /* Index of the tasks waiting for bits to be cleared       */
+#endif
+#endif
 } OS_FLAG_GRP;
 
 
@@ -487,6 +517,11 @@ typedef struct os_flag_node {               /* Event Flag Wait List Node
                                             /*      OS_FLAG_WAIT_ALL                                   */
                                             /*      OS_FLAG_WAIT_OR                                    */
                                             /*      OS_FLAG_WAIT_ANY                                   */
+#if OS_FLAG_WAIT_IX_EN > 0u
+    void         *OSFlagNodeIxNext;         /* Pointer to next     NODE in index list                  */
+    void         *OSFlagNodeIxPrev;         /* Pointer to previous NODE in index list                  */
+    void        **OSFlagNodeIxHead;         /* Pointer to head of the index list holding the NODE      */
+#endif
 } OS_FLAG_NODE;
 #endif
 
@@ -532,6 +567,43 @@ typedef struct os_mem_data {
     INT32U  OSNFree;                        /* Number of memory blocks free                            */
     INT32U  OSNUsed;                        /* Number of memory blocks used                            */
 } OS_MEM_DATA;
+
+
+#if OS_MEM_SLAB_EN > 0u
+                                            /* Number of size classes, see OSMemSlabCreate()           */
+#define  OS_MEM_SLAB_CLASS_NBR     (((OS_MEM_SLAB_SHIFT_MAX - OS_MEM_SLAB_SHIFT_MIN) << OS_MEM_SLAB_SUB_BITS) + 1u)
+#define  OS_MEM_SLAB_CLASS_NONE      0xFFu
+
+#define  OS_MEM_SLAB_OPT_NONE        0x00u  /* Serve a request from its class only                     */
+#define  OS_MEM_SLAB_OPT_FALLBACK    0x01u  /* Try the next larger classes when a class is empty       */
+
+typedef struct os_mem_slab_class {          /* SIZE CLASS OF A SLAB ALLOCATOR                          */
+    OS_MEM  *OSMemSlabPart;                 /* Partition holding the blocks of the class, or NULL      */
+    INT32U   OSMemSlabNUsedMax;             /* Highest number of blocks of the partition used at once  */
+    INT32U   OSMemSlabNGet;                 /* Requests of this class served                           */
+    INT32U   OSMemSlabNFallback;            /* ... of which served by a larger class                   */
+    INT32U   OSMemSlabNFail;                /* Requests of this class not served                       */
+    INT8U    OSMemSlabNext;                 /* First class from this one that has a partition          */
+} OS_MEM_SLAB_CLASS;
+
+
+typedef struct os_mem_slab {                /* SLAB (SIZE-CLASS) ALLOCATOR                             */
+    OS_MEM_SLAB_CLASS  OSMemSlabClassTbl[OS_MEM_SLAB_CLASS_NBR];
+    INT8U              OSMemSlabOpt;        /* OS_MEM_SLAB_OPT_*                                       */
+} OS_MEM_SLAB;
+
+
+typedef struct os_mem_slab_data {
+    INT32U  OSBlkSize;                      /* Size (in bytes) of the blocks of the class              */
+    INT32U  OSNBlks;                        /* Total number of blocks, 0 if the class has no partition */
+    INT32U  OSNFree;                        /* Number of blocks free                                   */
+    INT32U  OSNUsed;                        /* Number of blocks used                                   */
+    INT32U  OSNUsedMax;                     /* Highest number of blocks used at once                   */
+    INT32U  OSNGet;                         /* Requests of this class served                           */
+    INT32U  OSNFallback;                    /* ... of which served by a larger class                   */
+    INT32U  OSNFail;                        /* Requests of this class not served                       */
+} OS_MEM_SLAB_DATA;
+#endif
 #endif
 
 
@@ -576,6 +648,19 @@ typedef struct os_q_data {
     OS_PRIO        OSEventTbl[OS_EVENT_TBL_SIZE];  /* List of tasks waiting for event to occur         */
     OS_PRIO        OSEventGrp;              /* Group corresponding to tasks waiting for event to occur */
 } OS_Q_DATA;
+
+
+#if OS_Q_BUF_EN > 0u
+typedef struct os_q_buf {                   /* HEADER OF A ZERO-COPY MESSAGE, see OSQBufGet()          */
+    OS_MEM        *OSQBufMemPtr;            /* Partition the block is returned to                      */
+    struct os_tcb *OSQBufOwnerPtr;          /* Task holding the message, NULL while queued             */
+    INT32U         OSQBufLen;               /* Length of the message (in bytes)                        */
+    INT16U         OSQBufRefCtr;            /* Number of references, the block is freed at 0           */
+} OS_Q_BUF;
+
+                                            /* Bytes before the message in a block, keeps 8-byte align */
+#define  OS_Q_BUF_HDR_SIZE         ((INT32U)((sizeof(OS_Q_BUF) + 7u) & ~(INT32U)7u))
+#endif
 #endif
 
 /*
@@ -621,6 +706,12 @@ typedef struct os_tcb {
     INT32U           OSTCBStkSize;          /* Size of task stack (in number of stack elements)        */
     INT16U           OSTCBOpt;              /* Task options as passed by OSTaskCreateExt()             */
     INT16U           OSTCBId;               /* Task ID (0..65535)                                      */
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_STK_CLR_PAGE_SIZE > 0u)
+    OS_STK          *OSTCBStkClrPtr;        /* Last stack entry cleared so far, see OS_TaskStkClr()    */
+#endif
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_STK_CHK_INCR_EN > 0u)
+    OS_STK          *OSTCBStkChkPtr;        /* Deepest stack entry found in use, see OSTaskStkChk()    */
+#endif
 #endif
 
     struct os_tcb   *OSTCBNext;             /* Pointer to next     TCB in the TCB list                 */
@@ -668,8 +759,8 @@ typedef struct os_tcb {
 
 #if OS_TASK_PROFILE_EN > 0u
     INT32U           OSTCBCtxSwCtr;         /* Number of time the task was switched in                 */
-    INT32U           OSTCBCyclesTot;        /* Total number of clock cycles the task has been running  */
-    INT32U           OSTCBCyclesStart;      /* Snapshot of cycle counter at start of task resumption   */
+    INT64U           OSTCBCyclesTot;        /* Total number of clock cycles the task has been running  */
+    INT64U           OSTCBCyclesStart;      /* Snapshot of cycle counter at start of task resumption   */
     OS_STK          *OSTCBStkBase;          /* Pointer to the beginning of the task stack              */
     INT32U           OSTCBStkUsed;          /* Number of bytes used from the stack                     */
 #endif
@@ -712,6 +803,9 @@ typedef  struct  os_tmr {
                                             /*     OS_TMR_STATE_UNUSED                                 */
                                             /*     OS_TMR_STATE_RUNNING                                */
                                             /*     OS_TMR_STATE_STOPPED                                */
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u
+    struct os_tmr_wheel *OSTmrSpoke;        /* Spoke of the timer wheel the timer is linked in         */
+#endif
 } OS_TMR;
 
 
@@ -720,6 +814,15 @@ typedef  struct  os_tmr_wheel {
     OS_TMR          *OSTmrFirst;            /* Pointer to first timer in linked list                   */
     INT16U           OSTmrEntries;
 } OS_TMR_WHEEL;
+
+
+#if OS_TMR_CFG_WHEEL_HIER_EN > 0u                   /* Hierarchical timer wheel, see OSTmr_Link()      */
+#define  OS_TMR_WHEEL_SPOKES     (1uL << OS_TMR_CFG_WHEEL_BITS)
+#define  OS_TMR_WHEEL_LEVELS     ((32u + OS_TMR_CFG_WHEEL_BITS - 1u) / OS_TMR_CFG_WHEEL_BITS)
+#define  OS_TMR_WHEEL_TBL_SIZE   (OS_TMR_WHEEL_LEVELS * OS_TMR_WHEEL_SPOKES)
+#else
+#define  OS_TMR_WHEEL_TBL_SIZE    OS_TMR_CFG_WHEEL_SIZE
+#endif
 #endif
 
 
@@ -827,7 +930,7 @@ OS_EXT  OS_TMR            OSTmrTbl[OS_TMR_CFG_MAX]; /* Table containing pool of
 OS_EXT  OS_TMR           *OSTmrFreeList;            /* Pointer to free list of timers                  */
 OS_EXT  OS_STK            OSTmrTaskStk[OS_TASK_TMR_STK_SIZE];
 
-OS_EXT  OS_TMR_WHEEL      OSTmrWheelTbl[OS_TMR_CFG_WHEEL_SIZE];
+OS_EXT  OS_TMR_WHEEL      OSTmrWheelTbl[OS_TMR_WHEEL_TBL_SIZE];
 #endif
 
 extern  INT8U   const     OSUnMapTbl[256];          /* Priority->Index    lookup table                 */
@@ -866,6 +969,25 @@ INT16U        OSEventPendMulti        (OS_EVENT       **pevents_pend,
                                        INT8U           *perr);
 #endif
 
+#if (OS_EVENT_SET_EN > 0u)
+INT8U         OSEventSetAdd           (OS_EVENT        *pset,
+                                       OS_EVENT        *pevent);
+
+OS_EVENT     *OSEventSetCreate        (INT8U           *perr);
+
+OS_EVENT     *OSEventSetDel           (OS_EVENT        *pset,
+                                       INT8U           *perr);
+
+INT16U        OSEventSetPend          (OS_EVENT        *pset,
+                                       OS_EVENT       **pevents_rdy,
+                                       INT16U           n,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+
+INT8U         OSEventSetRemove        (OS_EVENT        *pset,
+                                       OS_EVENT        *pevent);
+#endif
+
 #endif
 
 /*
@@ -1035,6 +1157,33 @@ INT8U         OSMemQuery              (OS_MEM          *pmem,
                                        OS_MEM_DATA     *p_mem_data);
 #endif
 
+#if OS_MEM_SLAB_EN > 0u
+OS_MEM       *OSMemSlabAdd            (OS_MEM_SLAB     *pslab,
+                                       void            *addr,
+                                       INT32U           size,
+                                       INT32U           blksize,
+                                       INT8U           *perr);
+
+INT32U        OSMemSlabBlkSize        (INT32U           size);
+
+void          OSMemSlabCreate         (OS_MEM_SLAB     *pslab,
+                                       INT8U            opt,
+                                       INT8U           *perr);
+
+void         *OSMemSlabGet            (OS_MEM_SLAB     *pslab,
+                                       INT32U           size,
+                                       INT8U           *perr);
+
+INT8U         OSMemSlabPut            (OS_MEM_SLAB     *pslab,
+                                       void            *pblk);
+
+#if OS_MEM_QUERY_EN > 0u
+INT8U         OSMemSlabQuery          (OS_MEM_SLAB     *pslab,
+                                       INT8U            ix,
+                                       OS_MEM_SLAB_DATA *p_slab_data);
+#endif
+#endif
+
 #endif
 
 /*
@@ -1109,11 +1258,26 @@ INT8U         OSQPendAbort            (OS_EVENT        *pevent,
                                        INT8U           *perr);
 #endif
 
+#if OS_Q_PEND_N_EN > 0u
+INT16U        OSQPendN                (OS_EVENT        *pevent,
+                                       void           **pmsg_tbl,
+                                       INT16U           n,
+                                       INT32U           timeout,
+                                       INT8U           *perr);
+#endif
+
 #if OS_Q_POST_EN > 0u
 INT8U         OSQPost                 (OS_EVENT        *pevent,
                                        void            *pmsg);
 #endif
 
+#if OS_Q_POST_N_EN > 0u
+INT16U        OSQPostN                (OS_EVENT        *pevent,
+                                       void           **pmsg_tbl,
+                                       INT16U           n,
+                                       INT8U           *perr);
+#endif
+
 #if OS_Q_POST_FRONT_EN > 0u
 INT8U         OSQPostFront            (OS_EVENT        *pevent,
                                        void            *pmsg);
@@ -1130,6 +1294,24 @@ INT8U         OSQQuery                (OS_EVENT        *pevent,
                                        OS_Q_DATA       *p_q_data);
 #endif
 
+#if OS_Q_BUF_EN > 0u
+void         *OSQBufGet               (OS_MEM          *pmem,
+                                       INT8U           *perr);
+
+void         *OSQBufPend              (OS_EVENT        *pevent,
+                                       INT32U           timeout,
+                                       INT32U          *plen,
+                                       INT8U           *perr);
+
+INT8U         OSQBufPost              (OS_EVENT        *pevent,
+                                       void            *pbuf,
+                                       INT32U           len);
+
+INT8U         OSQBufRelease           (void            *pbuf);
+
+INT8U         OSQBufRetain            (void            *pbuf);
+#endif
+
 #endif
 
 
@@ -1164,6 +1346,11 @@ INT8U         OSSemPendAbort          (OS_EVENT        *pevent,
 
 INT8U         OSSemPost               (OS_EVENT        *pevent);
 
+#if OS_SEM_POST_N_EN > 0u
+INT8U         OSSemPostN              (OS_EVENT        *pevent,
+                                       INT16U           cnt);
+#endif
+
 #if OS_SEM_QUERY_EN > 0u
 INT8U         OSSemQuery              (OS_EVENT        *pevent,
                                        OS_SEM_DATA     *p_sem_data);
@@ -1375,6 +1562,12 @@ void          OS_EventTaskRemoveMulti (OS_TCB          *ptcb,
                                        OS_EVENT       **pevents_multi);
 #endif
 
+#if (OS_EVENT_SET_EN > 0u)
+void          OS_EventSetSignal       (OS_EVENT        *pevent);
+
+void          OS_EventSetUnlink       (OS_EVENT        *pevent);
+#endif
+
 void          OS_EventWaitListInit    (OS_EVENT        *pevent);
 #endif
 
@@ -1384,11 +1577,11 @@ void          OS_FlagUnlink           (OS_FLAG_NODE    *pnode);
 #endif
 
 void          OS_MemClr               (INT8U           *pdest,
-                                       INT16U           size);
+                                       INT32U           size);
 
 void          OS_MemCopy              (INT8U           *pdest,
                                        INT8U           *psrc,
-                                       INT16U           size);
+                                       INT32U           size);
 
 #if (OS_MEM_EN > 0u) && (OS_MAX_MEM_PART > 0u)
 void          OS_MemInit              (void);
@@ -1418,6 +1611,10 @@ void          OS_TaskStkClr           (OS_STK          *pbos,
                                        INT16U           opt);
 #endif
 
+#if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u) && (OS_TASK_STK_CLR_PAGE_SIZE > 0u)
+void          OS_TaskStkClrPage       (OS_TCB          *ptcb);
+#endif
+
 #if (OS_TASK_STAT_STK_CHK_EN > 0u) && (OS_TASK_CREATE_EXT_EN > 0u)
 void          OS_TaskStatStkChk       (void);
 #endif
@@ -1553,6 +1750,10 @@ void          InputFile              (void);
     #error  "OS_CFG.H, Missing OS_FLAG_WAIT_CLR_EN: Include code for Wait on Clear EVENT FLAGS"
     #endif
 
+    #ifndef OS_FLAG_WAIT_IX_EN
+    #error  "OS_CFG.H, Missing OS_FLAG_WAIT_IX_EN: Index waiters by flag bit to speed up OSFlagPost()"
+    #endif
+
     #ifndef OS_FLAG_ACCEPT_EN
     #error  "OS_CFG.H, Missing OS_FLAG_ACCEPT_EN: Include code for OSFlagAccept()"
     #endif
@@ -1628,6 +1829,20 @@ void          InputFile              (void);
     #ifndef OS_MEM_QUERY_EN
     #error  "OS_CFG.H, Missing OS_MEM_QUERY_EN: Include code for OSMemQuery()"
     #endif
+
+    #ifndef OS_MEM_SLAB_EN
+    #error  "OS_CFG.H, Missing OS_MEM_SLAB_EN: Include code for the size-class allocator, OSMemSlab*()"
+    #elif   OS_MEM_SLAB_EN > 0u
+        #if    !defined(OS_MEM_SLAB_SHIFT_MIN) || !defined(OS_MEM_SLAB_SHIFT_MAX) || !defined(OS_MEM_SLAB_SUB_BITS)
+        #error  "OS_CFG.H, Missing OS_MEM_SLAB_SHIFT_MIN, OS_MEM_SLAB_SHIFT_MAX or OS_MEM_SLAB_SUB_BITS"
+        #elif   OS_MEM_SLAB_SHIFT_MIN < OS_MEM_SLAB_SUB_BITS
+        #error  "OS_CFG.H, OS_MEM_SLAB_SHIFT_MIN must be >= OS_MEM_SLAB_SUB_BITS"
+        #elif  (OS_MEM_SLAB_SHIFT_MAX < OS_MEM_SLAB_SHIFT_MIN) || (OS_MEM_SLAB_SHIFT_MAX > 30u)
+        #error  "OS_CFG.H, OS_MEM_SLAB_SHIFT_MAX must be >= OS_MEM_SLAB_SHIFT_MIN and <= 30"
+        #elif  (((OS_MEM_SLAB_SHIFT_MAX - OS_MEM_SLAB_SHIFT_MIN) << OS_MEM_SLAB_SUB_BITS) + 1u) > 254u
+        #error  "OS_CFG.H, OS_MEM_SLAB_SHIFT_MIN, OS_MEM_SLAB_SHIFT_MAX and OS_MEM_SLAB_SUB_BITS give more than 254 classes"
+        #endif
+    #endif
 #endif
 
 /*
@@ -1685,10 +1900,18 @@ void          InputFile              (void);
     #error  "OS_CFG.H, Missing OS_Q_PEND_ABORT_EN: Include code for OSQPendAbort()"
     #endif
 
+    #ifndef OS_Q_PEND_N_EN
+    #error  "OS_CFG.H, Missing OS_Q_PEND_N_EN: Include code for OSQPendN()"
+    #endif
+
     #ifndef OS_Q_POST_EN
     #error  "OS_CFG.H, Missing OS_Q_POST_EN: Include code for OSQPost()"
     #endif
 
+    #ifndef OS_Q_POST_N_EN
+    #error  "OS_CFG.H, Missing OS_Q_POST_N_EN: Include code for OSQPostN()"
+    #endif
+
     #ifndef OS_Q_POST_FRONT_EN
     #error  "OS_CFG.H, Missing OS_Q_POST_FRONT_EN: Include code for OSQPostFront()"
     #endif
@@ -1700,6 +1923,14 @@ void          InputFile              (void);
     #ifndef OS_Q_QUERY_EN
     #error  "OS_CFG.H, Missing OS_Q_QUERY_EN: Include code for OSQQuery()"
     #endif
+
+    #ifndef OS_Q_BUF_EN
+    #error  "OS_CFG.H, Missing OS_Q_BUF_EN: Include code for zero-copy messages, OSQBuf*()"
+    #elif   OS_Q_BUF_EN > 0u
+        #if    (OS_MEM_EN == 0u) || (OS_MAX_MEM_PART == 0u) || (OS_Q_POST_EN == 0u)
+        #error  "OS_CFG.H, OS_Q_BUF_EN requires OS_MEM_EN, OS_MAX_MEM_PART > 0 and OS_Q_POST_EN"
+        #endif
+    #endif
 #endif
 
 /*
@@ -1723,6 +1954,10 @@ void          InputFile              (void);
     #error  "OS_CFG.H, Missing OS_SEM_PEND_ABORT_EN: Include code for OSSemPendAbort()"
     #endif
 
+    #ifndef OS_SEM_POST_N_EN
+    #error  "OS_CFG.H, Missing OS_SEM_POST_N_EN: Include code for OSSemPostN()"
+    #endif
+
     #ifndef OS_SEM_QUERY_EN
     #error  "OS_CFG.H, Missing OS_SEM_QUERY_EN: Include code for OSSemQuery()"
     #endif
@@ -1771,6 +2006,18 @@ void          InputFile              (void);
 #error  "OS_CFG.H, Missing OS_TASK_STAT_STK_CHK_EN: Check task stacks from statistics task"
 #endif
 
+#ifndef OS_TASK_STK_CLR_PAGE_SIZE
+#error  "OS_CFG.H, Missing OS_TASK_STK_CLR_PAGE_SIZE: Stack entries cleared at a time, 0 to clear whole stack"
+#endif
+
+#ifndef OS_TASK_STK_CHK_INCR_EN
+#error  "OS_CFG.H, Missing OS_TASK_STK_CHK_INCR_EN: Probe stacks from the last high-water mark only"
+#endif
+
+#ifndef OS_TASK_STK_CHK_INCR_GAP
+#error  "OS_CFG.H, Missing OS_TASK_STK_CHK_INCR_GAP: Zero entries in a row that end a probe"
+#endif
+
 #ifndef OS_TASK_CHANGE_PRIO_EN
 #error  "OS_CFG.H, Missing OS_TASK_CHANGE_PRIO_EN: Include code for OSTaskChangePrio()"
 #endif
@@ -1871,6 +2118,16 @@ void          InputFile              (void);
         #endif
     #endif
 
+    #ifndef OS_TMR_CFG_WHEEL_HIER_EN
+    #error  "OS_CFG.H, Missing OS_TMR_CFG_WHEEL_HIER_EN: Use a hierarchical timer wheel"
+    #elif   OS_TMR_CFG_WHEEL_HIER_EN > 0u
+        #ifndef OS_TMR_CFG_WHEEL_BITS
+        #error  "OS_CFG.H, Missing OS_TMR_CFG_WHEEL_BITS: Sets the number of spokes per level (2^n) of the hierarchical wheel"
+        #elif  (OS_TMR_CFG_WHEEL_BITS < 2u) || (OS_TMR_CFG_WHEEL_BITS > 10u)
+        #error  "OS_CFG.H, OS_TMR_CFG_WHEEL_BITS should be between 2 and 10"
+        #endif
+    #endif
+
     #ifndef OS_TMR_CFG_NAME_EN
     #error  "OS_CFG.H, Missing OS_TMR_CFG_NAME_EN: Enable Timer names"
     #endif
@@ -1935,6 +2192,11 @@ void          InputFile              (void);
 #endif
 
 
+#ifndef OS_EVENT_SET_EN
+#error  "OS_CFG.H, Missing OS_EVENT_SET_EN: Include code for event sets (OSEventSetPend())"
+#endif
+
+
 #ifndef OS_TASK_PROFILE_EN
 #error  "OS_CFG.H, Missing OS_TASK_PROFILE_EN: Include data structure for run-time task profiling"
 #endif
@@ -95,6 +95,30 @@ extern "C" {
 #define  OS_CFG_INVALID_OS_CALLS_CHK_EN  DEF_DISABLED
 #endif
 
+#ifndef OS_CFG_TICK_LIST_HEAP_EN
+#define  OS_CFG_TICK_LIST_HEAP_EN        DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MSG_POOL_SHARD_EN
+#define  OS_CFG_MSG_POOL_SHARD_EN        DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_MSG_POOL_BATCH
+#define  OS_CFG_MSG_POOL_BATCH                     4u
+#endif
+
+#ifndef OS_CFG_STAT_TASK_TS_EN
+#define  OS_CFG_STAT_TASK_TS_EN          DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_STAT_TASK_AVG_SHIFT
+#define  OS_CFG_STAT_TASK_AVG_SHIFT                3u
+#endif
+
+#ifndef OS_CFG_SCHED_LOCK_TIME_HIST_NBR
+#define  OS_CFG_SCHED_LOCK_TIME_HIST_NBR           0u
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -131,6 +155,8 @@ extern "C" {
 
 
 #define  OS_PRIO_TBL_SIZE          (((OS_CFG_PRIO_MAX - 1u) / (DEF_INT_CPU_NBR_BITS)) + 1u)
+                                                                /* Summary of OSPrioTbl[], one bit per entry            */
+#define  OS_PRIO_GRP_TBL_SIZE      (((OS_PRIO_TBL_SIZE - 1u) / (DEF_INT_CPU_NBR_BITS)) + 1u)
 
 #define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN == DEF_ENABLED) || (OS_CFG_Q_EN == DEF_ENABLED)) ? DEF_ENABLED : DEF_DISABLED)
 
@@ -850,6 +876,9 @@ struct  os_msg_pool {                                       /* OS_MSG POOL
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MSG_QTY           NbrUsedMax;                        /* Peak number of messages used                           */
 #endif
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+    CPU_INT32U           NbrEmptyCtr;                       /* Number of posts that found no OS_MSG to use            */
+#endif
 };
 
 
@@ -862,6 +891,12 @@ struct  os_msg_q {                                          /* OS_MSG_Q
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
 #endif
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+    OS_MSG              *FreePtr;                           /* Cache of free OS_MSGs taken from OSMsgPool             */
+    OS_MSG_QTY           NbrFree;                           /* Number of OS_MSGs in the cache                         */
+    OS_MSG_QTY           NbrQuota;                          /* Number of OS_MSGs reserved for the queue               */
+    CPU_INT32U           NbrEmptyCtr;                       /* Number of posts that found no OS_MSG to use            */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -1022,6 +1057,9 @@ struct os_tcb {
     OS_TCB              *TickPrevPtr;
 
     OS_TICK_LIST        *TickListPtr;                       /* Pointer to tick list if task is in a tick list         */
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    OS_TCB              *TickChildPtr;                      /* Pointer to first child when tick lists are heaps       */
+#endif
 #endif
 
 #if ((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED) || (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED))
@@ -1067,6 +1105,10 @@ struct os_tcb {
 #if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
     OS_TICK              TickRemain;                        /* Number of ticks remaining (updated by OS_TickTask()    */
     OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    OS_TICK              TickMatch;                         /* Value of OSTickCtr at which the delay/timeout expires  */
+                                                            /* ... '.TickRemain' is then only set on insert/removal   */
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
@@ -1113,6 +1155,9 @@ struct os_tcb {
     CPU_TS               CyclesStart;                       /* Snapshot of cycle counter at start of task resumption  */
     OS_CYCLES            CyclesTotal;                       /* Total number of # of cycles the task has been running  */
     OS_CYCLES            CyclesTotalPrev;                   /* Snapshot of previous # of cycles                       */
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    OS_CPU_USAGE         CPUUsageAvg;                       /* CPU Usage of task (0.00-100.00%) - Moving average      */
+#endif
 
     CPU_TS               SemPendTime;                       /* Time it took for signal to be received                 */
     CPU_TS               SemPendTimeMax;                    /* Max amount of time it took for signal to be received   */
@@ -1128,6 +1173,10 @@ struct os_tcb {
 #endif
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN == DEF_ENABLED)
     CPU_TS               SchedLockTimeMax;                  /* Maximum scheduler lock time                            */
+#if (OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0u)
+                                                            /* Histogram of the scheduler lock times of the task      */
+    CPU_INT32U           SchedLockTimeHist[OS_CFG_SCHED_LOCK_TIME_HIST_NBR];
+#endif
 #endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1217,6 +1266,10 @@ OS_EXT            OS_TCB                    OSIdleTaskTCB;
 
                                                                         /* MISCELLANEOUS ---------------------------- */
 OS_EXT            OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+OS_EXT            CPU_TS                    OSIntCyclesStart;           /* Snapshot of cycle counter at ISR entry     */
+OS_EXT            OS_CYCLES                 OSIntCyclesTotal;           /* Total number of cycles spent in ISRs       */
+#endif
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
 #if (OS_CFG_TS_EN == DEF_ENABLED)
 OS_EXT            CPU_TS                    OSIntDisTimeMax;            /* Overall interrupt disable time             */
@@ -1260,6 +1313,12 @@ OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Numbe
 OS_EXT            OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
 OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
 extern            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+extern            CPU_DATA                  OSPrioGrpTbl[OS_PRIO_GRP_TBL_SIZE];
+#if (OS_PRIO_TBL_SIZE > DEF_INT_CPU_NBR_BITS)
+extern            CPU_DATA                  OSPrioGrpTop;
+#endif
+#endif
 
                                                                         /* QUEUES ----------------------------------- */
 #if (OS_CFG_Q_EN == DEF_ENABLED)
@@ -1319,6 +1378,13 @@ OS_EXT            OS_TCB                    OSStatTaskTCB;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
 OS_EXT            CPU_TS                    OSStatTaskTimeMax;
 #endif
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+OS_EXT            OS_CPU_USAGE              OSStatTaskCPUUsageAvg;      /* CPU Usage in % (Moving average)            */
+OS_EXT            OS_CPU_USAGE              OSStatIntCPUUsage;          /* CPU Usage of ISRs in %                     */
+OS_EXT            OS_CPU_USAGE              OSStatIntCPUUsageAvg;       /* CPU Usage of ISRs in % (Moving average)    */
+OS_EXT            OS_CYCLES                 OSStatIntCyclesPrev;        /* Snapshot of OSIntCyclesTotal               */
+OS_EXT            CPU_TS                    OSStatTaskTSPrev;           /* Timestamp of the start of the window       */
+#endif
 #endif
 
                                                                         /* TASKS ------------------------------------ */
@@ -1681,6 +1747,12 @@ void          OSQPost                   (OS_Q                  *p_q,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void          OSQQuotaSet               (OS_Q                  *p_q,
+                                         OS_MSG_QTY             quota,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
@@ -1795,6 +1867,12 @@ void          OSTaskQPost               (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void          OSTaskQQuotaSet           (OS_TCB                *p_tcb,
+                                         OS_MSG_QTY             quota,
+                                         OS_ERR                *p_err);
+#endif
+
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -2017,6 +2095,12 @@ void          OSInit                    (OS_ERR                *p_err);
 void          OSIntEnter                (void);
 void          OSIntExit                 (void);
 
+#if (OS_MSG_EN == DEF_ENABLED) && (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void          OSMsgPoolExtend           (OS_MSG                *p_base,
+                                         OS_MSG_QTY             size,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
 void          OSSchedRoundRobinCfg      (CPU_BOOLEAN            en,
                                          OS_TICK                dflt_time_quanta,
@@ -2112,6 +2196,10 @@ void          OS_Dbg_Init               (void);
 
 void          OS_MsgPoolInit            (OS_ERR                *p_err);
 
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void          OS_MsgQCacheFree          (OS_MSG_Q              *p_msg_q);
+#endif
+
 OS_MSG_QTY    OS_MsgQFreeAll            (OS_MSG_Q              *p_msg_q);
 
 void         *OS_MsgQGet                (OS_MSG_Q              *p_msg_q,
@@ -2129,6 +2217,12 @@ void          OS_MsgQPut                (OS_MSG_Q              *p_msg_q,
                                          CPU_TS                 ts,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void          OS_MsgQQuotaSet           (OS_MSG_Q              *p_msg_q,
+                                         OS_MSG_QTY             quota,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ---------------------------------------------- PEND/POST MANAGEMENT ---------------------------------------------- */
 
 void          OS_Pend                   (OS_PEND_OBJ           *p_obj,
@@ -2267,6 +2361,10 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H,         OS_CFG_PRIO_MAX must be >= 8"
 #endif
 
+#if     OS_PRIO_GRP_TBL_SIZE > DEF_INT_CPU_NBR_BITS
+#error  "OS_CFG.H,         OS_CFG_PRIO_MAX must be <= DEF_INT_CPU_NBR_BITS ^ 3"
+#endif
+
 
 #ifndef OS_CFG_SCHED_LOCK_TIME_MEAS_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_LOCK_TIME_MEAS_EN: Include code to measure scheduler lock time"
@@ -2275,6 +2373,14 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
            (OS_CFG_TS_EN                   == DEF_DISABLED)
     #error  "OS_CFG.H,         OS_CFG_TS_EN must be Enabled (1) to measure scheduler lock time"
     #endif
+    #if    (OS_CFG_SCHED_LOCK_TIME_HIST_NBR >  0u) && \
+           (OS_CFG_SCHED_LOCK_TIME_MEAS_EN  == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_SCHED_LOCK_TIME_MEAS_EN must be Enabled (1) to use OS_CFG_SCHED_LOCK_TIME_HIST_NBR"
+    #endif
+    #if    (OS_CFG_SCHED_LOCK_TIME_HIST_NBR == 1u) || \
+           (OS_CFG_SCHED_LOCK_TIME_HIST_NBR >  33u)
+    #error  "OS_CFG.H,         OS_CFG_SCHED_LOCK_TIME_HIST_NBR must be 0 or between 2 and 33"
+    #endif
 #endif
 
 
@@ -2368,6 +2474,10 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #endif
 #endif
 
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED) && (OS_CFG_MSG_POOL_BATCH == 0u)
+#error  "OS_CFG.H,         OS_CFG_MSG_POOL_BATCH must be > 0"
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      SEMAPHORES
@@ -2404,6 +2514,21 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_STAT_TASK_STK_CHK_EN: Check task stacks from statistics task"
 #endif
 
+#if    (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    #if    (OS_CFG_STAT_TASK_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_STAT_TASK_EN must be Enabled (1) to use OS_CFG_STAT_TASK_TS_EN"
+    #endif
+    #if    (OS_CFG_TASK_PROFILE_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TASK_PROFILE_EN must be Enabled (1) to use OS_CFG_STAT_TASK_TS_EN"
+    #endif
+    #if    (OS_CFG_TS_EN == DEF_DISABLED)
+    #error  "OS_CFG.H,         OS_CFG_TS_EN must be Enabled (1) to use OS_CFG_STAT_TASK_TS_EN"
+    #endif
+    #if    (OS_CFG_STAT_TASK_AVG_SHIFT > 15u)
+    #error  "OS_CFG.H,         OS_CFG_STAT_TASK_AVG_SHIFT must be <= 15"
+    #endif
+#endif
+
 #ifndef OS_CFG_TASK_CHANGE_PRIO_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_CHANGE_PRIO_EN: Include code for OSTaskChangePrio()"
 #endif
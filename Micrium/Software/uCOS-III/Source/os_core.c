@@ -73,6 +73,10 @@ void  OSInit (OS_ERR  *p_err)
     OSInitHook();                                               /* Call port specific initialization code               */
 
     OSIntNestingCtr       =           0u;                       /* Clear the interrupt nesting counter                  */
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    OSIntCyclesStart      =           0u;
+    OSIntCyclesTotal      =           0u;
+#endif
 
     OSRunning             =  OS_STATE_OS_STOPPED;               /* Indicate that multitasking has not started           */
 
@@ -266,6 +270,8 @@ void  OSInit (OS_ERR  *p_err)
 *                 at the end of the ISR.
 *
 *              5) You are allowed to nest interrupts up to 250 levels deep.
+*
+*              6) With OS_CFG_STAT_TASK_TS_EN, the time spent in ISRs is measured from the entry of the outermost ISR.
 ************************************************************************************************************************
 */
 
@@ -282,6 +288,11 @@ void  OSIntEnter (void)
     }
 
     OSIntNestingCtr++;                                          /* Increment ISR nesting level                          */
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    if (OSIntNestingCtr == 1u) {                                /* See Note #6                                          */
+        OSIntCyclesStart = OS_TS_GET();
+    }
+#endif
 }
 
 
@@ -302,6 +313,9 @@ void  OSIntEnter (void)
 *                 at the end of the ISR.
 *
 *              2) Rescheduling is prevented when the scheduler is locked (see OSSchedLock())
+*
+*              3) With OS_CFG_STAT_TASK_TS_EN, the time spent in the outermost ISR is added to OSIntCyclesTotal and
+*                 not charged to the interrupted task: its '.CyclesStart' is moved forward by the same amount.
 ************************************************************************************************************************
 */
 
@@ -309,6 +323,9 @@ void  OSIntExit (void)
 {
 #if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
     CPU_BOOLEAN  stk_status;
+#endif
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    CPU_TS       ts_int;
 #endif
     CPU_SR_ALLOC();
 
@@ -332,6 +349,12 @@ void  OSIntExit (void)
         return;
     }
 
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    ts_int                    = OS_TS_GET() - OSIntCyclesStart; /* See Note #3                                          */
+    OSIntCyclesTotal         += (OS_CYCLES)ts_int;
+    OSTCBCurPtr->CyclesStart += ts_int;
+#endif
+
     if (OSSchedLockNestingCtr > 0u) {                           /* Scheduler still locked?                              */
         OS_TRACE_ISR_EXIT();
         CPU_INT_EN();                                           /* Yes                                                  */
@@ -2015,6 +2038,10 @@ void  OS_RdyListRemove (OS_TCB  *p_tcb)
 *                 don't expect to have the scheduler locked for 65536 counts even at the rate the TS timer is updated.
 *                 In other words, locking the scheduler for longer than 65536 count would not be a good thing for a
 *                 real-time system.
+*
+*              4) With OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0, each lock time is also counted in the histogram of the task
+*                 which locked the scheduler.  Bucket 0 holds the lock times of 0 counts, bucket 'n' the ones below 2^n
+*                 counts but not below 2^(n-1), and the last bucket everything above.
 ************************************************************************************************************************
 */
 
@@ -2032,6 +2059,9 @@ void  OS_SchedLockTimeMeasStart (void)
 void  OS_SchedLockTimeMeasStop (void)
 {
     CPU_TS_TMR  delta;
+#if (OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0u)
+    CPU_INT08U  ix;
+#endif
 
 
     if (OSSchedLockNestingCtr == 0u) {                          /* Make sure we fully un-nested scheduler lock          */
@@ -2043,6 +2073,14 @@ void  OS_SchedLockTimeMeasStop (void)
         if (OSSchedLockTimeMaxCur < delta) {                    /* Detect peak value (for resettable value)             */
             OSSchedLockTimeMaxCur = delta;
         }
+#if (OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0u)
+        ix = 0u;                                                /* Bucket of the lock time (see Note #4)                */
+        while ((ix < (OS_CFG_SCHED_LOCK_TIME_HIST_NBR - 1u)) &&
+               ((delta >> ix) != 0u)) {
+            ix++;
+        }
+        OSTCBCurPtr->SchedLockTimeHist[ix]++;                   /* Charge the task which locked the scheduler           */
+#endif
     }
 }
 #endif
@@ -273,6 +273,12 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSPrioCur)
                                   + sizeof(OSPrioHighRdy)
                                   + sizeof(OSPrioTbl)
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+                                  + sizeof(OSPrioGrpTbl)
+#if (OS_PRIO_TBL_SIZE > DEF_INT_CPU_NBR_BITS)
+                                  + sizeof(OSPrioGrpTop)
+#endif
+#endif
 
 #if (OS_CFG_Q_EN == DEF_ENABLED)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -42,6 +42,102 @@ const  CPU_CHAR  *os_msg__c = "$Id: $";
 
 #if (OS_MSG_EN == DEF_ENABLED)
 
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+static  OS_MSG_QTY  OS_MsgQCacheFill (OS_MSG_Q    *p_msg_q,
+                                      OS_MSG_QTY   qty);
+
+static  void        OS_MsgQCacheTrim (OS_MSG_Q    *p_msg_q,
+                                      OS_MSG_QTY   keep);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               EXTEND THE POOL OF 'OS_MSG'
+*
+* Description: This function adds a block of OS_MSGs to the pool at run-time, e.g. once the application knows how many
+*              messages its queues need.
+*
+* Argument(s): p_base    is a pointer to an array of OS_MSGs to add to the pool.  The array must remain allocated for as
+*                        long as the kernel runs.
+*
+*              size      is the number of OS_MSGs in the array.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_MSG_POOL_NULL_PTR    if 'p_base' is a NULL pointer
+*                            OS_ERR_MSG_POOL_EMPTY       if 'size' is 0
+*                            OS_ERR_NONE                 the OS_MSGs were added to the pool
+*
+* Returns    : none
+*
+* Note(s)    : 1) The total number of OS_MSGs must fit in an OS_MSG_QTY.
+*
+*              2) 'size' is checked even when OS_CFG_ARG_CHK_EN is disabled: the chain is built from 'p_base' on,
+*                 so an empty array would link 'p_base' into the pool without counting it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void  OSMsgPoolExtend (OS_MSG      *p_base,
+                       OS_MSG_QTY   size,
+                       OS_ERR      *p_err)
+{
+    OS_MSG      *p_msg;
+    OS_MSG_QTY   i;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_base == (OS_MSG *)0) {
+       *p_err = OS_ERR_MSG_POOL_NULL_PTR;
+        return;
+    }
+#endif
+    if (size == 0u) {                                           /* See Note #2                                          */
+       *p_err = OS_ERR_MSG_POOL_EMPTY;
+        return;
+    }
+
+    p_msg = p_base;                                             /* Chain the new OS_MSGs, not visible to the kernel yet */
+    for (i = 1u; i < size; i++) {
+        p_msg->NextPtr = p_msg + 1u;
+        p_msg->MsgPtr  = (void *)0;
+        p_msg->MsgSize =         0u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        p_msg->MsgTS   =         0u;
+#endif
+        p_msg++;
+    }
+    p_msg->MsgPtr  = (void *)0;
+    p_msg->MsgSize =         0u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_msg->MsgTS   =         0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_msg->NextPtr     = OSMsgPool.NextPtr;                     /* Add the chain at the beginning of the free list      */
+    OSMsgPool.NextPtr  = p_base;
+    OSMsgPool.NbrFree += size;
+    CPU_CRITICAL_EXIT();
+   *p_err              = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                            INITIALIZE THE POOL OF 'OS_MSG'
@@ -105,6 +201,9 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     OSMsgPool.NbrUsed    = 0u;
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSMsgPool.NbrUsedMax = 0u;
+#endif
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+    OSMsgPool.NbrEmptyCtr = 0u;
 #endif
    *p_err                = OS_ERR_NONE;
 }
@@ -122,6 +221,9 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
 * Returns    : the number of OS_MSGs returned to the free list
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_MSG_POOL_SHARD_EN, the OS_MSGs go to the cache of the queue, which is then trimmed down to
+*                 the quota of the queue.
 ************************************************************************************************************************
 */
 
@@ -135,21 +237,55 @@ OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
     qty = p_msg_q->NbrEntries;                                  /* Get the number of OS_MSGs being freed                */
     if (p_msg_q->NbrEntries > 0u) {
         p_msg                   = p_msg_q->InPtr;               /* Point to end of message chain                        */
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+        p_msg->NextPtr          = p_msg_q->FreePtr;             /* See Note #2                                          */
+        p_msg_q->FreePtr        = p_msg_q->OutPtr;
+        p_msg_q->NbrFree       += p_msg_q->NbrEntries;
+#else
         p_msg->NextPtr          = OSMsgPool.NextPtr;
         OSMsgPool.NextPtr       = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
         OSMsgPool.NbrUsed      -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
         OSMsgPool.NbrFree      += p_msg_q->NbrEntries;
+#endif
         p_msg_q->NbrEntries     =           0u;                 /* Flush the message queue                              */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
         p_msg_q->NbrEntriesMax  =           0u;
 #endif
         p_msg_q->InPtr          = (OS_MSG *)0;
         p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+        OS_MsgQCacheTrim(p_msg_q, p_msg_q->NbrQuota);
+#endif
     }
     return (qty);
 }
 
 
+/*
+************************************************************************************************************************
+*                                        RELEASE THE CACHE OF A MESSAGE QUEUE
+*
+* Description: This function returns all the OS_MSGs cached by a message queue to the pool and removes its quota.  It is
+*              called when the queue (or the task owning it) is deleted, after OS_MsgQFreeAll().
+*
+* Arguments  : p_msg_q       is a pointer to the OS_MSG_Q structure.
+*              -------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void  OS_MsgQCacheFree (OS_MSG_Q  *p_msg_q)
+{
+    p_msg_q->NbrQuota = 0u;
+    OS_MsgQCacheTrim(p_msg_q, 0u);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               INITIALIZE A MESSAGE QUEUE
@@ -177,6 +313,12 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 #endif
     p_msg_q->InPtr          = (OS_MSG *)0;
     p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+    p_msg_q->FreePtr        = (OS_MSG *)0;
+    p_msg_q->NbrFree        =           0u;
+    p_msg_q->NbrQuota       =           0u;
+    p_msg_q->NbrEmptyCtr    =           0u;
+#endif
 }
 
 
@@ -201,6 +343,9 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 * Returns    : The message (a pointer)
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_MSG_POOL_SHARD_EN, the OS_MSG is kept in the cache of the queue.  Once the queue is empty,
+*                 the OS_MSGs cached beyond its quota are returned to the pool.
 ************************************************************************************************************************
 */
 
@@ -246,10 +391,19 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
         p_msg_q->NbrEntries--;                                  /* Yes, One less message in the queue                   */
     }
 
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+    p_msg->NextPtr    = p_msg_q->FreePtr;                       /* Return message control block to cache of the queue   */
+    p_msg_q->FreePtr  = p_msg;
+    p_msg_q->NbrFree++;
+    if (p_msg_q->NbrEntries == 0u) {                            /* See Note #2                                          */
+        OS_MsgQCacheTrim(p_msg_q, p_msg_q->NbrQuota);
+    }
+#else
     p_msg->NextPtr    = OSMsgPool.NextPtr;                      /* Return message control block to free list            */
     OSMsgPool.NextPtr = p_msg;
     OSMsgPool.NbrFree++;
     OSMsgPool.NbrUsed--;
+#endif
 
    *p_err             = OS_ERR_NONE;
     return (p_void);
@@ -285,6 +439,10 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_MSG_POOL_SHARD_EN, the OS_MSG is taken from the cache of the queue.  An empty cache is
+*                 refilled with up to OS_CFG_MSG_POOL_BATCH OS_MSGs from the pool, so that the pool is only accessed
+*                 once per batch.
 ************************************************************************************************************************
 */
 
@@ -308,6 +466,22 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
         return;
     }
 
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+    if (p_msg_q->NbrFree == 0u) {                               /* See Note #2                                          */
+        (void)OS_MsgQCacheFill(p_msg_q,
+                               (OS_MSG_QTY)DEF_MIN(OS_CFG_MSG_POOL_BATCH, p_msg_q->NbrEntriesSize - p_msg_q->NbrEntries));
+        if (p_msg_q->NbrFree == 0u) {
+            p_msg_q->NbrEmptyCtr++;
+            OSMsgPool.NbrEmptyCtr++;
+           *p_err = OS_ERR_MSG_POOL_EMPTY;                      /* No more OS_MSG to use                                */
+            return;
+        }
+    }
+
+    p_msg            = p_msg_q->FreePtr;                        /* Remove message control block from cache of the queue */
+    p_msg_q->FreePtr = p_msg->NextPtr;
+    p_msg_q->NbrFree--;
+#else
     if (OSMsgPool.NbrFree == 0u) {
        *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* No more OS_MSG to use                                */
         return;
@@ -322,6 +496,7 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
     if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
         OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
     }
+#endif
 #endif
 
     if (p_msg_q->NbrEntries == 0u) {                            /* Is this first message placed in the queue?           */
@@ -355,4 +530,151 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
 #endif
    *p_err          = OS_ERR_NONE;
 }
+
+
+/*
+************************************************************************************************************************
+*                                         SET THE QUOTA OF A MESSAGE QUEUE
+*
+* Description: This function reserves OS_MSGs of the pool for a message queue.  A queue holding less entries than its
+*              quota never runs out of OS_MSGs, whatever the other queues do.
+*
+* Arguments  : p_msg_q       is a pointer to the message queue
+*              -------
+*
+*              quota         is the number of OS_MSGs to reserve.  0 returns the reserved OS_MSGs to the pool.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_MSG_POOL_EMPTY  if the pool does not have enough free OS_MSGs
+*                              OS_ERR_Q_SIZE          if 'quota' is larger than the size of the queue
+*                              OS_ERR_NONE            the quota was set
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The entries of the queue count in its quota.  The OS_MSGs missing to reach the quota are taken from the
+*                 pool in the cache of the queue, and the ones beyond the quota are returned.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void  OS_MsgQQuotaSet (OS_MSG_Q    *p_msg_q,
+                       OS_MSG_QTY   quota,
+                       OS_ERR      *p_err)
+{
+    OS_MSG_QTY  held;
+
+
+    if (quota > p_msg_q->NbrEntriesSize) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+
+    held = p_msg_q->NbrEntries + p_msg_q->NbrFree;              /* See Note #2                                          */
+    if (quota > held) {
+        if ((OS_MSG_QTY)(quota - held) > OSMsgPool.NbrFree) {
+           *p_err = OS_ERR_MSG_POOL_EMPTY;
+            return;
+        }
+        (void)OS_MsgQCacheFill(p_msg_q, quota - held);
+    }
+    p_msg_q->NbrQuota = quota;
+    if (quota > p_msg_q->NbrEntries) {
+        OS_MsgQCacheTrim(p_msg_q, quota - p_msg_q->NbrEntries);
+    } else {
+        OS_MsgQCacheTrim(p_msg_q, 0u);
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        FILL THE CACHE OF A MESSAGE QUEUE
+*
+* Description: This function moves OS_MSGs from the pool to the cache of a message queue.
+*
+* Arguments  : p_msg_q       is a pointer to the message queue
+*              -------
+*
+*              qty           is the number of OS_MSGs wanted
+*
+* Returns    : The number of OS_MSGs moved, less than 'qty' if the pool runs out of OS_MSGs.
+*
+* Note(s)    : 1) The OS_MSGs held by the caches are counted as used by the pool.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+static  OS_MSG_QTY  OS_MsgQCacheFill (OS_MSG_Q    *p_msg_q,
+                                      OS_MSG_QTY   qty)
+{
+    OS_MSG      *p_msg;
+    OS_MSG_QTY   i;
+
+
+    if (qty > OSMsgPool.NbrFree) {
+        qty = OSMsgPool.NbrFree;
+    }
+    for (i = 0u; i < qty; i++) {
+        p_msg             = OSMsgPool.NextPtr;                  /* Move one OS_MSG from the free list to the cache      */
+        OSMsgPool.NextPtr = p_msg->NextPtr;
+        p_msg->NextPtr    = p_msg_q->FreePtr;
+        p_msg_q->FreePtr  = p_msg;
+    }
+    p_msg_q->NbrFree   += qty;
+    OSMsgPool.NbrFree  -= qty;                                  /* See Note #1                                          */
+    OSMsgPool.NbrUsed  += qty;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
+        OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
+    }
+#endif
+    return (qty);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        TRIM THE CACHE OF A MESSAGE QUEUE
+*
+* Description: This function returns the OS_MSGs cached by a message queue beyond 'keep' to the pool.
+*
+* Arguments  : p_msg_q       is a pointer to the message queue
+*              -------
+*
+*              keep          is the number of OS_MSGs to leave in the cache
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+static  void  OS_MsgQCacheTrim (OS_MSG_Q    *p_msg_q,
+                                OS_MSG_QTY   keep)
+{
+    OS_MSG      *p_msg;
+    OS_MSG_QTY   qty;
+
+
+    if (p_msg_q->NbrFree <= keep) {
+        return;
+    }
+    qty = p_msg_q->NbrFree - keep;
+    p_msg_q->NbrFree   = keep;
+    OSMsgPool.NbrFree += qty;
+    OSMsgPool.NbrUsed -= qty;
+    while (qty > 0u) {
+        p_msg             = p_msg_q->FreePtr;                   /* Move one OS_MSG from the cache to the free list      */
+        p_msg_q->FreePtr  = p_msg->NextPtr;
+        p_msg->NextPtr    = OSMsgPool.NextPtr;
+        OSMsgPool.NextPtr = p_msg;
+        qty--;
+    }
+}
+#endif
 #endif
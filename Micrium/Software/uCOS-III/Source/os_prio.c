@@ -44,6 +44,13 @@ CPU_DATA   OSPrioTbl[OS_PRIO_TBL_SIZE];                         /* Declare the a
                                                                 /* ... optimization.  In other words, this allows the ...*/
                                                                 /* ... table to be located in fast memory                */
 
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+CPU_DATA   OSPrioGrpTbl[OS_PRIO_GRP_TBL_SIZE];                  /* One bit per non-zero entry of OSPrioTbl[]             */
+#if (OS_PRIO_TBL_SIZE > DEF_INT_CPU_NBR_BITS)
+CPU_DATA   OSPrioGrpTop;                                        /* One bit per non-zero entry of OSPrioGrpTbl[]          */
+#endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                               INITIALIZE THE PRIORITY LIST
@@ -67,6 +74,14 @@ void  OS_PrioInit (void)
     for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
          OSPrioTbl[i] = 0u;
     }
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    for (i = 0u; i < OS_PRIO_GRP_TBL_SIZE; i++) {
+         OSPrioGrpTbl[i] = 0u;
+    }
+#if (OS_PRIO_TBL_SIZE > DEF_INT_CPU_NBR_BITS)
+    OSPrioGrpTop = 0u;
+#endif
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN == DEF_DISABLED)
     OS_PrioInsert ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));            /* Insert what would be the idle task                   */
@@ -85,24 +100,35 @@ void  OS_PrioInit (void)
 * Returns    : The priority of the Highest Priority Task (HPT) waiting for the event
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) OSPrioGrpTbl[] summarizes OSPrioTbl[] and OSPrioGrpTop summarizes OSPrioGrpTbl[], one bit per non-zero
+*                 entry, so the highest priority is found with at most three CPU_CntLeadZeros() whatever the value of
+*                 OS_CFG_PRIO_MAX.  The table is never empty since the idle task is always ready.
 ************************************************************************************************************************
 */
 
 OS_PRIO  OS_PrioGetHighest (void)
 {
-    CPU_DATA  *p_tbl;
-    OS_PRIO    prio;
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    CPU_DATA  grp;
+    CPU_DATA  ix;
+#endif
+    OS_PRIO   prio;
 
 
-    prio  = 0u;
-    p_tbl = &OSPrioTbl[0];
 #if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
-    while (*p_tbl == 0u) {                                      /* Search the bitmap table for the highest priority     */
-        prio += (OS_PRIO)DEF_INT_CPU_NBR_BITS;                  /* Compute the step of each CPU_DATA entry              */
-        p_tbl++;
-    }
+#if (OS_PRIO_TBL_SIZE > DEF_INT_CPU_NBR_BITS)
+    grp  = CPU_CntLeadZeros(OSPrioGrpTop);                      /* Find the first non-zero entry of OSPrioGrpTbl[]      */
+#else
+    grp  = 0u;
+#endif
+    ix   = (grp * DEF_INT_CPU_NBR_BITS)                         /* Find the first non-zero entry of OSPrioTbl[]         */
+         + CPU_CntLeadZeros(OSPrioGrpTbl[grp]);
+    prio = (OS_PRIO)((ix * DEF_INT_CPU_NBR_BITS)                /* Find the position of the first bit set at the entry  */
+         +           CPU_CntLeadZeros(OSPrioTbl[ix]));
+#else
+    prio = (OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[0]);             /* Find the position of the first bit set at the entry  */
 #endif
-    prio += (OS_PRIO)CPU_CntLeadZeros(*p_tbl);                  /* Find the position of the first bit set at the entry  */
 
     return (prio);
 }
@@ -126,6 +152,9 @@ void  OS_PrioInsert (OS_PRIO  prio)
     CPU_DATA  bit;
     CPU_DATA  bit_nbr;
     OS_PRIO   ix;
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    CPU_DATA  grp;
+#endif
 
 #if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
     ix             = prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS;
@@ -137,6 +166,18 @@ void  OS_PrioInsert (OS_PRIO  prio)
     bit            = 1u;
     bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
     OSPrioTbl[ix] |= bit;
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    grp                = (CPU_DATA)ix / DEF_INT_CPU_NBR_BITS;   /* Flag the entry as non-zero in the summary            */
+    bit_nbr            = (CPU_DATA)ix & (DEF_INT_CPU_NBR_BITS - 1u);
+    bit                = 1u;
+    bit              <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
+    OSPrioGrpTbl[grp] |= bit;
+#if (OS_PRIO_TBL_SIZE > DEF_INT_CPU_NBR_BITS)
+    bit                = 1u;
+    bit              <<= (DEF_INT_CPU_NBR_BITS - 1u) - grp;
+    OSPrioGrpTop      |= bit;
+#endif
+#endif
 }
 
 /*
@@ -158,6 +199,9 @@ void  OS_PrioRemove (OS_PRIO  prio)
     CPU_DATA  bit;
     CPU_DATA  bit_nbr;
     OS_PRIO   ix;
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    CPU_DATA  grp;
+#endif
 
 #if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
     ix             = prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS;
@@ -169,4 +213,20 @@ void  OS_PrioRemove (OS_PRIO  prio)
     bit            = 1u;
     bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
     OSPrioTbl[ix] &= ~bit;
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    if (OSPrioTbl[ix] == 0u) {                                  /* Clear the summary once the entry is empty            */
+        grp                = (CPU_DATA)ix / DEF_INT_CPU_NBR_BITS;
+        bit_nbr            = (CPU_DATA)ix & (DEF_INT_CPU_NBR_BITS - 1u);
+        bit                = 1u;
+        bit              <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
+        OSPrioGrpTbl[grp] &= ~bit;
+#if (OS_PRIO_TBL_SIZE > DEF_INT_CPU_NBR_BITS)
+        if (OSPrioGrpTbl[grp] == 0u) {
+            bit            = 1u;
+            bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - grp;
+            OSPrioGrpTop  &= ~bit;
+        }
+#endif
+    }
+#endif
 }
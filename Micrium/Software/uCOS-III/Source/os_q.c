@@ -885,6 +885,70 @@ void  OSQPost (OS_Q         *p_q,
 }
 
 
+/*
+************************************************************************************************************************
+*                                          RESERVE MESSAGES FOR A QUEUE
+*
+* Description: This function reserves OS_MSGs of the pool for a message queue so that posts to this queue always find
+*              an OS_MSG as long as the queue holds less than 'quota' messages.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              quota         is the number of OS_MSGs to reserve, up to the size of the queue.  0 removes the quota.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The quota was set
+*                                OS_ERR_MSG_POOL_EMPTY    If the pool does not have enough free OS_MSGs
+*                                OS_ERR_OBJ_PTR_NULL      If you passed a NULL pointer for 'p_q'
+*                                OS_ERR_OBJ_TYPE          If the message queue was not created
+*                                OS_ERR_Q_SIZE            If 'quota' is larger than the size of the queue
+*
+* Returns    : none
+*
+* Note(s)    : 1) The messages held by the queue count in its quota.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void  OSQQuotaSet (OS_Q        *p_q,
+                   OS_MSG_QTY   quota,
+                   OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OS_MsgQQuotaSet(&p_q->MsgQ,
+                    quota,
+                    p_err);
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                        CLEAR THE CONTENTS OF A MESSAGE QUEUE
@@ -904,6 +968,9 @@ void  OSQPost (OS_Q         *p_q,
 void  OS_QClr (OS_Q  *p_q)
 {
     (void)OS_MsgQFreeAll(&p_q->MsgQ);                           /* Return all OS_MSGs to the free list                  */
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+    OS_MsgQCacheFree(&p_q->MsgQ);                               /* Including the ones cached by the queue               */
+#endif
 #if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
     p_q->Type    =  OS_OBJ_TYPE_NONE;                           /* Mark the data structure as a NONE                    */
 #endif
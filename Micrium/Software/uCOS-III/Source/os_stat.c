@@ -42,6 +42,21 @@ const  CPU_CHAR  *os_stat__c = "$Id: $";
 
 #if (OS_CFG_STAT_TASK_EN == DEF_ENABLED)
 
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+static  OS_CPU_USAGE  OS_StatTaskUsage (OS_CYCLES     cycles,
+                                        OS_CYCLES     cycles_window);
+
+static  OS_CPU_USAGE  OS_StatTaskAvg   (OS_CPU_USAGE  avg,
+                                        OS_CPU_USAGE  usage);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   RESET STATISTICS
@@ -68,6 +83,9 @@ void  OSStatReset (OS_ERR  *p_err)
 #if (OS_CFG_Q_EN == DEF_ENABLED)
     OS_Q        *p_q;
 #endif
+#if (OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0u)
+    CPU_INT08U   i;
+#endif
 #endif
     CPU_SR_ALLOC();
 
@@ -86,6 +104,11 @@ void  OSStatReset (OS_ERR  *p_err)
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     OSStatTaskTimeMax     = 0u;
 #endif
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    OSStatTaskTSPrev              = OS_TS_GET();                /* Start a new window                                   */
+    OSStatIntCyclesPrev           = OSIntCyclesTotal;
+    OSIdleTaskTCB.CyclesTotalPrev = OSIdleTaskTCB.CyclesTotal;
+#endif
 #endif
 
 #if (OS_CFG_TS_EN == DEF_ENABLED)
@@ -111,6 +134,9 @@ void  OSStatReset (OS_ERR  *p_err)
 
 #if ((OS_MSG_EN == DEF_ENABLED) && (OS_CFG_DBG_EN == DEF_ENABLED))
     OSMsgPool.NbrUsedMax  = 0u;
+#endif
+#if ((OS_MSG_EN == DEF_ENABLED) && (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED))
+    OSMsgPool.NbrEmptyCtr = 0u;
 #endif
     CPU_CRITICAL_EXIT();
 
@@ -127,6 +153,11 @@ void  OSStatReset (OS_ERR  *p_err)
 
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN == DEF_ENABLED)
         p_tcb->SchedLockTimeMax = 0u;
+#if (OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0u)
+        for (i = 0u; i < OS_CFG_SCHED_LOCK_TIME_HIST_NBR; i++) {
+            p_tcb->SchedLockTimeHist[i] = 0u;
+        }
+#endif
 #endif
 
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
@@ -137,6 +168,9 @@ void  OSStatReset (OS_ERR  *p_err)
         p_tcb->CtxSwCtr         = 0u;
         p_tcb->CPUUsage         = 0u;
         p_tcb->CPUUsageMax      = 0u;
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+        p_tcb->CPUUsageAvg      = 0u;
+#endif
         p_tcb->CyclesTotal      = 0u;
         p_tcb->CyclesTotalPrev  = 0u;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
@@ -147,6 +181,9 @@ void  OSStatReset (OS_ERR  *p_err)
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
         p_msg_q                 = &p_tcb->MsgQ;
         p_msg_q->NbrEntriesMax  = 0u;
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+        p_msg_q->NbrEmptyCtr    = 0u;
+#endif
 #endif
         p_tcb                   = p_tcb->DbgNextPtr;
         CPU_CRITICAL_EXIT();
@@ -161,6 +198,9 @@ void  OSStatReset (OS_ERR  *p_err)
         CPU_CRITICAL_ENTER();
         p_msg_q                = &p_q->MsgQ;
         p_msg_q->NbrEntriesMax = 0u;
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+        p_msg_q->NbrEmptyCtr   = 0u;
+#endif
         p_q                    = p_q->DbgNextPtr;
         CPU_CRITICAL_EXIT();
     }
@@ -191,18 +231,24 @@ void  OSStatReset (OS_ERR  *p_err)
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_STAT_TASK_TS_EN, CPU usage is computed from the cycles accumulated by OSTaskSwHook() and
+*                 OSIntExit() so, no calibration is needed.  This function only starts the first window and returns
+*                 immediately.
 ************************************************************************************************************************
 */
 
 void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_DISABLED)
     OS_ERR   err;
     OS_TICK  dly;
+#endif
     CPU_SR_ALLOC();
 
 
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_DISABLED)
     err = OS_ERR_NONE;                                          /* Initialize err explicitly for static analysis.       */
+#endif
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
@@ -218,6 +264,16 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     }
 #endif
 
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    CPU_CRITICAL_ENTER();                                       /* See Note #1                                          */
+    OSStatTaskTSPrev              = OS_TS_GET();
+    OSStatIntCyclesPrev           = OSIntCyclesTotal;
+    OSIdleTaskTCB.CyclesTotalPrev = OSIdleTaskTCB.CyclesTotal;
+    OSStatTaskTimeMax             = 0u;
+    OSStatTaskRdy                 = OS_STATE_RDY;
+    CPU_CRITICAL_EXIT();
+   *p_err                         = OS_ERR_NONE;
+#else
 #if ((OS_CFG_TMR_EN == DEF_ENABLED) && (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED))
     OSTaskSuspend(&OSTmrTaskTCB, &err);
     if (err != OS_ERR_NONE) {
@@ -266,6 +322,7 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     OSStatTaskRdy     = OS_STATE_RDY;
     CPU_CRITICAL_EXIT();
    *p_err             = OS_ERR_NONE;
+#endif
 }
 
 
@@ -292,6 +349,16 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 *                 for the idle counter.
 *
 *              4) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              5) With OS_CFG_STAT_TASK_TS_EN, the usages are computed over the window elapsed since the previous run
+*                 (1/OS_CFG_STAT_TASK_RATE_HZ), from the cycles charged to each task and to ISRs:
+*
+*                                                       cycles of the idle task
+*                 OSStatTaskCPUUsage = 100 * (1 - ---------------------------)     (units are in %)
+*                                                         cycles of the window
+*
+*                 Each usage also has a moving average weighted by 1/2^OS_CFG_STAT_TASK_AVG_SHIFT.  The window must be
+*                 shorter than the period of the CPU_TS counter.
 ************************************************************************************************************************
 */
 
@@ -300,16 +367,28 @@ void  OS_StatTask (void  *p_arg)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
     OS_CPU_USAGE usage;
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_DISABLED)
     OS_CYCLES    cycles_total;
     OS_CYCLES    cycles_div;
     OS_CYCLES    cycles_mult;
     OS_CYCLES    cycles_max;
+#endif
 #endif
     OS_TCB      *p_tcb;
 #endif
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    CPU_TS       ts_window;
+    OS_CYCLES    cycles_window;
+    OS_CYCLES    cycles_idle;
+    OS_CYCLES    cycles_int;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_CYCLES    cycles;
+#endif
+#else
     OS_TICK      ctr_max;
     OS_TICK      ctr_mult;
     OS_TICK      ctr_div;
+#endif
     OS_ERR       err;
     OS_TICK      dly;
 #if (OS_CFG_TS_EN == DEF_ENABLED)
@@ -345,6 +424,27 @@ void  OS_StatTask (void  *p_arg)
 #endif
 #endif
 
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+        CPU_CRITICAL_ENTER();                                   /* ---------------- OVERALL CPU USAGE ----------------- */
+        ts_window           = OS_TS_GET();                      /* See Note #5                                          */
+        cycles_window       = (OS_CYCLES)(ts_window - OSStatTaskTSPrev);
+        OSStatTaskTSPrev    = ts_window;
+        cycles_idle         = OSIdleTaskTCB.CyclesTotal - OSIdleTaskTCB.CyclesTotalPrev;
+#if (OS_CFG_DBG_EN == DEF_DISABLED)
+        OSIdleTaskTCB.CyclesTotalPrev = OSIdleTaskTCB.CyclesTotal;
+#endif
+        cycles_int          = OSIntCyclesTotal - OSStatIntCyclesPrev;
+        OSStatIntCyclesPrev = OSIntCyclesTotal;
+        CPU_CRITICAL_EXIT();
+
+        OSStatTaskCPUUsage    = (OS_CPU_USAGE)(10000u - OS_StatTaskUsage(cycles_idle, cycles_window));
+        if (OSStatTaskCPUUsageMax < OSStatTaskCPUUsage) {
+            OSStatTaskCPUUsageMax = OSStatTaskCPUUsage;
+        }
+        OSStatTaskCPUUsageAvg = OS_StatTaskAvg(OSStatTaskCPUUsageAvg, OSStatTaskCPUUsage);
+        OSStatIntCPUUsage     = OS_StatTaskUsage(cycles_int, cycles_window);
+        OSStatIntCPUUsageAvg  = OS_StatTaskAvg(OSStatIntCPUUsageAvg, OSStatIntCPUUsage);
+#else
         CPU_CRITICAL_ENTER();                                   /* ---------------- OVERALL CPU USAGE ----------------- */
         OSStatTaskCtrRun   = OSStatTaskCtr;                     /* Obtain the of the stat counter for the past .1 second*/
         OSStatTaskCtr      = 0u;                                /* Reset the stat counter for the next .1 second        */
@@ -375,12 +475,13 @@ void  OS_StatTask (void  *p_arg)
         } else {
             OSStatTaskCPUUsage = 0u;
         }
+#endif
 
         OSStatTaskHook();                                       /* Invoke user definable hook                           */
 
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
-#if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
+#if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED) && (OS_CFG_STAT_TASK_TS_EN == DEF_DISABLED)
         cycles_total = 0u;
 
         CPU_CRITICAL_ENTER();
@@ -401,7 +502,7 @@ void  OS_StatTask (void  *p_arg)
 #endif
 
 
-#if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
+#if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED) && (OS_CFG_STAT_TASK_TS_EN == DEF_DISABLED)
                                                                 /* ------------ INDIVIDUAL TASK CPU USAGE ------------- */
         if (cycles_total > 0u) {                                /* 'cycles_total' scaling ...                           */
             if (cycles_total < 400000u) {                       /* 1 to       400,000                                   */
@@ -431,14 +532,25 @@ void  OS_StatTask (void  *p_arg)
         CPU_CRITICAL_EXIT();
         while (p_tcb != (OS_TCB *)0) {
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)                     /* Compute execution time of each task                  */
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+            CPU_CRITICAL_ENTER();
+            cycles                 = p_tcb->CyclesTotal - p_tcb->CyclesTotalPrev;
+            p_tcb->CyclesTotalPrev = p_tcb->CyclesTotal;
+            CPU_CRITICAL_EXIT();
+            usage = OS_StatTaskUsage(cycles, cycles_window);
+#else
             usage = (OS_CPU_USAGE)(cycles_mult * p_tcb->CyclesTotalPrev / cycles_max);
             if (usage > 10000u) {
                 usage = 10000u;
             }
+#endif
             p_tcb->CPUUsage = usage;
             if (p_tcb->CPUUsageMax < usage) {                   /* Detect peak CPU usage                                */
                 p_tcb->CPUUsageMax = usage;
             }
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+            p_tcb->CPUUsageAvg = OS_StatTaskAvg(p_tcb->CPUUsageAvg, usage);
+#endif
 #endif
 
 #if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
@@ -498,8 +610,19 @@ void  OS_StatTaskInit (OS_ERR  *p_err)
     OSStatTaskCtr    = 0u;
     OSStatTaskCtrRun = 0u;
     OSStatTaskCtrMax = 0u;
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    OSStatTaskRdy    = OS_STATE_RDY;                            /* No calibration needed (see OSStatTaskCPUUsageInit()) */
+#else
     OSStatTaskRdy    = OS_STATE_NOT_RDY;                        /* Statistic task is not ready                          */
+#endif
     OSStatResetFlag  = DEF_FALSE;
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+    OSStatTaskCPUUsageAvg = 0u;
+    OSStatIntCPUUsage     = 0u;
+    OSStatIntCPUUsageAvg  = 0u;
+    OSStatIntCyclesPrev   = 0u;
+    OSStatTaskTSPrev      = 0u;
+#endif
 
                                                                 /* --------------- CREATE THE STAT TASK --------------- */
     if (OSCfg_StatTaskStkBasePtr == (CPU_STK *)0) {
@@ -536,4 +659,86 @@ void  OS_StatTaskInit (OS_ERR  *p_err)
                   p_err);
 }
 
+
+
+/*
+************************************************************************************************************************
+*                                             COMPUTE A CPU USAGE
+*
+* Description: This function computes the share of a window represented by a number of cycles.
+*
+* Argument(s): cycles          is the number of cycles spent by a task or by ISRs during the window.
+*
+*              cycles_window   is the number of cycles of the window.
+*
+* Returns    : The usage, from 0 to 10000 (0.00-100.00%).
+*
+* Note(s)    : 1) The same scaling as the idle counter is used to keep the best resolution without overflowing.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+static  OS_CPU_USAGE  OS_StatTaskUsage (OS_CYCLES  cycles,
+                                        OS_CYCLES  cycles_window)
+{
+    OS_CYCLES  cycles_mult;
+    OS_CYCLES  cycles_div;
+    OS_CYCLES  cycles_max;
+
+
+    if (cycles_window == 0u) {
+        return (0u);
+    }
+    if (cycles >= cycles_window) {                              /* Charged cycles may exceed the window by a few        */
+        return (10000u);
+    }
+    if (cycles_window < 400000u) {                              /* See Note #1                                          */
+        cycles_mult = 10000u;
+        cycles_div  =     1u;
+    } else if (cycles_window <   4000000u) {
+        cycles_mult =  1000u;
+        cycles_div  =    10u;
+    } else if (cycles_window <  40000000u) {
+        cycles_mult =   100u;
+        cycles_div  =   100u;
+    } else if (cycles_window < 400000000u) {
+        cycles_mult =    10u;
+        cycles_div  =  1000u;
+    } else {
+        cycles_mult =     1u;
+        cycles_div  = 10000u;
+    }
+    cycles_max = cycles_window / cycles_div;
+    return ((OS_CPU_USAGE)DEF_MIN(10000u, (cycles_mult * cycles) / cycles_max));
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         UPDATE THE MOVING AVERAGE OF A USAGE
+*
+* Description: This function moves an exponentially weighted average toward the usage of the last window by
+*              1/2^OS_CFG_STAT_TASK_AVG_SHIFT of their difference.
+*
+* Argument(s): avg       is the current average.
+*
+*              usage     is the usage of the last window.
+*
+* Returns    : The new average.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_TASK_TS_EN == DEF_ENABLED)
+static  OS_CPU_USAGE  OS_StatTaskAvg (OS_CPU_USAGE  avg,
+                                      OS_CPU_USAGE  usage)
+{
+    if (usage >= avg) {
+        avg += (OS_CPU_USAGE)((usage - avg) >> OS_CFG_STAT_TASK_AVG_SHIFT);
+    } else {
+        avg -= (OS_CPU_USAGE)((avg - usage) >> OS_CFG_STAT_TASK_AVG_SHIFT);
+    }
+    return (avg);
+}
+#endif
 #endif
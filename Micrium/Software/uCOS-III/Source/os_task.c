@@ -619,6 +619,9 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                         /* Free task's message queue messages                   */
+#if (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+    OS_MsgQCacheFree(&p_tcb->MsgQ);                             /* Including the ones cached by the queue               */
+#endif
 #endif
 
     OSTaskDelHook(p_tcb);                                       /* Call user defined hook                               */
@@ -1169,6 +1172,58 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                       RESERVE MESSAGES FOR A TASK'S QUEUE
+*
+* Description: This function reserves OS_MSGs of the pool for the message queue of a task so that posts to this task
+*              always find an OS_MSG as long as its queue holds less than 'quota' messages.
+*
+* Arguments  : p_tcb         is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you are
+*                            setting the quota of the calling task's queue.
+*
+*              quota         is the number of OS_MSGs to reserve, up to the size of the queue.  0 removes the quota.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The quota was set
+*                                OS_ERR_MSG_POOL_EMPTY    If the pool does not have enough free OS_MSGs
+*                                OS_ERR_Q_SIZE            If 'quota' is larger than the size of the queue
+*
+* Returns    : none
+*
+* Note(s)    : 1) The messages held by the queue count in its quota.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED) && (OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED)
+void  OSTaskQQuotaSet (OS_TCB      *p_tcb,
+                       OS_MSG_QTY   quota,
+                       OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Set the quota of the calling task's queue?           */
+        p_tcb = OSTCBCurPtr;
+    }
+    OS_MsgQQuotaSet(&p_tcb->MsgQ,
+                    quota,
+                    p_err);
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                       GET THE CURRENT VALUE OF A TASK REGISTER
@@ -2442,6 +2497,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     OS_TLS_ID   id;
 #endif
+#if (OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0u)
+    CPU_INT08U  i;
+#endif
 
 
     p_tcb->StkPtr               = (CPU_STK          *)0;
@@ -2458,6 +2516,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->TickNextPtr          = (OS_TCB           *)0;
     p_tcb->TickPrevPtr          = (OS_TCB           *)0;
     p_tcb->TickListPtr          = (OS_TICK_LIST     *)0;
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    p_tcb->TickChildPtr         = (OS_TCB           *)0;
+#endif
 #endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -2539,6 +2600,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
     p_tcb->TickRemain           =                     0u;
     p_tcb->TickCtrPrev          =                     0u;
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    p_tcb->TickMatch            =                     0u;
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
@@ -2564,6 +2628,11 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #endif
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN == DEF_ENABLED)
     p_tcb->SchedLockTimeMax     =                     0u;
+#if (OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0u)
+    for (i = 0u; i < OS_CFG_SCHED_LOCK_TIME_HIST_NBR; i++) {
+        p_tcb->SchedLockTimeHist[i] = 0u;
+    }
+#endif
 #endif
 
     p_tcb->PendNextPtr          = (OS_TCB           *)0;
@@ -48,6 +48,16 @@ const  CPU_CHAR  *os_tick__c = "$Id: $";
 
 static  CPU_TS  OS_TickListUpdateDly     (OS_TICK ticks);
 static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK ticks);
+static  OS_TCB *OS_TickListExpire        (OS_TICK_LIST  *p_list,
+                                          OS_TICK       *p_ticks);
+
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+static  OS_TCB *OS_TickHeapMeld          (OS_TCB        *p_tcb1,
+                                          OS_TCB        *p_tcb2,
+                                          OS_TICK        base);
+static  OS_TCB *OS_TickHeapMergePairs    (OS_TCB        *p_first,
+                                          OS_TICK        base);
+#endif
 
 /*
 ************************************************************************************************************************
@@ -117,12 +127,21 @@ void  OS_TickTask (void  *p_arg)
 #if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
             tick_step_dly = (OS_TICK)-1;
             tick_step_timeout = (OS_TICK)-1;
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+            if(OSTickListDly.TCB_Ptr != (OS_TCB *)0) {          /* Root of a heap is the task that expires first        */
+                tick_step_dly = OSTickListDly.TCB_Ptr->TickMatch - OSTickCtr;
+            }
+            if(OSTickListTimeout.TCB_Ptr != (OS_TCB *)0) {
+                tick_step_timeout = OSTickListTimeout.TCB_Ptr->TickMatch - OSTickCtr;
+            }
+#else
             if(OSTickListDly.TCB_Ptr != (OS_TCB *)0) {
                 tick_step_dly = OSTickListDly.TCB_Ptr->TickRemain;
             }
             if(OSTickListTimeout.TCB_Ptr != (OS_TCB *)0) {
                 tick_step_timeout = OSTickListTimeout.TCB_Ptr->TickRemain;
             }
+#endif
             OSTickCtrStep = (tick_step_dly < tick_step_timeout) ? tick_step_dly : tick_step_timeout;
             BSP_OS_TickNextSet(OSTickCtrStep);
 #endif
@@ -221,7 +240,16 @@ void  OS_TickTaskInit (OS_ERR  *p_err)
 *
 * Returns    : none
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) When OS_CFG_TICK_LIST_HEAP_EN is enabled, a tick list is a pairing heap ordered by the value of
+*                 OSTickCtr at which each task expires ('.TickMatch') instead of a delta list.  Inserting is done
+*                 in constant time and removing a task, or the task that expires first, in O(log n) amortized
+*                 time instead of walking the list.  The heap links use '.TickChildPtr' for the first child and
+*                 '.TickNextPtr'/'.TickPrevPtr' for the siblings, '.TickPrevPtr' of a first child pointing to its
+*                 parent.  '.TickRemain' is not updated as ticks elapse, since that would visit every task on
+*                 each tick : it holds the delay given at insertion (0 once removed), & the ticks remaining are
+*                 '.TickMatch' - OSTickCtr.
 ************************************************************************************************************************
 */
 
@@ -229,14 +257,37 @@ void  OS_TickListInsert (OS_TICK_LIST  *p_list,
                          OS_TCB        *p_tcb,
                          OS_TICK        time)
 {
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_DISABLED)
     OS_TCB  *p_tcb1;
     OS_TCB  *p_tcb2;
     OS_TICK  remain;
+#endif
 #if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
     OS_TICK  tick_step = (OS_TICK)-1;
 #endif
 
 
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    p_tcb->TickMatch    = OSTickCtr + time;                     /* Determine when the task expires                      */
+    p_tcb->TickRemain   = time;
+    p_tcb->TickChildPtr = (OS_TCB *)0;
+    p_tcb->TickNextPtr  = (OS_TCB *)0;
+    p_tcb->TickPrevPtr  = (OS_TCB *)0;
+    p_tcb->TickListPtr  = p_list;                               /* Link TCB to this list                                */
+    if (p_list->TCB_Ptr == (OS_TCB *)0) {                       /* Is the heap empty?                                   */
+        p_list->TCB_Ptr = p_tcb;
+    } else {
+        p_list->TCB_Ptr = OS_TickHeapMeld(p_list->TCB_Ptr, p_tcb, OSTickCtr);
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_list->NbrEntries++;                                       /* List contains an extra entry                         */
+#endif
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    if (p_list->TCB_Ptr == p_tcb) {                             /* Task expires first in this list?                     */
+        tick_step = time;
+    }
+#endif
+#else
     if (p_list->TCB_Ptr == (OS_TCB *)0) {                       /* Is the list empty?                                   */
         p_tcb->TickRemain  = time;                              /* Yes, Store time in TCB                               */
         p_tcb->TickNextPtr = (OS_TCB *)0;
@@ -306,6 +357,7 @@ void  OS_TickListInsert (OS_TICK_LIST  *p_list,
         p_list->NbrEntries++;                                   /* List contains an extra entry                         */
 #endif
     }
+#endif
 
 #if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
     if (tick_step < OSTickCtrStep) {
@@ -429,6 +481,32 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
     p_list = p_tcb->TickListPtr;
     p_tcb1 = p_tcb->TickPrevPtr;
     p_tcb2 = p_tcb->TickNextPtr;
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    if (p_list->TCB_Ptr == p_tcb) {                             /* Remove the root of the heap?                         */
+        p_list->TCB_Ptr = OS_TickHeapMergePairs(p_tcb->TickChildPtr, OSTickCtr);
+    } else {
+        if (p_tcb1->TickChildPtr == p_tcb) {                    /* Unlink TCB from its parent or previous sibling       */
+            p_tcb1->TickChildPtr = p_tcb2;
+        } else {
+            p_tcb1->TickNextPtr  = p_tcb2;
+        }
+        if (p_tcb2 != (OS_TCB *)0) {
+            p_tcb2->TickPrevPtr  = p_tcb1;
+        }
+        p_tcb2 = OS_TickHeapMergePairs(p_tcb->TickChildPtr, OSTickCtr);
+        if (p_tcb2 != (OS_TCB *)0) {                            /* Meld the children of the TCB back into the heap      */
+            p_list->TCB_Ptr = OS_TickHeapMeld(p_list->TCB_Ptr, p_tcb2, OSTickCtr);
+        }
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_list->NbrEntries--;
+#endif
+    p_tcb->TickChildPtr = (OS_TCB       *)0;
+    p_tcb->TickNextPtr  = (OS_TCB       *)0;
+    p_tcb->TickPrevPtr  = (OS_TCB       *)0;
+    p_tcb->TickRemain   =                 0u;
+    p_tcb->TickListPtr  = (OS_TICK_LIST *)0;
+#else
     if (p_tcb1 == (OS_TCB *)0) {
         if (p_tcb2 == (OS_TCB *)0) {                            /* Remove ONLY entry in the list?                       */
             p_list->TCB_Ptr     = (OS_TCB       *)0;
@@ -462,13 +540,14 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
         p_tcb->TickRemain   =                 0u;
         p_tcb->TickListPtr  = (OS_TICK_LIST *)0;
     }
+#endif
 }
 
 /*
 ************************************************************************************************************************
 *                                           UPDATE THE LIST OF TASKS DELAYED
 *
-* Description: This function updates the delta list which contains tasks that have been delayed.
+* Description: This function updates the tick list which contains tasks that have been delayed.
 *
 * Arguments  : ticks          the number of ticks which have elapsed.
 *
@@ -498,50 +577,21 @@ static  CPU_TS  OS_TickListUpdateDly (OS_TICK  ticks)
     nbr_updated = (OS_OBJ_QTY)0u;
 #endif
     p_list      = &OSTickListDly;
-    p_tcb       = p_list->TCB_Ptr;
-    if (p_tcb != (OS_TCB *)0) {
-        if (p_tcb->TickRemain <= ticks) {
-            ticks = ticks - p_tcb->TickRemain;
-            p_tcb->TickRemain = 0u;
-        } else {
-            p_tcb->TickRemain -= ticks;
-        }
-
-        while (p_tcb->TickRemain == 0u) {
+    p_tcb       = OS_TickListExpire(p_list, &ticks);
+    while (p_tcb != (OS_TCB *)0) {                              /* Process every task whose delay expired               */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
-            nbr_updated++;                                      /* Keep track of the number of TCBs updated             */
+        nbr_updated++;                                          /* Keep track of the number of TCBs updated             */
 #endif
-            if (p_tcb->TaskState == OS_TASK_STATE_DLY) {
-                p_tcb->TaskState = OS_TASK_STATE_RDY;
-                OS_RdyListInsert(p_tcb);                        /* Insert the task in the ready list                    */
+        if (p_tcb->TaskState == OS_TASK_STATE_DLY) {
+            p_tcb->TaskState = OS_TASK_STATE_RDY;
+            OS_RdyListInsert(p_tcb);                            /* Insert the task in the ready list                    */
 
-            } else {
-                if (p_tcb->TaskState == OS_TASK_STATE_DLY_SUSPENDED) {
-                    p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
-                }
-            }
-
-            p_list->TCB_Ptr = p_tcb->TickNextPtr;
-            p_tcb           = p_list->TCB_Ptr;                  /* Get 'p_tcb' again for loop                           */
-            if (p_tcb == (OS_TCB *)0) {
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-                p_list->NbrEntries = 0u;
-#endif
-                break;
-            } else {
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-                p_list->NbrEntries--;
-#endif
-                p_tcb->TickPrevPtr = (OS_TCB *)0;
-            }
-
-            if (p_tcb->TickRemain <= ticks) {
-                ticks = ticks - p_tcb->TickRemain;
-                p_tcb->TickRemain = 0u;
-            } else {
-                p_tcb->TickRemain -= ticks;
+        } else {
+            if (p_tcb->TaskState == OS_TASK_STATE_DLY_SUSPENDED) {
+                p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
             }
         }
+        p_tcb = OS_TickListExpire(p_list, &ticks);              /* Get 'p_tcb' again for loop                           */
     }
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     p_list->NbrUpdated = nbr_updated;
@@ -562,7 +612,7 @@ static  CPU_TS  OS_TickListUpdateDly (OS_TICK  ticks)
 ************************************************************************************************************************
 *                                       UPDATE THE LIST OF TASKS PENDING WITH TIMEOUT
 *
-* Description: This function updates the delta list which contains tasks that are pending with a timeout.
+* Description: This function updates the tick list which contains tasks that are pending with a timeout.
 *
 * Arguments  : ticks          the number of ticks which have elapsed.
 *
@@ -596,81 +646,54 @@ static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
     nbr_updated = 0u;
 #endif
     p_list      = &OSTickListTimeout;
-    p_tcb       = p_list->TCB_Ptr;
-    if (p_tcb != (OS_TCB *)0) {
-        if (p_tcb->TickRemain <= ticks) {
-            ticks = ticks - p_tcb->TickRemain;
-            p_tcb->TickRemain = 0u;
-        } else {
-            p_tcb->TickRemain -= ticks;
-        }
-
-        while (p_tcb->TickRemain == 0u) {
+    p_tcb       = OS_TickListExpire(p_list, &ticks);
+    while (p_tcb != (OS_TCB *)0) {                              /* Process every task whose timeout expired             */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
-            nbr_updated++;
+        nbr_updated++;                                          /* Keep track of the number of TCBs updated             */
 #endif
 
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
-            p_tcb_owner = (OS_TCB *)0;
-            if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
-                p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
-            }
+        p_tcb_owner = (OS_TCB *)0;
+        if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
+            p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
+        }
 #endif
 
 #if (OS_MSG_EN == DEF_ENABLED)
-            p_tcb->MsgPtr  = (void *)0;
-            p_tcb->MsgSize = 0u;
+        p_tcb->MsgPtr  = (void *)0;
+        p_tcb->MsgSize = 0u;
 #endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
-            p_tcb->TS      = OS_TS_GET();
+        p_tcb->TS      = OS_TS_GET();
 #endif
-            OS_PendListRemove(p_tcb);                           /* Remove task from pend list                           */
-            if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
-                OS_RdyListInsert(p_tcb);                        /* Insert the task in the ready list                    */
-                p_tcb->TaskState  = OS_TASK_STATE_RDY;
+        OS_PendListRemove(p_tcb);                               /* Remove task from pend list                           */
+        if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
+            OS_RdyListInsert(p_tcb);                            /* Insert the task in the ready list                    */
+            p_tcb->TaskState  = OS_TASK_STATE_RDY;
 
-            } else {
-                if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
-                    p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
-                }
+        } else {
+            if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
+                p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
             }
-            p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;         /* Indicate pend timed out                              */
-            p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;        /* Indicate no longer pending                           */
+        }
+        p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;             /* Indicate pend timed out                              */
+        p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;            /* Indicate no longer pending                           */
 
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
-            if (p_tcb_owner != (OS_TCB *)0) {
-                if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
-                    (p_tcb_owner->Prio == p_tcb->Prio)) {       /* Has the owner inherited a priority?                  */
-                    prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-                    prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
-                    if(prio_new != p_tcb_owner->Prio) {
-                        OS_TaskChangePrio(p_tcb_owner, prio_new);
-                        OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
-                    }
+        if (p_tcb_owner != (OS_TCB *)0) {
+            if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+                (p_tcb_owner->Prio == p_tcb->Prio)) {           /* Has the owner inherited a priority?                  */
+                prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                if(prio_new != p_tcb_owner->Prio) {
+                    OS_TaskChangePrio(p_tcb_owner, prio_new);
+                    OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
                 }
             }
+        }
 #endif
 
-            p_list->TCB_Ptr = p_tcb->TickNextPtr;
-            p_tcb           = p_list->TCB_Ptr;                  /* Get 'p_tcb' again for loop                           */
-            if (p_tcb == (OS_TCB *)0) {
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-                p_list->NbrEntries = 0u;
-#endif
-                break;
-            } else {
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-                p_list->NbrEntries--;
-#endif
-                p_tcb->TickPrevPtr = (OS_TCB *)0;
-            }
-            if (p_tcb->TickRemain <= ticks) {
-                ticks = ticks - p_tcb->TickRemain;
-                p_tcb->TickRemain = 0u;
-            } else {
-                p_tcb->TickRemain -= ticks;
-            }
-        }
+        p_tcb = OS_TickListExpire(p_list, &ticks);              /* Get 'p_tcb' again for loop                           */
     }
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     p_list->NbrUpdated = nbr_updated;
@@ -685,4 +708,175 @@ static  CPU_TS  OS_TickListUpdateTimeout (OS_TICK  ticks)
     return (0u);
 #endif
 }
+
+
+/*
+************************************************************************************************************************
+*                                          GET THE NEXT EXPIRED TASK OF A TICK LIST
+*
+* Description: This function is called by OS_TickListUpdateDly() and OS_TickListUpdateTimeout() to remove, one at a
+*              time, the tasks of a tick list that expire within the ticks which have elapsed.
+*
+* Arguments  : p_list         is a pointer to the tick list.
+*
+*              p_ticks        is a pointer to the number of ticks which have elapsed.  With a delta list, it is reduced
+*                             by the delta of each task removed and set to 0 once the first task not expired is updated.
+*
+* Returns    : A pointer to the OS_TCB of the task removed or, a NULL pointer if no more task expired.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With heaps, OSTickCtr has already been advanced by '*p_ticks' so the tasks are compared from the
+*                 previous value of OSTickCtr.  A task expired when its '.TickMatch' is within '*p_ticks' of it.
+************************************************************************************************************************
+*/
+
+static  OS_TCB  *OS_TickListExpire (OS_TICK_LIST  *p_list,
+                                    OS_TICK       *p_ticks)
+{
+    OS_TCB   *p_tcb;
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    OS_TICK   base;
+#else
+    OS_TCB   *p_tcb_next;
+#endif
+
+
+    p_tcb = p_list->TCB_Ptr;
+    if (p_tcb == (OS_TCB *)0) {                                 /* Is the list empty?                                   */
+        return ((OS_TCB *)0);
+    }
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    base = OSTickCtr - *p_ticks;                                /* See Note #2                                          */
+    if ((OS_TICK)(p_tcb->TickMatch - base) > *p_ticks) {        /* Has the root of the heap expired?                    */
+        return ((OS_TCB *)0);
+    }
+    p_list->TCB_Ptr     = OS_TickHeapMergePairs(p_tcb->TickChildPtr, base);
+    p_tcb->TickChildPtr = (OS_TCB *)0;
+#else
+    if (p_tcb->TickRemain > *p_ticks) {                         /* Has the first task of the list expired?              */
+        p_tcb->TickRemain -= *p_ticks;                          /* No,  update its delta and stop                       */
+       *p_ticks            = 0u;
+        return ((OS_TCB *)0);
+    }
+   *p_ticks        -= p_tcb->TickRemain;                        /* Yes, remove it from the list                         */
+    p_tcb_next      = p_tcb->TickNextPtr;
+    p_list->TCB_Ptr = p_tcb_next;
+    if (p_tcb_next != (OS_TCB *)0) {
+        p_tcb_next->TickPrevPtr = (OS_TCB *)0;
+    }
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_list->NbrEntries--;
+#endif
+    p_tcb->TickNextPtr = (OS_TCB       *)0;
+    p_tcb->TickPrevPtr = (OS_TCB       *)0;
+    p_tcb->TickRemain  =                 0u;
+    p_tcb->TickListPtr = (OS_TICK_LIST *)0;
+    return (p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  MELD TWO TICK HEAPS
+*
+* Description: This function links two tick heaps.  The root that expires last becomes the first child of the other.
+*
+* Arguments  : p_tcb1         is a pointer to the root of the first heap.
+*
+*              p_tcb2         is a pointer to the root of the second heap.
+*
+*              base           is the value of OSTickCtr from which the expiration of the tasks is compared.
+*
+* Returns    : A pointer to the root of the resulting heap.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The siblings of the roots are NOT preserved.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+static  OS_TCB  *OS_TickHeapMeld (OS_TCB   *p_tcb1,
+                                  OS_TCB   *p_tcb2,
+                                  OS_TICK   base)
+{
+    OS_TCB  *p_tcb;
+
+
+    if ((OS_TICK)(p_tcb2->TickMatch - base) < (OS_TICK)(p_tcb1->TickMatch - base)) {
+        p_tcb  = p_tcb1;                                        /* Make 'p_tcb1' the task that expires first            */
+        p_tcb1 = p_tcb2;
+        p_tcb2 = p_tcb;
+    }
+    p_tcb                = p_tcb1->TickChildPtr;                /* Link 'p_tcb2' as the first child of 'p_tcb1'         */
+    p_tcb2->TickNextPtr  = p_tcb;
+    p_tcb2->TickPrevPtr  = p_tcb1;
+    if (p_tcb != (OS_TCB *)0) {
+        p_tcb->TickPrevPtr = p_tcb2;
+    }
+    p_tcb1->TickChildPtr = p_tcb2;
+    p_tcb1->TickNextPtr  = (OS_TCB *)0;
+    p_tcb1->TickPrevPtr  = (OS_TCB *)0;
+    return (p_tcb1);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           MERGE THE CHILDREN OF A TICK HEAP
+*
+* Description: This function merges a list of sibling heaps into a single heap, using the two pass method of pairing
+*              heaps: the siblings are melded in pairs from left to right, then the pairs are melded from right to left.
+*
+* Arguments  : p_first        is a pointer to the first sibling, i.e. the first child of a task removed from a heap.
+*
+*              base           is the value of OSTickCtr from which the expiration of the tasks is compared.
+*
+* Returns    : A pointer to the root of the resulting heap or, a NULL pointer if 'p_first' is a NULL pointer.
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+static  OS_TCB  *OS_TickHeapMergePairs (OS_TCB   *p_first,
+                                        OS_TICK   base)
+{
+    OS_TCB  *p_tcb;
+    OS_TCB  *p_tcb_next;
+    OS_TCB  *p_pairs;
+
+
+    if (p_first == (OS_TCB *)0) {
+        return ((OS_TCB *)0);
+    }
+    p_pairs = (OS_TCB *)0;                                      /* First pass, pairs are kept in reverse order          */
+    p_tcb   = p_first;
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb_next = p_tcb->TickNextPtr;
+        if (p_tcb_next != (OS_TCB *)0) {
+            p_first    = p_tcb_next->TickNextPtr;
+            p_tcb      = OS_TickHeapMeld(p_tcb, p_tcb_next, base);
+            p_tcb_next = p_first;
+        }
+        p_tcb->TickNextPtr = p_pairs;
+        p_pairs            = p_tcb;
+        p_tcb              = p_tcb_next;
+    }
+
+    p_tcb   = p_pairs;                                          /* Second pass, meld the pairs from the last one        */
+    p_pairs = p_tcb->TickNextPtr;
+    while (p_pairs != (OS_TCB *)0) {
+        p_tcb_next = p_pairs->TickNextPtr;
+        p_tcb      = OS_TickHeapMeld(p_tcb, p_pairs, base);
+        p_pairs    = p_tcb_next;
+    }
+    p_tcb->TickNextPtr = (OS_TCB *)0;
+    p_tcb->TickPrevPtr = (OS_TCB *)0;
+    return (p_tcb);
+}
+#endif
 #endif
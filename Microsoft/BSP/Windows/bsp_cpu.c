@@ -39,6 +39,15 @@
 #define    WIN32_LEAN_AND_MEAN
 #include  <windows.h>
 
+#if   (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)))
+#include  <intrin.h>
+#define  BSP_CPU_TSC_PRESENT
+#elif (defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)))
+#include  <cpuid.h>
+#include  <x86intrin.h>
+#define  BSP_CPU_TSC_PRESENT
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -46,6 +55,9 @@
 *********************************************************************************************************
 */
 
+#define  BSP_CPU_TS_TSC_EN                      DEF_ENABLED     /* Time stamps from the TSC (see CPU_TS_TmrInit() Note #3). */
+#define  BSP_CPU_TS_TSC_CALIB_MS                         20u    /* Interval the TSC rate is measured over.              */
+
 
 /*
 *********************************************************************************************************
@@ -74,6 +86,10 @@
 *********************************************************************************************************
 */
 
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  BSP_CPU_TS_TscSel;                         /* DEF_YES if CPU_TS_TmrRd() reads the TSC.             */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -81,6 +97,10 @@
 *********************************************************************************************************
 */
 
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED) && (BSP_CPU_TS_TSC_EN == DEF_ENABLED) && defined(BSP_CPU_TSC_PRESENT)
+static  CPU_BOOLEAN  BSP_CPU_TS_TscInvariant (void);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -138,6 +158,11 @@
 *                       inadequate to measure desired times.
 *
 *                   See also 'CPU_TS_TmrRd()  Note #2'.
+*
+*               (3) The time stamp counter (TSC) is used when the CPU reports it as invariant, i.e.
+*                   counting at a constant rate across power states & cores, and its rate fits the 32-bit
+*                   'CPU_TS_TMR_FREQ'.  Its rate is measured against the performance counter, which is
+*                   used otherwise.
 *********************************************************************************************************
 */
 
@@ -145,9 +170,36 @@
 void  CPU_TS_TmrInit (void)
 {
     LARGE_INTEGER  freq;
+#if (BSP_CPU_TS_TSC_EN == DEF_ENABLED) && defined(BSP_CPU_TSC_PRESENT)
+    LARGE_INTEGER  cnt_start;
+    LARGE_INTEGER  cnt_end;
+    CPU_INT64U     tsc_start;
+    CPU_INT64U     tsc_end;
+    CPU_INT64U     tsc_freq;
+#endif
 
 
+    BSP_CPU_TS_TscSel = DEF_NO;
     QueryPerformanceFrequency(&freq);
+
+#if (BSP_CPU_TS_TSC_EN == DEF_ENABLED) && defined(BSP_CPU_TSC_PRESENT)
+    if (BSP_CPU_TS_TscInvariant() == DEF_YES) {                 /* See Note #3.                                         */
+        QueryPerformanceCounter(&cnt_start);
+        tsc_start = __rdtsc();
+        Sleep(BSP_CPU_TS_TSC_CALIB_MS);
+        QueryPerformanceCounter(&cnt_end);
+        tsc_end   = __rdtsc();
+
+        tsc_freq  = ((tsc_end - tsc_start) * (CPU_INT64U)freq.QuadPart)
+                  / (CPU_INT64U)(cnt_end.QuadPart - cnt_start.QuadPart);
+        if ((tsc_freq != 0u) && (tsc_freq <= DEF_INT_32U_MAX_VAL)) {
+            BSP_CPU_TS_TscSel = DEF_YES;
+            CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)tsc_freq);
+            return;
+        }
+    }
+#endif
+
     CPU_TS_TmrFreqSet(freq.LowPart);
 }
 #endif
@@ -241,6 +293,12 @@ CPU_TS_TMR  CPU_TS_TmrRd (void)
     LARGE_INTEGER  cnt;
 
 
+#if (BSP_CPU_TS_TSC_EN == DEF_ENABLED) && defined(BSP_CPU_TSC_PRESENT)
+    if (BSP_CPU_TS_TscSel == DEF_YES) {                         /* See 'CPU_TS_TmrInit()  Note #3'.                     */
+        return ((CPU_TS_TMR)__rdtsc());
+    }
+#endif
+
     if (QueryPerformanceCounter(&cnt) == 0) {
         return (0);
     }
@@ -350,3 +408,58 @@ CPU_INT64U  CPU_TS64_to_uSec (CPU_TS64  ts_cnts)
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      BSP_CPU_TS_TscInvariant()
+*
+* Description : Check whether the time stamp counter runs at a constant rate.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_YES, if CPUID reports an invariant TSC (leaf 0x80000007, EDX bit 8).
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : CPU_TS_TmrInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED) && (BSP_CPU_TS_TSC_EN == DEF_ENABLED) && defined(BSP_CPU_TSC_PRESENT)
+static  CPU_BOOLEAN  BSP_CPU_TS_TscInvariant (void)
+{
+#if defined(_MSC_VER)
+    int           regs[4];
+
+
+    __cpuid(regs, (int)0x80000000u);
+    if ((unsigned int)regs[0] < 0x80000007u) {
+        return (DEF_NO);
+    }
+    __cpuid(regs, (int)0x80000007u);
+    return (DEF_BIT_IS_SET((CPU_INT32U)regs[3], DEF_BIT_08));
+#else
+    unsigned int  eax;
+    unsigned int  ebx;
+    unsigned int  ecx;
+    unsigned int  edx;
+
+
+    if (__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx) == 0) {
+        return (DEF_NO);
+    }
+    return (DEF_BIT_IS_SET((CPU_INT32U)edx, DEF_BIT_08));
+#endif
+}
+#endif
+
@@ -0,0 +1,1043 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                       KERNEL MICROBENCHMARKS
+*
+* Filename : app_bench.c
+*
+* Note(s)  : (1) The kernel of this project is instrumented for the CPP/RM task set (see 'os_core.c
+*                OSIntExit()' & 'OSTimeTick()').  With no task set loaded (TASK_NUMBER == 0) the deadline
+*                checks & the trace of App_TaskSwHook() are skipped; AppBench_ParamReset() keeps
+*                'Task_need_ExecutionTime' of every task non-zero so that OSIntExit() still preempts, &
+*                OSTime is rewound before each case so that SYSTEM_END_TIME is never reached.
+*
+*            (2) Timestamps are read from the CPU cycle counter; QueryPerformanceCounter() is used where
+*                the compiler offers no access to it, & to convert cycles to microseconds.
+*
+*            (3) The memory function cases run in the thread of main(), before the kernel is started.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdlib.h>
+#include  <windows.h>
+#if (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)))
+#include  <intrin.h>
+#elif (defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)))
+#include  <x86intrin.h>
+#endif
+
+#include  <cpu.h>
+#include  <lib_mem.h>
+#include  <os.h>
+
+#include  "app_bench.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#if (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))) || \
+    (defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)))
+#define  APP_BENCH_TS_GET()                 ((CPU_INT64U)__rdtsc())
+#else
+#define  APP_BENCH_TS_GET()                 AppBench_QPC_Get()
+#endif
+
+#define  APP_BENCH_PRIO_CEIL                            2u      /* Ceiling of the mutex, free since R1/R2 are not made. */
+#define  APP_BENCH_PRIO_FIRST                     T_start       /* Priorities given to the tasks of a case.             */
+#define  APP_BENCH_PRIO_LAST          (OS_LOWEST_PRIO - 3u)     /* Above the timer task (OS_TASK_TMR_PRIO).             */
+#define  APP_BENCH_PRIO_NBR           (APP_BENCH_PRIO_LAST - APP_BENCH_PRIO_FIRST + 1u)
+
+#if (OS_MAX_TASKS < APP_BENCH_PRIO_NBR)
+#define  APP_BENCH_TASK_NBR_MAX              OS_MAX_TASKS
+#else
+#define  APP_BENCH_TASK_NBR_MAX        APP_BENCH_PRIO_NBR
+#endif
+
+#define  APP_BENCH_NEED_EXEC_TIME                  0xFFFFu      /* See Note #1.                                         */
+#define  APP_BENCH_CALIB_MS                            50u      /* Interval used to measure the cycle counter rate.     */
+
+#define  APP_BENCH_FLAG_WAIT                       0x0001u      /* Waited for by the other tasks, never posted.         */
+#define  APP_BENCH_FLAG_POST                       0x0002u
+#define  APP_BENCH_FILLER_DLY                  0x7FFFFFFFu      /* Keeps the other tasks in the tick list.              */
+
+                                                                /* ---------------- MEASURED SERVICES ---------------- */
+#define  APP_BENCH_OP_TS                                0u      /* Two back-to-back timestamps.                         */
+#define  APP_BENCH_OP_CTX_SW                            1u
+#define  APP_BENCH_OP_INT_CTX_SW                        2u      /* Must follow APP_BENCH_OP_CTX_SW.                     */
+#define  APP_BENCH_OP_SCHED                             3u
+#define  APP_BENCH_OP_TIME_TICK                         4u
+#define  APP_BENCH_OP_MUTEX_PEND                        5u
+#define  APP_BENCH_OP_MUTEX_POST                        6u
+#define  APP_BENCH_OP_SEM_POST                          7u
+#define  APP_BENCH_OP_SEM_PEND                          8u
+#define  APP_BENCH_OP_Q_POST                            9u
+#define  APP_BENCH_OP_Q_PEND                           10u
+#define  APP_BENCH_OP_FLAG_POST                        11u
+#define  APP_BENCH_OP_Q_POST_BURST                     12u      /* APP_BENCH_Q_BURST calls to OSQPost().                */
+#define  APP_BENCH_OP_Q_POST_N                         13u      /* Same messages with one call to OSQPostN().           */
+#define  APP_BENCH_OP_Q_PEND_N                         14u
+#define  APP_BENCH_OP_SEM_POST_N                       15u
+#define  APP_BENCH_OP_NBR                              16u
+
+                                                                /* ------------ MEMORY FUNCTIONS (Note #3) ------------ */
+#define  APP_BENCH_MEM_OP_SET                           0u
+#define  APP_BENCH_MEM_OP_CLR                           1u
+#define  APP_BENCH_MEM_OP_COPY                          2u
+#define  APP_BENCH_MEM_OP_MOVE                          3u      /* Destination one octet above the source.              */
+#define  APP_BENCH_MEM_OP_CMP                           4u
+#define  APP_BENCH_MEM_OP_ZERO_LEN                      5u      /* Buffer all zeros, i.e. scanned to the end.           */
+#define  APP_BENCH_MEM_OP_NBR                           6u
+
+#define  APP_BENCH_MEM_BUF_ALIGN                       64u
+#define  APP_BENCH_MEM_OFFSET_DEST                      1u      /* Offsets of the unaligned case.                       */
+#define  APP_BENCH_MEM_OFFSET_SRC                       3u
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT16U  AppBench_TaskNbrTbl[] = {
+    APP_BENCH_TASK_NBR_TBL
+};
+
+static  const  CPU_CHAR  *AppBench_OpNameTbl[APP_BENCH_OP_NBR] = {
+    "TS_Get",     "OSCtxSw",     "OSIntCtxSw", "OS_Sched",
+    "OSTimeTick", "OSMutexPend", "OSMutexPost", "OSSemPost",
+    "OSSemPend",  "OSQPost",     "OSQPend",    "OSFlagPost",
+    "OSQPostBurst", "OSQPostN",  "OSQPendN",   "OSSemPostN"
+};
+
+static  const  CPU_CHAR  *AppBench_MemOpNameTbl[APP_BENCH_MEM_OP_NBR] = {
+    "Mem_Set",    "Mem_Clr",     "Mem_Copy",   "Mem_Move",
+    "Mem_Cmp",    "Mem_ZeroLen"
+};
+
+static  const  CPU_CHAR  *AppBench_MemLvlNameTbl[] = {          /* Indexed by LIB_MEM_SIMD_LVL_xxx.                     */
+    "none",       "sse2",        "avx2"
+};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U             AppBench_Iter;
+static  const  CPU_CHAR       *AppBench_OutputPath;
+static  const  CPU_CHAR       *AppBench_Label;
+static  double                 AppBench_CycPerUs;
+
+static  OS_STK                 AppBench_Stk[APP_BENCH_TASK_NBR_MAX][APP_BENCH_STK_SIZE];
+static  CPU_INT32U             AppBench_Samples[APP_BENCH_ITER_MAX];
+
+static  OS_EVENT              *AppBench_SemIsr;                 /* Posted by the simulated ISR.                         */
+static  OS_EVENT              *AppBench_Sem;
+static  OS_EVENT              *AppBench_Mutex;
+static  OS_EVENT              *AppBench_Q;
+static  void                  *AppBench_QTbl[APP_BENCH_Q_BURST];
+static  void                  *AppBench_QRxTbl[APP_BENCH_Q_BURST];
+static  OS_FLAG_GRP           *AppBench_FlagGrp;
+static  HANDLE                 AppBench_IsrSignalPtr;
+
+static  INT8U                  AppBench_HighPrio;               /* Task switched to by the OSCtxSw & OSIntCtxSw cases.  */
+static  volatile  CPU_INT08U   AppBench_HighOp;
+static  volatile  CPU_BOOLEAN  AppBench_HighDone;
+static  volatile  CPU_INT64U   AppBench_TsStart;
+static  volatile  CPU_INT64U   AppBench_TsEnd;
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void          AppBench_Task       (void        *p_arg);
+
+static  void          AppBench_HighTask   (void        *p_arg);
+
+static  void          AppBench_FillerTask (void        *p_arg);
+
+static  DWORD WINAPI  AppBench_IsrW32     (LPVOID       p_arg);
+
+static  void          AppBench_ParamReset (void);
+
+static  CPU_BOOLEAN   AppBench_CaseRun    (CPU_INT32U   task_nbr,
+                                           CPU_BOOLEAN  sparse,
+                                           FILE        *p_file);
+
+static  void          AppBench_Measure    (CPU_INT08U   op,
+                                           CPU_INT32U   iter);
+
+static  CPU_INT32U    AppBench_MemMeasure (CPU_INT08U   op,
+                                           CPU_INT08U  *p_dest,
+                                           CPU_INT08U  *p_src,
+                                           CPU_INT32U   size,
+                                           CPU_INT32U   iter);
+
+static  double        AppBench_CycPerUsGet(void);
+
+static  int           AppBench_SampleCmp  (const void  *p_a,
+                                           const void  *p_b);
+
+static  CPU_INT64U    AppBench_QPC_Get    (void);
+
+
+/*
+*********************************************************************************************************
+*                                           AppBench_Run()
+*
+* Description : Start the kernel with the benchmark task instead of the task set.
+*
+* Argument(s) : iter            Iterations per measurement, 0 for APP_BENCH_ITER_DFLT.
+*
+*               p_output_path   CSV file the results are appended to (see 'app_bench.h  Note #2').
+*
+*               p_label         Label of the run, e.g. a commit id.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Replaces the kernel startup sequence of main() & does not return : the process exits
+*                   with 0 once every case is written, or with 1 if a case could not run.
+*********************************************************************************************************
+*/
+
+void  AppBench_Run (       CPU_INT32U   iter,
+                    const  CPU_CHAR    *p_output_path,
+                    const  CPU_CHAR    *p_label)
+{
+    INT8U  err;
+
+
+    if (iter == 0u) {
+        iter = APP_BENCH_ITER_DFLT;
+    }
+    if (iter > APP_BENCH_ITER_MAX) {
+        iter = APP_BENCH_ITER_MAX;
+    }
+    AppBench_Iter       = iter;
+    AppBench_OutputPath = p_output_path;
+    AppBench_Label      = p_label;
+
+    OSInit();                                                   /* CPU & uC/LIB are initialized by main().              */
+
+    TASK_NUMBER = 0;                                            /* See 'app_bench.c  Note #1'.                          */
+    AppBench_ParamReset();
+
+    AppBench_SemIsr  = OSSemCreate(0u);
+    AppBench_Sem     = OSSemCreate(0u);
+    AppBench_Mutex   = OSMutexCreate(APP_BENCH_PRIO_CEIL, &err);
+    AppBench_Q       = OSQCreate(&AppBench_QTbl[0], APP_BENCH_Q_BURST);
+    AppBench_FlagGrp = OSFlagCreate(0u, &err);
+
+    (void)OSTaskCreateExt(AppBench_Task,
+                          (void *)0,
+                          &AppBench_Stk[0][APP_BENCH_STK_SIZE - 1u],
+                          APP_BENCH_PRIO_LAST,
+                          APP_BENCH_PRIO_LAST,
+                          &AppBench_Stk[0][0],
+                          APP_BENCH_STK_SIZE,
+                          (void *)0,
+                          OS_TASK_OPT_NONE);
+
+    OSStart();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppBench_MemRun()
+*
+* Description : Time the memory functions of uC/LIB (see 'app_bench.h  Note #4').
+*
+* Argument(s) : iter            Samples per measurement, 0 for APP_BENCH_ITER_DFLT.
+*
+*               p_output_path   CSV file the results are appended to.
+*
+*               p_label         Label of the run, e.g. a commit id.
+*
+* Return(s)   : DEF_OK,   if every case was written.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Large buffers get fewer samples, so that a measurement processes no more than
+*                   APP_BENCH_MEM_OCTETS_MAX octets.
+*
+*               (2) The SIMD level in use when the function returns is the highest one supported.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppBench_MemRun (       CPU_INT32U   iter,
+                              const  CPU_CHAR    *p_output_path,
+                              const  CPU_CHAR    *p_label)
+{
+    FILE        *p_file;
+    CPU_INT08U  *p_buf_dest;
+    CPU_INT08U  *p_buf_src;
+    CPU_INT08U  *p_dest;
+    CPU_INT08U  *p_src;
+    CPU_INT32U   size;
+    CPU_INT32U   iter_size;
+    CPU_INT32U   align;
+    CPU_INT32U   med;
+    CPU_INT08U   lvl;
+    CPU_INT08U   lvl_nbr;
+    CPU_INT08U   op;
+
+
+    if (iter == 0u) {
+        iter = APP_BENCH_ITER_DFLT;
+    }
+    if (iter > APP_BENCH_ITER_MAX) {
+        iter = APP_BENCH_ITER_MAX;
+    }
+
+    p_buf_dest = (CPU_INT08U *)malloc(APP_BENCH_MEM_SIZE_MAX + (2u * APP_BENCH_MEM_BUF_ALIGN));
+    p_buf_src  = (CPU_INT08U *)malloc(APP_BENCH_MEM_SIZE_MAX + (2u * APP_BENCH_MEM_BUF_ALIGN));
+    if ((p_buf_dest == (CPU_INT08U *)0) || (p_buf_src == (CPU_INT08U *)0)) {
+        printf("bench-mem: cannot allocate the buffers\n");
+        free(p_buf_dest);
+        free(p_buf_src);
+        return (DEF_FAIL);
+    }
+    if (fopen_s(&p_file, p_output_path, "a") != 0) {
+        printf("bench-mem: cannot open '%s'\n", p_output_path);
+        free(p_buf_dest);
+        free(p_buf_src);
+        return (DEF_FAIL);
+    }
+    fseek(p_file, 0L, SEEK_END);
+    if (ftell(p_file) == 0L) {
+        fprintf(p_file, "label,op,size,align,simd,iter,min,median,p99,max,bytes_per_cyc,cyc_per_us\n");
+    }
+
+    Mem_Set(p_buf_dest, 0x5Au, APP_BENCH_MEM_SIZE_MAX + (2u * APP_BENCH_MEM_BUF_ALIGN));
+    Mem_Set(p_buf_src,  0x5Au, APP_BENCH_MEM_SIZE_MAX + (2u * APP_BENCH_MEM_BUF_ALIGN));
+    AppBench_CycPerUs = AppBench_CycPerUsGet();
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    lvl_nbr = Mem_SIMD_LvlGet() + 1u;
+#else
+    lvl_nbr = 1u;
+#endif
+
+    printf("%u sample(s), %.1f cycles/us, cycles per call :\n", (unsigned)iter, AppBench_CycPerUs);
+    printf("%-10s %8s %-9s %-5s %10s %10s %10s %10s %8s\n",
+           "op", "size", "align", "simd", "min", "median", "p99", "max", "B/cyc");
+
+    for (lvl = 0u; lvl < lvl_nbr; lvl++) {
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+        (void)Mem_SIMD_LvlSet(lvl);
+#endif
+        for (op = 0u; op < APP_BENCH_MEM_OP_NBR; op++) {
+            for (align = 0u; align < 2u; align++) {
+                p_dest = p_buf_dest + ((0u - (CPU_ADDR)p_buf_dest) & (APP_BENCH_MEM_BUF_ALIGN - 1u));
+                p_src  = p_buf_src  + ((0u - (CPU_ADDR)p_buf_src)  & (APP_BENCH_MEM_BUF_ALIGN - 1u));
+                if (align != 0u) {
+                    p_dest += APP_BENCH_MEM_OFFSET_DEST;
+                    p_src  += APP_BENCH_MEM_OFFSET_SRC;
+                }
+                if (op == APP_BENCH_MEM_OP_MOVE) {              /* Overlapping buffers.                                 */
+                    p_dest = p_src + 1u;
+                }
+
+                for (size = 1u; size <= APP_BENCH_MEM_SIZE_MAX; size *= 2u) {
+                    iter_size = AppBench_MemMeasure(op, p_dest, p_src, size, iter);
+                    qsort(AppBench_Samples, iter_size, sizeof(AppBench_Samples[0]), AppBench_SampleCmp);
+                    med = AppBench_Samples[iter_size / 2u];
+
+                    printf("%-10s %8u %-9s %-5s %10u %10u %10u %10u %8.2f\n",
+                           AppBench_MemOpNameTbl[op],
+                           (unsigned)size,
+                           (align != 0u) ? "unaligned" : "aligned",
+                           AppBench_MemLvlNameTbl[lvl],
+                           (unsigned)AppBench_Samples[0],
+                           (unsigned)med,
+                           (unsigned)AppBench_Samples[((iter_size * 99u) + 99u) / 100u - 1u],
+                           (unsigned)AppBench_Samples[iter_size - 1u],
+                           (med != 0u) ? ((double)size / (double)med) : 0.0);
+                    fprintf(p_file, "%s,%s,%u,%s,%s,%u,%u,%u,%u,%u,%.3f,%.1f\n",
+                            p_label,
+                            AppBench_MemOpNameTbl[op],
+                            (unsigned)size,
+                            (align != 0u) ? "unaligned" : "aligned",
+                            AppBench_MemLvlNameTbl[lvl],
+                            (unsigned)iter_size,
+                            (unsigned)AppBench_Samples[0],
+                            (unsigned)med,
+                            (unsigned)AppBench_Samples[((iter_size * 99u) + 99u) / 100u - 1u],
+                            (unsigned)AppBench_Samples[iter_size - 1u],
+                            (med != 0u) ? ((double)size / (double)med) : 0.0,
+                            AppBench_CycPerUs);
+                }
+                fflush(p_file);
+            }
+        }
+    }
+#if (LIB_MEM_CFG_SIMD_EN == DEF_ENABLED)
+    (void)Mem_SIMD_LvlSet(LIB_MEM_SIMD_LVL_AVX2);               /* See Note #2.                                         */
+#endif
+
+    fclose(p_file);
+    free(p_buf_dest);
+    free(p_buf_src);
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          AppBench_Task()
+*
+* Description : Benchmark task : runs every case, lowest priority of the case it runs.
+*
+* Argument(s) : p_arg       Argument passed to 'OSTaskCreateExt()', not used.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Task counts above what the configuration allows are skipped & reported, rather than
+*                   measured at a smaller count under a misleading label.
+*********************************************************************************************************
+*/
+
+static  void  AppBench_Task (void  *p_arg)
+{
+    FILE         *p_file;
+    HANDLE        thread;
+    CPU_INT32U    task_nbr;
+    CPU_INT32U    i;
+    CPU_BOOLEAN   ok;
+
+
+    (void)p_arg;
+
+    thread = CreateThread((LPSECURITY_ATTRIBUTES)0, 0u, AppBench_IsrW32, (LPVOID)0, 0u, (LPDWORD)0);
+    AppBench_IsrSignalPtr = CreateEvent((LPSECURITY_ATTRIBUTES)0, FALSE, FALSE, (LPCTSTR)0);
+    if ((thread == (HANDLE)0) || (AppBench_IsrSignalPtr == (HANDLE)0)) {
+        printf("bench: cannot create the ISR thread\n");
+        exit(1);
+    }
+    SetThreadPriority(thread, THREAD_PRIORITY_HIGHEST);         /* Same as the tick thread of the port.                 */
+
+    AppBench_CycPerUs = AppBench_CycPerUsGet();
+
+    if (fopen_s(&p_file, AppBench_OutputPath, "a") != 0) {
+        printf("bench: cannot open '%s'\n", AppBench_OutputPath);
+        exit(1);
+    }
+    fseek(p_file, 0L, SEEK_END);
+    if (ftell(p_file) == 0L) {
+        fprintf(p_file, "label,op,tasks,spread,iter,min,median,p99,max,cyc_per_us\n");
+    }
+
+    printf("%u iteration(s), %.1f cycles/us, cycles :\n", (unsigned)AppBench_Iter, AppBench_CycPerUs);
+    printf("%-12s %5s %-6s %10s %10s %10s %10s\n", "op", "tasks", "spread", "min", "median", "p99", "max");
+
+    ok = DEF_OK;
+    for (i = 0u; i < (sizeof(AppBench_TaskNbrTbl) / sizeof(AppBench_TaskNbrTbl[0])); i++) {
+        task_nbr = AppBench_TaskNbrTbl[i];
+        if (task_nbr > APP_BENCH_TASK_NBR_MAX) {                /* See Note #1.                                         */
+            printf("%u task(s) skipped, the configuration allows %u\n", (unsigned)task_nbr, (unsigned)APP_BENCH_TASK_NBR_MAX);
+            continue;
+        }
+        if (task_nbr < 2u) {
+            continue;
+        }
+
+        if ((AppBench_CaseRun(task_nbr, DEF_NO,  p_file) != DEF_OK) ||
+            (AppBench_CaseRun(task_nbr, DEF_YES, p_file) != DEF_OK)) {
+            ok = DEF_FAIL;
+            break;
+        }
+    }
+
+    fclose(p_file);
+    OSRunning = OS_FALSE;
+    exit((ok == DEF_OK) ? 0 : 1);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppBench_HighTask()
+*
+* Description : Highest priority task of a case; timestamps its wake-up for the switch measurements.
+*
+* Argument(s) : p_arg       Argument passed to 'OSTaskCreateExt()', not used.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppBench_HighTask (void  *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+
+    while (DEF_TRUE) {
+        if (AppBench_HighOp == APP_BENCH_OP_CTX_SW) {
+            (void)OSTaskSuspend(OS_PRIO_SELF);
+        } else {
+            OSSemPend(AppBench_SemIsr, 0u, &err);
+        }
+        AppBench_TsEnd    = APP_BENCH_TS_GET();
+        AppBench_HighDone = DEF_YES;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppBench_FillerTask()
+*
+* Description : Other tasks of a case : wait on the flag group for a flag that is never posted, with a
+*               timeout that never expires, so that they sit in the flag wait list & in the tick list.
+*
+* Argument(s) : p_arg       Argument passed to 'OSTaskCreateExt()', not used.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppBench_FillerTask (void  *p_arg)
+{
+    INT8U  err;
+
+
+    (void)p_arg;
+
+    while (DEF_TRUE) {
+        (void)OSFlagPend(AppBench_FlagGrp, APP_BENCH_FLAG_WAIT, OS_FLAG_WAIT_SET_ALL, APP_BENCH_FILLER_DLY, &err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppBench_IsrW32()
+*
+* Description : Simulated interrupt : posts AppBench_SemIsr each time AppBench_IsrSignalPtr is set, with
+*               the same sequence as the tick thread of the port ('os_cpu_c.c  OSTickW32()').
+*
+* Argument(s) : p_arg       Argument passed to 'CreateThread()', not used.
+*
+* Return(s)   : 0.
+*********************************************************************************************************
+*/
+
+static  DWORD WINAPI  AppBench_IsrW32 (LPVOID  p_arg)
+{
+    CPU_BOOLEAN  suspended;
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;
+
+    while (DEF_TRUE) {
+        WaitForSingleObject(AppBench_IsrSignalPtr, INFINITE);
+        do {
+            AppBench_TsStart = APP_BENCH_TS_GET();
+            CPU_CRITICAL_ENTER();
+            suspended = OSIntCurTaskSuspend();
+            if (suspended == DEF_TRUE) {
+                OSIntEnter();
+                (void)OSSemPost(AppBench_SemIsr);
+                OSIntExit();
+                OSIntCurTaskResume();
+            }
+            CPU_CRITICAL_EXIT();
+        } while (suspended != DEF_TRUE);
+    }
+
+    return (0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppBench_ParamReset()
+*
+* Description : Keep the CPP bookkeeping of the kernel out of the way (see 'app_bench.c  Note #1').
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppBench_ParamReset (void)
+{
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < OS_MAX_TASKS; i++) {
+        TaskParameter[i].Task_need_ExecutionTime = APP_BENCH_NEED_EXEC_TIME;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppBench_CaseRun()
+*
+* Description : Measure every service with 'task_nbr' tasks & write one line per service.
+*
+* Argument(s) : task_nbr    Number of tasks, including the benchmark task.
+*
+*               sparse      DEF_YES to spread the priorities over all the free priorities,
+*                           DEF_NO  to pack them.
+*
+*               p_file      CSV file.
+*
+* Return(s)   : DEF_OK,   if every task of the case could be created.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The benchmark task takes the lowest priority of the case, the task timestamping the
+*                   switches the highest.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppBench_CaseRun (CPU_INT32U   task_nbr,
+                                       CPU_BOOLEAN  sparse,
+                                       FILE        *p_file)
+{
+    INT8U        prio[APP_BENCH_TASK_NBR_MAX];
+    INT8U        err;
+    CPU_INT32U   iter;
+    CPU_INT32U   i;
+    CPU_INT08U   op;
+    CPU_BOOLEAN  ok;
+
+
+    for (i = 0u; i < task_nbr; i++) {
+        prio[i] = (sparse == DEF_YES) ? (INT8U)(APP_BENCH_PRIO_FIRST + ((i * (APP_BENCH_PRIO_NBR - 1u)) / (task_nbr - 1u)))
+                                      : (INT8U)(APP_BENCH_PRIO_FIRST + i);
+    }
+
+    OSTimeSet(0u);                                              /* See 'app_bench.c  Note #1'.                          */
+    AppBench_ParamReset();
+
+    if (OSTCBCur->OSTCBPrio != prio[task_nbr - 1u]) {           /* See Note #1.                                         */
+        err = OSTaskChangePrio(OS_PRIO_SELF, prio[task_nbr - 1u]);
+        if (err != OS_ERR_NONE) {
+            printf("bench: cannot move to priority %u (err %u)\n", (unsigned)prio[task_nbr - 1u], (unsigned)err);
+            return (DEF_FAIL);
+        }
+    }
+
+    ok                = DEF_OK;
+    AppBench_HighPrio = prio[0];
+    AppBench_HighOp   = APP_BENCH_OP_CTX_SW;
+    for (i = 0u; i < (task_nbr - 1u); i++) {                    /* Each task runs at once & blocks.                     */
+        err = OSTaskCreateExt((i == 0u) ? AppBench_HighTask : AppBench_FillerTask,
+                              (void *)0,
+                              &AppBench_Stk[i + 1u][APP_BENCH_STK_SIZE - 1u],
+                              prio[i],
+                              prio[i],
+                              &AppBench_Stk[i + 1u][0],
+                              APP_BENCH_STK_SIZE,
+                              (void *)0,
+                              OS_TASK_OPT_NONE);
+        if (err != OS_ERR_NONE) {
+            printf("bench: cannot create task at priority %u (err %u)\n", (unsigned)prio[i], (unsigned)err);
+            ok = DEF_FAIL;
+            break;
+        }
+    }
+
+    if (ok == DEF_OK) {
+        for (op = 0u; op < APP_BENCH_OP_NBR; op++) {
+            iter = AppBench_Iter;
+            AppBench_Measure(op, iter);
+            qsort(AppBench_Samples, iter, sizeof(AppBench_Samples[0]), AppBench_SampleCmp);
+
+            printf("%-12s %5u %-6s %10u %10u %10u %10u\n",
+                   AppBench_OpNameTbl[op],
+                   (unsigned)task_nbr,
+                   (sparse == DEF_YES) ? "sparse" : "dense",
+                   (unsigned)AppBench_Samples[0],
+                   (unsigned)AppBench_Samples[iter / 2u],
+                   (unsigned)AppBench_Samples[((iter * 99u) + 99u) / 100u - 1u],
+                   (unsigned)AppBench_Samples[iter - 1u]);
+            fprintf(p_file, "%s,%s,%u,%s,%u,%u,%u,%u,%u,%.1f\n",
+                    AppBench_Label,
+                    AppBench_OpNameTbl[op],
+                    (unsigned)task_nbr,
+                    (sparse == DEF_YES) ? "sparse" : "dense",
+                    (unsigned)iter,
+                    (unsigned)AppBench_Samples[0],
+                    (unsigned)AppBench_Samples[iter / 2u],
+                    (unsigned)AppBench_Samples[((iter * 99u) + 99u) / 100u - 1u],
+                    (unsigned)AppBench_Samples[iter - 1u],
+                    AppBench_CycPerUs);
+        }
+        fflush(p_file);
+    }
+
+    for (i = 0u; i < (task_nbr - 1u); i++) {
+        (void)OSTaskDel(prio[i]);
+    }
+
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppBench_Measure()
+*
+* Description : Time 'iter' calls of one service into AppBench_Samples[].
+*
+* Argument(s) : op          Service to time, APP_BENCH_OP_xxx.
+*
+*               iter        Number of samples.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The call that undoes the measured one (e.g. OSSemPend() after OSSemPost()) is made
+*                   outside of the timestamps, so that every sample starts from the same state.
+*
+*               (2) The benchmark task spins, & is therefore the task interrupted, until the high task
+*                   has run; the port only resumes it once the high task pends again.
+*********************************************************************************************************
+*/
+
+static  void  AppBench_Measure (CPU_INT08U  op,
+                                CPU_INT32U  iter)
+{
+    CPU_INT64U  ts;
+    CPU_INT64U  te;
+    CPU_INT32U  tick;
+    CPU_INT32U  i;
+    CPU_INT32U  k;
+    INT8U       err;
+
+
+    if (op == APP_BENCH_OP_INT_CTX_SW) {                        /* Have the high task pend on AppBench_SemIsr.          */
+        AppBench_HighOp = APP_BENCH_OP_INT_CTX_SW;
+        (void)OSTaskResume(AppBench_HighPrio);
+    }
+
+    for (i = 0u; i < iter; i++) {
+        switch (op) {
+            case APP_BENCH_OP_CTX_SW:
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSTaskResume(AppBench_HighPrio);
+                 te = AppBench_TsEnd;
+                 break;
+
+            case APP_BENCH_OP_INT_CTX_SW:                       /* See Note #2.                                         */
+                 AppBench_HighDone = DEF_NO;
+                 SetEvent(AppBench_IsrSignalPtr);
+                 while (AppBench_HighDone == DEF_NO) {
+                     ;
+                 }
+                 ts = AppBench_TsStart;
+                 te = AppBench_TsEnd;
+                 break;
+
+            case APP_BENCH_OP_SCHED:
+                 ts = APP_BENCH_TS_GET();
+                 OS_Sched();
+                 te = APP_BENCH_TS_GET();
+                 break;
+
+            case APP_BENCH_OP_TIME_TICK:
+                 tick = OSTimeGet();
+                 ts   = APP_BENCH_TS_GET();
+                 OSTimeTick();
+                 te   = APP_BENCH_TS_GET();
+                 OSTimeSet(tick);
+                 AppBench_ParamReset();
+                 break;
+
+            case APP_BENCH_OP_MUTEX_PEND:                       /* See Note #1.                                         */
+                 ts = APP_BENCH_TS_GET();
+                 OSMutexPend(AppBench_Mutex, 0u, &err);
+                 te = APP_BENCH_TS_GET();
+                 (void)OSMutexPost(AppBench_Mutex);
+                 break;
+
+            case APP_BENCH_OP_MUTEX_POST:
+                 OSMutexPend(AppBench_Mutex, 0u, &err);
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSMutexPost(AppBench_Mutex);
+                 te = APP_BENCH_TS_GET();
+                 break;
+
+            case APP_BENCH_OP_SEM_POST:
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSSemPost(AppBench_Sem);
+                 te = APP_BENCH_TS_GET();
+                 OSSemPend(AppBench_Sem, 0u, &err);
+                 break;
+
+            case APP_BENCH_OP_SEM_PEND:
+                 (void)OSSemPost(AppBench_Sem);
+                 ts = APP_BENCH_TS_GET();
+                 OSSemPend(AppBench_Sem, 0u, &err);
+                 te = APP_BENCH_TS_GET();
+                 break;
+
+            case APP_BENCH_OP_Q_POST:
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSQPost(AppBench_Q, (void *)&AppBench_QTbl[0]);
+                 te = APP_BENCH_TS_GET();
+                 (void)OSQPend(AppBench_Q, 0u, &err);
+                 break;
+
+            case APP_BENCH_OP_Q_PEND:
+                 (void)OSQPost(AppBench_Q, (void *)&AppBench_QTbl[0]);
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSQPend(AppBench_Q, 0u, &err);
+                 te = APP_BENCH_TS_GET();
+                 break;
+
+            case APP_BENCH_OP_FLAG_POST:
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSFlagPost(AppBench_FlagGrp, APP_BENCH_FLAG_POST, OS_FLAG_SET, &err);
+                 te = APP_BENCH_TS_GET();
+                 break;
+
+            case APP_BENCH_OP_Q_POST_BURST:
+                 ts = APP_BENCH_TS_GET();
+                 for (k = 0u; k < APP_BENCH_Q_BURST; k++) {
+                     (void)OSQPost(AppBench_Q, (void *)&AppBench_QTbl[k]);
+                 }
+                 te = APP_BENCH_TS_GET();
+                 (void)OSQPendN(AppBench_Q, &AppBench_QRxTbl[0], APP_BENCH_Q_BURST, 0u, &err);
+                 break;
+
+            case APP_BENCH_OP_Q_POST_N:
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSQPostN(AppBench_Q, &AppBench_QTbl[0], APP_BENCH_Q_BURST, &err);
+                 te = APP_BENCH_TS_GET();
+                 (void)OSQPendN(AppBench_Q, &AppBench_QRxTbl[0], APP_BENCH_Q_BURST, 0u, &err);
+                 break;
+
+            case APP_BENCH_OP_Q_PEND_N:
+                 (void)OSQPostN(AppBench_Q, &AppBench_QTbl[0], APP_BENCH_Q_BURST, &err);
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSQPendN(AppBench_Q, &AppBench_QRxTbl[0], APP_BENCH_Q_BURST, 0u, &err);
+                 te = APP_BENCH_TS_GET();
+                 break;
+
+            case APP_BENCH_OP_SEM_POST_N:
+                 ts = APP_BENCH_TS_GET();
+                 (void)OSSemPostN(AppBench_Sem, APP_BENCH_Q_BURST);
+                 te = APP_BENCH_TS_GET();
+                 for (k = 0u; k < APP_BENCH_Q_BURST; k++) {
+                     OSSemPend(AppBench_Sem, 0u, &err);
+                 }
+                 break;
+
+            case APP_BENCH_OP_TS:
+            default:
+                 ts = APP_BENCH_TS_GET();
+                 te = APP_BENCH_TS_GET();
+                 break;
+        }
+        AppBench_Samples[i] = ((te - ts) > DEF_INT_32U_MAX_VAL) ? DEF_INT_32U_MAX_VAL : (CPU_INT32U)(te - ts);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppBench_MemMeasure()
+*
+* Description : Time calls of one memory function into AppBench_Samples[].
+*
+* Argument(s) : op          Function to time, APP_BENCH_MEM_OP_xxx.
+*
+*               p_dest      Destination buffer (first buffer of Mem_Cmp(), buffer of Mem_ZeroLen()).
+*
+*               p_src       Source buffer (second buffer of Mem_Cmp()).
+*
+*               size        Number of octets per call.
+*
+*               iter        Number of samples wanted.
+*
+* Return(s)   : Number of samples taken (see 'AppBench_MemRun()  Note #1').
+*
+* Note(s)     : (1) A sample is the mean time of the calls that cover APP_BENCH_MEM_SAMPLE_SIZE octets, so
+*                   that small sizes are not lost in the cost of reading the timestamps.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppBench_MemMeasure (CPU_INT08U   op,
+                                         CPU_INT08U  *p_dest,
+                                         CPU_INT08U  *p_src,
+                                         CPU_INT32U   size,
+                                         CPU_INT32U   iter)
+{
+    volatile  CPU_BOOLEAN  cmp;
+    volatile  CPU_SIZE_T   len;
+              CPU_INT64U   ts;
+              CPU_INT64U   te;
+              CPU_INT32U   call_nbr;
+              CPU_INT32U   i;
+              CPU_INT32U   j;
+
+
+    call_nbr = (size < APP_BENCH_MEM_SAMPLE_SIZE) ? (APP_BENCH_MEM_SAMPLE_SIZE / size) : 1u;    /* See Note #1.     */
+    if (((CPU_INT64U)iter * call_nbr * size) > APP_BENCH_MEM_OCTETS_MAX) {
+        iter = APP_BENCH_MEM_OCTETS_MAX / (call_nbr * size);
+    }
+    if (iter == 0u) {
+        iter = 1u;
+    }
+
+    if (op == APP_BENCH_MEM_OP_ZERO_LEN) {
+        Mem_Clr(p_dest, size);
+    } else {
+        Mem_Copy(p_dest, p_src, size);                          /* Identical buffers for Mem_Cmp().                     */
+    }
+    for (i = 0u; i < iter; i++) {
+        ts = APP_BENCH_TS_GET();
+        for (j = 0u; j < call_nbr; j++) {
+            switch (op) {
+                case APP_BENCH_MEM_OP_SET:
+                     Mem_Set(p_dest, 0xA5u, size);
+                     break;
+
+                case APP_BENCH_MEM_OP_CLR:
+                     Mem_Clr(p_dest, size);
+                     break;
+
+                case APP_BENCH_MEM_OP_COPY:
+                     Mem_Copy(p_dest, p_src, size);
+                     break;
+
+                case APP_BENCH_MEM_OP_MOVE:
+                     Mem_Move(p_dest, p_src, size);
+                     break;
+
+                case APP_BENCH_MEM_OP_ZERO_LEN:
+                     len = Mem_ZeroLen(p_dest, size);
+                     break;
+
+                case APP_BENCH_MEM_OP_CMP:
+                default:
+                     cmp = Mem_Cmp(p_dest, p_src, size);
+                     break;
+            }
+        }
+        te = APP_BENCH_TS_GET();
+        AppBench_Samples[i] = (CPU_INT32U)(((te - ts) / call_nbr > DEF_INT_32U_MAX_VAL) ? DEF_INT_32U_MAX_VAL
+                                                                                       : ((te - ts) / call_nbr));
+    }
+    (void)cmp;
+    (void)len;
+
+    return (iter);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppBench_CycPerUsGet()
+*
+* Description : Measure the rate of the cycle counter against the performance counter.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Cycles per microsecond (see 'app_bench.c  Note #2').
+*********************************************************************************************************
+*/
+
+static  double  AppBench_CycPerUsGet (void)
+{
+    CPU_INT64U     ts;
+    CPU_INT64U     qpc;
+    LARGE_INTEGER  freq;
+
+
+    QueryPerformanceFrequency(&freq);
+    qpc = AppBench_QPC_Get();
+    ts  = APP_BENCH_TS_GET();
+    Sleep(APP_BENCH_CALIB_MS);
+    qpc = AppBench_QPC_Get() - qpc;
+    ts  = APP_BENCH_TS_GET() - ts;
+
+    return (((double)ts * (double)freq.QuadPart) / ((double)qpc * 1000000.0));
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppBench_SampleCmp()
+*
+* Description : Order samples for qsort().
+*********************************************************************************************************
+*/
+
+static  int  AppBench_SampleCmp (const void  *p_a,
+                                 const void  *p_b)
+{
+    CPU_INT32U  a;
+    CPU_INT32U  b;
+
+
+    a = *(const CPU_INT32U *)p_a;
+    b = *(const CPU_INT32U *)p_b;
+    return ((a > b) - (a < b));
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppBench_QPC_Get()
+*
+* Description : Read the performance counter.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  AppBench_QPC_Get (void)
+{
+    LARGE_INTEGER  ctr;
+
+
+    QueryPerformanceCounter(&ctr);
+    return ((CPU_INT64U)ctr.QuadPart);
+}
@@ -0,0 +1,125 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                       KERNEL MICROBENCHMARKS
+*
+* Filename : app_bench.h
+*
+* Note(s)  : (1) The kernel is started with a benchmark task instead of the task set, & every kernel
+*                service below is timed with the CPU cycle counter over many iterations :
+*
+*                    OSCtxSw       From OSTaskResume() in a task to the first instruction of the
+*                                  resumed, higher priority task.
+*                    OSIntCtxSw    From the start of a simulated ISR that posts a semaphore to the
+*                                  first instruction of the task pending on it (see 'os_cpu_c.c
+*                                  OSIntCtxSw() Note #2').
+*                    OS_Sched      Scheduler call that does not switch.
+*                    OSTimeTick    Tick with every other task in the tick list.
+*                    OSFlagPost    Post that readies no task, with every other task in the wait list.
+*                    OSMutexPend/OSMutexPost, OSSemPost/OSSemPend, OSQPost/OSQPend
+*                                  Uncontended.
+*                    OSQPostBurst, OSQPostN, OSQPendN, OSSemPostN
+*                                  APP_BENCH_Q_BURST messages or counts, posted with one call each
+*                                  (burst) or with one call in all, uncontended.
+*
+*                Each service is measured for every task count in APP_BENCH_TASK_NBR_TBL, with the tasks'
+*                priorities packed (dense) or spread evenly over all the free priorities (sparse).  The
+*                table stops at 16 tasks, the largest power of two that 'os_cfg.h' (OS_MAX_TASKS of 20)
+*                allows; larger counts need OS_MAX_TASKS & OS_LOWEST_PRIO raised first, & are otherwise
+*                skipped with a message.
+*
+*            (2) Results are appended, one line per service, task count & spread, to a CSV file so that
+*                runs can be compared over time :
+*
+*                    label,op,tasks,spread,iter,min,median,p99,max,cyc_per_us
+*
+*                'label' is given on the command line (e.g. a commit id), times are in CPU cycles.
+*
+*            (3) The numbers include the Win32 thread hand-off of the port; they are meant to compare
+*                builds of the kernel on the same host, not to predict the cost on a target.
+*
+*            (4) AppBench_MemRun() times Mem_Set(), Mem_Clr(), Mem_Copy(), Mem_Move() (overlapping, from the
+*                end), Mem_Cmp() (identical buffers) & Mem_ZeroLen() (buffer all zeros, as scanned by
+*                OSTaskStkChk()) of uC/LIB, without the kernel, for every power of two size from 1 octet to
+*                APP_BENCH_MEM_SIZE_MAX, with 64-octet aligned buffers & with buffers offset by a few octets,
+*                & for every SIMD level the CPU supports (see 'lib_mem.h  SIMD LEVELS').  A sample is the
+*                mean time of enough calls to cover APP_BENCH_MEM_SAMPLE_SIZE octets.  Results are appended
+*                to a CSV file :
+*
+*                    label,op,size,align,simd,iter,min,median,p99,max,bytes_per_cyc,cyc_per_us
+*
+*                'bytes_per_cyc' is computed from the median.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_BENCH_H
+#define  APP_BENCH_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_BENCH_ITER_DFLT                        10000u      /* Iterations per measurement when none is given.       */
+#define  APP_BENCH_ITER_MAX                        100000u
+#define  APP_BENCH_TASK_NBR_TBL          2u, 4u, 8u, 16u        /* See Note #1.                                         */
+#define  APP_BENCH_STK_SIZE                           256u      /* Stack of a task, in OS_STK.                          */
+#define  APP_BENCH_Q_BURST                              8u      /* Messages of the batched post & pend cases.           */
+#define  APP_BENCH_OUTPUT_FILE_NAME        "./bench.csv"
+#define  APP_BENCH_LABEL_DFLT                         "-"
+
+                                                                /* ----------------- MEMORY FUNCTIONS ----------------- */
+#define  APP_BENCH_MEM_SIZE_MAX               (1024u * 1024u)   /* Largest buffer timed, in octets.                     */
+#define  APP_BENCH_MEM_SAMPLE_SIZE                   4096u      /* Octets processed by the calls of one sample.         */
+#define  APP_BENCH_MEM_OCTETS_MAX       (64u * 1024u * 1024u)   /* Cap on the octets processed by one measurement.      */
+#define  APP_BENCH_MEM_OUTPUT_FILE_NAME    "./bench_mem.csv"
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void         AppBench_Run    (       CPU_INT32U   iter,
+                              const  CPU_CHAR    *p_output_path,
+                              const  CPU_CHAR    *p_label);
+
+CPU_BOOLEAN  AppBench_MemRun (       CPU_INT32U   iter,
+                              const  CPU_CHAR    *p_output_path,
+                              const  CPU_CHAR    *p_label);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -0,0 +1,3349 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                        KERNEL SERVICE CHECKS
+*
+* Filename : app_check.c
+*
+* Note(s)  : (1) As for the benchmarks (see 'app_bench.c  Note #1'), no task set is loaded : TASK_NUMBER is 0
+*                & 'Task_need_ExecutionTime' of every task is kept non-zero so that OSIntExit() preempts, &
+*                OSTime is rewound before each case & while a case runs so that SYSTEM_END_TIME is never
+*                reached.
+*
+*            (2) The timer task is moved above every task of the checks, so that each OSTmrSignal() of the
+*                check task updates the timer wheel before it returns.  The ticks of the port may signal
+*                the timer task as well; the model therefore follows OSTmrTime rather than counting the
+*                signals it sends.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdlib.h>
+
+#include  <cpu.h>
+#include  <lib_mem.h>
+#include  <os.h>
+
+#include  "app_check.h"
+
+#ifdef   _WIN32
+#include  <windows.h>
+#else
+#include  <pthread.h>
+#include  <time.h>
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CHECK_PRIO_TMR                       T_start       /* Timer task while the checks run (see Note #2).       */
+#define  APP_CHECK_PRIO_MAIN                          20u       /* Check task.                                          */
+#define  APP_CHECK_PRIO_HELPER                        10u       /* Helper task of a case, above the check task.         */
+
+#define  APP_CHECK_NEED_EXEC_TIME                  0xFFFFu      /* See 'app_check.c  Note #1'.                          */
+#define  APP_CHECK_TIME_RESET_NBR                      64u      /* Steps of a case between two rewinds of OSTime.       */
+
+#define  APP_CHECK_RES_PASS                             0u
+#define  APP_CHECK_RES_FAIL                             1u
+#define  APP_CHECK_RES_SKIP                             2u      /* Services of the case disabled in 'os_cfg.h'.         */
+
+                                                                /* ---------------------- OSTmr ---------------------- */
+#define  APP_CHECK_TMR_DLY_BITS_MAX                    24u      /* Delays up to 2^24 updates, i.e. up to wheel level 3. */
+#define  APP_CHECK_TMR_PERIOD_BITS_MAX                 14u
+#define  APP_CHECK_TMR_OP_RATE                          8u      /* One timer operation every 8 updates on average.      */
+
+                                                                /* -------------------- OSMemSlab -------------------- */
+#define  APP_CHECK_MEM_SLAB_NBR                         2u      /* Without & with OS_MEM_SLAB_OPT_FALLBACK.             */
+#define  APP_CHECK_MEM_SLAB_PART_NBR                    3u      /* Partitions of a slab allocator.                      */
+#define  APP_CHECK_MEM_SLAB_PART_NONE                0xFFu
+#define  APP_CHECK_MEM_SLAB_BLK_MAX                    16u      /* Blocks of the partitions of a slab allocator.        */
+#define  APP_CHECK_MEM_SLAB_STOR_SIZE                 512u      /* Storage of a slab allocator, in 64-bit words.        */
+#define  APP_CHECK_MEM_SLAB_SIZE_ERR_RATE              64u      /* One size out of the classes every 64 requests.       */
+#define  APP_CHECK_MEM_SLAB_PBLK_ERR_RATE              16u      /* One misaligned block every 16 releases.              */
+
+                                                                /* ---------------------- OSQBuf --------------------- */
+#define  APP_CHECK_Q_BUF_MSG_SIZE                      64u      /* Largest message, a multiple of 8 bytes.              */
+#define  APP_CHECK_Q_BUF_BLK_SIZE                   (OS_Q_BUF_HDR_SIZE + APP_CHECK_Q_BUF_MSG_SIZE)
+#define  APP_CHECK_Q_BUF_BLK_NBR                        8u      /* Buffers of the partition.                            */
+#define  APP_CHECK_Q_BUF_Q_SIZE                         4u      /* Messages of a queue.                                 */
+#define  APP_CHECK_Q_BUF_REF_MAX                        4u      /* References to a buffer of the check task, at most.   */
+#define  APP_CHECK_Q_BUF_OP_ECHO                        0u      /* Helper task posts the message back,                  */
+#define  APP_CHECK_Q_BUF_OP_HOLD                        1u      /* ... keeps it, releasing the one it kept,             */
+#define  APP_CHECK_Q_BUF_OP_DROP                        2u      /* ... releases it & the one it kept.                   */
+
+                                                                /* -------------------- OSEventSet ------------------- */
+#if ((OS_EVENT_SET_EN    > 0u) &&                                                                   \
+     (OS_SEM_ACCEPT_EN   > 0u) && (OS_MBOX_ACCEPT_EN > 0u) && (OS_Q_ACCEPT_EN > 0u) &&                   \
+     (OS_SEM_DEL_EN      > 0u) && (OS_MBOX_DEL_EN    > 0u) && (OS_Q_DEL_EN    > 0u) &&                   \
+     (OS_TASK_SUSPEND_EN > 0u) && (OS_TASK_DEL_EN    > 0u))
+#define  APP_CHECK_EVENT_SET_EN                  DEF_ENABLED
+#else
+#define  APP_CHECK_EVENT_SET_EN                  DEF_DISABLED
+#endif
+#define  APP_CHECK_EVENT_SET_SEM                        0u      /* Events of the set, by index.                         */
+#define  APP_CHECK_EVENT_SET_MBOX                       1u
+#define  APP_CHECK_EVENT_SET_Q                          2u
+#define  APP_CHECK_EVENT_SET_EVT_NBR                    3u
+#define  APP_CHECK_EVENT_SET_AVAIL_MAX                  4u      /* Count of the semaphore & messages of the queue.      */
+#define  APP_CHECK_EVENT_SET_TIMEOUT                   10u      /* Wait of the check task, so that a lost post fails.   */
+#define  APP_CHECK_EVENT_SET_OP_NONE                    0u      /* Helper task only suspends itself,                    */
+#define  APP_CHECK_EVENT_SET_OP_POST_ACCEPT             1u      /* ... posts & accepts the semaphore, then the mailbox, */
+#define  APP_CHECK_EVENT_SET_OP_PEND_Q                  2u      /* ... waits on the queue,                              */
+#define  APP_CHECK_EVENT_SET_OP_PEND_SET                3u      /* ... waits on the other set.                          */
+
+                                                                /* ------------------ Mem_DynPoolMag ----------------- */
+#define  APP_CHECK_MAG_BLK_SIZE                        16u      /* Octets of a block of the pool.                       */
+#define  APP_CHECK_MAG_BLK_NBR                       2048u      /* Blocks of the pool, see 'AppCheck_MagGet()  Note #2'.*/
+                                                                /* Segment of the pool, in 64-bit words.                */
+#define  APP_CHECK_MAG_STOR_SIZE     ((APP_CHECK_MAG_BLK_NBR * APP_CHECK_MAG_BLK_SIZE) / 8u)
+#define  APP_CHECK_MAG_CACHE_SIZE                      16u      /* Blocks cached by a magazine, at most.                */
+#define  APP_CHECK_MAG_HELD_MAX                        64u      /* Blocks held by a worker, at most.                    */
+#define  APP_CHECK_MAG_CHK_RATE                        16u      /* Steps of a worker between two checks of the pool.    */
+#define  APP_CHECK_MAG_TAG_OFFSET                       8u      /* Owner of a held block, past the link of the lists.   */
+#define  APP_CHECK_MAG_TIME_BURST                       8u      /* Blocks got, then freed, at once by a timed round.    */
+#define  APP_CHECK_MAG_MODE_CHK                         0u      /* Workers get & free random blocks,                    */
+#define  APP_CHECK_MAG_MODE_FREE                        1u      /* ... free every block they hold,                      */
+#define  APP_CHECK_MAG_MODE_TIME_MAG                    2u      /* ... are timed through their magazines,               */
+#define  APP_CHECK_MAG_MODE_TIME_POOL                   3u      /* ... are timed straight from the pool.                */
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT08U  (*APP_CHECK_FNCT)(void);
+
+typedef  struct  app_check_case {
+    const  CPU_CHAR        *NamePtr;
+           APP_CHECK_FNCT   Fnct;
+} APP_CHECK_CASE;
+
+
+#if (OS_TMR_EN > 0u)
+typedef  struct  app_check_tmr {                                /* Reference model of a timer.                          */
+    OS_TMR       *TmrPtr;
+    CPU_BOOLEAN   Run;                                          /* Timer expected in the wheel.                         */
+    CPU_INT08U    Opt;
+    CPU_INT32U    Dly;
+    CPU_INT32U    Period;
+    CPU_INT32U    Match;                                        /* Value of OSTmrTime at the next callback.             */
+} APP_CHECK_TMR;
+#endif
+
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+typedef  struct  app_check_mem_slab_part {                      /* Partition of a slab allocator.                       */
+    CPU_INT32U    BlkSize;                                      /* Block size passed to OSMemSlabAdd().                 */
+    CPU_INT32U    BlkNbr;
+} APP_CHECK_MEM_SLAB_PART;
+
+
+typedef  struct  app_check_mem_slab {                           /* Slab allocator & its reference model.                */
+    OS_MEM_SLAB   Slab;
+    CPU_INT08U    Opt;
+    CPU_INT08U    PartClass[APP_CHECK_MEM_SLAB_PART_NBR];       /* Class of each partition.                             */
+    CPU_INT08U   *PartAddrPtr[APP_CHECK_MEM_SLAB_PART_NBR];
+    CPU_INT32U    PartNFree[APP_CHECK_MEM_SLAB_PART_NBR];
+    CPU_INT32U    PartNUsedMax[APP_CHECK_MEM_SLAB_PART_NBR];
+    CPU_INT32U    NGet[OS_MEM_SLAB_CLASS_NBR];                  /* Statistics of each class, see OSMemSlabGet().        */
+    CPU_INT32U    NFallback[OS_MEM_SLAB_CLASS_NBR];
+    CPU_INT32U    NFail[OS_MEM_SLAB_CLASS_NBR];
+    void         *BlkTbl[APP_CHECK_MEM_SLAB_BLK_MAX];           /* Blocks held by the check task.                       */
+    CPU_INT32U    BlkNbr;
+} APP_CHECK_MEM_SLAB;
+#endif
+
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+typedef  struct  app_check_q_buf {                              /* Buffer of the check task.                            */
+    CPU_INT08U   *MsgPtr;
+    CPU_INT32U    RefCtr;                                       /* References expected.                                 */
+} APP_CHECK_Q_BUF;
+#endif
+
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+typedef  struct  app_check_event_set_evt {                      /* Event of the set & its reference model.              */
+    OS_EVENT     *EventPtr;
+    CPU_INT32U    Avail;                                        /* Count or messages.                                   */
+    CPU_BOOLEAN   Member;                                       /* Event expected in the set.                           */
+    CPU_BOOLEAN   Rdy;                                          /* Event expected in the list of ready events.          */
+} APP_CHECK_EVENT_SET_EVT;
+#endif
+
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+typedef  struct  app_check_mag_worker {                         /* Worker of the magazine check, on its own thread.     */
+           MEM_DYN_POOL_MAG   Mag;
+           CPU_INT32U         Ix;
+           CPU_INT08U         Mode;                             /* What the worker does, APP_CHECK_MAG_MODE_...         */
+           CPU_INT32U         RandState;
+           CPU_INT08U        *BlkTbl[APP_CHECK_MAG_HELD_MAX];   /* Blocks held.                                         */
+           CPU_INT32U         BlkNbr;
+           CPU_INT32U         HeldLo;                           /* See 'AppCheck_MagGet()  Note #1'.                    */
+           CPU_INT32U         HeldHi;
+           CPU_INT32U         ChkNbr;                           /* See AppCheck_MagEq().                                */
+    const  CPU_CHAR          *FailWhatPtr;
+           CPU_INT32U         FailVal;
+           CPU_INT32U         FailValExp;
+} APP_CHECK_MAG_WORKER;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void         AppCheck_Task         (void         *p_arg);
+
+static  CPU_INT08U   AppCheck_Tmr          (void);
+
+static  void         AppCheck_ParamReset   (void);
+
+static  CPU_BOOLEAN  AppCheck_Eq           (const  CPU_CHAR  *p_what,
+                                                   CPU_INT32U  val,
+                                                   CPU_INT32U  val_exp);
+
+static  void         AppCheck_Fail         (const  CPU_CHAR  *p_what,
+                                                   CPU_INT32U  val,
+                                                   CPU_INT32U  val_exp);
+
+static  CPU_INT32U   AppCheck_Rand         (void);
+
+#if (OS_TMR_EN > 0u)
+static  CPU_BOOLEAN  AppCheck_TmrStart     (CPU_INT32U    ix,
+                                            CPU_BOOLEAN   create);
+
+static  CPU_BOOLEAN  AppCheck_TmrCmp       (void);
+
+static  void         AppCheck_TmrCallback  (void         *ptmr,
+                                            void         *p_arg);
+#endif
+
+static  CPU_INT08U   AppCheck_MemSlab      (void);
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_MemSlabAdd   (APP_CHECK_MEM_SLAB  *p_slab,
+                                            CPU_INT08U          *p_stor);
+
+static  CPU_BOOLEAN  AppCheck_MemSlabGet   (APP_CHECK_MEM_SLAB  *p_slab);
+
+static  CPU_BOOLEAN  AppCheck_MemSlabPut   (APP_CHECK_MEM_SLAB  *p_slab,
+                                            CPU_INT32U           blk_ix);
+
+static  CPU_BOOLEAN  AppCheck_MemSlabCmp   (APP_CHECK_MEM_SLAB  *p_slab);
+
+static  CPU_INT08U   AppCheck_MemSlabPart  (APP_CHECK_MEM_SLAB  *p_slab,
+                                            void                *p_blk);
+
+static  CPU_INT08U   AppCheck_MemSlabClass (CPU_INT32U           size);
+
+static  CPU_INT32U   AppCheck_MemSlabBlkSize(CPU_INT08U          ix);
+#endif
+
+static  CPU_INT08U   AppCheck_QBuf         (void);
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  CPU_INT08U   AppCheck_QBufRun      (void);
+
+static  void         AppCheck_QBufTask     (void         *p_arg);
+
+static  CPU_BOOLEAN  AppCheck_QBufGet      (void);
+
+static  CPU_BOOLEAN  AppCheck_QBufSend     (CPU_INT32U    ix,
+                                            CPU_INT08U    op);
+
+static  CPU_BOOLEAN  AppCheck_QBufRetain   (CPU_INT32U    ix);
+
+static  CPU_BOOLEAN  AppCheck_QBufRelease  (CPU_INT32U    ix);
+
+static  CPU_BOOLEAN  AppCheck_QBufCmp      (void);
+#endif
+
+static  CPU_INT08U   AppCheck_EventSet     (void);
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+static  CPU_INT08U   AppCheck_EventSetRun  (void);
+
+static  void         AppCheck_EventSetTask (void         *p_arg);
+
+static  CPU_BOOLEAN  AppCheck_EventSetPost (CPU_INT32U    ix);
+
+static  CPU_BOOLEAN  AppCheck_EventSetAccept(CPU_INT32U   ix);
+
+static  CPU_BOOLEAN  AppCheck_EventSetPend (void);
+
+static  CPU_BOOLEAN  AppCheck_EventSetMember(CPU_INT32U   ix);
+#endif
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  double       AppCheck_MagRound     (CPU_INT08U    mode);
+
+static  void         AppCheck_MagWorker    (APP_CHECK_MAG_WORKER  *p_worker);
+
+#ifdef  _WIN32
+static  DWORD WINAPI AppCheck_MagThread    (LPVOID        p_arg);
+#else
+static  void        *AppCheck_MagThread    (void         *p_arg);
+#endif
+
+static  CPU_BOOLEAN  AppCheck_MagGet       (APP_CHECK_MAG_WORKER  *p_worker);
+
+static  CPU_BOOLEAN  AppCheck_MagFree      (APP_CHECK_MAG_WORKER  *p_worker,
+                                            CPU_INT32U             ix);
+
+static  CPU_BOOLEAN  AppCheck_MagAvailChk  (APP_CHECK_MAG_WORKER  *p_worker);
+
+static  void         AppCheck_MagTime      (APP_CHECK_MAG_WORKER  *p_worker);
+
+static  CPU_BOOLEAN  AppCheck_MagCmp       (void);
+
+static  CPU_BOOLEAN  AppCheck_MagRpt       (CPU_INT32U    thread_nbr,
+                                            double        ms_mag,
+                                            double        ms_pool);
+
+static  CPU_BOOLEAN  AppCheck_MagEq        (       APP_CHECK_MAG_WORKER  *p_worker,
+                                            const  CPU_CHAR              *p_what,
+                                                   CPU_INT32U             val,
+                                                   CPU_INT32U             val_exp);
+
+static  CPU_INT32U   AppCheck_MagRand      (APP_CHECK_MAG_WORKER  *p_worker);
+
+static  double       AppCheck_MagMsGet     (void);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  APP_CHECK_CASE  AppCheck_CaseTbl[] = {
+    { "OSTmr",        AppCheck_Tmr      },
+    { "OSMemSlab",    AppCheck_MemSlab  },
+    { "OSQBuf",       AppCheck_QBuf     },
+    { "OSEventSet",   AppCheck_EventSet }
+};
+
+#if (OS_TMR_EN > 0u)
+static  const  CPU_INT32U  AppCheck_TmrTimeTbl[APP_CHECK_TMR_RUN_NBR] = {
+    0x00000000u,                                                /* From the reset value.                                */
+    0x0003F000u,                                                /* Across a cascade from level 3 (2^18).                */
+    0x7FFFE000u,                                                /* Across the change of the top digit.                  */
+    0xFFFFE000u                                                 /* Across the wrap-around of OSTmrTime.                 */
+};
+#endif
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  const  APP_CHECK_MEM_SLAB_PART  AppCheck_MemSlabPartTbl[APP_CHECK_MEM_SLAB_PART_NBR] = {
+    {   48u,  4u },                                             /* In increasing classes, see AppCheck_MemSlabGet().    */
+    {  100u,  3u },                                             /* Class of 97 to 112 bytes.                            */
+    { 1000u,  2u }                                              /* Class of 897 to 1024 bytes.                          */
+};
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_STK                 AppCheck_Stk[APP_CHECK_STK_SIZE];
+static  OS_STK                 AppCheck_HelperStk[APP_CHECK_STK_SIZE];
+
+static  CPU_INT32U             AppCheck_Seed;
+static  CPU_INT32U             AppCheck_RandState;
+static  CPU_INT32U             AppCheck_ChkNbr;                 /* Comparisons made by the current case.                */
+static  const  CPU_CHAR       *AppCheck_FailWhatPtr;            /* First failure of the current case.                   */
+static  CPU_INT32U             AppCheck_FailVal;
+static  CPU_INT32U             AppCheck_FailValExp;
+
+#if (OS_TMR_EN > 0u)
+static  APP_CHECK_TMR          AppCheck_TmrTbl[APP_CHECK_TMR_NBR];
+static  CPU_INT32U             AppCheck_TmrCallbackNbr;
+static  const  CPU_CHAR       *AppCheck_TmrErrWhatPtr;          /* First callback that did not match the model.         */
+static  CPU_INT32U             AppCheck_TmrErrTime;
+static  CPU_INT32U             AppCheck_TmrErrMatch;
+#endif
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  APP_CHECK_MEM_SLAB     AppCheck_MemSlabTbl[APP_CHECK_MEM_SLAB_NBR];
+static  CPU_INT64U             AppCheck_MemSlabStor[APP_CHECK_MEM_SLAB_NBR][APP_CHECK_MEM_SLAB_STOR_SIZE];
+static  CPU_INT32U             AppCheck_MemSlabBoundTbl[OS_MEM_SLAB_CLASS_NBR];
+#endif
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  CPU_INT64U             AppCheck_QBufStor[APP_CHECK_Q_BUF_BLK_NBR][APP_CHECK_Q_BUF_BLK_SIZE / 8u];
+static  CPU_INT64U             AppCheck_QBufStorSmall[2u][OS_Q_BUF_HDR_SIZE / 8u];
+static  void                  *AppCheck_QBufQStor[2u][APP_CHECK_Q_BUF_Q_SIZE];
+static  OS_MEM                *AppCheck_QBufMemPtr;
+static  OS_EVENT              *AppCheck_QBufTxPtr;              /* Queue of the helper task.                            */
+static  OS_EVENT              *AppCheck_QBufRxPtr;              /* Queue of the check task.                             */
+static  APP_CHECK_Q_BUF        AppCheck_QBufTbl[APP_CHECK_Q_BUF_BLK_NBR];
+static  CPU_INT32U             AppCheck_QBufNbr;
+static  void                  *AppCheck_QBufHeldPtr;            /* Buffer the helper task is expected to keep.          */
+static  void                  *AppCheck_QBufTaskHeldPtr;        /* Buffer the helper task keeps.                        */
+static  INT32U                 AppCheck_QBufTaskLen;            /* Length of the last message of the helper task.       */
+static  const  CPU_CHAR       *AppCheck_QBufTaskErrWhatPtr;     /* First error of the helper task.                      */
+static  INT8U                  AppCheck_QBufTaskErr;
+#endif
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+static  void                  *AppCheck_EventSetQStor[APP_CHECK_EVENT_SET_AVAIL_MAX];
+static  OS_EVENT              *AppCheck_EventSetPtr;
+static  OS_EVENT              *AppCheck_EventSetOtherPtr;       /* Set the helper task waits on.                        */
+static  OS_EVENT              *AppCheck_EventSetSemPtr;         /* Semaphore of the other set.                          */
+static  APP_CHECK_EVENT_SET_EVT  AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_EVT_NBR];
+static  CPU_INT08U             AppCheck_EventSetRdyTbl[APP_CHECK_EVENT_SET_EVT_NBR];
+static  CPU_INT32U             AppCheck_EventSetRdyNbr;         /* Events of the model in the list of ready events.     */
+static  CPU_INT08U             AppCheck_EventSetTaskOp;         /* Next step of the helper task.                        */
+static  INT16U                 AppCheck_EventSetTaskCnt;        /* Results of the last step of the helper task.         */
+static  void                  *AppCheck_EventSetTaskMsgPtr;
+static  OS_EVENT              *AppCheck_EventSetTaskEvtPtr;
+static  INT16U                 AppCheck_EventSetTaskNbr;
+static  INT8U                  AppCheck_EventSetTaskErr;
+#endif
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  CPU_INT64U             AppCheck_MagStor[APP_CHECK_MAG_STOR_SIZE];
+static  MEM_SEG                AppCheck_MagSeg;
+static  MEM_DYN_POOL           AppCheck_MagPool;
+static  APP_CHECK_MAG_WORKER   AppCheck_MagWorkerTbl[APP_CHECK_MAG_THREAD_MAX];
+static  CPU_INT32U             AppCheck_MagThreadNbr;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_Run()
+*
+* Description : Start the kernel with the check task instead of the task set.
+*
+* Argument(s) : seed        Seed of the random choices of the cases, 0 for APP_CHECK_SEED_DFLT.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Replaces the kernel startup sequence of main() & does not return : the process exits
+*                   with 0 if every case passed or was skipped, or with 1 otherwise.
+*********************************************************************************************************
+*/
+
+void  AppCheck_Run (CPU_INT32U  seed)
+{
+    AppCheck_Seed = (seed != 0u) ? seed : APP_CHECK_SEED_DFLT;
+
+    OSInit();                                                   /* CPU & uC/LIB are initialized by main().              */
+
+    TASK_NUMBER = 0;                                            /* See 'app_check.c  Note #1'.                          */
+    AppCheck_ParamReset();
+
+    (void)OSTaskCreateExt(AppCheck_Task,
+                          (void *)0,
+                          &AppCheck_Stk[APP_CHECK_STK_SIZE - 1u],
+                          APP_CHECK_PRIO_MAIN,
+                          APP_CHECK_PRIO_MAIN,
+                          &AppCheck_Stk[0],
+                          APP_CHECK_STK_SIZE,
+                          (void *)0,
+                          OS_TASK_OPT_NONE);
+
+    OSStart();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_MagRun()
+*
+* Description : Check the magazines of a dynamic memory pool from several host threads, without the kernel
+*               (see 'app_check.h  Note #3').
+*
+* Argument(s) : thread_nbr  Number of threads, 0 for APP_CHECK_MAG_THREAD_NBR_DFLT.
+*
+*               seed        Seed of the random choices, 0 for APP_CHECK_SEED_DFLT.
+*
+* Return(s)   : DEF_OK,   if every check passed (or the magazines are disabled in 'lib_cfg.h').
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) main() enters the critical section of uC/CPU before it runs the offline commands; it is
+*                   left while the threads run, since every pool & magazine service enters it.
+*
+*               (2) The threads run APP_CHECK_MAG_ROUND_NBR rounds; between two rounds no thread runs, &
+*                   the blocks available must be exactly those no thread holds.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppCheck_MagRun (CPU_INT32U  thread_nbr,
+                              CPU_INT32U  seed)
+{
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+    APP_CHECK_MAG_WORKER  *p_worker;
+    CPU_INT32U             round;
+    CPU_INT32U             i;
+    CPU_BOOLEAN            ok;
+    double                 ms_mag;
+    double                 ms_pool;
+    LIB_ERR                err;
+
+
+    if (thread_nbr == 0u) {
+        thread_nbr = APP_CHECK_MAG_THREAD_NBR_DFLT;
+    }
+    if (thread_nbr > APP_CHECK_MAG_THREAD_MAX) {
+        thread_nbr = APP_CHECK_MAG_THREAD_MAX;
+    }
+    AppCheck_MagThreadNbr = thread_nbr;
+    AppCheck_ChkNbr       = 0u;
+    AppCheck_FailWhatPtr  = (const CPU_CHAR *)0;
+
+    Mem_SegCreate("Check magazines",
+                  &AppCheck_MagSeg,
+                  (CPU_ADDR)&AppCheck_MagStor[0],
+                  sizeof(AppCheck_MagStor),
+                  LIB_MEM_PADDING_ALIGN_NONE,
+                  &err);
+    if (err == LIB_MEM_ERR_NONE) {
+        Mem_DynPoolCreate("Check magazines",
+                          &AppCheck_MagPool,
+                          &AppCheck_MagSeg,
+                          APP_CHECK_MAG_BLK_SIZE,
+                          sizeof(void *),
+                          APP_CHECK_MAG_BLK_NBR,
+                          APP_CHECK_MAG_BLK_NBR,
+                          &err);
+    }
+    if (AppCheck_Eq("Mem_SegCreate() & Mem_DynPoolCreate()", err, LIB_MEM_ERR_NONE) != DEF_OK) {
+        return (AppCheck_MagRpt(thread_nbr, 0.0, 0.0));
+    }
+
+    Mem_Clr(&AppCheck_MagWorkerTbl[0], sizeof(AppCheck_MagWorkerTbl));
+    for (i = 0u; i < thread_nbr; i++) {
+        p_worker             = &AppCheck_MagWorkerTbl[i];
+        p_worker->Ix         = i;
+        p_worker->RandState  = ((seed != 0u) ? seed : APP_CHECK_SEED_DFLT) * 2654435761u + i;
+        if (p_worker->RandState == 0u) {
+            p_worker->RandState = 1u;
+        }
+        Mem_DynPoolMagCreate(&AppCheck_MagPool, &p_worker->Mag, APP_CHECK_MAG_CACHE_SIZE, &err);
+        if (AppCheck_Eq("Mem_DynPoolMagCreate()", err, LIB_MEM_ERR_NONE) != DEF_OK) {
+            return (AppCheck_MagRpt(thread_nbr, 0.0, 0.0));
+        }
+    }
+
+    CPU_IntEn();                                                /* See Note #1.                                         */
+    ok = DEF_OK;
+    for (round = 0u; (round < APP_CHECK_MAG_ROUND_NBR) && (ok == DEF_OK); round++) {
+        (void)AppCheck_MagRound(APP_CHECK_MAG_MODE_CHK);
+        ok = AppCheck_MagCmp();                                 /* See Note #2.                                         */
+    }
+    if (ok == DEF_OK) {
+        (void)AppCheck_MagRound(APP_CHECK_MAG_MODE_FREE);       /* Give every block held back through the magazines.    */
+        ok = AppCheck_MagCmp();
+    }
+    ms_mag  = 0.0;
+    ms_pool = 0.0;
+    if (ok == DEF_OK) {
+        ms_mag  = AppCheck_MagRound(APP_CHECK_MAG_MODE_TIME_MAG);
+        ms_pool = AppCheck_MagRound(APP_CHECK_MAG_MODE_TIME_POOL);
+        ok      = AppCheck_MagCmp();
+    }
+    for (i = 0u; (i < thread_nbr) && (ok == DEF_OK); i++) {     /* Cached blocks go back to the pool.                   */
+        Mem_DynPoolMagDel(&AppCheck_MagWorkerTbl[i].Mag, &err);
+        ok = AppCheck_Eq("Mem_DynPoolMagDel()", err, LIB_MEM_ERR_NONE);
+    }
+    if (ok == DEF_OK) {
+        ok = AppCheck_MagCmp();
+    }
+    CPU_IntDis();
+
+    return (AppCheck_MagRpt(thread_nbr, ms_mag, ms_pool));
+#else
+    (void)thread_nbr;
+    (void)seed;
+
+    printf("SKIP\tMem_DynPoolMag\tdisabled in lib_cfg.h\n");
+
+    return (DEF_OK);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_Task()
+*
+* Description : Check task : runs every case & prints one line per case.
+*
+* Argument(s) : p_arg       Argument passed to 'OSTaskCreateExt()', not used.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Each case draws its random choices from its own seed, so that a case gives the same
+*                   result whatever cases run before it.
+*********************************************************************************************************
+*/
+
+static  void  AppCheck_Task (void  *p_arg)
+{
+    CPU_INT32U  case_nbr;
+    CPU_INT32U  fail_nbr;
+    CPU_INT32U  i;
+    CPU_INT08U  res;
+
+
+    (void)p_arg;
+
+    printf("seed %u\n", (unsigned)AppCheck_Seed);
+
+    case_nbr = 0u;
+    fail_nbr = 0u;
+    for (i = 0u; i < (sizeof(AppCheck_CaseTbl) / sizeof(AppCheck_CaseTbl[0])); i++) {
+        AppCheck_RandState   = (i + 1u) * 0x9E3779B9u;          /* See Note #1.                                         */
+        AppCheck_RandState  ^= AppCheck_Seed;
+        if (AppCheck_RandState == 0u) {
+            AppCheck_RandState = 1u;
+        }
+        AppCheck_ChkNbr      = 0u;
+        AppCheck_FailWhatPtr = (const CPU_CHAR *)0;
+        OSTimeSet(0u);                                          /* See 'app_check.c  Note #1'.                          */
+        AppCheck_ParamReset();
+
+        res = AppCheck_CaseTbl[i].Fnct();
+        switch (res) {
+            case APP_CHECK_RES_PASS:
+                 printf("PASS\t%s\t%u check(s)\n", AppCheck_CaseTbl[i].NamePtr, (unsigned)AppCheck_ChkNbr);
+                 break;
+
+            case APP_CHECK_RES_SKIP:
+                 printf("SKIP\t%s\tdisabled in os_cfg.h\n", AppCheck_CaseTbl[i].NamePtr);
+                 break;
+
+            case APP_CHECK_RES_FAIL:
+            default:
+                 printf("FAIL\t%s\tafter %u check(s)\n", AppCheck_CaseTbl[i].NamePtr, (unsigned)AppCheck_ChkNbr);
+                 if (AppCheck_FailWhatPtr != (const CPU_CHAR *)0) {
+                     printf("\t%s : expected %u, got %u\n",
+                            AppCheck_FailWhatPtr,
+                            (unsigned)AppCheck_FailValExp,
+                            (unsigned)AppCheck_FailVal);
+                 }
+                 fail_nbr++;
+                 break;
+        }
+        if (res != APP_CHECK_RES_SKIP) {
+            case_nbr++;
+        }
+    }
+
+    printf("%u case(s), %u failed\n", (unsigned)case_nbr, (unsigned)fail_nbr);
+    OSRunning = OS_FALSE;
+    exit((fail_nbr == 0u) ? 0 : 1);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_Tmr()
+*
+* Description : Check the timers on the hierarchical timer wheel (see 'app_check.h  Note #1').
+*
+* Argument(s) : none.
+*
+* Return(s)   : APP_CHECK_RES_PASS, APP_CHECK_RES_FAIL or APP_CHECK_RES_SKIP.
+*
+* Note(s)     : (1) OSTmrTime may only be moved while no timer is in the wheel, since the wheel is indexed
+*                   by the digits of the match times relative to it.
+*
+*               (2) The check task starts, restarts, stops & deletes a random timer every
+*                   APP_CHECK_TMR_OP_RATE updates on average, then signals the timer task for one update.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  AppCheck_Tmr (void)
+{
+#if (OS_TMR_EN > 0u)
+    APP_CHECK_TMR  *p_tmr;
+    CPU_INT32U      run;
+    CPU_INT32U      update;
+    CPU_INT32U      ix;
+    INT8U           err;
+
+
+    err = OSTaskChangePrio(OS_TASK_TMR_PRIO, APP_CHECK_PRIO_TMR);  /* See 'app_check.c  Note #2'.                   */
+    if (AppCheck_Eq("OSTaskChangePrio() of the timer task", err, OS_ERR_NONE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    Mem_Clr(&AppCheck_TmrTbl[0], sizeof(AppCheck_TmrTbl));
+    AppCheck_TmrCallbackNbr = 0u;
+    AppCheck_TmrErrWhatPtr  = (const CPU_CHAR *)0;
+
+    for (run = 0u; run < APP_CHECK_TMR_RUN_NBR; run++) {
+        OSSchedLock();                                          /* See Note #1.                                         */
+        OSTmrTime = AppCheck_TmrTimeTbl[run];
+        OSSchedUnlock();
+
+        for (update = 0u; update < APP_CHECK_TMR_UPDATE_NBR; update++) {
+            if ((update % APP_CHECK_TIME_RESET_NBR) == 0u) {
+                OSTimeSet(0u);                                  /* See 'app_check.c  Note #1'.                          */
+                AppCheck_ParamReset();
+                if (AppCheck_TmrCmp() != DEF_OK) {
+                    return (APP_CHECK_RES_FAIL);
+                }
+            }
+
+            if ((AppCheck_Rand() % APP_CHECK_TMR_OP_RATE) == 0u) {  /* See Note #2.                                 */
+                ix    = AppCheck_Rand() % APP_CHECK_TMR_NBR;
+                p_tmr = &AppCheck_TmrTbl[ix];
+                switch ((p_tmr->TmrPtr == (OS_TMR *)0) ? 0u : (AppCheck_Rand() % 4u)) {
+                    case 0u:                                    /* New timer, or new delay & period.                    */
+                         if (AppCheck_TmrStart(ix, DEF_YES) != DEF_OK) {
+                             return (APP_CHECK_RES_FAIL);
+                         }
+                         break;
+
+                    case 1u:                                    /* Restart, or start again once stopped or completed.   */
+                         if (AppCheck_TmrStart(ix, DEF_NO) != DEF_OK) {
+                             return (APP_CHECK_RES_FAIL);
+                         }
+                         break;
+
+                    case 2u:
+                    case 3u:
+                    default:
+                         (void)OSTmrStop(p_tmr->TmrPtr, OS_TMR_OPT_NONE, (void *)0, &err);
+                         if (AppCheck_Eq("OSTmrStop()",
+                                         err,
+                                         (p_tmr->Run == DEF_YES) ? OS_ERR_NONE : OS_ERR_TMR_STOPPED) != DEF_OK) {
+                             return (APP_CHECK_RES_FAIL);
+                         }
+                         p_tmr->Run = DEF_NO;
+                         break;
+                }
+            }
+
+            (void)OSTmrSignal();                                /* The timer task runs before OSTmrSignal() returns.    */
+
+            AppCheck_ChkNbr++;
+            if (AppCheck_TmrErrWhatPtr != (const CPU_CHAR *)0) {
+                AppCheck_Fail(AppCheck_TmrErrWhatPtr, AppCheck_TmrErrTime, AppCheck_TmrErrMatch);
+                return (APP_CHECK_RES_FAIL);
+            }
+            for (ix = 0u; ix < APP_CHECK_TMR_NBR; ix++) {       /* No timer may be left past its match time.            */
+                p_tmr = &AppCheck_TmrTbl[ix];
+                if ((p_tmr->Run == DEF_YES) &&
+                    ((CPU_INT32S)(p_tmr->Match - OSTmrTime) <= 0)) {
+                    AppCheck_Fail("callbacks of a timer at its match time", 0u, 1u);
+                    return (APP_CHECK_RES_FAIL);
+                }
+            }
+        }
+
+        if (AppCheck_TmrCmp() != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+        for (ix = 0u; ix < APP_CHECK_TMR_NBR; ix++) {           /* See Note #1.                                         */
+            p_tmr = &AppCheck_TmrTbl[ix];
+            if (p_tmr->TmrPtr != (OS_TMR *)0) {
+                (void)OSTmrDel(p_tmr->TmrPtr, &err);
+                p_tmr->TmrPtr = (OS_TMR *)0;
+                p_tmr->Run    = DEF_NO;
+            }
+        }
+    }
+
+    if (AppCheck_Eq("callbacks", (AppCheck_TmrCallbackNbr > 0u) ? DEF_YES : DEF_NO, DEF_YES) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    return (APP_CHECK_RES_PASS);
+#else
+    return (APP_CHECK_RES_SKIP);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppCheck_TmrStart()
+*
+* Description : Start a timer of the OSTmr case & update its model.
+*
+* Argument(s) : ix          Index of the timer.
+*
+*               create      DEF_YES to (re)create the timer with a random option, delay & period first,
+*                           DEF_NO  to start the timer as it is.
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The bit widths of the delays are drawn evenly so that every level of the wheel gets
+*                   timers; delays wider than the run make timers that must not expire within it.
+*
+*               (2) OSTmrTime is read with the scheduler locked, so that an update signaled by a tick of
+*                   the port cannot come between the start & the read.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u)
+static  CPU_BOOLEAN  AppCheck_TmrStart (CPU_INT32U   ix,
+                                        CPU_BOOLEAN  create)
+{
+    APP_CHECK_TMR  *p_tmr;
+    CPU_INT32U      bits;
+    INT8U           err;
+
+
+    p_tmr = &AppCheck_TmrTbl[ix];
+    if (create == DEF_YES) {
+        if (p_tmr->TmrPtr != (OS_TMR *)0) {
+            (void)OSTmrDel(p_tmr->TmrPtr, &err);
+            if (AppCheck_Eq("OSTmrDel()", err, OS_ERR_NONE) != DEF_OK) {
+                return (DEF_FAIL);
+            }
+            p_tmr->TmrPtr = (OS_TMR *)0;
+            p_tmr->Run    = DEF_NO;
+        }
+        p_tmr->Opt    = ((AppCheck_Rand() & 1u) != 0u) ? OS_TMR_OPT_PERIODIC : OS_TMR_OPT_ONE_SHOT;
+        bits          = 1u + (AppCheck_Rand() % APP_CHECK_TMR_DLY_BITS_MAX);
+        p_tmr->Dly    = AppCheck_Rand() & ((1uL << bits) - 1u); /* See Note #1.                                         */
+        bits          = 1u + (AppCheck_Rand() % APP_CHECK_TMR_PERIOD_BITS_MAX);
+        p_tmr->Period = 1u + (AppCheck_Rand() & ((1uL << bits) - 1u));
+        if (p_tmr->Opt == OS_TMR_OPT_ONE_SHOT) {
+            p_tmr->Dly   += 1u;                                 /* A one-shot timer needs a delay.                      */
+            p_tmr->Period = 0u;
+        }
+        p_tmr->TmrPtr = OSTmrCreate(p_tmr->Dly,
+                                    p_tmr->Period,
+                                    p_tmr->Opt,
+                                    AppCheck_TmrCallback,
+                                    (void *)(CPU_ADDR)ix,
+                                    (INT8U *)(void *)"Check",
+                                    &err);
+        if (AppCheck_Eq("OSTmrCreate()", err, OS_ERR_NONE) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+    }
+
+    OSSchedLock();                                              /* See Note #2.                                         */
+    (void)OSTmrStart(p_tmr->TmrPtr, &err);
+    p_tmr->Match = OSTmrTime + ((p_tmr->Dly != 0u) ? p_tmr->Dly : p_tmr->Period);
+    p_tmr->Run   = DEF_YES;
+    OSSchedUnlock();
+
+    return (AppCheck_Eq("OSTmrStart()", err, OS_ERR_NONE));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_TmrCmp()
+*
+* Description : Compare the state & the remaining time of every timer of the OSTmr case with its model.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if every timer agrees with its model.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u)
+static  CPU_BOOLEAN  AppCheck_TmrCmp (void)
+{
+    APP_CHECK_TMR  *p_tmr;
+    CPU_INT32U      remain;
+    CPU_INT32U      ix;
+    INT8U           state;
+    INT8U           err;
+
+
+    for (ix = 0u; ix < APP_CHECK_TMR_NBR; ix++) {
+        p_tmr = &AppCheck_TmrTbl[ix];
+        if (p_tmr->TmrPtr == (OS_TMR *)0) {
+            continue;
+        }
+        OSSchedLock();
+        state  = OSTmrStateGet(p_tmr->TmrPtr, &err);
+        remain = OSTmrRemainGet(p_tmr->TmrPtr, &err);
+        if (p_tmr->Run == DEF_YES) {
+            if ((AppCheck_Eq("OSTmrStateGet() of a running timer", state, OS_TMR_STATE_RUNNING) != DEF_OK) ||
+                (AppCheck_Eq("OSTmrRemainGet()", remain, p_tmr->Match - OSTmrTime)             != DEF_OK)) {
+                OSSchedUnlock();
+                return (DEF_FAIL);
+            }
+        } else {
+            if (AppCheck_Eq("OSTmrStateGet() of a stopped or completed timer",
+                            (state != OS_TMR_STATE_RUNNING) ? DEF_YES : DEF_NO,
+                            DEF_YES) != DEF_OK) {
+                OSSchedUnlock();
+                return (DEF_FAIL);
+            }
+        }
+        OSSchedUnlock();
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_TmrCallback()
+*
+* Description : Callback of the timers of the OSTmr case : checks the time of the callback against the
+*               model of the timer & moves the model to the next match time.
+*
+* Argument(s) : ptmr        Timer that expired.
+*
+*               p_arg       Index of the timer in AppCheck_TmrTbl[].
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Runs in the timer task : a mismatch is only recorded, & reported by the check task once
+*                   OSTmrSignal() returns.
+*********************************************************************************************************
+*/
+
+#if (OS_TMR_EN > 0u)
+static  void  AppCheck_TmrCallback (void  *ptmr,
+                                    void  *p_arg)
+{
+    APP_CHECK_TMR  *p_tmr;
+
+
+    p_tmr = &AppCheck_TmrTbl[(CPU_ADDR)p_arg];
+    if (AppCheck_TmrErrWhatPtr != (const CPU_CHAR *)0) {        /* See Note #1.                                         */
+        return;
+    }
+    AppCheck_TmrErrTime  = OSTmrTime;
+    AppCheck_TmrErrMatch = p_tmr->Match;
+    if (p_tmr->TmrPtr != (OS_TMR *)ptmr) {
+        AppCheck_TmrErrWhatPtr = "callback with the argument of another timer (OSTmrTime)";
+        return;
+    }
+    if (p_tmr->Run != DEF_YES) {
+        AppCheck_TmrErrWhatPtr = "callback of a stopped or completed timer (OSTmrTime)";
+        return;
+    }
+    if (p_tmr->Match != OSTmrTime) {
+        AppCheck_TmrErrWhatPtr = "callback before or after its match time (OSTmrTime)";
+        return;
+    }
+
+    AppCheck_TmrCallbackNbr++;
+    if (p_tmr->Opt == OS_TMR_OPT_PERIODIC) {
+        p_tmr->Match += p_tmr->Period;
+    } else {
+        p_tmr->Run    = DEF_NO;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_MemSlab()
+*
+* Description : Check the slab allocators (see 'app_check.h  Note #1').
+*
+* Argument(s) : none.
+*
+* Return(s)   : APP_CHECK_RES_PASS, APP_CHECK_RES_FAIL or APP_CHECK_RES_SKIP.
+*
+* Note(s)     : (1) The classes of the model are built from their definition (class 0 up to
+*                   2^OS_MEM_SLAB_SHIFT_MIN bytes, then 2^OS_MEM_SLAB_SUB_BITS even steps per power of two),
+*                   not from the computation of the kernel.
+*
+*               (2) The first allocator serves a request from its class only, the second one falls back on
+*                   the larger classes.  Requests & releases are drawn at random, so that partitions are
+*                   often full & requests fall back or fail.
+*
+*               (3) The case takes APP_CHECK_MEM_SLAB_NBR * APP_CHECK_MEM_SLAB_PART_NBR of the
+*                   OS_MAX_MEM_PART partitions for good, as partitions cannot be deleted.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  AppCheck_MemSlab (void)
+{
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+    APP_CHECK_MEM_SLAB  *p_slab;
+    CPU_INT08U          *p_addr;
+    CPU_INT32U           size;
+    CPU_INT32U           blk_size;
+    CPU_INT32U           shift;
+    CPU_INT32U           sub;
+    CPU_INT32U           op;
+    CPU_INT32U           ix;
+    CPU_INT32U           i;
+    CPU_BOOLEAN          ok;
+    INT8U                err;
+
+
+    ix = 0u;                                                    /* See Note #1.                                         */
+    AppCheck_MemSlabBoundTbl[ix++] = 1uL << OS_MEM_SLAB_SHIFT_MIN;
+    for (shift = OS_MEM_SLAB_SHIFT_MIN; shift < OS_MEM_SLAB_SHIFT_MAX; shift++) {
+        for (sub = 1u; sub <= (1uL << OS_MEM_SLAB_SUB_BITS); sub++) {
+            AppCheck_MemSlabBoundTbl[ix++] = (1uL << shift) + ((sub << shift) >> OS_MEM_SLAB_SUB_BITS);
+        }
+    }
+
+    for (size = 0u; size <= ((1uL << OS_MEM_SLAB_SHIFT_MAX) + 1u); size++) {
+        blk_size = 0u;                                          /* No class for 0 & above the largest class.            */
+        if ((size > 0u) && (size <= (1uL << OS_MEM_SLAB_SHIFT_MAX))) {
+            blk_size = AppCheck_MemSlabBlkSize(AppCheck_MemSlabClass(size));
+        }
+        if (AppCheck_Eq("OSMemSlabBlkSize()", OSMemSlabBlkSize(size), blk_size) != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+
+    OSMemSlabCreate(&AppCheck_MemSlabTbl[0].Slab, (INT8U)(OS_MEM_SLAB_OPT_FALLBACK << 1u), &err);
+    if (AppCheck_Eq("OSMemSlabCreate() with an invalid option", err, OS_ERR_INVALID_OPT) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    for (i = 0u; i < APP_CHECK_MEM_SLAB_NBR; i++) {             /* See Note #2.                                         */
+        p_slab = &AppCheck_MemSlabTbl[i];
+        Mem_Clr(p_slab, sizeof(APP_CHECK_MEM_SLAB));
+        p_slab->Opt = (i == 0u) ? OS_MEM_SLAB_OPT_NONE : OS_MEM_SLAB_OPT_FALLBACK;
+        OSMemSlabCreate(&p_slab->Slab, p_slab->Opt, &err);
+        if ((AppCheck_Eq("OSMemSlabCreate()", err, OS_ERR_NONE)                       != DEF_OK) ||
+            (AppCheck_MemSlabAdd(p_slab, (CPU_INT08U *)&AppCheck_MemSlabStor[i][0]) != DEF_OK)) {
+            return (APP_CHECK_RES_FAIL);
+        }
+
+        for (op = 0u; op < APP_CHECK_MEM_SLAB_OP_NBR; op++) {
+            if ((op % APP_CHECK_TIME_RESET_NBR) == 0u) {
+                OSTimeSet(0u);                                  /* See 'app_check.c  Note #1'.                          */
+                AppCheck_ParamReset();
+                if (AppCheck_MemSlabCmp(p_slab) != DEF_OK) {
+                    return (APP_CHECK_RES_FAIL);
+                }
+            }
+            if ((p_slab->BlkNbr == 0u) || ((AppCheck_Rand() & 1u) == 0u)) {
+                ok = AppCheck_MemSlabGet(p_slab);
+            } else {
+                ok = AppCheck_MemSlabPut(p_slab, AppCheck_Rand() % p_slab->BlkNbr);
+            }
+            if (ok != DEF_OK) {
+                return (APP_CHECK_RES_FAIL);
+            }
+        }
+
+        while (p_slab->BlkNbr > 0u) {                           /* Return every block ...                               */
+            if (AppCheck_MemSlabPut(p_slab, 0u) != DEF_OK) {
+                return (APP_CHECK_RES_FAIL);
+            }
+        }
+        for (ix = 0u; ix < APP_CHECK_MEM_SLAB_PART_NBR; ix++) { /* ... & give blocks of no partition.                   */
+            p_addr   = p_slab->PartAddrPtr[ix];
+            blk_size = AppCheck_MemSlabBlkSize(p_slab->PartClass[ix]);
+            err      = OSMemSlabPut(&p_slab->Slab, p_addr);
+            if (AppCheck_Eq("OSMemSlabPut() to a full partition", err, OS_ERR_MEM_FULL) != DEF_OK) {
+                return (APP_CHECK_RES_FAIL);
+            }
+            err      = OSMemSlabPut(&p_slab->Slab, p_addr + (AppCheck_MemSlabPartTbl[ix].BlkNbr * blk_size));
+            if (AppCheck_Eq("OSMemSlabPut() past the blocks of a partition", err, OS_ERR_MEM_INVALID_PBLK) != DEF_OK) {
+                return (APP_CHECK_RES_FAIL);
+            }
+        }
+        err = OSMemSlabPut(&p_slab->Slab, &AppCheck_Seed);
+        if ((AppCheck_Eq("OSMemSlabPut() of a block of no partition", err, OS_ERR_MEM_INVALID_PBLK) != DEF_OK) ||
+            (AppCheck_MemSlabCmp(p_slab)                                                          != DEF_OK)) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+
+    return (APP_CHECK_RES_PASS);
+#else
+    return (APP_CHECK_RES_SKIP);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MemSlabAdd()
+*
+* Description : Give the partitions of AppCheck_MemSlabPartTbl[] to a slab allocator of the OSMemSlab case.
+*
+* Argument(s) : p_slab      Slab allocator.
+*
+*               p_stor      Storage of the partitions, APP_CHECK_MEM_SLAB_STOR_SIZE 64-bit words.
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Each partition is given the room of one more pointer than its blocks need, so that
+*                   OSMemSlabAdd() must round the number of blocks down & OSMemSlabPut() must not take
+*                   an address past the blocks for one of the partition.
+*********************************************************************************************************
+*/
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_MemSlabAdd (APP_CHECK_MEM_SLAB  *p_slab,
+                                          CPU_INT08U          *p_stor)
+{
+    const  APP_CHECK_MEM_SLAB_PART  *p_part;
+           OS_MEM                   *p_mem;
+           CPU_INT32U                size;
+           CPU_INT32U                blk_size;
+           CPU_INT32U                off;
+           CPU_INT32U                i;
+           INT8U                     err;
+
+
+    off = 0u;
+    for (i = 0u; i < APP_CHECK_MEM_SLAB_PART_NBR; i++) {
+        p_part                 = &AppCheck_MemSlabPartTbl[i];
+        p_slab->PartClass[i]   = AppCheck_MemSlabClass(p_part->BlkSize);
+        p_slab->PartAddrPtr[i] = p_stor + off;
+        p_slab->PartNFree[i]   = p_part->BlkNbr;
+        blk_size               = AppCheck_MemSlabBlkSize(p_slab->PartClass[i]);
+        size                   = p_part->BlkNbr * blk_size;
+        size                  += sizeof(void *);                /* See Note #1.                                         */
+        off                   += size;
+        if (AppCheck_Eq("storage of the partitions within APP_CHECK_MEM_SLAB_STOR_SIZE",
+                        (off <= (APP_CHECK_MEM_SLAB_STOR_SIZE * sizeof(CPU_INT64U))) ? DEF_YES : DEF_NO,
+                        DEF_YES) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+
+        p_mem = OSMemSlabAdd(&p_slab->Slab, p_slab->PartAddrPtr[i], size, p_part->BlkSize, &err);
+        if ((AppCheck_Eq("OSMemSlabAdd()", err, OS_ERR_NONE)                                  != DEF_OK) ||
+            (AppCheck_Eq("partition of OSMemSlabAdd()", (p_mem != (OS_MEM *)0) ? DEF_YES : DEF_NO, DEF_YES) != DEF_OK)) {
+            return (DEF_FAIL);
+        }
+    }
+
+    p_mem = OSMemSlabAdd(&p_slab->Slab, p_stor + off, sizeof(void *), 0u, &err);
+    if (AppCheck_Eq("OSMemSlabAdd() of blocks of 0 bytes", err, OS_ERR_MEM_INVALID_SIZE) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+    p_mem = OSMemSlabAdd(&p_slab->Slab, p_stor + off, sizeof(void *), (1uL << OS_MEM_SLAB_SHIFT_MAX) + 1u, &err);
+    if (AppCheck_Eq("OSMemSlabAdd() above the largest class", err, OS_ERR_MEM_INVALID_SIZE) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+    p_mem = OSMemSlabAdd(&p_slab->Slab, p_stor + off, sizeof(void *), AppCheck_MemSlabPartTbl[0].BlkSize, &err);
+    if (AppCheck_Eq("OSMemSlabAdd() to a class with a partition", err, OS_ERR_MEM_INVALID_SIZE) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MemSlabGet()
+*
+* Description : Request a block of a random size from a slab allocator of the OSMemSlab case & update its
+*               model.
+*
+* Argument(s) : p_slab      Slab allocator.
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The bit widths of the sizes are drawn evenly so that every class gets requests.
+*
+*               (2) The request is served by the first partition, in increasing classes, at or above the
+*                   class of the size that has a free block.  Without fallback only the first partition at
+*                   or above that class is tried.
+*********************************************************************************************************
+*/
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_MemSlabGet (APP_CHECK_MEM_SLAB  *p_slab)
+{
+    void        *p_blk;
+    CPU_INT32U   size;
+    CPU_INT32U   bits;
+    CPU_INT32U   nused;
+    CPU_INT32U   i;
+    CPU_INT08U   ix;
+    CPU_INT08U   part;
+    CPU_INT08U   part_first;
+    CPU_INT08U   part_exp;
+    INT8U        err;
+
+
+    if ((AppCheck_Rand() % APP_CHECK_MEM_SLAB_SIZE_ERR_RATE) == 0u) {
+        size  = ((AppCheck_Rand() & 1u) != 0u) ? 0u : ((1uL << OS_MEM_SLAB_SHIFT_MAX) + 1u);
+        p_blk = OSMemSlabGet(&p_slab->Slab, size, &err);
+        return (AppCheck_Eq("OSMemSlabGet() of a size out of the classes", err, OS_ERR_MEM_INVALID_SIZE));
+    }
+
+    bits = 1u + (AppCheck_Rand() % OS_MEM_SLAB_SHIFT_MAX);      /* See Note #1.                                         */
+    size = 1u + (AppCheck_Rand() & ((1uL << bits) - 1u));
+    ix   = AppCheck_MemSlabClass(size);
+
+    part_first = APP_CHECK_MEM_SLAB_PART_NONE;                  /* See Note #2.                                         */
+    part_exp   = APP_CHECK_MEM_SLAB_PART_NONE;
+    for (i = 0u; i < APP_CHECK_MEM_SLAB_PART_NBR; i++) {
+        if (p_slab->PartClass[i] < ix) {
+            continue;
+        }
+        if (part_first == APP_CHECK_MEM_SLAB_PART_NONE) {
+            part_first = (CPU_INT08U)i;
+        }
+        if (p_slab->PartNFree[i] > 0u) {
+            part_exp = (CPU_INT08U)i;
+            break;
+        }
+        if ((p_slab->Opt & OS_MEM_SLAB_OPT_FALLBACK) == 0u) {
+            break;
+        }
+    }
+
+    p_blk = OSMemSlabGet(&p_slab->Slab, size, &err);
+    if (part_exp == APP_CHECK_MEM_SLAB_PART_NONE) {
+        p_slab->NFail[ix]++;
+        return (AppCheck_Eq("OSMemSlabGet() with no free block to serve it", err, OS_ERR_MEM_NO_FREE_BLKS));
+    }
+    if (AppCheck_Eq("OSMemSlabGet()", err, OS_ERR_NONE) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+    part = AppCheck_MemSlabPart(p_slab, p_blk);
+    if (AppCheck_Eq("partition of the block of OSMemSlabGet()", part, part_exp) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+    for (i = 0u; i < p_slab->BlkNbr; i++) {
+        if (AppCheck_Eq("OSMemSlabGet() of a block already given",
+                        (p_slab->BlkTbl[i] == p_blk) ? DEF_YES : DEF_NO,
+                        DEF_NO) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+    }
+
+    p_slab->BlkTbl[p_slab->BlkNbr] = p_blk;
+    p_slab->BlkNbr++;
+    p_slab->PartNFree[part]--;
+    nused = AppCheck_MemSlabPartTbl[part].BlkNbr - p_slab->PartNFree[part];
+    if (nused > p_slab->PartNUsedMax[part]) {
+        p_slab->PartNUsedMax[part] = nused;
+    }
+    p_slab->NGet[ix]++;
+    if (part != part_first) {
+        p_slab->NFallback[ix]++;
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MemSlabPut()
+*
+* Description : Release a block held by the check task to a slab allocator of the OSMemSlab case & update
+*               its model.
+*
+* Argument(s) : p_slab      Slab allocator.
+*
+*               blk_ix      Index of the block in the blocks held.
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Now & then the block is first given one pointer past its start, which OSMemSlabPut()
+*                   must reject without releasing anything.
+*********************************************************************************************************
+*/
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_MemSlabPut (APP_CHECK_MEM_SLAB  *p_slab,
+                                          CPU_INT32U           blk_ix)
+{
+    void   *p_blk;
+    INT8U   err;
+
+
+    p_blk = p_slab->BlkTbl[blk_ix];
+    if ((AppCheck_Rand() % APP_CHECK_MEM_SLAB_PBLK_ERR_RATE) == 0u) {  /* See Note #1.                              */
+        err = OSMemSlabPut(&p_slab->Slab, (CPU_INT08U *)p_blk + sizeof(void *));
+        if (AppCheck_Eq("OSMemSlabPut() of a misaligned block", err, OS_ERR_MEM_INVALID_PBLK) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+    }
+
+    err = OSMemSlabPut(&p_slab->Slab, p_blk);
+    if (AppCheck_Eq("OSMemSlabPut()", err, OS_ERR_NONE) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+    p_slab->PartNFree[AppCheck_MemSlabPart(p_slab, p_blk)]++;
+    p_slab->BlkNbr--;
+    p_slab->BlkTbl[blk_ix] = p_slab->BlkTbl[p_slab->BlkNbr];
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MemSlabCmp()
+*
+* Description : Compare what OSMemSlabQuery() returns for every class of a slab allocator of the OSMemSlab
+*               case with its model.
+*
+* Argument(s) : p_slab      Slab allocator.
+*
+* Return(s)   : DEF_OK,   if every class agrees with the model.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_MemSlabCmp (APP_CHECK_MEM_SLAB  *p_slab)
+{
+    OS_MEM_SLAB_DATA  data;
+    CPU_INT32U        nblks;
+    CPU_INT32U        nfree;
+    CPU_INT32U        nused_max;
+    CPU_INT32U        i;
+    CPU_INT08U        ix;
+    INT8U             err;
+
+
+    for (ix = 0u; ix < OS_MEM_SLAB_CLASS_NBR; ix++) {
+        nblks     = 0u;
+        nfree     = 0u;
+        nused_max = 0u;
+        for (i = 0u; i < APP_CHECK_MEM_SLAB_PART_NBR; i++) {
+            if (p_slab->PartClass[i] == ix) {
+                nblks     = AppCheck_MemSlabPartTbl[i].BlkNbr;
+                nfree     = p_slab->PartNFree[i];
+                nused_max = p_slab->PartNUsedMax[i];
+            }
+        }
+        err = OSMemSlabQuery(&p_slab->Slab, ix, &data);
+        if ((AppCheck_Eq("OSMemSlabQuery()",             err,              OS_ERR_NONE)                 != DEF_OK) ||
+            (AppCheck_Eq("OSBlkSize of OSMemSlabQuery()",   data.OSBlkSize,   AppCheck_MemSlabBlkSize(ix)) != DEF_OK) ||
+            (AppCheck_Eq("OSNBlks of OSMemSlabQuery()",     data.OSNBlks,     nblks)                       != DEF_OK) ||
+            (AppCheck_Eq("OSNFree of OSMemSlabQuery()",     data.OSNFree,     nfree)                       != DEF_OK) ||
+            (AppCheck_Eq("OSNUsed of OSMemSlabQuery()",     data.OSNUsed,     nblks - nfree)               != DEF_OK) ||
+            (AppCheck_Eq("OSNUsedMax of OSMemSlabQuery()",  data.OSNUsedMax,  nused_max)                   != DEF_OK) ||
+            (AppCheck_Eq("OSNGet of OSMemSlabQuery()",      data.OSNGet,      p_slab->NGet[ix])            != DEF_OK) ||
+            (AppCheck_Eq("OSNFallback of OSMemSlabQuery()", data.OSNFallback, p_slab->NFallback[ix])       != DEF_OK) ||
+            (AppCheck_Eq("OSNFail of OSMemSlabQuery()",     data.OSNFail,     p_slab->NFail[ix])           != DEF_OK)) {
+            return (DEF_FAIL);
+        }
+    }
+
+    err = OSMemSlabQuery(&p_slab->Slab, OS_MEM_SLAB_CLASS_NBR, &data);
+    return (AppCheck_Eq("OSMemSlabQuery() past the last class", err, OS_ERR_MEM_INVALID_PART));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MemSlabPart()
+*
+* Description : Find the partition of a slab allocator of the OSMemSlab case a block belongs to.
+*
+* Argument(s) : p_slab      Slab allocator.
+*
+*               p_blk       Block.
+*
+* Return(s)   : Index of the partition, or APP_CHECK_MEM_SLAB_PART_NONE if 'p_blk' is not the start of a
+*               block of any partition.
+*********************************************************************************************************
+*/
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  CPU_INT08U  AppCheck_MemSlabPart (APP_CHECK_MEM_SLAB  *p_slab,
+                                          void                *p_blk)
+{
+    CPU_INT08U  *p_addr;
+    CPU_INT32U   blk_size;
+    CPU_INT32U   i;
+
+
+    p_addr = (CPU_INT08U *)p_blk;
+    for (i = 0u; i < APP_CHECK_MEM_SLAB_PART_NBR; i++) {
+        blk_size = AppCheck_MemSlabBlkSize(p_slab->PartClass[i]);
+        if ((p_addr >= p_slab->PartAddrPtr[i]) &&
+            (p_addr <  p_slab->PartAddrPtr[i] + (AppCheck_MemSlabPartTbl[i].BlkNbr * blk_size)) &&
+            (((CPU_INT32U)(p_addr - p_slab->PartAddrPtr[i]) % blk_size) == 0u)) {
+            return ((CPU_INT08U)i);
+        }
+    }
+
+    return (APP_CHECK_MEM_SLAB_PART_NONE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      AppCheck_MemSlabClass()
+*
+* Description : Class of a size in the model of the OSMemSlab case.
+*
+* Argument(s) : size        Size, 1 to 2^OS_MEM_SLAB_SHIFT_MAX bytes.
+*
+* Return(s)   : Index of the smallest class whose largest size is at least 'size'.
+*********************************************************************************************************
+*/
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  CPU_INT08U  AppCheck_MemSlabClass (CPU_INT32U  size)
+{
+    CPU_INT08U  ix;
+
+
+    ix = 0u;
+    while (AppCheck_MemSlabBoundTbl[ix] < size) {
+        ix++;
+    }
+
+    return (ix);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     AppCheck_MemSlabBlkSize()
+*
+* Description : Block size of a class in the model of the OSMemSlab case.
+*
+* Argument(s) : ix          Index of the class.
+*
+* Return(s)   : Largest size of the class, rounded up to a multiple of the size of a pointer.
+*********************************************************************************************************
+*/
+
+#if ((OS_MEM_SLAB_EN > 0u) && (OS_MEM_QUERY_EN > 0u))
+static  CPU_INT32U  AppCheck_MemSlabBlkSize (CPU_INT08U  ix)
+{
+    return ((AppCheck_MemSlabBoundTbl[ix] + (sizeof(void *) - 1u)) & ~(CPU_INT32U)(sizeof(void *) - 1u));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_QBuf()
+*
+* Description : Check the zero-copy messages (see 'app_check.h  Note #1').
+*
+* Argument(s) : none.
+*
+* Return(s)   : APP_CHECK_RES_PASS, APP_CHECK_RES_FAIL or APP_CHECK_RES_SKIP.
+*
+* Note(s)     : (1) The helper task & the queues are deleted whatever the result, so that the next cases
+*                   find the priority & the event control blocks free.  The partitions are kept, as
+*                   partitions cannot be deleted.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  AppCheck_QBuf (void)
+{
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+    OS_MEM      *p_mem;
+    void        *p_msg;
+    CPU_INT08U   res;
+    INT8U        err;
+
+
+    p_mem = OSMemCreate(&AppCheck_QBufStorSmall[0][0], 2u, OS_Q_BUF_HDR_SIZE, &err);
+    if (AppCheck_Eq("OSMemCreate()", err, OS_ERR_NONE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    p_msg = OSQBufGet(p_mem, &err);
+    if ((AppCheck_Eq("OSQBufGet() from blocks with no room past the header", err, OS_ERR_MEM_INVALID_SIZE) != DEF_OK) ||
+        (AppCheck_Eq("buffer of OSQBufGet() on an error", (p_msg == (void *)0) ? DEF_YES : DEF_NO, DEF_YES)  != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    AppCheck_QBufMemPtr = OSMemCreate(&AppCheck_QBufStor[0][0],
+                                      APP_CHECK_Q_BUF_BLK_NBR,
+                                      APP_CHECK_Q_BUF_BLK_SIZE,
+                                      &err);
+    if (AppCheck_Eq("OSMemCreate()", err, OS_ERR_NONE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    AppCheck_QBufNbr            = 0u;
+    AppCheck_QBufHeldPtr        = (void *)0;
+    AppCheck_QBufTaskHeldPtr    = (void *)0;
+    AppCheck_QBufTaskErrWhatPtr = (const CPU_CHAR *)0;
+
+    AppCheck_QBufTxPtr = OSQCreate(&AppCheck_QBufQStor[0][0], APP_CHECK_Q_BUF_Q_SIZE);
+    AppCheck_QBufRxPtr = OSQCreate(&AppCheck_QBufQStor[1][0], APP_CHECK_Q_BUF_Q_SIZE);
+    err = OSTaskCreateExt(AppCheck_QBufTask,
+                          (void *)0,
+                          &AppCheck_HelperStk[APP_CHECK_STK_SIZE - 1u],
+                          APP_CHECK_PRIO_HELPER,
+                          APP_CHECK_PRIO_HELPER,
+                          &AppCheck_HelperStk[0],
+                          APP_CHECK_STK_SIZE,
+                          (void *)0,
+                          OS_TASK_OPT_NONE);
+
+    res = APP_CHECK_RES_FAIL;
+    if ((AppCheck_Eq("OSQCreate()",
+                     ((AppCheck_QBufTxPtr != (OS_EVENT *)0) && (AppCheck_QBufRxPtr != (OS_EVENT *)0)) ? DEF_YES : DEF_NO,
+                     DEF_YES) == DEF_OK) &&
+        (AppCheck_Eq("OSTaskCreateExt() of the helper task", err, OS_ERR_NONE) == DEF_OK)) {
+        res = AppCheck_QBufRun();
+    }
+
+    (void)OSTaskDel(APP_CHECK_PRIO_HELPER);                     /* See Note #1.                                         */
+    if (AppCheck_QBufTxPtr != (OS_EVENT *)0) {
+        (void)OSQDel(AppCheck_QBufTxPtr, OS_DEL_ALWAYS, &err);
+    }
+    if (AppCheck_QBufRxPtr != (OS_EVENT *)0) {
+        (void)OSQDel(AppCheck_QBufRxPtr, OS_DEL_ALWAYS, &err);
+    }
+
+    return (res);
+#else
+    return (APP_CHECK_RES_SKIP);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_QBufRun()
+*
+* Description : Steps of the OSQBuf case, once the partition, the queues & the helper task are created.
+*
+* Argument(s) : none.
+*
+* Return(s)   : APP_CHECK_RES_PASS or APP_CHECK_RES_FAIL.
+*
+* Note(s)     : (1) The check task gets, sends, retains & releases random buffers, then checks the cases
+*                   that need a set order : a full queue, a message that is not a buffer, a timeout & the
+*                   largest number of references.
+*
+*               (2) The message posted holds a copy of the header of its buffer right at its start, so that
+*                   it looks like a buffer but does not start a block of the partition.
+*********************************************************************************************************
+*/
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  CPU_INT08U  AppCheck_QBufRun (void)
+{
+    CPU_INT08U  *p_msg;
+    CPU_INT32U   op;
+    CPU_INT32U   ix;
+    CPU_INT32U   len;
+    CPU_INT32U   i;
+    CPU_BOOLEAN  ok;
+    INT8U        err;
+
+
+    for (op = 0u; op < APP_CHECK_Q_BUF_OP_NBR; op++) {          /* See Note #1.                                         */
+        if ((op % APP_CHECK_TIME_RESET_NBR) == 0u) {
+            OSTimeSet(0u);                                      /* See 'app_check.c  Note #1'.                          */
+            AppCheck_ParamReset();
+        }
+        ix = (AppCheck_QBufNbr > 0u) ? (AppCheck_Rand() % AppCheck_QBufNbr) : 0u;
+        switch ((AppCheck_QBufNbr == 0u) ? 0u : (AppCheck_Rand() % 6u)) {
+            case 0u:
+                 ok = AppCheck_QBufGet();
+                 break;
+
+            case 1u:
+                 ok = AppCheck_QBufSend(ix, APP_CHECK_Q_BUF_OP_ECHO);
+                 break;
+
+            case 2u:
+                 ok = AppCheck_QBufSend(ix, ((AppCheck_Rand() & 1u) != 0u) ? APP_CHECK_Q_BUF_OP_HOLD
+                                                                           : APP_CHECK_Q_BUF_OP_DROP);
+                 break;
+
+            case 3u:
+                 ok = AppCheck_QBufRetain(ix);
+                 break;
+
+            case 4u:
+                 err = OSQBufPost(AppCheck_QBufTxPtr, AppCheck_QBufTbl[ix].MsgPtr, APP_CHECK_Q_BUF_MSG_SIZE + 1u);
+                 ok  = AppCheck_Eq("OSQBufPost() of a message larger than its buffer", err, OS_ERR_Q_BUF_SIZE);
+                 break;
+
+            case 5u:
+            default:
+                 ok = AppCheck_QBufRelease(ix);
+                 break;
+        }
+        if ((ok != DEF_OK) || (AppCheck_QBufCmp() != DEF_OK)) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+
+    while (AppCheck_QBufNbr > 0u) {                             /* Release every buffer ...                             */
+        if (AppCheck_QBufRelease(0u) != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+    if (AppCheck_QBufHeldPtr != (void *)0) {                    /* ... including the one of the helper task.            */
+        if ((AppCheck_QBufGet()                      != DEF_OK) ||
+            (AppCheck_QBufSend(0u, APP_CHECK_Q_BUF_OP_DROP) != DEF_OK)) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+    if (AppCheck_QBufCmp() != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    for (i = 0u; i <= APP_CHECK_Q_BUF_Q_SIZE; i++) {            /* Fill the queue with no task pending on it.           */
+        if (AppCheck_QBufGet() != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+    for (i = 0u; i < APP_CHECK_Q_BUF_Q_SIZE; i++) {
+        err = OSQBufPost(AppCheck_QBufRxPtr, AppCheck_QBufTbl[i].MsgPtr, i + 1u);
+        if (AppCheck_Eq("OSQBufPost() to a queue with no task pending", err, OS_ERR_NONE) != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+    err = OSQBufPost(AppCheck_QBufRxPtr, AppCheck_QBufTbl[i].MsgPtr, 1u);
+    if (AppCheck_Eq("OSQBufPost() to a full queue", err, OS_ERR_Q_FULL) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    err = OSQBufRelease(AppCheck_QBufTbl[i].MsgPtr);
+    if (AppCheck_Eq("OSQBufRelease() of a message a full queue did not take", err, OS_ERR_NONE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    for (i = 0u; i < APP_CHECK_Q_BUF_Q_SIZE; i++) {
+        p_msg = (CPU_INT08U *)OSQBufPend(AppCheck_QBufRxPtr, 0u, &len, &err);
+        if ((AppCheck_Eq("OSQBufPend()", err, OS_ERR_NONE) != DEF_OK) ||
+            (AppCheck_Eq("message of OSQBufPend() in posting order",
+                         (p_msg == AppCheck_QBufTbl[i].MsgPtr) ? DEF_YES : DEF_NO,
+                         DEF_YES) != DEF_OK) ||
+            (AppCheck_Eq("length of OSQBufPend()", len, i + 1u) != DEF_OK) ||
+            (AppCheck_Eq("OSQBufRelease()", OSQBufRelease(p_msg), OS_ERR_NONE) != DEF_OK)) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+    AppCheck_QBufNbr = 0u;
+    if (AppCheck_QBufCmp() != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    if (AppCheck_QBufGet() != DEF_OK) {                         /* A message that is not a buffer (see Note #2).        */
+        return (APP_CHECK_RES_FAIL);
+    }
+    p_msg = AppCheck_QBufTbl[0].MsgPtr;
+    Mem_Copy(p_msg, p_msg - OS_Q_BUF_HDR_SIZE, OS_Q_BUF_HDR_SIZE);
+    err   = OSQPost(AppCheck_QBufRxPtr, p_msg + OS_Q_BUF_HDR_SIZE);
+    if (AppCheck_Eq("OSQPost()", err, OS_ERR_NONE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    p_msg = (CPU_INT08U *)OSQBufPend(AppCheck_QBufRxPtr, 0u, &len, &err);
+    if ((AppCheck_Eq("OSQBufPend() of a message that is not a buffer", err, OS_ERR_Q_BUF_INVALID) != DEF_OK) ||
+        (AppCheck_Eq("message of OSQBufPend() on an error",
+                     (p_msg == (CPU_INT08U *)0) ? DEF_YES : DEF_NO,
+                     DEF_YES) != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    p_msg = (CPU_INT08U *)OSQBufPend(AppCheck_QBufRxPtr, 1u, &len, &err);
+    if ((AppCheck_Eq("OSQBufPend() on an empty queue", err, OS_ERR_TIMEOUT) != DEF_OK) ||
+        (AppCheck_Eq("length of OSQBufPend() on a timeout", len, 0u)       != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    p_msg = AppCheck_QBufTbl[0].MsgPtr;                         /* The largest number of references.                    */
+    for (i = 1u; i < DEF_INT_16U_MAX_VAL; i++) {
+        if (AppCheck_Eq("OSQBufRetain()", OSQBufRetain(p_msg), OS_ERR_NONE) != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+    err = OSQBufRetain(p_msg);
+    if (AppCheck_Eq("OSQBufRetain() of a buffer with 65535 references", err, OS_ERR_Q_BUF_REF_OVF) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    for (i = 0u; i < DEF_INT_16U_MAX_VAL; i++) {
+        if (AppCheck_Eq("OSQBufRelease()", OSQBufRelease(p_msg), OS_ERR_NONE) != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+    AppCheck_QBufNbr = 0u;
+    if (AppCheck_QBufCmp() != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    return (APP_CHECK_RES_PASS);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_QBufTask()
+*
+* Description : Helper task of the OSQBuf case : pends on the queue the check task sends to & does what the
+*               first byte of each message asks (APP_CHECK_Q_BUF_OP_...).
+*
+* Argument(s) : p_arg       Argument passed to 'OSTaskCreateExt()', not used.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The helper task runs above the check task, so that it has handled a message before
+*                   OSQBufPost() returns to the check task.  An error is only recorded, & reported by the
+*                   check task.
+*********************************************************************************************************
+*/
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  void  AppCheck_QBufTask (void  *p_arg)
+{
+    CPU_INT08U        *p_msg;
+    const  CPU_CHAR   *p_what;
+    INT32U             len;
+    INT8U              err;
+
+
+    (void)p_arg;
+
+    while (DEF_ON) {
+        p_msg  = (CPU_INT08U *)OSQBufPend(AppCheck_QBufTxPtr, 0u, &len, &err);
+        p_what = "OSQBufPend() of the helper task";
+        if (err == OS_ERR_NONE) {
+            AppCheck_QBufTaskLen = len;
+            switch (p_msg[0]) {
+                case APP_CHECK_Q_BUF_OP_ECHO:
+                     p_what = "OSQBufPost() of the helper task";
+                     err    = OSQBufPost(AppCheck_QBufRxPtr, p_msg, len);
+                     break;
+
+                case APP_CHECK_Q_BUF_OP_HOLD:
+                     p_what = "OSQBufRelease() of the helper task";
+                     if (AppCheck_QBufTaskHeldPtr != (void *)0) {
+                         err = OSQBufRelease(AppCheck_QBufTaskHeldPtr);
+                     }
+                     AppCheck_QBufTaskHeldPtr = p_msg;
+                     break;
+
+                case APP_CHECK_Q_BUF_OP_DROP:
+                default:
+                     p_what = "OSQBufRelease() of the helper task";
+                     err    = OSQBufRelease(p_msg);
+                     if ((err == OS_ERR_NONE) && (AppCheck_QBufTaskHeldPtr != (void *)0)) {
+                         err = OSQBufRelease(AppCheck_QBufTaskHeldPtr);
+                     }
+                     AppCheck_QBufTaskHeldPtr = (void *)0;
+                     break;
+            }
+        }
+        if ((err != OS_ERR_NONE) && (AppCheck_QBufTaskErrWhatPtr == (const CPU_CHAR *)0)) {
+            AppCheck_QBufTaskErrWhatPtr = p_what;               /* See Note #1.                                         */
+            AppCheck_QBufTaskErr        = err;
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_QBufGet()
+*
+* Description : Get a buffer for the check task in the OSQBuf case & update the model.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_QBufGet (void)
+{
+    CPU_INT08U  *p_msg;
+    CPU_INT32U   nbr;
+    INT8U        err;
+
+
+    nbr   = AppCheck_QBufNbr + ((AppCheck_QBufHeldPtr != (void *)0) ? 1u : 0u);
+    p_msg = (CPU_INT08U *)OSQBufGet(AppCheck_QBufMemPtr, &err);
+    if (nbr >= APP_CHECK_Q_BUF_BLK_NBR) {
+        return (AppCheck_Eq("OSQBufGet() from a partition with no free block", err, OS_ERR_MEM_NO_FREE_BLKS));
+    }
+    if (AppCheck_Eq("OSQBufGet()", err, OS_ERR_NONE) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+    AppCheck_QBufTbl[AppCheck_QBufNbr].MsgPtr = p_msg;
+    AppCheck_QBufTbl[AppCheck_QBufNbr].RefCtr = 1u;
+    AppCheck_QBufNbr++;
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_QBufSend()
+*
+* Description : Send a buffer of the check task to the helper task in the OSQBuf case, check what the kernel
+*               lets the check task do with it afterwards & update the model.
+*
+* Argument(s) : ix          Index of the buffer in AppCheck_QBufTbl[].
+*
+*               op          What the helper task does with the message (APP_CHECK_Q_BUF_OP_...).
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) A buffer with more than one reference is only echoed : the reference the helper task
+*                   releases would otherwise be one of the check task.
+*
+*               (2) Once posted, a buffer with one reference belongs to the task that pends on it, & to no
+*                   task while it is queued : the check task may neither release it nor post it again.
+*********************************************************************************************************
+*/
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_QBufSend (CPU_INT32U  ix,
+                                        CPU_INT08U  op)
+{
+    APP_CHECK_Q_BUF  *p_buf;
+    CPU_INT08U       *p_msg;
+    CPU_INT08U       *p_msg_rx;
+    CPU_INT32U        len;
+    INT32U            len_rx;
+    CPU_INT32U        i;
+    INT8U             err;
+
+
+    p_buf = &AppCheck_QBufTbl[ix];
+    p_msg = p_buf->MsgPtr;
+    if (p_buf->RefCtr > 1u) {                                   /* See Note #1.                                         */
+        op = APP_CHECK_Q_BUF_OP_ECHO;
+    }
+    len      = 1u + (AppCheck_Rand() % APP_CHECK_Q_BUF_MSG_SIZE);
+    p_msg[0] = op;
+    for (i = 1u; i < len; i++) {
+        p_msg[i] = (CPU_INT08U)(len + i);
+    }
+
+    err = OSQBufPost(AppCheck_QBufTxPtr, p_msg, len);           /* The helper task runs before OSQBufPost() returns.    */
+    if ((AppCheck_Eq("OSQBufPost()", err, OS_ERR_NONE)                          != DEF_OK) ||
+        (AppCheck_Eq("length of OSQBufPend()", AppCheck_QBufTaskLen, len)       != DEF_OK)) {
+        return (DEF_FAIL);
+    }
+
+    switch (op) {
+        case APP_CHECK_Q_BUF_OP_ECHO:
+             if (p_buf->RefCtr == 1u) {                         /* See Note #2.                                         */
+                 err = OSQBufRelease(p_msg);
+                 if (AppCheck_Eq("OSQBufRelease() of a queued message", err, OS_ERR_Q_BUF_NOT_OWNER) != DEF_OK) {
+                     return (DEF_FAIL);
+                 }
+                 err = OSQBufPost(AppCheck_QBufTxPtr, p_msg, len);
+                 if (AppCheck_Eq("OSQBufPost() of a queued message", err, OS_ERR_Q_BUF_NOT_OWNER) != DEF_OK) {
+                     return (DEF_FAIL);
+                 }
+             }
+             p_msg_rx = (CPU_INT08U *)OSQBufPend(AppCheck_QBufRxPtr, 0u, &len_rx, &err);
+             if ((AppCheck_Eq("OSQBufPend()", err, OS_ERR_NONE) != DEF_OK) ||
+                 (AppCheck_Eq("message of OSQBufPend()", (p_msg_rx == p_msg) ? DEF_YES : DEF_NO, DEF_YES) != DEF_OK) ||
+                 (AppCheck_Eq("length of OSQBufPend()", len_rx, len) != DEF_OK)) {
+                 return (DEF_FAIL);
+             }
+             for (i = 1u; i < len; i++) {
+                 if (p_msg[i] != (CPU_INT08U)(len + i)) {
+                     return (AppCheck_Eq("byte of a message echoed", p_msg[i], (CPU_INT08U)(len + i)));
+                 }
+             }
+             break;
+
+        case APP_CHECK_Q_BUF_OP_HOLD:
+             AppCheck_QBufHeldPtr = p_msg;                      /* The buffer held before is released.                  */
+             AppCheck_QBufNbr--;
+             *p_buf               = AppCheck_QBufTbl[AppCheck_QBufNbr];
+             err = OSQBufRelease(p_msg);                        /* See Note #2.                                         */
+             if (AppCheck_Eq("OSQBufRelease() of a message another task holds", err, OS_ERR_Q_BUF_NOT_OWNER) != DEF_OK) {
+                 return (DEF_FAIL);
+             }
+             err = OSQBufPost(AppCheck_QBufTxPtr, p_msg, len);
+             if (AppCheck_Eq("OSQBufPost() of a message another task holds", err, OS_ERR_Q_BUF_NOT_OWNER) != DEF_OK) {
+                 return (DEF_FAIL);
+             }
+             break;
+
+        case APP_CHECK_Q_BUF_OP_DROP:
+        default:
+             AppCheck_QBufHeldPtr = (void *)0;
+             AppCheck_QBufNbr--;
+             *p_buf               = AppCheck_QBufTbl[AppCheck_QBufNbr];
+             break;
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        AppCheck_QBufRetain()
+*
+* Description : Add a reference to a buffer of the check task in the OSQBuf case, or release one once the
+*               buffer has APP_CHECK_Q_BUF_REF_MAX references.
+*
+* Argument(s) : ix          Index of the buffer in AppCheck_QBufTbl[].
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_QBufRetain (CPU_INT32U  ix)
+{
+    INT8U  err;
+
+
+    if (AppCheck_QBufTbl[ix].RefCtr >= APP_CHECK_Q_BUF_REF_MAX) {
+        return (AppCheck_QBufRelease(ix));
+    }
+    err = OSQBufRetain(AppCheck_QBufTbl[ix].MsgPtr);
+    AppCheck_QBufTbl[ix].RefCtr++;
+
+    return (AppCheck_Eq("OSQBufRetain()", err, OS_ERR_NONE));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        AppCheck_QBufRelease()
+*
+* Description : Release a reference to a buffer of the check task in the OSQBuf case & update the model.
+*
+* Argument(s) : ix          Index of the buffer in AppCheck_QBufTbl[].
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_QBufRelease (CPU_INT32U  ix)
+{
+    INT8U  err;
+
+
+    err = OSQBufRelease(AppCheck_QBufTbl[ix].MsgPtr);
+    AppCheck_QBufTbl[ix].RefCtr--;
+    if (AppCheck_QBufTbl[ix].RefCtr == 0u) {                    /* Last reference : the block is freed.                 */
+        AppCheck_QBufNbr--;
+        AppCheck_QBufTbl[ix] = AppCheck_QBufTbl[AppCheck_QBufNbr];
+    }
+
+    return (AppCheck_Eq("OSQBufRelease()", err, OS_ERR_NONE));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_QBufCmp()
+*
+* Description : Compare the free blocks of the partition & the buffer kept by the helper task in the OSQBuf
+*               case with the model, & report an error of the helper task.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if the kernel & the helper task agree with the model.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+#if ((OS_Q_BUF_EN > 0u) && (OS_MEM_QUERY_EN > 0u) && (OS_Q_DEL_EN > 0u) && (OS_TASK_DEL_EN > 0u))
+static  CPU_BOOLEAN  AppCheck_QBufCmp (void)
+{
+    OS_MEM_DATA  data;
+    CPU_INT32U   nbr;
+    INT8U        err;
+
+
+    if (AppCheck_QBufTaskErrWhatPtr != (const CPU_CHAR *)0) {
+        AppCheck_Fail(AppCheck_QBufTaskErrWhatPtr, AppCheck_QBufTaskErr, OS_ERR_NONE);
+        return (DEF_FAIL);
+    }
+
+    nbr = AppCheck_QBufNbr + ((AppCheck_QBufHeldPtr != (void *)0) ? 1u : 0u);
+    err = OSMemQuery(AppCheck_QBufMemPtr, &data);
+    if ((AppCheck_Eq("OSMemQuery()", err, OS_ERR_NONE) != DEF_OK) ||
+        (AppCheck_Eq("OSNFree of OSMemQuery()", data.OSNFree, APP_CHECK_Q_BUF_BLK_NBR - nbr) != DEF_OK) ||
+        (AppCheck_Eq("buffer kept by the helper task",
+                     (AppCheck_QBufTaskHeldPtr == AppCheck_QBufHeldPtr) ? DEF_YES : DEF_NO,
+                     DEF_YES) != DEF_OK)) {
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_EventSet()
+*
+* Description : Check the event sets (see 'app_check.h  Note #1').
+*
+* Argument(s) : none.
+*
+* Return(s)   : APP_CHECK_RES_PASS, APP_CHECK_RES_FAIL or APP_CHECK_RES_SKIP.
+*
+* Note(s)     : (1) The helper task & the events are deleted whatever the result, so that the next cases
+*                   find the priority & the event control blocks free.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  AppCheck_EventSet (void)
+{
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+    APP_CHECK_EVENT_SET_EVT  *p_evt;
+    CPU_INT08U                res;
+    CPU_INT32U                ix;
+    INT8U                     err;
+    INT8U                     err_task;
+
+
+    Mem_Clr(&AppCheck_EventSetEvtTbl[0], sizeof(AppCheck_EventSetEvtTbl));
+    AppCheck_EventSetRdyNbr = 0u;
+    AppCheck_EventSetTaskOp = APP_CHECK_EVENT_SET_OP_NONE;
+
+    AppCheck_EventSetPtr      = OSEventSetCreate(&err);
+    AppCheck_EventSetOtherPtr = OSEventSetCreate(&err);
+    AppCheck_EventSetSemPtr   = OSSemCreate(0u);
+    AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_SEM ].EventPtr = OSSemCreate(0u);
+    AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_MBOX].EventPtr = OSMboxCreate((void *)0);
+    AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_Q   ].EventPtr = OSQCreate(&AppCheck_EventSetQStor[0],
+                                                                           APP_CHECK_EVENT_SET_AVAIL_MAX);
+    err_task = OSTaskCreateExt(AppCheck_EventSetTask,
+                               (void *)0,
+                               &AppCheck_HelperStk[APP_CHECK_STK_SIZE - 1u],
+                               APP_CHECK_PRIO_HELPER,
+                               APP_CHECK_PRIO_HELPER,
+                               &AppCheck_HelperStk[0],
+                               APP_CHECK_STK_SIZE,
+                               (void *)0,
+                               OS_TASK_OPT_NONE);
+
+    res = APP_CHECK_RES_FAIL;
+    if ((AppCheck_Eq("OSEventSetCreate(), OSSemCreate(), OSMboxCreate() & OSQCreate()",
+                     ((AppCheck_EventSetPtr      != (OS_EVENT *)0) &&
+                      (AppCheck_EventSetOtherPtr != (OS_EVENT *)0) &&
+                      (AppCheck_EventSetSemPtr   != (OS_EVENT *)0) &&
+                      (AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_SEM ].EventPtr != (OS_EVENT *)0) &&
+                      (AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_MBOX].EventPtr != (OS_EVENT *)0) &&
+                      (AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_Q   ].EventPtr != (OS_EVENT *)0)) ? DEF_YES : DEF_NO,
+                     DEF_YES) == DEF_OK) &&
+        (AppCheck_Eq("OSTaskCreateExt() of the helper task", err_task, OS_ERR_NONE) == DEF_OK)) {
+        res = AppCheck_EventSetRun();
+    }
+
+    (void)OSTaskDel(APP_CHECK_PRIO_HELPER);                     /* See Note #1.                                         */
+    for (ix = 0u; ix < APP_CHECK_EVENT_SET_EVT_NBR; ix++) {     /* Deleting an event also removes it from its set.      */
+        p_evt = &AppCheck_EventSetEvtTbl[ix];
+        if (p_evt->EventPtr != (OS_EVENT *)0) {
+            switch (ix) {
+                case APP_CHECK_EVENT_SET_SEM:
+                     (void)OSSemDel(p_evt->EventPtr, OS_DEL_ALWAYS, &err);
+                     break;
+
+                case APP_CHECK_EVENT_SET_MBOX:
+                     (void)OSMboxDel(p_evt->EventPtr, OS_DEL_ALWAYS, &err);
+                     break;
+
+                case APP_CHECK_EVENT_SET_Q:
+                default:
+                     (void)OSQDel(p_evt->EventPtr, OS_DEL_ALWAYS, &err);
+                     break;
+            }
+        }
+    }
+    if (AppCheck_EventSetSemPtr != (OS_EVENT *)0) {
+        (void)OSSemDel(AppCheck_EventSetSemPtr, OS_DEL_ALWAYS, &err);
+    }
+    if (AppCheck_EventSetOtherPtr != (OS_EVENT *)0) {
+        (void)OSEventSetDel(AppCheck_EventSetOtherPtr, &err);
+    }
+    if (AppCheck_EventSetPtr != (OS_EVENT *)0) {
+        (void)OSEventSetDel(AppCheck_EventSetPtr, &err);
+        if ((res == APP_CHECK_RES_PASS) &&
+            (AppCheck_Eq("OSEventSetDel() once its events are deleted", err, OS_ERR_NONE) != DEF_OK)) {
+            res = APP_CHECK_RES_FAIL;
+        }
+    }
+
+    return (res);
+#else
+    return (APP_CHECK_RES_SKIP);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_EventSetRun()
+*
+* Description : Steps of the OSEventSet case, once the sets, the events & the helper task are created.
+*
+* Argument(s) : none.
+*
+* Return(s)   : APP_CHECK_RES_PASS or APP_CHECK_RES_FAIL.
+*
+* Note(s)     : (1) The steps that need the helper task or a set order come first, while every event is
+*                   empty & the list of ready events of the set is empty : the model starts from there.
+*
+*               (2) The helper task posts the semaphore & accepts it while the check task waits on the set,
+*                   then posts the mailbox one tick later : the check task must skip the semaphore, wait
+*                   again & return the mailbox alone.
+*
+*               (3) A post to an event a task waits on goes to that task & leaves the set alone.
+*
+*               (4) The other set is deleted while the helper task waits on it & while it holds an event,
+*                   then once the event is deleted, which must remove it from the set.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+static  CPU_INT08U  AppCheck_EventSetRun (void)
+{
+    OS_EVENT     *p_set;
+    OS_EVENT     *p_sem;
+    OS_EVENT     *p_mbox;
+    OS_EVENT     *p_q;
+    OS_EVENT     *pevents_rdy[APP_CHECK_EVENT_SET_EVT_NBR];
+    CPU_INT32U    op;
+    CPU_INT32U    ix;
+    CPU_BOOLEAN   ok;
+    INT16U        nbr;
+    INT8U         err;
+
+
+    p_set  = AppCheck_EventSetPtr;
+    p_sem  = AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_SEM ].EventPtr;
+    p_mbox = AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_MBOX].EventPtr;
+    p_q    = AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_Q   ].EventPtr;
+
+                                                                /* --------- MEMBERS & ERRORS (see Note #1) ---------- */
+    err = OSEventSetAdd(p_set, AppCheck_EventSetOtherPtr);
+    if (AppCheck_Eq("OSEventSetAdd() of a set", err, OS_ERR_EVENT_TYPE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    err = OSEventSetAdd(p_sem, p_mbox);
+    if (AppCheck_Eq("OSEventSetAdd() to a semaphore", err, OS_ERR_EVENT_TYPE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    for (ix = 0u; ix < APP_CHECK_EVENT_SET_EVT_NBR; ix++) {
+        if (AppCheck_EventSetMember(ix) != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+    err = OSEventSetAdd(AppCheck_EventSetOtherPtr, p_sem);
+    if (AppCheck_Eq("OSEventSetAdd() of an event of another set", err, OS_ERR_EVENT_SET_MEMBER) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    err = OSEventSetRemove(AppCheck_EventSetOtherPtr, p_sem);
+    if (AppCheck_Eq("OSEventSetRemove() of an event of another set", err, OS_ERR_EVENT_SET_NOT_MEMBER) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    (void)OSEventSetDel(p_set, &err);
+    if (AppCheck_Eq("OSEventSetDel() of a set with events", err, OS_ERR_EVENT_SET_NOT_EMPTY) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+    OSSchedLock();
+    nbr = OSEventSetPend(p_set, &pevents_rdy[0], APP_CHECK_EVENT_SET_EVT_NBR, 0u, &err);
+    OSSchedUnlock();
+    if ((AppCheck_Eq("OSEventSetPend() with the scheduler locked", err, OS_ERR_PEND_LOCKED) != DEF_OK) ||
+        (AppCheck_Eq("events of OSEventSetPend() on an error", nbr, 0u)                     != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    nbr = OSEventSetPend(p_set, &pevents_rdy[0], APP_CHECK_EVENT_SET_EVT_NBR, 2u, &err);
+    if ((AppCheck_Eq("OSEventSetPend() with no event posted", err, OS_ERR_TIMEOUT) != DEF_OK) ||
+        (AppCheck_Eq("events of OSEventSetPend() on a timeout", nbr, 0u)         != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+                                                                /* ------ ACCEPT BY ANOTHER TASK (see Note #2) ------- */
+    AppCheck_EventSetTaskOp = APP_CHECK_EVENT_SET_OP_POST_ACCEPT;
+    (void)OSTaskResume(APP_CHECK_PRIO_HELPER);
+    nbr = OSEventSetPend(p_set, &pevents_rdy[0], APP_CHECK_EVENT_SET_EVT_NBR, APP_CHECK_EVENT_SET_TIMEOUT, &err);
+    if ((AppCheck_Eq("OSEventSetPend()", err, OS_ERR_NONE)                                   != DEF_OK) ||
+        (AppCheck_Eq("events of OSEventSetPend() after an accept by another task", nbr, 1u) != DEF_OK) ||
+        (AppCheck_Eq("event of OSEventSetPend() after an accept by another task",
+                     (pevents_rdy[0] == p_mbox) ? DEF_YES : DEF_NO,
+                     DEF_YES) != DEF_OK) ||
+        (AppCheck_Eq("OSSemAccept() of the helper task", AppCheck_EventSetTaskCnt, 1u)     != DEF_OK) ||
+        (AppCheck_Eq("OSMboxPost() of the helper task", AppCheck_EventSetTaskErr, OS_ERR_NONE) != DEF_OK) ||
+        (AppCheck_Eq("OSMboxAccept()", (OSMboxAccept(p_mbox) != (void *)0) ? DEF_YES : DEF_NO, DEF_YES) != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+                                                                /* ----- TASK WAITING ON AN EVENT (see Note #3) ------ */
+    AppCheck_EventSetTaskOp = APP_CHECK_EVENT_SET_OP_PEND_Q;
+    (void)OSTaskResume(APP_CHECK_PRIO_HELPER);
+    err = OSQPost(p_q, (void *)p_q);
+    if ((AppCheck_Eq("OSQPost()", err, OS_ERR_NONE)                                          != DEF_OK) ||
+        (AppCheck_Eq("OSQPend() of the helper task", AppCheck_EventSetTaskErr, OS_ERR_NONE) != DEF_OK) ||
+        (AppCheck_Eq("message of OSQPend() of the helper task",
+                     (AppCheck_EventSetTaskMsgPtr == (void *)p_q) ? DEF_YES : DEF_NO,
+                     DEF_YES) != DEF_OK) ||
+        (AppCheck_Eq("OSSemPost()", OSSemPost(p_sem), OS_ERR_NONE)                          != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    nbr = OSEventSetPend(p_set, &pevents_rdy[0], APP_CHECK_EVENT_SET_EVT_NBR, APP_CHECK_EVENT_SET_TIMEOUT, &err);
+    if ((AppCheck_Eq("OSEventSetPend()", err, OS_ERR_NONE)                                 != DEF_OK) ||
+        (AppCheck_Eq("events of OSEventSetPend() after a post to a waiting task", nbr, 1u) != DEF_OK) ||
+        (AppCheck_Eq("event of OSEventSetPend() after a post to a waiting task",
+                     (pevents_rdy[0] == p_sem) ? DEF_YES : DEF_NO,
+                     DEF_YES) != DEF_OK) ||
+        (AppCheck_Eq("OSSemAccept()", OSSemAccept(p_sem), 1u)                              != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+                                                                /* ------- DELETE THE OTHER SET (see Note #4) -------- */
+    AppCheck_EventSetTaskOp = APP_CHECK_EVENT_SET_OP_PEND_SET;
+    (void)OSTaskResume(APP_CHECK_PRIO_HELPER);
+    (void)OSEventSetDel(AppCheck_EventSetOtherPtr, &err);
+    if (AppCheck_Eq("OSEventSetDel() of a set a task waits on", err, OS_ERR_TASK_WAITING) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    err = OSEventSetAdd(AppCheck_EventSetOtherPtr, AppCheck_EventSetSemPtr);
+    if ((AppCheck_Eq("OSEventSetAdd()", err, OS_ERR_NONE)                         != DEF_OK) ||
+        (AppCheck_Eq("OSSemPost()", OSSemPost(AppCheck_EventSetSemPtr), OS_ERR_NONE) != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    if ((AppCheck_Eq("OSEventSetPend() of the helper task", AppCheck_EventSetTaskErr, OS_ERR_NONE) != DEF_OK) ||
+        (AppCheck_Eq("events of OSEventSetPend() of the helper task", AppCheck_EventSetTaskNbr, 1u) != DEF_OK) ||
+        (AppCheck_Eq("event of OSEventSetPend() of the helper task",
+                     (AppCheck_EventSetTaskEvtPtr == AppCheck_EventSetSemPtr) ? DEF_YES : DEF_NO,
+                     DEF_YES) != DEF_OK) ||
+        (AppCheck_Eq("OSSemPost()", OSSemPost(AppCheck_EventSetSemPtr), OS_ERR_NONE) != DEF_OK)) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    (void)OSEventSetDel(AppCheck_EventSetOtherPtr, &err);
+    if (AppCheck_Eq("OSEventSetDel() of a set with a ready event", err, OS_ERR_EVENT_SET_NOT_EMPTY) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    (void)OSSemDel(AppCheck_EventSetSemPtr, OS_DEL_ALWAYS, &err);
+    AppCheck_EventSetSemPtr = (OS_EVENT *)0;
+    if (AppCheck_Eq("OSSemDel()", err, OS_ERR_NONE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+    (void)OSEventSetDel(AppCheck_EventSetOtherPtr, &err);
+    AppCheck_EventSetOtherPtr = (OS_EVENT *)0;
+    if (AppCheck_Eq("OSEventSetDel() once its event is deleted", err, OS_ERR_NONE) != DEF_OK) {
+        return (APP_CHECK_RES_FAIL);
+    }
+
+                                                                /* ------------------ RANDOM STEPS ------------------- */
+    for (op = 0u; op < APP_CHECK_EVENT_SET_OP_NBR; op++) {
+        if ((op % APP_CHECK_TIME_RESET_NBR) == 0u) {
+            OSTimeSet(0u);                                      /* See 'app_check.c  Note #1'.                          */
+            AppCheck_ParamReset();
+        }
+        ix = AppCheck_Rand() % APP_CHECK_EVENT_SET_EVT_NBR;
+        switch (AppCheck_Rand() % 8u) {
+            case 0u:
+            case 1u:
+            case 2u:
+                 ok = AppCheck_EventSetPost(ix);
+                 break;
+
+            case 3u:
+            case 4u:
+                 ok = AppCheck_EventSetAccept(ix);
+                 break;
+
+            case 5u:
+            case 6u:
+                 ok = AppCheck_EventSetPend();
+                 break;
+
+            case 7u:
+            default:
+                 ok = AppCheck_EventSetMember(ix);
+                 break;
+        }
+        if (ok != DEF_OK) {
+            return (APP_CHECK_RES_FAIL);
+        }
+    }
+
+    for (ix = 0u; ix < APP_CHECK_EVENT_SET_EVT_NBR; ix++) {     /* Delete the set with its events in it.                */
+        if (AppCheck_EventSetEvtTbl[ix].Member == DEF_NO) {
+            if (AppCheck_EventSetMember(ix) != DEF_OK) {
+                return (APP_CHECK_RES_FAIL);
+            }
+        }
+    }
+
+    return (APP_CHECK_RES_PASS);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_EventSetTask()
+*
+* Description : Helper task of the OSEventSet case : does what AppCheck_EventSetTaskOp asks
+*               (APP_CHECK_EVENT_SET_OP_...), then suspends itself until the check task resumes it.
+*
+* Argument(s) : p_arg       Argument passed to 'OSTaskCreateExt()', not used.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The helper task runs above the check task : it has run until it waits or is suspended
+*                   before OSTaskResume() returns to the check task.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+static  void  AppCheck_EventSetTask (void  *p_arg)
+{
+    OS_EVENT  *p_sem;
+    OS_EVENT  *p_mbox;
+    INT8U      err;
+
+
+    (void)p_arg;
+
+    p_sem  = AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_SEM ].EventPtr;
+    p_mbox = AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_MBOX].EventPtr;
+    while (DEF_ON) {
+        switch (AppCheck_EventSetTaskOp) {
+            case APP_CHECK_EVENT_SET_OP_POST_ACCEPT:            /* See 'AppCheck_EventSetRun()  Note #2'.               */
+                 OSTimeDly(1u);
+                 (void)OSSemPost(p_sem);
+                 AppCheck_EventSetTaskCnt = OSSemAccept(p_sem);
+                 OSTimeDly(1u);
+                 AppCheck_EventSetTaskErr = OSMboxPost(p_mbox, (void *)p_mbox);
+                 break;
+
+            case APP_CHECK_EVENT_SET_OP_PEND_Q:
+                 AppCheck_EventSetTaskMsgPtr = OSQPend(AppCheck_EventSetEvtTbl[APP_CHECK_EVENT_SET_Q].EventPtr, 0u, &err);
+                 AppCheck_EventSetTaskErr    = err;
+                 break;
+
+            case APP_CHECK_EVENT_SET_OP_PEND_SET:
+                 AppCheck_EventSetTaskNbr = OSEventSetPend(AppCheck_EventSetOtherPtr,
+                                                           &AppCheck_EventSetTaskEvtPtr,
+                                                           1u,
+                                                           0u,
+                                                           &err);
+                 AppCheck_EventSetTaskErr = err;
+                 break;
+
+            default:
+                 break;
+        }
+        AppCheck_EventSetTaskOp = APP_CHECK_EVENT_SET_OP_NONE;
+        (void)OSTaskSuspend(OS_PRIO_SELF);
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_EventSetPost()
+*
+* Description : Post to an event of the OSEventSet case & update the model.
+*
+* Argument(s) : ix          Index of the event in AppCheck_EventSetEvtTbl[].
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) A post that makes the event available appends the event to the list of ready events of
+*                   its set, unless it is in the list already.  It does so even when the event was available
+*                   before the post, as the event leaves the list when OSEventSetPend() returns it.
+*
+*               (2) A semaphore is accepted instead of posted once its count reaches
+*                   APP_CHECK_EVENT_SET_AVAIL_MAX; a full mailbox or queue must reject the post.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_EventSetPost (CPU_INT32U  ix)
+{
+    APP_CHECK_EVENT_SET_EVT  *p_evt;
+    CPU_INT32U                avail_max;
+    INT8U                     err;
+    INT8U                     err_full;
+
+
+    p_evt = &AppCheck_EventSetEvtTbl[ix];
+    switch (ix) {
+        case APP_CHECK_EVENT_SET_SEM:
+             if (p_evt->Avail >= APP_CHECK_EVENT_SET_AVAIL_MAX) {   /* See Note #2.                                     */
+                 return (AppCheck_EventSetAccept(ix));
+             }
+             avail_max = APP_CHECK_EVENT_SET_AVAIL_MAX;
+             err_full  = OS_ERR_NONE;
+             err       = OSSemPost(p_evt->EventPtr);
+             break;
+
+        case APP_CHECK_EVENT_SET_MBOX:
+             avail_max = 1u;
+             err_full  = OS_ERR_MBOX_FULL;
+             err       = OSMboxPost(p_evt->EventPtr, (void *)p_evt);
+             break;
+
+        case APP_CHECK_EVENT_SET_Q:
+        default:
+             avail_max = APP_CHECK_EVENT_SET_AVAIL_MAX;
+             err_full  = OS_ERR_Q_FULL;
+             err       = OSQPost(p_evt->EventPtr, (void *)p_evt);
+             break;
+    }
+
+    if (p_evt->Avail >= avail_max) {
+        return (AppCheck_Eq("post to a full mailbox or queue", err, err_full));
+    }
+    p_evt->Avail++;
+    if ((p_evt->Member == DEF_YES) &&                           /* See Note #1.                                         */
+        (p_evt->Rdy    == DEF_NO)) {
+        p_evt->Rdy = DEF_YES;
+        AppCheck_EventSetRdyTbl[AppCheck_EventSetRdyNbr] = (CPU_INT08U)ix;
+        AppCheck_EventSetRdyNbr++;
+    }
+
+    return (AppCheck_Eq("post to an event of a set", err, OS_ERR_NONE));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      AppCheck_EventSetAccept()
+*
+* Description : Accept from an event of the OSEventSet case & update the model.
+*
+* Argument(s) : ix          Index of the event in AppCheck_EventSetEvtTbl[].
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) An accept leaves the list of ready events of the set alone : an event that is no longer
+*                   available is skipped by OSEventSetPend().
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_EventSetAccept (CPU_INT32U  ix)
+{
+    APP_CHECK_EVENT_SET_EVT  *p_evt;
+    void                     *p_msg;
+    CPU_INT32U                cnt;
+    INT8U                     err;
+
+
+    p_evt = &AppCheck_EventSetEvtTbl[ix];
+    if (ix == APP_CHECK_EVENT_SET_SEM) {
+        cnt = OSSemAccept(p_evt->EventPtr);
+        if (AppCheck_Eq("count of OSSemAccept()", cnt, p_evt->Avail) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+    } else {
+        if (ix == APP_CHECK_EVENT_SET_MBOX) {
+            p_msg = OSMboxAccept(p_evt->EventPtr);
+        } else {
+            p_msg = OSQAccept(p_evt->EventPtr, &err);
+        }
+        if (AppCheck_Eq("message of OSMboxAccept() or OSQAccept()",
+                        (p_msg == (void *)0) ? 0u : ((p_msg == (void *)p_evt) ? 1u : 2u),
+                        (p_evt->Avail > 0u)  ? 1u : 0u) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+    }
+    if (p_evt->Avail > 0u) {                                    /* See Note #1.                                         */
+        p_evt->Avail--;
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_EventSetPend()
+*
+* Description : Pend on the set of the OSEventSet case, for a random number of events, & compare the events
+*               returned with the model.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The events leave the list of ready events in the order they entered it, available or
+*                   not, until 'n' available events are taken.  OSEventSetPend() is only called when the
+*                   model holds an available event in the list, since it would wait otherwise.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_EventSetPend (void)
+{
+    OS_EVENT    *pevents_rdy[APP_CHECK_EVENT_SET_EVT_NBR];
+    CPU_INT08U   evt_exp[APP_CHECK_EVENT_SET_EVT_NBR];
+    CPU_INT32U   n;
+    CPU_INT32U   nbr_exp;
+    CPU_INT32U   i;
+    CPU_INT32U   j;
+    INT16U       nbr;
+    INT8U        err;
+
+
+    for (i = 0u; i < AppCheck_EventSetRdyNbr; i++) {            /* See Note #1.                                         */
+        if (AppCheck_EventSetEvtTbl[AppCheck_EventSetRdyTbl[i]].Avail > 0u) {
+            break;
+        }
+    }
+    if (i >= AppCheck_EventSetRdyNbr) {
+        return (DEF_OK);
+    }
+
+    n       = 1u + (AppCheck_Rand() % APP_CHECK_EVENT_SET_EVT_NBR);
+    nbr_exp = 0u;
+    i       = 0u;
+    while ((nbr_exp < n) &&
+           (i       < AppCheck_EventSetRdyNbr)) {
+        AppCheck_EventSetEvtTbl[AppCheck_EventSetRdyTbl[i]].Rdy = DEF_NO;
+        if (AppCheck_EventSetEvtTbl[AppCheck_EventSetRdyTbl[i]].Avail > 0u) {
+            evt_exp[nbr_exp] = AppCheck_EventSetRdyTbl[i];
+            nbr_exp++;
+        }
+        i++;
+    }
+    for (j = 0u; (i + j) < AppCheck_EventSetRdyNbr; j++) {
+        AppCheck_EventSetRdyTbl[j] = AppCheck_EventSetRdyTbl[i + j];
+    }
+    AppCheck_EventSetRdyNbr = j;
+
+    nbr = OSEventSetPend(AppCheck_EventSetPtr, &pevents_rdy[0], (INT16U)n, APP_CHECK_EVENT_SET_TIMEOUT, &err);
+    if ((AppCheck_Eq("OSEventSetPend()", err, OS_ERR_NONE)           != DEF_OK) ||
+        (AppCheck_Eq("events of OSEventSetPend()", nbr, nbr_exp) != DEF_OK)) {
+        return (DEF_FAIL);
+    }
+    for (i = 0u; i < nbr_exp; i++) {
+        if (AppCheck_Eq("event of OSEventSetPend(), in the order the events became ready",
+                        (pevents_rdy[i] == AppCheck_EventSetEvtTbl[evt_exp[i]].EventPtr) ? DEF_YES : DEF_NO,
+                        DEF_YES) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      AppCheck_EventSetMember()
+*
+* Description : Remove an event of the OSEventSet case from the set, or add it back, & update the model.
+*
+* Argument(s) : ix          Index of the event in AppCheck_EventSetEvtTbl[].
+*
+* Return(s)   : DEF_OK,   if the kernel returned what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) An event added while it is available enters the list of ready events of the set at once.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_EVENT_SET_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_EventSetMember (CPU_INT32U  ix)
+{
+    APP_CHECK_EVENT_SET_EVT  *p_evt;
+    CPU_INT32U                i;
+    INT8U                     err;
+
+
+    p_evt = &AppCheck_EventSetEvtTbl[ix];
+    if (p_evt->Member == DEF_YES) {
+        err = OSEventSetRemove(AppCheck_EventSetPtr, p_evt->EventPtr);
+        if (AppCheck_Eq("OSEventSetRemove()", err, OS_ERR_NONE) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+        err = OSEventSetRemove(AppCheck_EventSetPtr, p_evt->EventPtr);
+        if (AppCheck_Eq("OSEventSetRemove() of an event out of the set", err, OS_ERR_EVENT_SET_NOT_MEMBER) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+        p_evt->Member = DEF_NO;
+        if (p_evt->Rdy == DEF_YES) {                            /* Unlink the event from the list of ready events.      */
+            p_evt->Rdy = DEF_NO;
+            for (i = 0u; AppCheck_EventSetRdyTbl[i] != ix; i++) {
+                ;
+            }
+            for (; (i + 1u) < AppCheck_EventSetRdyNbr; i++) {
+                AppCheck_EventSetRdyTbl[i] = AppCheck_EventSetRdyTbl[i + 1u];
+            }
+            AppCheck_EventSetRdyNbr--;
+        }
+    } else {
+        err = OSEventSetAdd(AppCheck_EventSetPtr, p_evt->EventPtr);
+        if (AppCheck_Eq("OSEventSetAdd()", err, OS_ERR_NONE) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+        err = OSEventSetAdd(AppCheck_EventSetPtr, p_evt->EventPtr);
+        if (AppCheck_Eq("OSEventSetAdd() of an event in the set", err, OS_ERR_EVENT_SET_MEMBER) != DEF_OK) {
+            return (DEF_FAIL);
+        }
+        p_evt->Member = DEF_YES;
+        if (p_evt->Avail > 0u) {                                /* See Note #1.                                         */
+            p_evt->Rdy = DEF_YES;
+            AppCheck_EventSetRdyTbl[AppCheck_EventSetRdyNbr] = (CPU_INT08U)ix;
+            AppCheck_EventSetRdyNbr++;
+        }
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_ParamReset()
+*
+* Description : Keep the CPP bookkeeping of the kernel out of the way (see 'app_check.c  Note #1').
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppCheck_ParamReset (void)
+{
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < OS_MAX_TASKS; i++) {
+        TaskParameter[i].Task_need_ExecutionTime = APP_CHECK_NEED_EXEC_TIME;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_Eq()
+*
+* Description : Count one comparison of the current case & record it if it is the first one to fail.
+*
+* Argument(s) : p_what      What was compared.
+*
+*               val         Value observed.
+*
+*               val_exp     Value expected.
+*
+* Return(s)   : DEF_OK,   if 'val' is equal to 'val_exp'.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppCheck_Eq (const  CPU_CHAR    *p_what,
+                                         CPU_INT32U   val,
+                                         CPU_INT32U   val_exp)
+{
+    AppCheck_ChkNbr++;
+    if (val == val_exp) {
+        return (DEF_OK);
+    }
+    AppCheck_Fail(p_what, val, val_exp);
+
+    return (DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_Fail()
+*
+* Description : Record a failure of the current case, unless one is recorded already.
+*
+* Argument(s) : p_what      What was compared.
+*
+*               val         Value observed.
+*
+*               val_exp     Value expected.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppCheck_Fail (const  CPU_CHAR    *p_what,
+                                    CPU_INT32U   val,
+                                    CPU_INT32U   val_exp)
+{
+    if (AppCheck_FailWhatPtr == (const CPU_CHAR *)0) {
+        AppCheck_FailWhatPtr = p_what;
+        AppCheck_FailVal     = val;
+        AppCheck_FailValExp  = val_exp;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_Rand()
+*
+* Description : Next random number of the current case.
+*
+* Argument(s) : none.
+*
+* Return(s)   : A 32-bit random number.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppCheck_Rand (void)
+{
+    CPU_INT32U  x;
+
+
+    x                  = AppCheck_RandState;                    /* xorshift32.                                          */
+    x                 ^= x << 13u;
+    x                 ^= x >> 17u;
+    x                 ^= x <<  5u;
+    AppCheck_RandState = x;
+
+    return (x);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_MagRound()
+*
+* Description : Run every worker of the magazine check, each on its own thread, & wait for them.
+*
+* Argument(s) : mode        What the workers do (APP_CHECK_MAG_MODE_...).
+*
+* Return(s)   : Wall-clock time of the round, in milliseconds.
+*
+* Note(s)     : (1) The checks & the first failure of each worker are added to those of the run once every
+*                   thread is joined.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  double  AppCheck_MagRound (CPU_INT08U  mode)
+{
+    APP_CHECK_MAG_WORKER  *p_worker;
+    CPU_INT32U             i;
+    double                 start;
+#ifdef  _WIN32
+    HANDLE                 threads[APP_CHECK_MAG_THREAD_MAX];
+#else
+    pthread_t              threads[APP_CHECK_MAG_THREAD_MAX];
+#endif
+
+
+    for (i = 0u; i < AppCheck_MagThreadNbr; i++) {
+        AppCheck_MagWorkerTbl[i].Mode = mode;
+    }
+
+    start = AppCheck_MagMsGet();
+    for (i = 1u; i < AppCheck_MagThreadNbr; i++) {              /* The calling thread is worker 0.                      */
+        p_worker = &AppCheck_MagWorkerTbl[i];
+#ifdef  _WIN32
+        threads[i] = CreateThread((LPSECURITY_ATTRIBUTES)0, 0u, AppCheck_MagThread, p_worker, 0u, (LPDWORD)0);
+#else
+        (void)pthread_create(&threads[i], (const pthread_attr_t *)0, AppCheck_MagThread, p_worker);
+#endif
+    }
+    AppCheck_MagWorker(&AppCheck_MagWorkerTbl[0]);
+    for (i = 1u; i < AppCheck_MagThreadNbr; i++) {
+#ifdef  _WIN32
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        (void)pthread_join(threads[i], (void **)0);
+#endif
+    }
+    start = AppCheck_MagMsGet() - start;
+
+    for (i = 0u; i < AppCheck_MagThreadNbr; i++) {              /* See Note #1.                                         */
+        p_worker         = &AppCheck_MagWorkerTbl[i];
+        AppCheck_ChkNbr += p_worker->ChkNbr;
+        p_worker->ChkNbr = 0u;
+        if (p_worker->FailWhatPtr != (const CPU_CHAR *)0) {
+            AppCheck_Fail(p_worker->FailWhatPtr, p_worker->FailVal, p_worker->FailValExp);
+            p_worker->FailWhatPtr = (const CPU_CHAR *)0;
+        }
+    }
+
+    return (start);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_MagWorker()
+*
+* Description : Worker of the magazine check : gets & frees blocks through its magazine.
+*
+* Argument(s) : p_worker    Pointer to the worker.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A worker holds between 0 & APP_CHECK_MAG_HELD_MAX blocks, more than its magazine caches,
+*                   so that the magazine is emptied & refilled, & filled & drained, all along the round.
+*
+*               (2) Workers share the pool & the counters read by AppCheck_MagAvailChk() only; a magazine is
+*                   used by the thread of its worker alone (see 'lib_mem.h  DYNAMIC MEMORY POOL MAGAZINE
+*                   DATA TYPE  Note #1').
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  void  AppCheck_MagWorker (APP_CHECK_MAG_WORKER  *p_worker)
+{
+    CPU_INT32U   op;
+    CPU_BOOLEAN  get;
+    CPU_BOOLEAN  ok;
+
+
+    switch (p_worker->Mode) {
+        case APP_CHECK_MAG_MODE_CHK:                            /* See Note #1.                                         */
+             ok = DEF_OK;
+             for (op = 0u; (op < APP_CHECK_MAG_OP_NBR) && (ok == DEF_OK); op++) {
+                 if (p_worker->BlkNbr == 0u) {
+                     get = DEF_YES;
+                 } else if (p_worker->BlkNbr >= APP_CHECK_MAG_HELD_MAX) {
+                     get = DEF_NO;
+                 } else {
+                     get = ((AppCheck_MagRand(p_worker) & 1u) != 0u) ? DEF_YES : DEF_NO;
+                 }
+                 if (get == DEF_YES) {
+                     ok = AppCheck_MagGet(p_worker);
+                 } else {
+                     ok = AppCheck_MagFree(p_worker, AppCheck_MagRand(p_worker) % p_worker->BlkNbr);
+                 }
+                 if ((ok == DEF_OK) &&
+                     ((op % APP_CHECK_MAG_CHK_RATE) == 0u)) {
+                     ok = AppCheck_MagAvailChk(p_worker);
+                 }
+             }
+             break;
+
+        case APP_CHECK_MAG_MODE_FREE:
+             ok = DEF_OK;
+             while ((p_worker->BlkNbr > 0u) && (ok == DEF_OK)) {
+                 ok = AppCheck_MagFree(p_worker, p_worker->BlkNbr - 1u);
+             }
+             break;
+
+        case APP_CHECK_MAG_MODE_TIME_MAG:
+        case APP_CHECK_MAG_MODE_TIME_POOL:
+        default:
+             AppCheck_MagTime(p_worker);
+             break;
+    }
+}
+#endif
+
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+#ifdef  _WIN32
+static  DWORD WINAPI  AppCheck_MagThread (LPVOID  p_arg)
+{
+    AppCheck_MagWorker((APP_CHECK_MAG_WORKER *)p_arg);
+
+    return (0u);
+}
+#else
+static  void  *AppCheck_MagThread (void  *p_arg)
+{
+    AppCheck_MagWorker((APP_CHECK_MAG_WORKER *)p_arg);
+
+    return ((void *)0);
+}
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_MagGet()
+*
+* Description : Get a block through the magazine of a worker & check that no other worker holds it.
+*
+* Argument(s) : p_worker    Pointer to the worker.
+*
+* Return(s)   : DEF_OK,   if the block is a free block of the pool.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) 'HeldHi' counts the block before the call & 'HeldLo' after it, in the critical section, so
+*                   that the blocks the worker holds for the pool are between the two whenever another
+*                   worker reads them (see AppCheck_MagAvailChk()).
+*
+*               (2) The pool is larger than what every worker can hold & cache, so a get never finds it
+*                   empty.
+*
+*               (3) A block holds the index of its worker, plus 1, past the link of the free lists while it is
+*                   held, & 0 while it is free.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MagGet (APP_CHECK_MAG_WORKER  *p_worker)
+{
+    CPU_INT08U  *p_blk;
+    CPU_INT32U  *p_tag;
+    LIB_ERR      err;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+    p_worker->HeldHi++;
+    CPU_CRITICAL_EXIT();
+    p_blk = (CPU_INT08U *)Mem_DynPoolMagBlkGet(&p_worker->Mag, &err);
+    CPU_CRITICAL_ENTER();
+    if (err == LIB_MEM_ERR_NONE) {
+        p_worker->HeldLo++;
+    } else {
+        p_worker->HeldHi--;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((AppCheck_MagEq(p_worker, "Mem_DynPoolMagBlkGet()", err, LIB_MEM_ERR_NONE) != DEF_OK) ||  /* See Note #2.  */
+        (AppCheck_MagEq(p_worker,
+                        "block of Mem_DynPoolMagBlkGet() in the segment of the pool",
+                        ((p_blk >= (CPU_INT08U *)&AppCheck_MagStor[0]) &&
+                         (p_blk <  (CPU_INT08U *)&AppCheck_MagStor[APP_CHECK_MAG_STOR_SIZE])) ? DEF_YES : DEF_NO,
+                        DEF_YES) != DEF_OK)) {
+        return (DEF_FAIL);
+    }
+    p_tag = (CPU_INT32U *)(p_blk + APP_CHECK_MAG_TAG_OFFSET);   /* See Note #3.                                         */
+    if (AppCheck_MagEq(p_worker, "worker holding a block given by Mem_DynPoolMagBlkGet()", *p_tag, 0u) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+   *p_tag = p_worker->Ix + 1u;
+    p_worker->BlkTbl[p_worker->BlkNbr] = p_blk;
+    p_worker->BlkNbr++;
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_MagFree()
+*
+* Description : Free a block held by a worker through its magazine.
+*
+* Argument(s) : p_worker    Pointer to the worker.
+*
+*               ix          Index of the block in the blocks held by the worker.
+*
+* Return(s)   : DEF_OK,   if the block was still the worker's & the magazine took it.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) 'HeldLo' drops before the call & 'HeldHi' after it (see 'AppCheck_MagGet()  Note #1').
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MagFree (APP_CHECK_MAG_WORKER  *p_worker,
+                                       CPU_INT32U             ix)
+{
+    CPU_INT08U  *p_blk;
+    CPU_INT32U  *p_tag;
+    LIB_ERR      err;
+    CPU_SR_ALLOC();
+
+
+    p_blk = p_worker->BlkTbl[ix];
+    p_tag = (CPU_INT32U *)(p_blk + APP_CHECK_MAG_TAG_OFFSET);
+    if (AppCheck_MagEq(p_worker, "worker holding a block before it is freed", *p_tag, p_worker->Ix + 1u) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+   *p_tag = 0u;
+    p_worker->BlkNbr--;
+    p_worker->BlkTbl[ix] = p_worker->BlkTbl[p_worker->BlkNbr];
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+    p_worker->HeldLo--;
+    CPU_CRITICAL_EXIT();
+    Mem_DynPoolMagBlkFree(&p_worker->Mag, p_blk, &err);
+    CPU_CRITICAL_ENTER();
+    p_worker->HeldHi--;
+    CPU_CRITICAL_EXIT();
+
+    return (AppCheck_MagEq(p_worker, "Mem_DynPoolMagBlkFree()", err, LIB_MEM_ERR_NONE));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        AppCheck_MagAvailChk()
+*
+* Description : Check the blocks available in the pool while the other workers run.
+*
+* Argument(s) : p_worker    Pointer to the worker.
+*
+* Return(s)   : DEF_OK,   if Mem_DynPoolBlkNbrAvailGet() is within the blocks the workers hold.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The pool & the counters of the workers are read in one critical section, which the
+*                   pool service enters again : the critical section of the Win32 port is recursive.  The
+*                   blocks available must then be APP_CHECK_MAG_BLK_NBR less what the workers hold, i.e.
+*                   between APP_CHECK_MAG_BLK_NBR less the sum of 'HeldHi' & APP_CHECK_MAG_BLK_NBR less the
+*                   sum of 'HeldLo' (see 'AppCheck_MagGet()  Note #1').  A block cached by a magazine counts as
+*                   available (see 'lib_mem.c  Mem_DynPoolBlkNbrAvailGet()  Note #1').
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MagAvailChk (APP_CHECK_MAG_WORKER  *p_worker)
+{
+    CPU_SIZE_T  avail;
+    CPU_INT32U  held_lo;
+    CPU_INT32U  held_hi;
+    CPU_INT32U  i;
+    LIB_ERR     err;
+    CPU_SR_ALLOC();
+
+
+    held_lo = 0u;
+    held_hi = 0u;
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+    avail = Mem_DynPoolBlkNbrAvailGet(&AppCheck_MagPool, &err);
+    for (i = 0u; i < AppCheck_MagThreadNbr; i++) {
+        held_lo += AppCheck_MagWorkerTbl[i].HeldLo;
+        held_hi += AppCheck_MagWorkerTbl[i].HeldHi;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((AppCheck_MagEq(p_worker, "Mem_DynPoolBlkNbrAvailGet()", err, LIB_MEM_ERR_NONE) != DEF_OK) ||
+        (AppCheck_MagEq(p_worker,                               /* Expected : the nearest bound if out of them.         */
+                        "Mem_DynPoolBlkNbrAvailGet() while the workers run",
+                        (CPU_INT32U)avail,
+                        DEF_MIN(DEF_MAX((CPU_INT32U)avail, APP_CHECK_MAG_BLK_NBR - held_hi),
+                                APP_CHECK_MAG_BLK_NBR - held_lo)) != DEF_OK)) {
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_MagTime()
+*
+* Description : Get & free APP_CHECK_MAG_TIME_OP_NBR blocks, in bursts of APP_CHECK_MAG_TIME_BURST, through
+*               the magazine of a worker or straight from the pool.
+*
+* Argument(s) : p_worker    Pointer to the worker.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  void  AppCheck_MagTime (APP_CHECK_MAG_WORKER  *p_worker)
+{
+    void        *blk_tbl[APP_CHECK_MAG_TIME_BURST];
+    CPU_INT32U   op;
+    CPU_INT32U   i;
+    LIB_ERR      err;
+
+
+    for (op = 0u; op < APP_CHECK_MAG_TIME_OP_NBR; op += APP_CHECK_MAG_TIME_BURST) {
+        for (i = 0u; i < APP_CHECK_MAG_TIME_BURST; i++) {
+            if (p_worker->Mode == APP_CHECK_MAG_MODE_TIME_MAG) {
+                blk_tbl[i] = Mem_DynPoolMagBlkGet(&p_worker->Mag, &err);
+            } else {
+                blk_tbl[i] = Mem_DynPoolBlkGet(&AppCheck_MagPool, &err);
+            }
+            if (AppCheck_MagEq(p_worker, "get of a timed round", err, LIB_MEM_ERR_NONE) != DEF_OK) {
+                return;
+            }
+        }
+        for (i = 0u; i < APP_CHECK_MAG_TIME_BURST; i++) {
+            if (p_worker->Mode == APP_CHECK_MAG_MODE_TIME_MAG) {
+                Mem_DynPoolMagBlkFree(&p_worker->Mag, blk_tbl[i], &err);
+            } else {
+                Mem_DynPoolBlkFree(&AppCheck_MagPool, blk_tbl[i], &err);
+            }
+            if (AppCheck_MagEq(p_worker, "free of a timed round", err, LIB_MEM_ERR_NONE) != DEF_OK) {
+                return;
+            }
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_MagCmp()
+*
+* Description : Compare the blocks available in the pool with the blocks the workers hold, while no worker
+*               runs.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if Mem_DynPoolBlkNbrAvailGet() is exact & no worker failed.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MagCmp (void)
+{
+    APP_CHECK_MAG_WORKER  *p_worker;
+    CPU_SIZE_T             avail;
+    CPU_INT32U             held;
+    CPU_INT32U             i;
+    LIB_ERR                err;
+
+
+    if (AppCheck_FailWhatPtr != (const CPU_CHAR *)0) {          /* A worker failed.                                     */
+        return (DEF_FAIL);
+    }
+
+    held = 0u;
+    for (i = 0u; i < AppCheck_MagThreadNbr; i++) {
+        p_worker = &AppCheck_MagWorkerTbl[i];
+        if ((AppCheck_Eq("'HeldLo' of a worker between rounds", p_worker->HeldLo, p_worker->BlkNbr) != DEF_OK) ||
+            (AppCheck_Eq("'HeldHi' of a worker between rounds", p_worker->HeldHi, p_worker->BlkNbr) != DEF_OK)) {
+            return (DEF_FAIL);
+        }
+        held += p_worker->BlkNbr;
+    }
+
+    avail = Mem_DynPoolBlkNbrAvailGet(&AppCheck_MagPool, &err);
+    if ((AppCheck_Eq("Mem_DynPoolBlkNbrAvailGet()", err, LIB_MEM_ERR_NONE) != DEF_OK) ||
+        (AppCheck_Eq("Mem_DynPoolBlkNbrAvailGet() between rounds",
+                     (CPU_INT32U)avail,
+                     APP_CHECK_MAG_BLK_NBR - held) != DEF_OK)) {
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_MagRpt()
+*
+* Description : Print the result of the magazine check.
+*
+* Argument(s) : thread_nbr  Number of threads.
+*
+*               ms_mag      Time of the timed round through the magazines, in milliseconds.
+*
+*               ms_pool     Time of the timed round straight from the pool, in milliseconds.
+*
+* Return(s)   : DEF_OK,   if every check passed.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The times compare the two ways of getting blocks on the same host only; the critical
+*                   section of the Win32 port is far slower than disabling interrupts on a target.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MagRpt (CPU_INT32U  thread_nbr,
+                                      double      ms_mag,
+                                      double      ms_pool)
+{
+    if (AppCheck_FailWhatPtr != (const CPU_CHAR *)0) {
+        printf("FAIL\tMem_DynPoolMag\tafter %u check(s)\n", (unsigned)AppCheck_ChkNbr);
+        printf("\t%s : expected %u, got %u\n",
+               AppCheck_FailWhatPtr,
+               (unsigned)AppCheck_FailValExp,
+               (unsigned)AppCheck_FailVal);
+        return (DEF_FAIL);
+    }
+
+    printf("PASS\tMem_DynPoolMag\t%u check(s)\n", (unsigned)AppCheck_ChkNbr);
+    printf("\t%u thread(s), %u gets & frees each : %.1f ms through the magazines, %.1f ms from the pool\n",
+           (unsigned)thread_nbr,
+           (unsigned)APP_CHECK_MAG_TIME_OP_NBR,
+           ms_mag,
+           ms_pool);
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_MagEq()
+*
+* Description : Count one comparison of a worker & record it if it is the first one of the worker to fail.
+*
+* Argument(s) : p_worker    Pointer to the worker.
+*
+*               p_what      What was compared.
+*
+*               val         Value observed.
+*
+*               val_exp     Value expected.
+*
+* Return(s)   : DEF_OK,   if 'val' is equal to 'val_exp'.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Each worker counts in its own fields, as AppCheck_Eq() is not thread-safe.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MagEq (       APP_CHECK_MAG_WORKER  *p_worker,
+                                     const  CPU_CHAR              *p_what,
+                                            CPU_INT32U             val,
+                                            CPU_INT32U             val_exp)
+{
+    p_worker->ChkNbr++;
+    if (val == val_exp) {
+        return (DEF_OK);
+    }
+    if (p_worker->FailWhatPtr == (const CPU_CHAR *)0) {
+        p_worker->FailWhatPtr = p_what;
+        p_worker->FailVal     = val;
+        p_worker->FailValExp  = val_exp;
+    }
+
+    return (DEF_FAIL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_MagRand()
+*
+* Description : Next random number of a worker.
+*
+* Argument(s) : p_worker    Pointer to the worker.
+*
+* Return(s)   : A 32-bit random number.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  CPU_INT32U  AppCheck_MagRand (APP_CHECK_MAG_WORKER  *p_worker)
+{
+    CPU_INT32U  x;
+
+
+    x                   = p_worker->RandState;                  /* xorshift32, as AppCheck_Rand().                      */
+    x                  ^= x << 13u;
+    x                  ^= x >> 17u;
+    x                  ^= x <<  5u;
+    p_worker->RandState = x;
+
+    return (x);
+}
+#endif
+
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static  double  AppCheck_MagMsGet (void)                        /* Wall-clock time, as AppFuzz_MsGet().                 */
+{
+#ifdef  _WIN32
+    LARGE_INTEGER    freq;
+    LARGE_INTEGER    ctr;
+
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&ctr);
+    return ((double)ctr.QuadPart * 1000.0 / (double)freq.QuadPart);
+#else
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0);
+#endif
+}
+#endif
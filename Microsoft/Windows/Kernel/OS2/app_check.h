@@ -0,0 +1,128 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                        KERNEL SERVICE CHECKS
+*
+* Filename : app_check.h
+*
+* Note(s)  : (1) The kernel is started with a check task instead of the task set, & each case below calls
+*                kernel services from tasks & compares what they do with what is expected :
+*
+*                    OSTmr         Random one-shot & periodic timers started, restarted, stopped &
+*                                  deleted on the hierarchical timer wheel (OS_TMR_CFG_WHEEL_HIER_EN),
+*                                  with delays reaching every level of the wheel & runs that cross the
+*                                  wrap-around of OSTmrTime.  Every callback must come at the match
+*                                  time of a reference model, & OSTmrRemainGet() must agree with it.
+*
+*                    OSMemSlab     Requests of random sizes to two slab allocators with three partitions,
+*                                  one without & one with OS_MEM_SLAB_OPT_FALLBACK, & releases of the
+*                                  blocks given.  The partition serving each request & the statistics of
+*                                  OSMemSlabQuery() must match a reference model of the size classes, &
+*                                  OSMemSlabPut() must reject addresses that are not blocks it gave.
+*
+*                    OSQBuf        Random buffers got, retained, released & sent to a helper task that
+*                                  posts them back, keeps them or releases them.  Lengths, contents &
+*                                  free blocks must match a reference model, & a task must not release
+*                                  or post a buffer it gave away.  Then a full queue, a message that is
+*                                  not a buffer, a timeout & the largest number of references.
+*
+*                    OSEventSet    A semaphore, a mailbox & a queue in a set, posted, accepted, removed
+*                                  from the set & added back at random while the check task waits on the
+*                                  set.  The events returned & their order must match a reference model
+*                                  of the list of ready events.  Then the errors, a timeout, an event
+*                                  accepted by another task while in the list, a post to a task waiting
+*                                  on the event itself & the deletion of a set & of its events.
+*
+*                A case is skipped when the services it checks are disabled in 'os_cfg.h'.
+*
+*            (2) Random choices come from a seed given on the command line, so that a failing run can be
+*                repeated.  A failure prints what was observed & what was expected.
+*
+*            (3) AppCheck_MagRun() checks the magazines of a dynamic memory pool of uC/LIB (see 'lib_mem.h
+*                DYNAMIC MEMORY POOL MAGAZINE DATA TYPE'), without the kernel, from several host threads at
+*                once.  Each thread gets & frees random blocks through its own magazine, so that magazines are
+*                refilled from & drained to the pool concurrently.  No block may be given to two threads, &
+*                Mem_DynPoolBlkNbrAvailGet() must stay exact : within the blocks the threads hold while they
+*                run, & equal to the blocks they do not hold between rounds.  A timed round then gets & frees
+*                the same number of blocks through the magazines & straight from the pool.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CHECK_H
+#define  APP_CHECK_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CHECK_SEED_DFLT                            1u      /* Seed when none is given.                             */
+#define  APP_CHECK_STK_SIZE                           512u      /* Stack of a task, in OS_STK.                          */
+
+                                                                /* ---------------------- OSTmr ---------------------- */
+#define  APP_CHECK_TMR_NBR                              8u      /* Timers of the case, at most OS_TMR_CFG_MAX.          */
+#define  APP_CHECK_TMR_RUN_NBR                          4u      /* Runs, each from another OSTmrTime (see Note #1).     */
+#define  APP_CHECK_TMR_UPDATE_NBR                   20000u      /* Timer wheel updates per run.                         */
+
+                                                                /* -------------------- OSMemSlab -------------------- */
+#define  APP_CHECK_MEM_SLAB_OP_NBR                  20000u      /* Requests & releases per slab allocator.              */
+
+                                                                /* ---------------------- OSQBuf --------------------- */
+#define  APP_CHECK_Q_BUF_OP_NBR                     20000u      /* Random steps.                                        */
+
+                                                                /* -------------------- OSEventSet ------------------- */
+#define  APP_CHECK_EVENT_SET_OP_NBR                 20000u      /* Random steps.                                        */
+
+                                                                /* ------------------ Mem_DynPoolMag ----------------- */
+#define  APP_CHECK_MAG_THREAD_NBR_DFLT                  4u      /* Threads when none is given.                          */
+#define  APP_CHECK_MAG_THREAD_MAX                      16u
+#define  APP_CHECK_MAG_ROUND_NBR                       64u      /* Rounds, see 'app_check.c  AppCheck_MagRun()'.        */
+#define  APP_CHECK_MAG_OP_NBR                        5000u      /* Gets & frees of a thread per round.                  */
+#define  APP_CHECK_MAG_TIME_OP_NBR                1000000u      /* Gets & frees of a thread in a timed round.           */
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void         AppCheck_Run    (CPU_INT32U  seed);
+
+CPU_BOOLEAN  AppCheck_MagRun (CPU_INT32U  thread_nbr,
+                              CPU_INT32U  seed);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
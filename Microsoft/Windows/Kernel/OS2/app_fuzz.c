@@ -0,0 +1,1337 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                   DIFFERENTIAL SCHEDULE FUZZER
+*
+* Filename : app_fuzz.c
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <math.h>
+
+#include  "app_fuzz.h"
+
+#ifdef   _WIN32
+#include  <windows.h>
+#else
+#include  <pthread.h>
+#include  <time.h>
+#include  <unistd.h>
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_FUZZ_SHRINK_OP_NBR                        11u      /* Shrinking steps tried on each task.                  */
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_fuzz_ctx {                                 /* State of one AppFuzz_Check().                        */
+    APP_SIM           Sim;
+    CPU_INT32S        Bound[APP_SIM_TASK_MAX];                  /* Blocking bound, per task in priority order.          */
+    CPU_INT32S        Rta[APP_SIM_TASK_MAX];                    /* Response-time bound, -1 if not schedulable.          */
+    CPU_INT32U        InvTicks[APP_SIM_TASK_MAX];               /* Ticks the current job spent behind lower tasks.      */
+    APP_FUZZ_RESULT  *ResultPtr;
+} APP_FUZZ_CTX;
+
+
+typedef  struct  app_fuzz_worker {
+    CPU_INT32U      Ix;                                         /* Worker 'Ix' runs cases Ix, Ix + ThreadNbr, ...       */
+    CPU_INT32U      ThreadNbr;
+    CPU_INT32U      CaseNbr;
+    CPU_INT32U      Seed;
+    CPU_INT32U      InvCtr[APP_FUZZ_INV_NBR];
+    CPU_INT32U      FailNbr;
+    APP_FUZZ_FAIL   Fail[APP_FUZZ_FAIL_MAX];                    /* First failing cases of this worker, shrunk.          */
+} APP_FUZZ_WORKER;
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT16U  AppFuzz_PeriodTbl[] = {             /* Divisors of 120, so that hyperperiods stay short.    */
+    4u, 5u, 6u, 8u, 10u, 12u, 15u, 20u, 24u, 30u, 40u, 60u
+};
+
+static  const  CPU_CHAR  *AppFuzz_InvNameTbl[APP_FUZZ_INV_NBR] = {
+    "BLOCKING", "BLOCKING_T", "DEADLOCK", "RESPONSE", "RDY_TBL", "TCB", "DEADLINE"
+};
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U   AppFuzz_Rand      (       CPU_INT32U       *p_state);
+
+static  CPU_INT32U   AppFuzz_SeedGet   (       CPU_INT32U        seed,
+                                               CPU_INT32U        case_ix);
+
+static  void         AppFuzz_PtsGet    (       CPU_INT32U       *p_state,
+                                               CPU_INT32U        hi,
+                                               CPU_INT08U       *p_pts,
+                                               CPU_INT32U        pts_nbr);
+
+static  CPU_BOOLEAN  AppFuzz_SetValid  (const  task_para_set    *p_tasks,
+                                               CPU_INT32U        task_nbr);
+
+static  CPU_INT32U   AppFuzz_EndTimeGet(const  task_para_set    *p_tasks,
+                                               CPU_INT32U        task_nbr);
+
+static  void         AppFuzz_BoundCalc (       APP_FUZZ_CTX     *p_ctx);
+
+static  void         AppFuzz_Fail      (       APP_FUZZ_CTX     *p_ctx,
+                                               CPU_INT08U        inv,
+                                               CPU_INT16U        task_id,
+                                               CPU_INT16U        job,
+                                               CPU_INT32S        bound,
+                                               CPU_INT32S        val);
+
+static  void         AppFuzz_EventChk  (       void             *p_arg,
+                                        const  APP_TSB_EVENT    *p_event);
+
+static  void         AppFuzz_TickChk   (       APP_FUZZ_CTX     *p_ctx);
+
+static  CPU_BOOLEAN  AppFuzz_Mutate    (       task_para_set    *p_tasks,
+                                               CPU_INT32U       *p_task_nbr,
+                                               CPU_INT32U        op_ix);
+
+static  void         AppFuzz_Worker    (       APP_FUZZ_WORKER  *p_worker);
+
+#ifdef  _WIN32
+static  DWORD WINAPI AppFuzz_Thread    (       LPVOID            p_arg);
+#else
+static  void        *AppFuzz_Thread    (       void             *p_arg);
+#endif
+
+static  void         AppFuzz_FailPrint (const  APP_FUZZ_FAIL    *p_fail);
+
+static  void         AppFuzz_ResultPrint(const  APP_FUZZ_RESULT  *p_result);
+
+static  CPU_INT32U   AppFuzz_CPU_NbrGet(       void);
+
+static  double       AppFuzz_MsGet     (       void);
+
+
+/*
+*********************************************************************************************************
+*                                            AppFuzz_Gen()
+*
+* Description : Generate a random task set.
+*
+* Argument(s) : seed        Seed of the set.
+*
+*               p_tasks     Array of APP_FUZZ_TASK_NBR_MAX entries to fill, in file order.
+*
+* Return(s)   : Number of tasks.
+*
+* Note(s)     : (1) Utilizations are drawn with UUniFast for a total between APP_FUZZ_UTIL_MIN and
+*                   APP_FUZZ_UTIL_MAX percent, so that both schedulable & overloaded sets are covered.
+*
+*               (2) Critical sections follow the shape of the hand-written task sets : a section starts
+*                   after the first tick & ends before the last one, since task() never locks or unlocks
+*                   at either end of a job, and two sections are either nested or disjoint.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  AppFuzz_Gen (CPU_INT32U      seed,
+                         task_para_set  *p_tasks)
+{
+    task_para_set  *p_task;
+    CPU_INT32U      state;
+    CPU_INT32U      task_nbr;
+    CPU_INT32U      exec;
+    CPU_INT32U      period;
+    CPU_INT32U      i;
+    CPU_INT08U      pts[4];
+    CPU_INT08U      res_first;
+    double          util_sum;
+    double          util_next;
+    double          util;
+
+
+    state    = (seed != 0u) ? seed : 1u;
+    task_nbr = 1u + AppFuzz_Rand(&state) % APP_FUZZ_TASK_NBR_MAX;
+    util_sum = (double)(APP_FUZZ_UTIL_MIN + AppFuzz_Rand(&state) % (APP_FUZZ_UTIL_MAX - APP_FUZZ_UTIL_MIN + 1u)) / 100.0;
+
+    Mem_Clr(p_tasks, task_nbr * sizeof(task_para_set));
+    for (i = 0u; i < task_nbr; i++) {
+        if ((i + 1u) < task_nbr) {                              /* See Note #1.                                         */
+            util_next = util_sum * pow((double)(AppFuzz_Rand(&state) % 10000u) / 10000.0, 1.0 / (double)(task_nbr - i - 1u));
+            util      = util_sum - util_next;
+            util_sum  = util_next;
+        } else {
+            util      = util_sum;
+        }
+
+        period = AppFuzz_PeriodTbl[AppFuzz_Rand(&state) % (sizeof(AppFuzz_PeriodTbl) / sizeof(AppFuzz_PeriodTbl[0]))];
+        exec   = (CPU_INT32U)(util * (double)period + 0.5);
+        if (exec < 1u) {
+            exec = 1u;
+        } else if (exec > period) {
+            exec = period;
+        }
+
+        p_task                    = &p_tasks[i];
+        p_task->TaskID            = (INT16U)(i + 1u);
+        p_task->TaskExecutionTime = (INT16U)exec;
+        p_task->TaskPeriodic      = (INT16U)period;
+        if ((AppFuzz_Rand(&state) & 1u) != 0u) {
+            p_task->TaskArriveTime = (INT16U)(AppFuzz_Rand(&state) % period);
+        }
+
+        if (exec < 3u) {                                        /* See Note #2.                                         */
+            continue;
+        }
+        switch (AppFuzz_Rand(&state) % 4u) {
+            case 0u:                                            /* No resource.                                         */
+                 break;
+
+            case 1u:                                            /* One resource.                                        */
+                 AppFuzz_PtsGet(&state, exec - 1u, pts, 2u);
+                 if ((AppFuzz_Rand(&state) & 1u) != 0u) {
+                     p_task->R1_start = pts[0];
+                     p_task->R1_end   = pts[1];
+                 } else {
+                     p_task->R2_start = pts[0];
+                     p_task->R2_end   = pts[1];
+                 }
+                 break;
+
+            default:                                            /* Both resources, nested or disjoint.                  */
+                 if (exec < 5u) {
+                     break;
+                 }
+                 AppFuzz_PtsGet(&state, exec - 1u, pts, 4u);
+                 res_first = (CPU_INT08U)(AppFuzz_Rand(&state) & 1u);
+                 if ((AppFuzz_Rand(&state) & 1u) != 0u) {
+                     p_task->R1_start = pts[0];
+                     p_task->R1_end   = pts[3];
+                     p_task->R2_start = pts[1];
+                     p_task->R2_end   = pts[2];
+                 } else {
+                     p_task->R1_start = pts[0];
+                     p_task->R1_end   = pts[1];
+                     p_task->R2_start = pts[2];
+                     p_task->R2_end   = pts[3];
+                 }
+                 if (res_first != 0u) {                         /* Swap the roles of R1 & R2.                           */
+                     pts[0]           = p_task->R1_start;
+                     pts[1]           = p_task->R1_end;
+                     p_task->R1_start = p_task->R2_start;
+                     p_task->R1_end   = p_task->R2_end;
+                     p_task->R2_start = pts[0];
+                     p_task->R2_end   = pts[1];
+                 }
+                 break;
+        }
+    }
+
+    return (task_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppFuzz_Check()
+*
+* Description : Run a task set through the model & check every invariant at every tick.
+*
+* Argument(s) : p_tasks     Task set, in file order.
+*
+*               task_nbr    Number of tasks.
+*
+*               p_result    Pointer to the result; 'Inv' is APP_FUZZ_INV_NONE if no invariant is violated.
+*
+* Return(s)   : DEF_OK,   if no invariant is violated (or the set cannot be loaded).
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The set runs for one hyperperiod past its last arrival, up to APP_FUZZ_END_TIME_MAX.
+*
+*               (2) The interval that starts at 'Time' is charged to the task that runs once the model is
+*                   idle again, as OSTimeTick() charges it to OSPrioCur.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppFuzz_Check (const  task_para_set    *p_tasks,
+                                   CPU_INT32U        task_nbr,
+                                   APP_FUZZ_RESULT  *p_result)
+{
+    APP_FUZZ_CTX  *p_ctx;
+    CPU_INT08U     err;
+
+
+    Mem_Clr(p_result, sizeof(APP_FUZZ_RESULT));
+    p_result->Inv   = APP_FUZZ_INV_NONE;
+    p_result->Bound = -1;
+
+    p_ctx = (APP_FUZZ_CTX *)malloc(sizeof(APP_FUZZ_CTX));
+    if (p_ctx == (APP_FUZZ_CTX *)0) {
+        return (DEF_OK);
+    }
+    Mem_Clr(p_ctx, sizeof(APP_FUZZ_CTX));
+    p_ctx->ResultPtr = p_result;
+
+    if (AppSim_Init(&p_ctx->Sim, p_tasks, task_nbr, AppFuzz_EndTimeGet(p_tasks, task_nbr), AppFuzz_EventChk, p_ctx) != DEF_OK) {
+        err = p_ctx->Sim.Err;
+    } else {
+        AppFuzz_BoundCalc(p_ctx);                               /* Nothing is printed before the first tick.            */
+        AppFuzz_TickChk(p_ctx);                                 /* See Note #2.                                         */
+        while ((p_result->Inv == APP_FUZZ_INV_NONE) &&
+               (AppSim_Tick(&p_ctx->Sim) == DEF_YES)) {
+            AppFuzz_TickChk(p_ctx);
+        }
+        err = p_ctx->Sim.Err;
+    }
+
+    if (p_result->Inv == APP_FUZZ_INV_NONE) {
+        if (err == APP_SIM_ERR_LIVELOCK) {
+            AppFuzz_Fail(p_ctx, APP_FUZZ_INV_DEADLOCK, 0u, 0u, -1, (CPU_INT32S)p_ctx->Sim.CtxSwCtr);
+        } else if (err == APP_SIM_ERR_TCB_INVALID) {
+            AppFuzz_Fail(p_ctx, APP_FUZZ_INV_TCB, 0u, 0u, -1, (CPU_INT32S)p_ctx->Sim.PrioCur);
+        }
+    }
+    free(p_ctx);
+
+    return ((p_result->Inv == APP_FUZZ_INV_NONE) ? DEF_OK : DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppFuzz_Shrink()
+*
+* Description : Reduce a failing task set to a minimal one that still violates the same invariant.
+*
+* Argument(s) : p_tasks     Failing task set, in file order; replaced by the minimal set.
+*
+*               task_nbr    Number of tasks.
+*
+*               p_result    Result of the failing set; replaced by the result of the minimal set.
+*
+* Return(s)   : Number of tasks of the minimal set.
+*
+* Note(s)     : (1) Each step removes a task, drops or shortens a critical section, moves an arrival to 0,
+*                   or lowers an execution time or a period.  Steps are retried until none applies, so the
+*                   result is minimal with respect to every single step.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  AppFuzz_Shrink (task_para_set    *p_tasks,
+                            CPU_INT32U        task_nbr,
+                            APP_FUZZ_RESULT  *p_result)
+{
+    task_para_set    tasks[APP_SIM_TASK_MAX];
+    APP_FUZZ_RESULT  result;
+    CPU_INT32U       nbr;
+    CPU_INT32U       op_ix;
+    CPU_BOOLEAN      progress;
+
+
+    if (p_result->Inv == APP_FUZZ_INV_NONE) {
+        return (task_nbr);
+    }
+
+    do {
+        progress = DEF_NO;
+        for (op_ix = 0u; op_ix < task_nbr * APP_FUZZ_SHRINK_OP_NBR; op_ix++) {
+            Mem_Copy(tasks, p_tasks, task_nbr * sizeof(task_para_set));
+            nbr = task_nbr;
+            if ((AppFuzz_Mutate(tasks, &nbr, op_ix)  == DEF_YES) &&
+                (AppFuzz_SetValid(tasks, nbr)          == DEF_YES) &&
+                (AppFuzz_Check(tasks, nbr, &result)    == DEF_FAIL) &&
+                (result.Inv == p_result->Inv)) {
+                Mem_Copy(p_tasks, tasks, nbr * sizeof(task_para_set));
+                task_nbr  = nbr;
+               *p_result  = result;
+                progress  = DEF_YES;
+            }
+        }
+    } while (progress == DEF_YES);
+
+    return (task_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppFuzz_Run()
+*
+* Description : Check many random task sets on every core & report the failing ones.
+*
+* Argument(s) : case_nbr    Number of task sets.
+*
+*               seed        Run seed.
+*
+*               thread_nbr  Number of threads, 0 for one per processor.
+*
+* Return(s)   : Number of failing task sets.
+*
+* Note(s)     : (1) Only the APP_FUZZ_FAIL_MAX failing cases with the lowest indexes are printed; each
+*                   worker shrinks its own first failures, which include those.  The report is therefore
+*                   the same for any number of threads.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  AppFuzz_Run (CPU_INT32U  case_nbr,
+                         CPU_INT32U  seed,
+                         CPU_INT32U  thread_nbr)
+{
+    APP_FUZZ_WORKER  *p_workers;
+    APP_FUZZ_FAIL    *p_best[APP_FUZZ_FAIL_MAX];
+    APP_FUZZ_FAIL    *p_fail;
+    CPU_INT32U        inv_ctr[APP_FUZZ_INV_NBR];
+    CPU_INT32U        fail_nbr;
+    CPU_INT32U        best_nbr;
+    CPU_INT32U        i;
+    CPU_INT32U        k;
+    CPU_INT32U        j;
+    double            start;
+#ifdef  _WIN32
+    HANDLE            threads[APP_FUZZ_THREAD_MAX];
+#else
+    pthread_t         threads[APP_FUZZ_THREAD_MAX];
+#endif
+
+
+    if (thread_nbr == 0u) {
+        thread_nbr = AppFuzz_CPU_NbrGet();
+    }
+    if (thread_nbr > APP_FUZZ_THREAD_MAX) {
+        thread_nbr = APP_FUZZ_THREAD_MAX;
+    }
+    if (thread_nbr > case_nbr) {
+        thread_nbr = case_nbr;
+    }
+    if (thread_nbr == 0u) {
+        thread_nbr = 1u;
+    }
+
+    p_workers = (APP_FUZZ_WORKER *)calloc(thread_nbr, sizeof(APP_FUZZ_WORKER));
+    if (p_workers == (APP_FUZZ_WORKER *)0) {
+        return (0u);
+    }
+
+    start = AppFuzz_MsGet();
+    for (i = 0u; i < thread_nbr; i++) {
+        p_workers[i].Ix        = i;
+        p_workers[i].ThreadNbr = thread_nbr;
+        p_workers[i].CaseNbr   = case_nbr;
+        p_workers[i].Seed      = seed;
+    }
+    for (i = 1u; i < thread_nbr; i++) {                         /* The calling thread is worker 0.                      */
+#ifdef  _WIN32
+        threads[i] = CreateThread((LPSECURITY_ATTRIBUTES)0, 0u, AppFuzz_Thread, &p_workers[i], 0u, (LPDWORD)0);
+#else
+        (void)pthread_create(&threads[i], (const pthread_attr_t *)0, AppFuzz_Thread, &p_workers[i]);
+#endif
+    }
+    AppFuzz_Worker(&p_workers[0]);
+    for (i = 1u; i < thread_nbr; i++) {
+#ifdef  _WIN32
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        (void)pthread_join(threads[i], (void **)0);
+#endif
+    }
+
+    Mem_Clr(inv_ctr, sizeof(inv_ctr));
+    fail_nbr = 0u;
+    best_nbr = 0u;
+    for (i = 0u; i < thread_nbr; i++) {                         /* Merge & keep the lowest failing cases (Note #1).     */
+        fail_nbr += p_workers[i].FailNbr;
+        for (k = 0u; k < APP_FUZZ_INV_NBR; k++) {
+            inv_ctr[k] += p_workers[i].InvCtr[k];
+        }
+        for (k = 0u; (k < p_workers[i].FailNbr) && (k < APP_FUZZ_FAIL_MAX); k++) {
+            p_fail = &p_workers[i].Fail[k];
+            for (j = best_nbr; (j > 0u) && (p_best[j - 1u]->CaseIx > p_fail->CaseIx); j--) {
+                if (j < APP_FUZZ_FAIL_MAX) {
+                    p_best[j] = p_best[j - 1u];
+                }
+            }
+            if (j < APP_FUZZ_FAIL_MAX) {
+                p_best[j] = p_fail;
+                if (best_nbr < APP_FUZZ_FAIL_MAX) {
+                    best_nbr++;
+                }
+            }
+        }
+    }
+
+    for (i = 0u; i < best_nbr; i++) {
+        AppFuzz_FailPrint(p_best[i]);
+    }
+    printf("%u case(s), seed 0x%08X, %u thread(s), %u failed, %.3f ms\n",
+           (unsigned)case_nbr, (unsigned)seed, (unsigned)thread_nbr, (unsigned)fail_nbr, AppFuzz_MsGet() - start);
+    for (k = 0u; k < APP_FUZZ_INV_NBR; k++) {
+        printf("\t%-12s %u\n", AppFuzz_InvNameTbl[k], (unsigned)inv_ctr[k]);
+    }
+    free(p_workers);
+
+    return (fail_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppFuzz_CheckFile()
+*
+* Description : Check one task set file, e.g. a reproducer written by AppFuzz_Run().
+*
+* Argument(s) : p_taskset_path  Path of the task set.
+*
+* Return(s)   : DEF_OK,   if no invariant is violated.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppFuzz_CheckFile (const  CPU_CHAR  *p_taskset_path)
+{
+    task_para_set    tasks[APP_SIM_TASK_MAX];
+    APP_FUZZ_RESULT  result;
+    CPU_INT32U       task_nbr;
+
+
+    task_nbr = AppTsb_TaskSetRd(p_taskset_path, tasks, APP_SIM_TASK_MAX);
+    if (task_nbr == 0u) {
+        printf("FAIL\t%s\tcannot read the task set\n", p_taskset_path);
+        return (DEF_FAIL);
+    }
+    if (AppFuzz_Check(tasks, task_nbr, &result) == DEF_OK) {
+        printf("PASS\t%s\n", p_taskset_path);
+        return (DEF_OK);
+    }
+    printf("FAIL\t%s\n", p_taskset_path);
+    AppFuzz_ResultPrint(&result);
+
+    return (DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GENERATION & SHRINKING
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppFuzz_Rand (CPU_INT32U  *p_state)
+{
+    CPU_INT32U  x;
+
+
+    x         = *p_state;                                       /* xorshift32.                                          */
+    x        ^= x << 13u;
+    x        ^= x >> 17u;
+    x        ^= x <<  5u;
+   *p_state   = x;
+
+    return (x);
+}
+
+
+static  CPU_INT32U  AppFuzz_SeedGet (CPU_INT32U  seed,
+                                     CPU_INT32U  case_ix)
+{
+    CPU_INT32U  x;
+
+
+    x  = seed ^ (case_ix * 0x9E3779B9u);                        /* Murmur3 finalizer.                                   */
+    x ^= x >> 16u;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13u;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16u;
+
+    return ((x != 0u) ? x : 1u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppFuzz_PtsGet()
+*
+* Description : Draw distinct points in [1, hi] & sort them.
+*
+* Argument(s) : p_state     Pointer to the generator state.
+*
+*               hi          Highest point; must be >= 'pts_nbr'.
+*
+*               p_pts       Array to fill.
+*
+*               pts_nbr     Number of points.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  AppFuzz_PtsGet (CPU_INT32U  *p_state,
+                              CPU_INT32U   hi,
+                              CPU_INT08U  *p_pts,
+                              CPU_INT32U   pts_nbr)
+{
+    CPU_INT08U  pt;
+    CPU_INT32U  i;
+    CPU_INT32U  k;
+
+
+    for (i = 0u; i < pts_nbr; ) {
+        pt = (CPU_INT08U)(1u + AppFuzz_Rand(p_state) % hi);
+        for (k = i; (k > 0u) && (p_pts[k - 1u] > pt); k--) {    /* Insertion sort.                                      */
+            p_pts[k] = p_pts[k - 1u];
+        }
+        if ((k > 0u) && (p_pts[k - 1u] == pt)) {                /* Already drawn : undo the shift & draw again.         */
+            for (; k < i; k++) {
+                p_pts[k] = p_pts[k + 1u];
+            }
+            continue;
+        }
+        p_pts[k] = pt;
+        i++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppFuzz_SetValid()
+*
+* Description : Check that a task set has the shape AppFuzz_Gen() produces (see AppFuzz_Gen() Note #2).
+*
+* Argument(s) : p_tasks     Task set.
+*
+*               task_nbr    Number of tasks.
+*
+* Return(s)   : DEF_YES, if the set is valid.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppFuzz_SetValid (const  task_para_set  *p_tasks,
+                                              CPU_INT32U      task_nbr)
+{
+    const  task_para_set  *p_task;
+           CPU_BOOLEAN     r1;
+           CPU_BOOLEAN     r2;
+           CPU_INT32U      i;
+
+
+    if (task_nbr == 0u) {
+        return (DEF_NO);
+    }
+    for (i = 0u; i < task_nbr; i++) {
+        p_task = &p_tasks[i];
+        if ((p_task->TaskExecutionTime == 0u) ||
+            (p_task->TaskExecutionTime >  p_task->TaskPeriodic)) {
+            return (DEF_NO);
+        }
+        r1 = (p_task->R1_start != p_task->R1_end) ? DEF_YES : DEF_NO;
+        r2 = (p_task->R2_start != p_task->R2_end) ? DEF_YES : DEF_NO;
+        if ((r1 == DEF_YES) &&
+            ((p_task->R1_start == 0u) || (p_task->R1_start > p_task->R1_end) || (p_task->R1_end >= p_task->TaskExecutionTime))) {
+            return (DEF_NO);
+        }
+        if ((r2 == DEF_YES) &&
+            ((p_task->R2_start == 0u) || (p_task->R2_start > p_task->R2_end) || (p_task->R2_end >= p_task->TaskExecutionTime))) {
+            return (DEF_NO);
+        }
+        if ((r1 == DEF_YES) && (r2 == DEF_YES)) {
+            if ((p_task->R1_end <= p_task->R2_start) || (p_task->R2_end <= p_task->R1_start)) {
+                continue;                                       /* Disjoint.                                            */
+            }
+            if (((p_task->R1_start < p_task->R2_start) && (p_task->R2_end < p_task->R1_end)) ||
+                ((p_task->R2_start < p_task->R1_start) && (p_task->R1_end < p_task->R2_end))) {
+                continue;                                       /* Strictly nested.                                     */
+            }
+            return (DEF_NO);
+        }
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppFuzz_Mutate()
+*
+* Description : Apply one shrinking step (see AppFuzz_Shrink() Note #1).
+*
+* Argument(s) : p_tasks     Task set to change.
+*
+*               p_task_nbr  Pointer to the number of tasks.
+*
+*               op_ix       Step : task index * APP_FUZZ_SHRINK_OP_NBR + step on that task.
+*
+* Return(s)   : DEF_YES, if the set was changed.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppFuzz_Mutate (task_para_set  *p_tasks,
+                                     CPU_INT32U     *p_task_nbr,
+                                     CPU_INT32U      op_ix)
+{
+    task_para_set  *p_task;
+    CPU_INT32U      task_ix;
+    CPU_INT32U      i;
+
+
+    task_ix = op_ix / APP_FUZZ_SHRINK_OP_NBR;
+    if (task_ix >= *p_task_nbr) {
+        return (DEF_NO);
+    }
+    p_task = &p_tasks[task_ix];
+
+    switch (op_ix % APP_FUZZ_SHRINK_OP_NBR) {
+        case 0u:                                                /* Remove the task.                                     */
+             if (*p_task_nbr <= 1u) {
+                 return (DEF_NO);
+             }
+             for (i = task_ix; (i + 1u) < *p_task_nbr; i++) {
+                 p_tasks[i] = p_tasks[i + 1u];
+             }
+             (*p_task_nbr)--;
+             break;
+
+        case 1u:                                                /* Drop R1.                                             */
+             if (p_task->R1_start == p_task->R1_end) {
+                 return (DEF_NO);
+             }
+             p_task->R1_start = 0u;
+             p_task->R1_end   = 0u;
+             break;
+
+        case 2u:                                                /* Drop R2.                                             */
+             if (p_task->R2_start == p_task->R2_end) {
+                 return (DEF_NO);
+             }
+             p_task->R2_start = 0u;
+             p_task->R2_end   = 0u;
+             break;
+
+        case 3u:                                                /* Arrive at 0.                                         */
+             if (p_task->TaskArriveTime == 0u) {
+                 return (DEF_NO);
+             }
+             p_task->TaskArriveTime = 0u;
+             break;
+
+        case 4u:                                                /* Arrive earlier.                                      */
+             if (p_task->TaskArriveTime <= 1u) {
+                 return (DEF_NO);
+             }
+             p_task->TaskArriveTime--;
+             break;
+
+        case 5u:                                                /* Shorter job.                                         */
+             if (p_task->TaskExecutionTime <= 1u) {
+                 return (DEF_NO);
+             }
+             p_task->TaskExecutionTime--;
+             break;
+
+        case 6u:                                                /* Shorter period, from the generator's table.          */
+             for (i = sizeof(AppFuzz_PeriodTbl) / sizeof(AppFuzz_PeriodTbl[0]); i > 0u; i--) {
+                 if (AppFuzz_PeriodTbl[i - 1u] < p_task->TaskPeriodic) {
+                     break;
+                 }
+             }
+             if ((i == 0u) || (AppFuzz_PeriodTbl[i - 1u] < p_task->TaskExecutionTime)) {
+                 return (DEF_NO);
+             }
+             p_task->TaskPeriodic = AppFuzz_PeriodTbl[i - 1u];
+             break;
+
+        case 7u:                                                /* Shorter critical sections.                           */
+             if (p_task->R1_end <= p_task->R1_start + 1u) {
+                 return (DEF_NO);
+             }
+             p_task->R1_start++;
+             break;
+
+        case 8u:
+             if (p_task->R1_end <= p_task->R1_start + 1u) {
+                 return (DEF_NO);
+             }
+             p_task->R1_end--;
+             break;
+
+        case 9u:
+             if (p_task->R2_end <= p_task->R2_start + 1u) {
+                 return (DEF_NO);
+             }
+             p_task->R2_start++;
+             break;
+
+        case 10u:
+        default:
+             if (p_task->R2_end <= p_task->R2_start + 1u) {
+                 return (DEF_NO);
+             }
+             p_task->R2_end--;
+             break;
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                              CHECKING
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppFuzz_EndTimeGet (const  task_para_set  *p_tasks,
+                                               CPU_INT32U      task_nbr)
+{
+    CPU_INT32U  hyper;
+    CPU_INT32U  arrive;
+    CPU_INT32U  a;
+    CPU_INT32U  b;
+    CPU_INT32U  t;
+    CPU_INT32U  i;
+
+
+    hyper  = 1u;
+    arrive = 0u;
+    for (i = 0u; i < task_nbr; i++) {
+        a = hyper;                                              /* hyper = lcm(hyper, period).                          */
+        b = p_tasks[i].TaskPeriodic;
+        while (b != 0u) {
+            t = a % b;
+            a = b;
+            b = t;
+        }
+        hyper = (hyper / a) * p_tasks[i].TaskPeriodic;
+        if (hyper > APP_FUZZ_END_TIME_MAX) {
+            return (APP_FUZZ_END_TIME_MAX);
+        }
+        if (p_tasks[i].TaskArriveTime > arrive) {
+            arrive = p_tasks[i].TaskArriveTime;
+        }
+    }
+
+    return (DEF_MIN(arrive + hyper, APP_FUZZ_END_TIME_MAX));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppFuzz_BoundCalc()
+*
+* Description : Compute the blocking & response-time bounds of every task.
+*
+* Argument(s) : p_ctx       Pointer to the check state; tasks are taken in priority order from the model.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Under the Priority Ceiling Protocol a job is blocked at most once, by one lower priority
+*                   job running above the job's priority.  A lower job runs at the highest ceiling of the
+*                   mutexes it holds; the bound is the longest run of its ticks where that ceiling is higher
+*                   than the blocked job's priority.
+*
+*               (2) R = C + B + sum over higher tasks of ceil(R / T) * C, iterated to a fixed point.  The
+*                   kernel reports a job completing on its deadline tick as a miss, so a task is only
+*                   considered schedulable if R < T.
+*********************************************************************************************************
+*/
+
+static  void  AppFuzz_BoundCalc (APP_FUZZ_CTX  *p_ctx)
+{
+    APP_SIM              *p_sim;
+    const  task_para_set *p_para;
+    const  task_para_set *p_low;
+    CPU_INT32U            prio;
+    CPU_INT32U            ceil;
+    CPU_INT32U            run;
+    CPU_INT32U            i;
+    CPU_INT32U            j;
+    CPU_INT32U            tick;
+    CPU_INT32S            blk;
+    CPU_INT32S            resp;
+    CPU_INT32S            resp_next;
+
+
+    p_sim = &p_ctx->Sim;
+    for (i = 0u; i < p_sim->TaskNbr; i++) {                     /* See Note #1.                                         */
+        p_para = &p_sim->Tcb[i].Para;
+        prio   = p_para->TaskPriority;
+        blk    = 0;
+        for (j = i + 1u; j < p_sim->TaskNbr; j++) {
+            p_low = &p_sim->Tcb[j].Para;
+            run   = 0u;
+            for (tick = 0u; tick < p_low->TaskExecutionTime; tick++) {
+                ceil = p_low->TaskPriority;
+                if ((p_low->R1_start != p_low->R1_end) &&
+                    (tick >= p_low->R1_start) && (tick < p_low->R1_end)) {
+                    ceil = DEF_MIN(ceil, p_sim->Ceiling[APP_SIM_MUTEX_R1]);
+                }
+                if ((p_low->R2_start != p_low->R2_end) &&
+                    (tick >= p_low->R2_start) && (tick < p_low->R2_end)) {
+                    ceil = DEF_MIN(ceil, p_sim->Ceiling[APP_SIM_MUTEX_R2]);
+                }
+                run = (ceil < prio) ? (run + 1u) : 0u;
+                blk = DEF_MAX(blk, (CPU_INT32S)run);
+            }
+        }
+        p_ctx->Bound[i] = blk;
+
+        resp = (CPU_INT32S)p_para->TaskExecutionTime + blk;     /* See Note #2.                                         */
+        for (;;) {
+            resp_next = (CPU_INT32S)p_para->TaskExecutionTime + blk;
+            for (j = 0u; j < i; j++) {
+                resp_next += ((resp + p_sim->Tcb[j].Para.TaskPeriodic - 1) / p_sim->Tcb[j].Para.TaskPeriodic)
+                           * p_sim->Tcb[j].Para.TaskExecutionTime;
+            }
+            if ((resp_next == resp) || (resp_next >= (CPU_INT32S)p_para->TaskPeriodic)) {
+                break;
+            }
+            resp = resp_next;
+        }
+        p_ctx->Rta[i] = (resp_next < (CPU_INT32S)p_para->TaskPeriodic) ? resp_next : -1;
+    }
+}
+
+
+static  void  AppFuzz_Fail (APP_FUZZ_CTX  *p_ctx,
+                            CPU_INT08U     inv,
+                            CPU_INT16U     task_id,
+                            CPU_INT16U     job,
+                            CPU_INT32S     bound,
+                            CPU_INT32S     val)
+{
+    APP_FUZZ_RESULT  *p_result;
+
+
+    p_result = p_ctx->ResultPtr;
+    if (p_result->Inv != APP_FUZZ_INV_NONE) {                   /* Keep the first violation only.                       */
+        return;
+    }
+    p_result->Inv    = inv;
+    p_result->Tick   = p_ctx->Sim.Time;
+    p_result->TaskId = task_id;
+    p_result->Job    = job;
+    p_result->Bound  = bound;
+    p_result->Val    = val;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppFuzz_EventChk()
+*
+* Description : Check the rows printed by the model; an APP_SIM_EVENT_FNCT.
+*
+* Argument(s) : p_arg       Pointer to the check state.
+*
+*               p_event     Pointer to the row.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  AppFuzz_EventChk (       void           *p_arg,
+                                const  APP_TSB_EVENT  *p_event)
+{
+    APP_FUZZ_CTX  *p_ctx;
+    CPU_INT32U     ix;
+
+
+    p_ctx = (APP_FUZZ_CTX *)p_arg;
+    for (ix = 0u; ix < p_ctx->Sim.TaskNbr; ix++) {
+        if (p_ctx->Sim.Tcb[ix].Para.TaskID == p_event->CurId) {
+            break;
+        }
+    }
+    if (ix >= p_ctx->Sim.TaskNbr) {
+        return;
+    }
+
+    switch (p_event->Kind) {
+        case APP_TSB_EVENT_COMPLETION:
+             if ((CPU_INT32S)p_event->Blk > p_ctx->Bound[ix]) {
+                 AppFuzz_Fail(p_ctx, APP_FUZZ_INV_BLOCKING_T, p_event->CurId, p_event->CurJob, p_ctx->Bound[ix], p_event->Blk);
+             } else if ((p_ctx->Rta[ix] >= 0) && ((CPU_INT32S)p_event->Resp > p_ctx->Rta[ix])) {
+                 AppFuzz_Fail(p_ctx, APP_FUZZ_INV_RESPONSE,   p_event->CurId, p_event->CurJob, p_ctx->Rta[ix],   p_event->Resp);
+             }
+             p_ctx->InvTicks[ix] = 0u;
+             break;
+
+        case APP_TSB_EVENT_MISS_DEADLINE:
+             if (p_ctx->Rta[ix] >= 0) {
+                 AppFuzz_Fail(p_ctx, APP_FUZZ_INV_RESPONSE, p_event->CurId, p_event->CurJob, p_ctx->Rta[ix], p_ctx->Sim.Tcb[ix].Para.TaskPeriodic);
+             }
+             break;
+
+        default:
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppFuzz_TickChk()
+*
+* Description : Check the state of the model once it waits for the next tick.
+*
+* Argument(s) : p_ctx       Pointer to the check state.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A task is ready iff it is neither pending nor delayed; its bit must then be set at its
+*                   current priority, & no other bit may be set.
+*
+*               (2) A wait-for cycle is looked for from every task pending on a mutex : the owner of that
+*                   mutex may itself pend on a mutex, & so on.
+*
+*               (3) A job still incomplete one period after its release has missed its deadline; since the
+*                   model stops on every 'MissDeadline' row, the kernel did not report it.
+*
+*               (4) Ticks given to a lower priority task while a job is pending count as blocking.  Ticks
+*                   given to the idle task do not; such a job is lost & caught by Note #3.
+*********************************************************************************************************
+*/
+
+static  void  AppFuzz_TickChk (APP_FUZZ_CTX  *p_ctx)
+{
+    APP_SIM        *p_sim;
+    APP_SIM_TCB    *p_tcb;
+    APP_SIM_TCB    *p_run;
+    task_para_set  *p_para;
+    CPU_INT32U      rdy_nbr;
+    CPU_INT32U      bit_nbr;
+    CPU_INT32U      wait_nbr[APP_SIM_MUTEX_NBR];
+    CPU_INT32U      release;
+    CPU_INT32U      hops;
+    CPU_INT32U      i;
+    CPU_INT32U      k;
+    CPU_INT32U      y;
+    CPU_INT08U      ix;
+    CPU_BOOLEAN     rdy;
+
+
+    p_sim = &p_ctx->Sim;
+    if (p_sim->Err != APP_SIM_ERR_NONE) {
+        return;
+    }
+                                                                /* ---------------- READY TABLE (Note #1) ------------- */
+    bit_nbr = 0u;
+    for (y = 0u; y < OS_RDY_TBL_SIZE; y++) {
+        if (((p_sim->RdyGrp >> y) & 1u) != ((p_sim->RdyTbl[y] != 0u) ? 1u : 0u)) {
+            AppFuzz_Fail(p_ctx, APP_FUZZ_INV_RDY_TBL, 0u, 0u, (CPU_INT32S)(p_sim->RdyTbl[y] != 0u), (CPU_INT32S)((p_sim->RdyGrp >> y) & 1u));
+            return;
+        }
+        for (k = 0u; k < 8u; k++) {
+            bit_nbr += (p_sim->RdyTbl[y] >> k) & 1u;
+        }
+    }
+    rdy_nbr = 0u;
+    Mem_Clr(wait_nbr, sizeof(wait_nbr));
+    for (i = 0u; i <= APP_SIM_TASK_MAX; i++) {
+        if ((i >= p_sim->TaskNbr) && (i != APP_SIM_IDLE_IX)) {
+            continue;
+        }
+        p_tcb = &p_sim->Tcb[i];
+        rdy   = ((p_tcb->Stat == OS_STAT_RDY) && (p_tcb->Dly == 0u)) ? DEF_YES : DEF_NO;
+        if (rdy != (((p_sim->RdyTbl[p_tcb->Y] & p_tcb->BitX) != 0u) ? DEF_YES : DEF_NO)) {
+            AppFuzz_Fail(p_ctx, APP_FUZZ_INV_RDY_TBL, p_tcb->Id, p_tcb->Para.TaskNumber, (CPU_INT32S)rdy, (CPU_INT32S)!rdy);
+            return;
+        }
+        rdy_nbr += (rdy == DEF_YES) ? 1u : 0u;
+        if ((p_tcb->Stat & OS_STAT_MUTEX) != 0u) {
+            if ((p_tcb->MutexIx >= APP_SIM_MUTEX_NBR) ||
+                ((p_sim->Mutex[p_tcb->MutexIx].Tbl[p_tcb->Y] & p_tcb->BitX) == 0u)) {
+                AppFuzz_Fail(p_ctx, APP_FUZZ_INV_RDY_TBL, p_tcb->Id, p_tcb->Para.TaskNumber, 1, 0);
+                return;
+            }
+            wait_nbr[p_tcb->MutexIx]++;
+        }
+    }
+    if (rdy_nbr != bit_nbr) {
+        AppFuzz_Fail(p_ctx, APP_FUZZ_INV_RDY_TBL, 0u, 0u, (CPU_INT32S)rdy_nbr, (CPU_INT32S)bit_nbr);
+        return;
+    }
+    for (i = 0u; i < APP_SIM_MUTEX_NBR; i++) {
+        bit_nbr = 0u;
+        for (y = 0u; y < OS_EVENT_TBL_SIZE; y++) {
+            for (k = 0u; k < 8u; k++) {
+                bit_nbr += (p_sim->Mutex[i].Tbl[y] >> k) & 1u;
+            }
+        }
+        if (bit_nbr != wait_nbr[i]) {
+            AppFuzz_Fail(p_ctx, APP_FUZZ_INV_RDY_TBL, 0u, 0u, (CPU_INT32S)wait_nbr[i], (CPU_INT32S)bit_nbr);
+            return;
+        }
+    }
+                                                                /* ------------------ DEADLOCK (Note #2) ------------- */
+    for (i = 0u; i < p_sim->TaskNbr; i++) {
+        ix = (CPU_INT08U)i;
+        for (hops = 0u; hops <= p_sim->TaskNbr; hops++) {
+            p_tcb = &p_sim->Tcb[ix];
+            if ((p_tcb->Stat & OS_STAT_MUTEX) == 0u) {
+                break;
+            }
+            ix = p_sim->Mutex[p_tcb->MutexIx].OwnerIx;
+            if (ix >= p_sim->TaskNbr) {
+                break;
+            }
+            if (ix == i) {
+                AppFuzz_Fail(p_ctx, APP_FUZZ_INV_DEADLOCK, p_sim->Tcb[i].Id, p_sim->Tcb[i].Para.TaskNumber, -1, (CPU_INT32S)(hops + 1u));
+                return;
+            }
+        }
+    }
+                                                                /* --------------- DEADLINES (Note #3) --------------- */
+    for (i = 0u; i < p_sim->TaskNbr; i++) {
+        p_para  = &p_sim->Tcb[i].Para;
+        release = p_para->TaskArriveTime + (CPU_INT32U)p_para->TaskNumber * p_para->TaskPeriodic;
+        if (p_sim->Time >= release + p_para->TaskPeriodic) {
+            AppFuzz_Fail(p_ctx, APP_FUZZ_INV_DEADLINE, p_para->TaskID, p_para->TaskNumber, p_para->TaskPeriodic, (CPU_INT32S)(p_sim->Time - release));
+            return;
+        }
+    }
+                                                                /* --------------- BLOCKING (Note #4) --------------- */
+    ix = p_sim->PrioTbl[p_sim->PrioCur];
+    if ((ix == APP_SIM_TCB_NONE) || (ix == APP_SIM_TCB_RESERVED) || (ix == APP_SIM_IDLE_IX)) {
+        return;                                                 /* A bad entry is reported by the next tick.            */
+    }
+    p_run = &p_sim->Tcb[ix];
+    for (i = 0u; i < p_sim->TaskNbr; i++) {
+        p_para  = &p_sim->Tcb[i].Para;
+        release = p_para->TaskArriveTime + (CPU_INT32U)p_para->TaskNumber * p_para->TaskPeriodic;
+        if ((p_sim->Time >= release) && (p_run->OriPrio > p_para->TaskPriority)) {
+            p_ctx->InvTicks[i]++;
+            if ((CPU_INT32S)p_ctx->InvTicks[i] > p_ctx->Bound[i]) {
+                AppFuzz_Fail(p_ctx, APP_FUZZ_INV_BLOCKING, p_para->TaskID, p_para->TaskNumber, p_ctx->Bound[i], (CPU_INT32S)p_ctx->InvTicks[i]);
+                return;
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                              REPORTING
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          AppFuzz_Worker()
+*
+* Description : Check, & shrink when failing, every case assigned to one worker.
+*
+* Argument(s) : p_worker    Pointer to the worker.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Workers share nothing but read-only tables, so no locking is needed.
+*********************************************************************************************************
+*/
+
+static  void  AppFuzz_Worker (APP_FUZZ_WORKER  *p_worker)
+{
+    task_para_set    tasks[APP_FUZZ_TASK_NBR_MAX];
+    APP_FUZZ_RESULT  result;
+    APP_FUZZ_FAIL   *p_fail;
+    CPU_INT32U       case_ix;
+    CPU_INT32U       seed;
+    CPU_INT32U       task_nbr;
+
+
+    for (case_ix = p_worker->Ix; case_ix < p_worker->CaseNbr; case_ix += p_worker->ThreadNbr) {
+        seed     = AppFuzz_SeedGet(p_worker->Seed, case_ix);
+        task_nbr = AppFuzz_Gen(seed, tasks);
+        if (AppFuzz_Check(tasks, task_nbr, &result) == DEF_OK) {
+            continue;
+        }
+        p_worker->InvCtr[result.Inv]++;
+        if (p_worker->FailNbr < APP_FUZZ_FAIL_MAX) {
+            p_fail              = &p_worker->Fail[p_worker->FailNbr];
+            p_fail->CaseIx      = case_ix;
+            p_fail->Seed        = seed;
+            p_fail->TaskNbrOrig = task_nbr;
+            p_fail->TaskNbr     = AppFuzz_Shrink(tasks, task_nbr, &result);
+            p_fail->Result      = result;
+            Mem_Copy(p_fail->Tasks, tasks, p_fail->TaskNbr * sizeof(task_para_set));
+        }
+        p_worker->FailNbr++;
+    }
+}
+
+
+#ifdef  _WIN32
+static  DWORD WINAPI  AppFuzz_Thread (LPVOID  p_arg)
+{
+    AppFuzz_Worker((APP_FUZZ_WORKER *)p_arg);
+
+    return (0u);
+}
+#else
+static  void  *AppFuzz_Thread (void  *p_arg)
+{
+    AppFuzz_Worker((APP_FUZZ_WORKER *)p_arg);
+
+    return ((void *)0);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppFuzz_FailPrint()
+*
+* Description : Print a shrunk failing case & write it to a reproducer file.
+*
+* Argument(s) : p_fail      Pointer to the failing case.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The reproducer is a 'TaskSet.txt' file; it can be replayed with AppFuzz_CheckFile(), or
+*                   run by the kernel itself by copying it over INPUT_FILE_NAME.
+*********************************************************************************************************
+*/
+
+static  void  AppFuzz_FailPrint (const  APP_FUZZ_FAIL  *p_fail)
+{
+    const  task_para_set  *p_task;
+           CPU_CHAR        path[64];
+           CPU_INT32U      i;
+           FILE           *p_fp;
+
+
+    (void)snprintf(path, sizeof(path), "%s%08X.txt", APP_FUZZ_REPRO_PREFIX, (unsigned)p_fail->Seed);
+    if (fopen_s(&p_fp, path, "w") != 0) {
+        p_fp = (FILE *)0;
+    }
+
+    printf("FAIL\tcase %u\tseed 0x%08X\n", (unsigned)p_fail->CaseIx, (unsigned)p_fail->Seed);
+    AppFuzz_ResultPrint(&p_fail->Result);
+    printf("\tminimal set, %u of %u task(s)%s%s :\n",
+           (unsigned)p_fail->TaskNbr, (unsigned)p_fail->TaskNbrOrig,
+           (p_fp != (FILE *)0) ? ", written to " : "",
+           (p_fp != (FILE *)0) ? path            : "");
+    for (i = 0u; i < p_fail->TaskNbr; i++) {                    /* See Note #1.                                         */
+        p_task = &p_fail->Tasks[i];
+        printf("\t\t%d %d %d %d %d %d %d %d\n",
+               p_task->TaskID, p_task->TaskArriveTime, p_task->TaskExecutionTime, p_task->TaskPeriodic,
+               p_task->R1_start, p_task->R1_end, p_task->R2_start, p_task->R2_end);
+        if (p_fp != (FILE *)0) {
+            fprintf(p_fp, "%s%d %d %d %d %d %d %d %d",
+                    (i == 0u) ? "" : "\n",
+                    p_task->TaskID, p_task->TaskArriveTime, p_task->TaskExecutionTime, p_task->TaskPeriodic,
+                    p_task->R1_start, p_task->R1_end, p_task->R2_start, p_task->R2_end);
+        }
+    }
+    if (p_fp != (FILE *)0) {
+        fclose(p_fp);
+    }
+}
+
+
+static  void  AppFuzz_ResultPrint (const  APP_FUZZ_RESULT  *p_result)
+{
+    printf("\t%s at tick %u, task %u job %u : ",
+           AppFuzz_InvNameTbl[p_result->Inv], (unsigned)p_result->Tick, (unsigned)p_result->TaskId, (unsigned)p_result->Job);
+    if (p_result->Inv == APP_FUZZ_INV_DEADLINE) {               /* The bound of a deadline miss is the deadline itself. */
+        printf("%d tick(s) since release, deadline %d\n", (int)p_result->Val, (int)p_result->Bound);
+    } else if (p_result->Bound >= 0) {
+        printf("observed %d, bound %d\n", (int)p_result->Val, (int)p_result->Bound);
+    } else {
+        printf("observed %d\n", (int)p_result->Val);
+    }
+}
+
+
+static  CPU_INT32U  AppFuzz_CPU_NbrGet (void)
+{
+#ifdef  _WIN32
+    SYSTEM_INFO  info;
+
+
+    GetSystemInfo(&info);
+    return ((CPU_INT32U)info.dwNumberOfProcessors);
+#else
+    long  nbr;
+
+
+    nbr = sysconf(_SC_NPROCESSORS_ONLN);
+    return ((nbr > 0) ? (CPU_INT32U)nbr : 1u);
+#endif
+}
+
+
+static  double  AppFuzz_MsGet (void)                            /* Wall-clock time; clock() sums all threads on POSIX.  */
+{
+#ifdef  _WIN32
+    LARGE_INTEGER    freq;
+    LARGE_INTEGER    ctr;
+
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&ctr);
+    return ((double)ctr.QuadPart * 1000.0 / (double)freq.QuadPart);
+#else
+    struct  timespec  ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0);
+#endif
+}
@@ -0,0 +1,143 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                   DIFFERENTIAL SCHEDULE FUZZER
+*
+* Filename : app_fuzz.h
+*
+* Note(s)  : (1) Random task sets are run through the virtual-time model (see app_sim.h) over one
+*                hyperperiod past the last arrival, and every tick is checked against theory :
+*
+*                    APP_FUZZ_INV_BLOCKING      A job is delayed by lower priority tasks for longer than
+*                                               the longest critical section that may block it (CPP).
+*                    APP_FUZZ_INV_BLOCKING_T    'Blocking_T' as reported by App_TaskSwHook() exceeds
+*                                               that same bound.
+*                    APP_FUZZ_INV_DEADLOCK      Tasks wait for each other's mutexes, or keep switching
+*                                               without a tick going by.
+*                    APP_FUZZ_INV_RESPONSE      A response time exceeds the response-time analysis
+*                                               bound, or a task that the analysis proves schedulable
+*                                               misses its deadline.
+*                    APP_FUZZ_INV_RDY_TBL       The ready group/table or a mutex wait list disagrees
+*                                               with the state of the TCBs.
+*                    APP_FUZZ_INV_TCB           The kernel would dereference a NULL or reserved
+*                                               OSTCBPrioTbl[] entry.
+*                    APP_FUZZ_INV_DEADLINE      A deadline goes by without a 'MissDeadline' row.
+*
+*            (2) Case 'n' of a run only depends on the run seed & on 'n', so results do not depend on
+*                the number of threads.  Failing sets are shrunk to a minimal set that still violates
+*                the same invariant & written in the 'TaskSet.txt' format.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_FUZZ_H
+#define  APP_FUZZ_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "app_sim.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_FUZZ_CASE_NBR_DFLT                     10000u      /* Cases per run when none is given.                    */
+#define  APP_FUZZ_TASK_NBR_MAX                          6u      /* Max nbr of tasks in a generated set.                 */
+#define  APP_FUZZ_UTIL_MIN                             30u      /* Total utilization of a generated set, in %.          */
+#define  APP_FUZZ_UTIL_MAX                            100u
+#define  APP_FUZZ_END_TIME_MAX                       1000u      /* Cap on the simulated length of a case.               */
+#define  APP_FUZZ_THREAD_MAX                           64u
+#define  APP_FUZZ_FAIL_MAX                              4u      /* Failing cases shrunk & reported per thread.          */
+#define  APP_FUZZ_REPRO_PREFIX                 "./fuzz_"        /* Reproducers : <prefix><seed>.txt                     */
+
+                                                                /* -------------------- INVARIANTS ------------------ */
+#define  APP_FUZZ_INV_BLOCKING                          0u
+#define  APP_FUZZ_INV_BLOCKING_T                        1u
+#define  APP_FUZZ_INV_DEADLOCK                          2u
+#define  APP_FUZZ_INV_RESPONSE                          3u
+#define  APP_FUZZ_INV_RDY_TBL                           4u
+#define  APP_FUZZ_INV_TCB                               5u
+#define  APP_FUZZ_INV_DEADLINE                          6u
+#define  APP_FUZZ_INV_NBR                               7u
+#define  APP_FUZZ_INV_NONE                           0xFFu
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_fuzz_result {
+    CPU_INT08U     Inv;                                         /* First invariant violated, APP_FUZZ_INV_xxx.          */
+    CPU_INT32U     Tick;
+    CPU_INT16U     TaskId;
+    CPU_INT16U     Job;
+    CPU_INT32S     Bound;                                       /* Value allowed by theory, -1 if none.                 */
+    CPU_INT32S     Val;                                         /* Value observed.                                      */
+} APP_FUZZ_RESULT;
+
+
+typedef  struct  app_fuzz_fail {
+    CPU_INT32U       CaseIx;
+    CPU_INT32U       Seed;                                      /* Seed of the generated set.                           */
+    CPU_INT32U       TaskNbrOrig;                               /* Nbr of tasks before shrinking.                       */
+    CPU_INT32U       TaskNbr;
+    task_para_set    Tasks[APP_FUZZ_TASK_NBR_MAX];              /* Minimal set, in file order.                          */
+    APP_FUZZ_RESULT  Result;                                    /* Result of the minimal set.                           */
+} APP_FUZZ_FAIL;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+CPU_INT32U   AppFuzz_Gen     (       CPU_INT32U        seed,
+                                     task_para_set    *p_tasks);
+
+CPU_BOOLEAN  AppFuzz_Check   (const  task_para_set    *p_tasks,
+                                     CPU_INT32U        task_nbr,
+                                     APP_FUZZ_RESULT  *p_result);
+
+CPU_INT32U   AppFuzz_Shrink  (       task_para_set    *p_tasks,
+                                     CPU_INT32U        task_nbr,
+                                     APP_FUZZ_RESULT  *p_result);
+
+CPU_INT32U   AppFuzz_Run     (       CPU_INT32U        case_nbr,
+                                     CPU_INT32U        seed,
+                                     CPU_INT32U        thread_nbr);
+
+CPU_BOOLEAN  AppFuzz_CheckFile(const  CPU_CHAR         *p_taskset_path);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
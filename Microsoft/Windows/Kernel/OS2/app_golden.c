@@ -0,0 +1,704 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                  GOLDEN-OUTPUT REGRESSION HARNESS
+*
+* Filename : app_golden.c
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <time.h>
+
+#include  "app_golden.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_GOLDEN_LINE_MAX                          128u
+#define  APP_GOLDEN_FIELD_NBR                          12u
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_golden_case {
+    const  CPU_CHAR  *TaskSetPath;
+    const  CPU_CHAR  *GoldenPath;
+} APP_GOLDEN_CASE;
+
+
+typedef  struct  app_golden_mp_case {                           /* See 'app_golden.h  Note #3'.                         */
+    const  CPU_CHAR  *TaskSetPath;
+    const  CPU_CHAR  *GoldenPath;                               /* Rows to compare with, or NULL.                       */
+    CPU_INT08U        CoreNbr;
+    CPU_INT08U        Sched;
+    CPU_INT08U        Proto;
+    CPU_INT08U        Err;                                      /* Expected reason why the model stops.                 */
+} APP_GOLDEN_MP_CASE;
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  APP_GOLDEN_CASE  AppGolden_CaseTbl[] = {
+    { INPUT_FILE_NAME,   APP_GOLDEN_DIR "TaskSet.txt"  },
+    { "./TaskSet1.txt",  APP_GOLDEN_DIR "TaskSet1.txt" },
+    { "./TaskSet2.txt",  APP_GOLDEN_DIR "TaskSet2.txt" },
+};
+
+                                                                /* TaskSet*.txt : 1 core, same rows as the kernel.      */
+                                                                /* MpDeadlock.txt : R1 & R2 nested in opposite orders   */
+                                                                /* on C0 & C1, & a third job locking R1 behind them.    */
+static  const  APP_GOLDEN_MP_CASE  AppGolden_MpCaseTbl[] = {
+    { INPUT_FILE_NAME,    APP_GOLDEN_DIR "TaskSet.txt",  1u, APP_MP_SCHED_FFD, APP_MP_PROTO_MPCP, APP_MP_ERR_END      },
+    { "./TaskSet1.txt",   APP_GOLDEN_DIR "TaskSet1.txt", 1u, APP_MP_SCHED_FFD, APP_MP_PROTO_MPCP, APP_MP_ERR_END      },
+    { "./TaskSet2.txt",   APP_GOLDEN_DIR "TaskSet2.txt", 1u, APP_MP_SCHED_FFD, APP_MP_PROTO_MPCP, APP_MP_ERR_END      },
+    { "./MpDeadlock.txt", (const CPU_CHAR *)0,           2u, APP_MP_SCHED_FFD, APP_MP_PROTO_MPCP, APP_MP_ERR_DEADLOCK },
+    { "./MpDeadlock.txt", (const CPU_CHAR *)0,           2u, APP_MP_SCHED_FFD, APP_MP_PROTO_MSRP, APP_MP_ERR_DEADLOCK },
+    { "./MpDeadlock.txt", (const CPU_CHAR *)0,           2u, APP_MP_SCHED_WFD, APP_MP_PROTO_MPCP, APP_MP_ERR_DEADLOCK },
+};
+
+static  const  CPU_CHAR  *AppGolden_FieldNameTbl[APP_GOLDEN_FIELD_NBR] = {
+    "Tick",    "Event",   "CurrentTaskID", "CurrentJob",
+    "NextTaskID", "NextJob", "Resource",   "PrioFrom",
+    "PrioTo",  "ResponseTime", "BlockingTime", "PreemptionTime"
+};
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32S  AppGolden_FieldGet  (const  APP_TSB_EVENT    *p_event,
+                                                CPU_INT08U        field);
+
+static  void        AppGolden_DiffPrint (const  APP_GOLDEN_DIFF  *p_diff);
+
+static  void        AppGolden_MpListAdd (       void             *p_list,
+                                         const  APP_MP_EVENT     *p_event);
+
+static  double      AppGolden_MsGet     (       clock_t           start);
+
+
+/*
+*********************************************************************************************************
+*                                         AppGolden_ListAdd()
+*
+* Description : Append an event to a list; usable as an APP_SIM_EVENT_FNCT.
+*
+* Argument(s) : p_list      Pointer to the APP_GOLDEN_LIST.
+*
+*               p_event     Pointer to the event.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The event is dropped if the list cannot grow; the comparison then fails.
+*********************************************************************************************************
+*/
+
+void  AppGolden_ListAdd (       void           *p_list,
+                         const  APP_TSB_EVENT  *p_event)
+{
+    APP_GOLDEN_LIST  *p_golden;
+    APP_TSB_EVENT    *p_tbl;
+    CPU_INT32U        max;
+
+
+    p_golden = (APP_GOLDEN_LIST *)p_list;
+    if (p_golden->Nbr == p_golden->Max) {
+        max   = (p_golden->Max == 0u) ? 256u : (p_golden->Max * 2u);
+        p_tbl = (APP_TSB_EVENT *)realloc(p_golden->Tbl, max * sizeof(APP_TSB_EVENT));
+        if (p_tbl == (APP_TSB_EVENT *)0) {                      /* See Note #1.                                         */
+            return;
+        }
+        p_golden->Tbl = p_tbl;
+        p_golden->Max = max;
+    }
+    p_golden->Tbl[p_golden->Nbr++] = *p_event;
+}
+
+
+void  AppGolden_ListFree (APP_GOLDEN_LIST  *p_list)
+{
+    free(p_list->Tbl);
+    p_list->Tbl = (APP_TSB_EVENT *)0;
+    p_list->Nbr = 0u;
+    p_list->Max = 0u;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppGolden_ListRd()
+*
+* Description : Read every row of a file in the 'Output.txt' format.
+*
+* Argument(s) : p_path      Path of the file.
+*
+*               p_list      Pointer to the (empty) list to fill.
+*
+* Return(s)   : DEF_OK,   if the file could be read.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Lines that are not rows (headers, blank lines) are skipped.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppGolden_ListRd (const  CPU_CHAR         *p_path,
+                                      APP_GOLDEN_LIST  *p_list)
+{
+    FILE           *p_fp;
+    CPU_CHAR        str[APP_GOLDEN_LINE_MAX];
+    APP_TSB_EVENT   event;
+
+
+    if (fopen_s(&p_fp, p_path, "r") != 0) {
+        return (DEF_FAIL);
+    }
+    while (fgets(str, sizeof(str), p_fp) != NULL) {
+        if (AppTsb_EventParse(str, &event) == DEF_OK) {         /* See Note #1.                                         */
+            AppGolden_ListAdd(p_list, &event);
+        }
+    }
+    fclose(p_fp);
+
+    return (DEF_OK);
+}
+
+
+CPU_BOOLEAN  AppGolden_ListWr (const  CPU_CHAR         *p_path,
+                               const  APP_GOLDEN_LIST  *p_list)
+{
+    FILE        *p_fp;
+    CPU_INT32U   i;
+
+
+    if (fopen_s(&p_fp, p_path, "w") != 0) {
+        return (DEF_FAIL);
+    }
+    for (i = 0u; i < p_list->Nbr; i++) {
+        AppTsb_EventWr(p_fp, &p_list->Tbl[i]);
+    }
+    fclose(p_fp);
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppGolden_Simulate()
+*
+* Description : Run a task set through the model up to SYSTEM_END_TIME.
+*
+* Argument(s) : p_taskset_path  Path of the task set.
+*
+*               p_list          Pointer to the (empty) list that receives the rows.
+*
+* Return(s)   : Reason why the model stopped, APP_SIM_ERR_xxx; APP_SIM_ERR_TASK_NBR if the task set
+*               could not be read.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  AppGolden_Simulate (const  CPU_CHAR         *p_taskset_path,
+                                       APP_GOLDEN_LIST  *p_list)
+{
+    task_para_set   tasks[APP_SIM_TASK_MAX];
+    APP_SIM        *p_sim;
+    CPU_INT32U      task_nbr;
+    CPU_INT08U      err;
+
+
+    task_nbr = AppTsb_TaskSetRd(p_taskset_path, tasks, APP_SIM_TASK_MAX);
+    p_sim    = (APP_SIM *)malloc(sizeof(APP_SIM));
+    if ((task_nbr == 0u) || (p_sim == (APP_SIM *)0)) {
+        free(p_sim);
+        return (APP_SIM_ERR_TASK_NBR);
+    }
+    (void)AppSim_Init(p_sim, tasks, task_nbr, SYSTEM_END_TIME, AppGolden_ListAdd, p_list);
+    err = AppSim_Run(p_sim);
+    free(p_sim);
+
+    return (err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppGolden_Diff()
+*
+* Description : Compare two event streams tick by tick & field by field.
+*
+* Argument(s) : p_exp       Expected stream.
+*
+*               p_act       Actual stream.
+*
+*               p_diff      Pointer to the result.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) When one stream ends first, the divergence is reported on the 'Tick' field against the
+*                   first row past its end.
+*********************************************************************************************************
+*/
+
+void  AppGolden_Diff (const  APP_GOLDEN_LIST  *p_exp,
+                      const  APP_GOLDEN_LIST  *p_act,
+                             APP_GOLDEN_DIFF  *p_diff)
+{
+    const  APP_TSB_EVENT  *p_e;
+    const  APP_TSB_EVENT  *p_a;
+           CPU_INT32U      i;
+           CPU_INT32U      tick_ix;
+           CPU_INT08U      field;
+
+
+    Mem_Clr(p_diff, sizeof(APP_GOLDEN_DIFF));
+    p_diff->Match = DEF_YES;
+    tick_ix       = 0u;
+
+    for (i = 0u; (i < p_exp->Nbr) || (i < p_act->Nbr); i++) {
+        p_e = (i < p_exp->Nbr) ? &p_exp->Tbl[i] : (const APP_TSB_EVENT *)0;
+        p_a = (i < p_act->Nbr) ? &p_act->Tbl[i] : (const APP_TSB_EVENT *)0;
+        if ((i > 0u) && (p_e != (const APP_TSB_EVENT *)0) && (p_e->Tick == p_exp->Tbl[i - 1u].Tick)) {
+            tick_ix++;
+        } else {
+            tick_ix = 0u;
+        }
+
+        field = 0u;
+        if ((p_e != (const APP_TSB_EVENT *)0) && (p_a != (const APP_TSB_EVENT *)0)) {
+            while ((field < APP_GOLDEN_FIELD_NBR) &&
+                   (AppGolden_FieldGet(p_e, field) == AppGolden_FieldGet(p_a, field))) {
+                field++;
+            }
+            if (field == APP_GOLDEN_FIELD_NBR) {
+                continue;
+            }
+        }
+                                                                /* ------------- FIRST DIVERGENCE FOUND ------------- */
+        p_diff->Match     = DEF_NO;
+        p_diff->EventIx   = i;
+        p_diff->TickIx    = tick_ix;
+        p_diff->FieldName = AppGolden_FieldNameTbl[field];
+        p_diff->ExpPtr    = p_e;
+        p_diff->ActPtr    = p_a;
+        p_diff->ExpVal    = (p_e != (const APP_TSB_EVENT *)0) ? AppGolden_FieldGet(p_e, field) : -1;
+        p_diff->ActVal    = (p_a != (const APP_TSB_EVENT *)0) ? AppGolden_FieldGet(p_a, field) : -1;
+        if (p_e == (const APP_TSB_EVENT *)0) {                  /* See Note #1.                                         */
+            p_diff->Tick = p_a->Tick;
+        } else if (p_a == (const APP_TSB_EVENT *)0) {
+            p_diff->Tick = p_e->Tick;
+        } else {
+            p_diff->Tick = DEF_MIN(p_e->Tick, p_a->Tick);
+        }
+        return;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppGolden_Case()
+*
+* Description : Run one golden case.
+*
+* Argument(s) : p_taskset_path  Path of the task set.
+*
+*               p_golden_path   Path of the golden file.
+*
+*               update          DEF_YES to rewrite the golden file instead of comparing against it.
+*
+* Return(s)   : DEF_OK,   if the schedule matches the golden file (or the file was rewritten).
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppGolden_Case (const  CPU_CHAR     *p_taskset_path,
+                             const  CPU_CHAR     *p_golden_path,
+                                    CPU_BOOLEAN   update)
+{
+    APP_GOLDEN_LIST  exp;
+    APP_GOLDEN_LIST  act;
+    APP_GOLDEN_DIFF  diff;
+    CPU_INT08U       err;
+    CPU_BOOLEAN      ok;
+    clock_t          start;
+
+
+    Mem_Clr(&exp, sizeof(exp));
+    Mem_Clr(&act, sizeof(act));
+    start = clock();
+    err   = AppGolden_Simulate(p_taskset_path, &act);
+    if ((err != APP_SIM_ERR_END) && (err != APP_SIM_ERR_MISS_DEADLINE)) {
+        printf("FAIL\t%s\tmodel stopped with error %d at the end of the stream\n", p_taskset_path, err);
+        AppGolden_ListFree(&act);
+        return (DEF_FAIL);
+    }
+
+    if (update == DEF_YES) {
+        ok = AppGolden_ListWr(p_golden_path, &act);
+        printf("%s\t%s\t-> %s\t%u rows\n", (ok == DEF_OK) ? "UPDATE" : "FAIL", p_taskset_path, p_golden_path, (unsigned)act.Nbr);
+        AppGolden_ListFree(&act);
+        return (ok);
+    }
+
+    if (AppGolden_ListRd(p_golden_path, &exp) != DEF_OK) {
+        printf("FAIL\t%s\tcannot read %s\n", p_taskset_path, p_golden_path);
+        AppGolden_ListFree(&act);
+        return (DEF_FAIL);
+    }
+    AppGolden_Diff(&exp, &act, &diff);
+    if (diff.Match == DEF_YES) {
+        printf("PASS\t%s\t%u rows\t%.3f ms\n", p_taskset_path, (unsigned)act.Nbr, AppGolden_MsGet(start));
+    } else {
+        printf("FAIL\t%s\n", p_taskset_path);
+        AppGolden_DiffPrint(&diff);
+    }
+    AppGolden_ListFree(&exp);
+    AppGolden_ListFree(&act);
+
+    return ((diff.Match == DEF_YES) ? DEF_OK : DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppGolden_MpCase()
+*
+* Description : Run one multicore case (see 'app_golden.h  Note #3').
+*
+* Argument(s) : p_taskset_path  Path of the task set.
+*
+*               p_golden_path   Path of the golden file the rows are compared with, or NULL.
+*
+*               core_nbr        Number of cores.
+*
+*               sched           Scheduling mode, APP_MP_SCHED_xxx.
+*
+*               proto           Protocol of the global resources, APP_MP_PROTO_xxx.
+*
+*               err_exp         Expected reason why the model stops, APP_MP_ERR_xxx.
+*
+* Return(s)   : DEF_OK,   if the model stopped for the expected reason (& the rows match the golden file).
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The model runs up to SYSTEM_END_TIME, like the single-core cases.  The golden files are
+*                   written by AppGolden_Case() only, so that 'golden-update' cannot hide a divergence of
+*                   the multicore model.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppGolden_MpCase (const  CPU_CHAR    *p_taskset_path,
+                               const  CPU_CHAR    *p_golden_path,
+                                      CPU_INT08U   core_nbr,
+                                      CPU_INT08U   sched,
+                                      CPU_INT08U   proto,
+                                      CPU_INT08U   err_exp)
+{
+    task_para_set     tasks[APP_MP_TASK_MAX];
+    APP_MP           *p_mp;
+    APP_GOLDEN_LIST   exp;
+    APP_GOLDEN_LIST   act;
+    APP_GOLDEN_DIFF   diff;
+    CPU_INT32U        task_nbr;
+    CPU_INT08U        err;
+    clock_t           start;
+
+
+    Mem_Clr(&exp, sizeof(exp));
+    Mem_Clr(&act, sizeof(act));
+    start    = clock();
+    task_nbr = AppTsb_TaskSetRd(p_taskset_path, tasks, APP_MP_TASK_MAX);
+    p_mp     = (APP_MP *)malloc(sizeof(APP_MP));
+    if ((task_nbr == 0u) || (p_mp == (APP_MP *)0)) {
+        printf("FAIL\t%s\tcannot read the task set\n", p_taskset_path);
+        free(p_mp);
+        return (DEF_FAIL);
+    }
+    if (AppMp_Init(p_mp, tasks, task_nbr, core_nbr, sched, proto, 0u, (const APP_MP_OVH *)0,
+                   SYSTEM_END_TIME, AppGolden_MpListAdd, &act) == DEF_OK) {
+        err = AppMp_Run(p_mp);                                  /* See Note #1.                                         */
+    } else {
+        err = p_mp->Err;
+    }
+
+    Mem_Clr(&diff, sizeof(diff));
+    diff.Match = DEF_YES;
+    if (p_golden_path != (const CPU_CHAR *)0) {
+        if (AppGolden_ListRd(p_golden_path, &exp) != DEF_OK) {
+            printf("FAIL\t%s\tcannot read %s\n", p_taskset_path, p_golden_path);
+            diff.Match = DEF_NO;
+        } else {
+            AppGolden_Diff(&exp, &act, &diff);
+        }
+    }
+    if ((err == err_exp) && (diff.Match == DEF_YES)) {
+        printf("PASS\t%s\t%u core(s)\terror %u at tick %u, %u rows\t%.3f ms\n",
+               p_taskset_path, (unsigned)core_nbr, (unsigned)err, (unsigned)p_mp->Time, (unsigned)act.Nbr,
+               AppGolden_MsGet(start));
+    } else {
+        printf("FAIL\t%s\t%u core(s)\terror %u at tick %u, expected error %u\n",
+               p_taskset_path, (unsigned)core_nbr, (unsigned)err, (unsigned)p_mp->Time, (unsigned)err_exp);
+        if ((diff.Match == DEF_NO) && (exp.Nbr != 0u)) {
+            AppGolden_DiffPrint(&diff);
+        }
+    }
+    free(p_mp);
+    AppGolden_ListFree(&exp);
+    AppGolden_ListFree(&act);
+
+    return (((err == err_exp) && (diff.Match == DEF_YES)) ? DEF_OK : DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppGolden_RunAll()
+*
+* Description : Run every golden case.
+*
+* Argument(s) : update      DEF_YES to rewrite the golden files.
+*
+* Return(s)   : Number of failed cases.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  AppGolden_RunAll (CPU_BOOLEAN  update)
+{
+    const  APP_GOLDEN_MP_CASE  *p_mp_case;
+    CPU_INT32U                  case_nbr;
+    CPU_INT32U                  fail_nbr;
+    CPU_INT32U                  i;
+    clock_t                     start;
+
+
+    fail_nbr = 0u;
+    start    = clock();
+    for (i = 0u; i < sizeof(AppGolden_CaseTbl) / sizeof(AppGolden_CaseTbl[0]); i++) {
+        if (AppGolden_Case(AppGolden_CaseTbl[i].TaskSetPath, AppGolden_CaseTbl[i].GoldenPath, update) != DEF_OK) {
+            fail_nbr++;
+        }
+    }
+    case_nbr = i;
+    for (i = 0u; i < sizeof(AppGolden_MpCaseTbl) / sizeof(AppGolden_MpCaseTbl[0]); i++) {
+        p_mp_case = &AppGolden_MpCaseTbl[i];
+        if (AppGolden_MpCase(p_mp_case->TaskSetPath, p_mp_case->GoldenPath, p_mp_case->CoreNbr,
+                             p_mp_case->Sched, p_mp_case->Proto, p_mp_case->Err) != DEF_OK) {
+            fail_nbr++;
+        }
+        case_nbr++;
+    }
+    printf("%u case(s), %u failed, %.3f ms\n", (unsigned)case_nbr, (unsigned)fail_nbr, AppGolden_MsGet(start));
+
+    return (fail_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppGolden_DiffFiles()
+*
+* Description : Compare two files in the 'Output.txt' format, e.g. a golden file & the output of a real
+*               run of the kernel.
+*
+* Argument(s) : p_exp_path  Path of the expected rows.
+*
+*               p_act_path  Path of the actual rows.
+*
+* Return(s)   : DEF_OK,   if both files hold the same rows.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppGolden_DiffFiles (const  CPU_CHAR  *p_exp_path,
+                                  const  CPU_CHAR  *p_act_path)
+{
+    APP_GOLDEN_LIST  exp;
+    APP_GOLDEN_LIST  act;
+    APP_GOLDEN_DIFF  diff;
+
+
+    Mem_Clr(&exp, sizeof(exp));
+    Mem_Clr(&act, sizeof(act));
+    if ((AppGolden_ListRd(p_exp_path, &exp) != DEF_OK) ||
+        (AppGolden_ListRd(p_act_path, &act) != DEF_OK)) {
+        printf("FAIL\tcannot read %s or %s\n", p_exp_path, p_act_path);
+        AppGolden_ListFree(&exp);
+        AppGolden_ListFree(&act);
+        return (DEF_FAIL);
+    }
+    AppGolden_Diff(&exp, &act, &diff);
+    if (diff.Match == DEF_YES) {
+        printf("PASS\t%s\t%u rows\n", p_act_path, (unsigned)act.Nbr);
+    } else {
+        printf("FAIL\t%s\n", p_act_path);
+        AppGolden_DiffPrint(&diff);
+    }
+    AppGolden_ListFree(&exp);
+    AppGolden_ListFree(&act);
+
+    return ((diff.Match == DEF_YES) ? DEF_OK : DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        AppGolden_FieldGet()
+*
+* Description : Get one field of an event, in the order of AppGolden_FieldNameTbl[].
+*
+* Argument(s) : p_event     Pointer to the event.
+*
+*               field       Field index.
+*
+* Return(s)   : Value of the field.
+*
+* Note(s)     : (1) Fields that a row kind does not print are zero, so they always compare equal.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32S  AppGolden_FieldGet (const  APP_TSB_EVENT  *p_event,
+                                               CPU_INT08U      field)
+{
+    switch (field) {
+        case 0u:  return ((CPU_INT32S)p_event->Tick);
+        case 1u:  return ((CPU_INT32S)p_event->Kind);
+        case 2u:  return ((CPU_INT32S)p_event->CurId);
+        case 3u:  return ((CPU_INT32S)p_event->CurJob);
+        case 4u:  return ((CPU_INT32S)p_event->NextId);
+        case 5u:  return ((CPU_INT32S)p_event->NextJob);
+        case 6u:  return ((CPU_INT32S)p_event->Res);
+        case 7u:  return ((CPU_INT32S)p_event->PrioFrom);
+        case 8u:  return ((CPU_INT32S)p_event->PrioTo);
+        case 9u:  return ((CPU_INT32S)p_event->Resp);
+        case 10u: return ((CPU_INT32S)p_event->Blk);
+        case 11u: return ((CPU_INT32S)p_event->Pre);
+        default:  return (0);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppGolden_DiffPrint()
+*
+* Description : Print the first divergence & the two rows involved.
+*
+* Argument(s) : p_diff      Pointer to the comparison result.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  AppGolden_DiffPrint (const  APP_GOLDEN_DIFF  *p_diff)
+{
+    printf("\tfirst divergence at tick %u, row %u of the tick (row %u of the stream)\n",
+           (unsigned)p_diff->Tick, (unsigned)p_diff->TickIx, (unsigned)p_diff->EventIx);
+    if (p_diff->ExpPtr == (const APP_TSB_EVENT *)0) {
+        printf("\tunexpected row\n");
+    } else if (p_diff->ActPtr == (const APP_TSB_EVENT *)0) {
+        printf("\tmissing row\n");
+    } else {
+        printf("\tfield %s : expected %d, got %d\n", p_diff->FieldName, (int)p_diff->ExpVal, (int)p_diff->ActVal);
+    }
+    printf("\texpected : ");
+    if (p_diff->ExpPtr != (const APP_TSB_EVENT *)0) {
+        AppTsb_EventWr(stdout, p_diff->ExpPtr);
+    } else {
+        printf("<end of stream>\n");
+    }
+    printf("\tactual   : ");
+    if (p_diff->ActPtr != (const APP_TSB_EVENT *)0) {
+        AppTsb_EventWr(stdout, p_diff->ActPtr);
+    } else {
+        printf("<end of stream>\n");
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppGolden_MpListAdd()
+*
+* Description : Append the row of a multicore event to a list; usable as an APP_MP_EVENT_FNCT.
+*
+* Argument(s) : p_list      Pointer to the APP_GOLDEN_LIST.
+*
+*               p_event     Pointer to the event.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The lock/unlock priorities are carried outside the row; on one core they are task
+*                   priorities & fit the row's fields.
+*********************************************************************************************************
+*/
+
+static  void  AppGolden_MpListAdd (       void          *p_list,
+                                   const  APP_MP_EVENT  *p_event)
+{
+    APP_TSB_EVENT  event;
+
+
+    event          = p_event->Event;
+    event.PrioFrom = (CPU_INT08U)p_event->PrioFrom;             /* See Note #1.                                         */
+    event.PrioTo   = (CPU_INT08U)p_event->PrioTo;
+    AppGolden_ListAdd(p_list, &event);
+}
+
+
+static  double  AppGolden_MsGet (clock_t  start)
+{
+    return ((double)(clock() - start) * 1000.0 / (double)CLOCKS_PER_SEC);
+}
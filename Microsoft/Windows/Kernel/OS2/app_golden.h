@@ -0,0 +1,134 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                  GOLDEN-OUTPUT REGRESSION HARNESS
+*
+* Filename : app_golden.h
+*
+* Note(s)  : (1) Each case runs one task set through the virtual-time model (see app_sim.h) up to
+*                SYSTEM_END_TIME and compares the rows it prints with a golden file in the 'Output.txt'
+*                format.  The comparison is semantic : rows are parsed, then compared tick by tick &
+*                field by field, so that only the first real divergence is reported.
+*
+*            (2) Golden files live in APP_GOLDEN_DIR, next to the task sets.  They are rewritten with the
+*                'golden-update' command when a schedule change is intended.
+*
+*            (3) Multicore cases run a task set through the multicore model (see app_mp.h) & check the
+*                reason why it stopped, e.g. that a deadlock is reported instead of hanging the run.  On
+*                one core, the rows it logs are also compared with the golden file of the task set, so
+*                that the model stays equal to the kernel (see 'app_mp.h  Note #2').
+*********************************************************************************************************
+*/
+
+#ifndef  APP_GOLDEN_H
+#define  APP_GOLDEN_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "app_mp.h"
+#include  "app_sim.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_GOLDEN_DIR                      "./Golden/"
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_golden_list {                              /* Growable event stream.                               */
+    APP_TSB_EVENT  *Tbl;
+    CPU_INT32U      Nbr;
+    CPU_INT32U      Max;
+} APP_GOLDEN_LIST;
+
+
+typedef  struct  app_golden_diff {
+    CPU_BOOLEAN      Match;
+    CPU_INT32U       Tick;                                      /* First diverging tick.                                */
+    CPU_INT32U       TickIx;                                    /* Index of the diverging row within that tick.         */
+    CPU_INT32U       EventIx;                                   /* Index of the diverging row in the stream.            */
+    const CPU_CHAR  *FieldName;                                 /* First diverging field.                               */
+    CPU_INT32S       ExpVal;
+    CPU_INT32S       ActVal;
+    const APP_TSB_EVENT  *ExpPtr;                               /* Diverging rows; NULL past the end of a stream.       */
+    const APP_TSB_EVENT  *ActPtr;
+} APP_GOLDEN_DIFF;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void         AppGolden_ListAdd  (       void             *p_list,
+                                 const  APP_TSB_EVENT    *p_event);
+
+void         AppGolden_ListFree (       APP_GOLDEN_LIST  *p_list);
+
+CPU_BOOLEAN  AppGolden_ListRd   (const  CPU_CHAR         *p_path,
+                                        APP_GOLDEN_LIST  *p_list);
+
+CPU_BOOLEAN  AppGolden_ListWr   (const  CPU_CHAR         *p_path,
+                                 const  APP_GOLDEN_LIST  *p_list);
+
+CPU_INT08U   AppGolden_Simulate (const  CPU_CHAR         *p_taskset_path,
+                                        APP_GOLDEN_LIST  *p_list);
+
+void         AppGolden_Diff     (const  APP_GOLDEN_LIST  *p_exp,
+                                 const  APP_GOLDEN_LIST  *p_act,
+                                        APP_GOLDEN_DIFF  *p_diff);
+
+CPU_BOOLEAN  AppGolden_Case     (const  CPU_CHAR         *p_taskset_path,
+                                 const  CPU_CHAR         *p_golden_path,
+                                        CPU_BOOLEAN       update);
+
+CPU_BOOLEAN  AppGolden_MpCase    (const  CPU_CHAR         *p_taskset_path,
+                                 const  CPU_CHAR         *p_golden_path,
+                                        CPU_INT08U        core_nbr,
+                                        CPU_INT08U        sched,
+                                        CPU_INT08U        proto,
+                                        CPU_INT08U        err_exp);
+
+CPU_INT32U   AppGolden_RunAll   (       CPU_BOOLEAN       update);
+
+CPU_BOOLEAN  AppGolden_DiffFiles(const  CPU_CHAR         *p_exp_path,
+                                 const  CPU_CHAR         *p_act_path);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -37,6 +37,8 @@
 
 #include  <os.h>
 
+#include  "../app_cmp.h"
+
 
 /*
 *********************************************************************************************************
@@ -302,6 +304,10 @@ void  App_TaskSwHook (void)
 #if (APP_CFG_PROBE_OS_PLUGIN_EN > 0) && (OS_PROBE_HOOKS_EN > 0)
     OSProbe_TaskSwHook();
 #endif
+    AppCmp_TaskSw();
+    if (TASK_NUMBER == 0) {                                     /* No task set loaded (e.g. 'bench'), nothing to trace. */
+        return;
+    }
     int CurPrio = OSTCBPrioTbl[OSPrioCur]->OSTCBOriPrio;
     if (CurPrio != OS_TASK_IDLE_PRIO) {
         for (int i = 0; i < TASK_NUMBER; i++) {
@@ -434,6 +440,7 @@ void  App_TimeTickHook (void)
 #if (APP_CFG_PROBE_OS_PLUGIN_EN == DEF_ENABLED) && (OS_PROBE_HOOKS_EN > 0)
     OSProbe_TickHook();
 #endif
+    AppCmp_TickMark();
 }
 #endif
 #endif
@@ -0,0 +1,2264 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                   MULTIPROCESSOR SCHEDULING MODEL
+*
+* Filename : app_mp.c
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdlib.h>
+
+#include  "app_mp.h"
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_mp_file {                                  /* Files written by AppMp_RunFile().                    */
+    FILE  *OutputPtr;
+    FILE  *TimelinePtr;
+} APP_MP_FILE;
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_CHAR  *AppMp_SchedNameTbl[] = { "ffd",  "wfd",  "grm", "gedf" };
+static  const  CPU_CHAR  *AppMp_ProtoNameTbl[] = { "mpcp", "msrp" };
+
+static  const  CPU_CHAR  *AppMp_ErrNameTbl[] = {
+    "NONE", "END", "MISS_DEADLINE", "PART", "DEADLOCK", "TASK_NBR", "OVH"
+};
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppMp_ResRangeGet (const  task_para_set  *p_para,
+                                               CPU_INT08U      res,
+                                               CPU_INT32U     *p_start,
+                                               CPU_INT32U     *p_end);
+
+static  CPU_INT32U   AppMp_ExecOvhGet  (const  APP_MP         *p_mp,
+                                               CPU_INT32U      ix);
+
+static  CPU_INT32S   AppMp_RtaGet      (const  APP_MP         *p_mp,
+                                               CPU_INT32U      ix,
+                                               CPU_INT08U      core,
+                                               CPU_INT32U      ix_new);
+
+static  CPU_BOOLEAN  AppMp_CoreFits    (const  APP_MP         *p_mp,
+                                               CPU_INT08U      core,
+                                               CPU_INT32U      ix_new);
+
+static  CPU_BOOLEAN  AppMp_Part        (       APP_MP         *p_mp);
+
+static  CPU_INT32S   AppMp_GrmRtaGet   (const  APP_MP         *p_mp,
+                                               CPU_INT32U      ix);
+
+static  void         AppMp_ResInit     (       APP_MP         *p_mp);
+
+static  CPU_INT32S   AppMp_PrioGet     (const  APP_MP         *p_mp,
+                                               CPU_INT32U      ix);
+
+static  CPU_BOOLEAN  AppMp_Before      (const  APP_MP         *p_mp,
+                                               CPU_INT32U      ix_a,
+                                               CPU_INT32U      ix_b,
+                                               CPU_BOOLEAN     base);
+
+static  void         AppMp_EventLog    (       APP_MP         *p_mp,
+                                               CPU_INT08U      core,
+                                               APP_MP_EVENT   *p_event);
+
+static  void         AppMp_EventPend   (       APP_MP         *p_mp,
+                                               CPU_INT08U      core,
+                                               APP_MP_EVENT   *p_event);
+
+static  void         AppMp_PendFlush   (       APP_MP         *p_mp,
+                                               CPU_INT08U      core,
+                                               CPU_INT08U      ix);
+
+static  void         AppMp_ResLog      (       APP_MP         *p_mp,
+                                               CPU_INT32U      ix,
+                                               CPU_INT08U      res,
+                                               CPU_INT08U      kind,
+                                               CPU_INT32S      prio_from);
+
+static  void         AppMp_Lock        (       APP_MP         *p_mp,
+                                               CPU_INT32U      ix,
+                                               CPU_INT08U      res);
+
+static  void         AppMp_Unlock      (       APP_MP         *p_mp,
+                                               CPU_INT32U      ix,
+                                               CPU_INT08U      res);
+
+static  CPU_INT32U   AppMp_CtxSwCostGet(       APP_MP         *p_mp);
+
+static  void         AppMp_OvhLockCharge(      APP_MP         *p_mp,
+                                               CPU_INT32U      ix,
+                                               CPU_INT32U      cost);
+
+static  CPU_BOOLEAN  AppMp_Step        (       APP_MP         *p_mp,
+                                               CPU_INT32U      ix);
+
+static  CPU_BOOLEAN  AppMp_Dispatch    (       APP_MP         *p_mp,
+                                               CPU_INT08U      core);
+
+static  CPU_BOOLEAN  AppMp_GlobalDispatch(     APP_MP         *p_mp);
+
+static  void         AppMp_RunUpdate   (       APP_MP         *p_mp);
+
+static  void         AppMp_SwLog       (       APP_MP         *p_mp,
+                                               CPU_INT08U      core);
+
+static  void         AppMp_BlkUpdate   (       APP_MP         *p_mp);
+
+static  void         AppMp_Exec        (       APP_MP         *p_mp,
+                                               CPU_INT08U      core);
+
+static  void         AppMp_PrioWr      (       FILE           *p_fp,
+                                               CPU_INT32S      prio);
+
+static  CPU_BOOLEAN  AppMp_OvhIsSet    (const  APP_MP_OVH     *p_ovh);
+
+static  void         AppMp_OvhWr       (       FILE           *p_fp,
+                                               CPU_INT32U      val);
+
+static  void         AppMp_OvhCfgWr    (const  APP_MP_OVH     *p_ovh);
+
+static  void         AppMp_EventWr     (       void           *p_arg,
+                                        const  APP_MP_EVENT   *p_event);
+
+static  void         AppMp_RptWr       (const  APP_MP         *p_mp,
+                                        const  CPU_CHAR       *p_stat_path);
+
+
+/*
+*********************************************************************************************************
+*                                            AppMp_Init()
+*
+* Description : Assign the priorities, partition the task set if needed & release the model at time 0.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               p_tasks     Task set, in file order.
+*
+*               task_nbr    Number of tasks.
+*
+*               core_nbr    Number of cores, 1 to APP_MP_CORE_MAX.
+*
+*               sched       Scheduling mode, APP_MP_SCHED_xxx.
+*
+*               proto       Protocol of the global resources, APP_MP_PROTO_xxx.
+*
+*               mig_cost    Ticks charged to a job for each migration (see 'app_mp.h  Note #6c').
+*
+*               p_ovh       Overhead model (see 'app_mp.h  Note #7'), or NULL for none.
+*
+*               end_time    Last tick simulated.
+*
+*               event_fnct  Function called for every row logged, or NULL.
+*
+*               p_event_arg Argument passed to 'event_fnct'.
+*
+* Return(s)   : DEF_OK,   if the model is ready to run.
+*               DEF_FAIL, otherwise (see 'p_mp->Err').
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppMp_Init (       APP_MP             *p_mp,
+                         const  task_para_set      *p_tasks,
+                                CPU_INT32U          task_nbr,
+                                CPU_INT08U          core_nbr,
+                                CPU_INT08U          sched,
+                                CPU_INT08U          proto,
+                                CPU_INT32U          mig_cost,
+                         const  APP_MP_OVH         *p_ovh,
+                                CPU_INT32U          end_time,
+                                APP_MP_EVENT_FNCT   event_fnct,
+                                void               *p_event_arg)
+{
+    APP_MP_TASK    *p_task;
+    APP_MP_CORE    *p_core;
+    task_para_set   tmp;
+    CPU_INT32U      i;
+    CPU_INT32U      k;
+
+
+    Mem_Clr(p_mp, sizeof(APP_MP));
+    p_mp->CoreNbr   = core_nbr;
+    p_mp->Sched     = sched;
+    p_mp->Proto     = proto;
+    p_mp->MigCost   = mig_cost;
+    p_mp->EndTime   = end_time;
+    p_mp->EventFnct = event_fnct;
+    p_mp->EventArg  = p_event_arg;
+    if (p_ovh != (const APP_MP_OVH *)0) {
+        p_mp->Ovh   = *p_ovh;
+    }
+    p_mp->Ovh.CtxSwMax = DEF_MAX(p_mp->Ovh.CtxSwMax, p_mp->Ovh.CtxSwMin);
+    p_mp->OvhRand      = (p_mp->Ovh.Seed != 0u) ? p_mp->Ovh.Seed : 1u;
+
+    if ((task_nbr == 0u) || (task_nbr > APP_MP_TASK_MAX) ||
+        (core_nbr == 0u) || (core_nbr > APP_MP_CORE_MAX)) {
+        p_mp->Err = APP_MP_ERR_TASK_NBR;
+        return (DEF_FAIL);
+    }
+    if (p_mp->Ovh.Tick >= APP_MP_OVH_RES) {
+        p_mp->Err = APP_MP_ERR_OVH;
+        return (DEF_FAIL);
+    }
+                                                                /* ----------- RATE MONOTONIC PRIORITIES ------------ */
+    p_mp->TaskNbr = task_nbr;
+    for (i = 0u; i < task_nbr; i++) {
+        p_mp->Task[i].Para = p_tasks[i];
+    }
+    for (i = 0u; (i + 1u) < task_nbr; i++) {                    /* Same bubble sort as InputFile().                     */
+        for (k = 0u; k < task_nbr - i - 1u; k++) {
+            if (p_mp->Task[k].Para.TaskPeriodic > p_mp->Task[k + 1u].Para.TaskPeriodic) {
+                tmp                     = p_mp->Task[k].Para;
+                p_mp->Task[k].Para      = p_mp->Task[k + 1u].Para;
+                p_mp->Task[k + 1u].Para = tmp;
+            }
+        }
+    }
+    for (i = 0u; i < task_nbr; i++) {
+        p_task                               = &p_mp->Task[i];
+        p_task->Para.TaskPriority            = (INT16U)((i + 1u) * T_start);
+        p_task->Para.Now_TaskPriority        = p_task->Para.TaskPriority;
+        p_task->Para.TaskNumber              = 0u;
+        p_task->Para.Task_need_ExecutionTime = p_task->Para.TaskExecutionTime;
+        p_task->Para.Blocking_T              = 0u;
+        p_task->Core                         = APP_MP_IX_NONE;
+        p_task->RunCore                      = APP_MP_IX_NONE;
+        p_task->WaitRes                      = APP_MP_RES_NONE;
+        p_task->PrioCur                      = (CPU_INT32S)p_task->Para.TaskPriority;
+    }
+
+    if (APP_MP_SCHED_IS_GLOBAL(sched)) {
+        for (i = 0u; i < task_nbr; i++) {                       /* In priority order, see AppMp_GrmRtaGet().            */
+            p_mp->Task[i].Rta = (sched == APP_MP_SCHED_GRM) ? AppMp_GrmRtaGet(p_mp, i) : -1;
+        }
+    } else {
+        if (AppMp_Part(p_mp) != DEF_OK) {
+            p_mp->Err = APP_MP_ERR_PART;
+            return (DEF_FAIL);
+        }
+        for (i = 0u; i < task_nbr; i++) {
+            p_mp->Task[i].Rta = AppMp_RtaGet(p_mp, i, p_mp->Task[i].Core, APP_MP_IX_NONE);
+        }
+    }
+    AppMp_ResInit(p_mp);
+
+    for (i = 0u; i < core_nbr; i++) {
+        p_core         = &p_mp->Core[i];
+        p_core->CurIx  = APP_MP_IX_NONE;
+        p_core->PrevIx = APP_MP_IX_NONE;
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppMp_Tick()
+*
+* Description : Advance the model by one tick on every core : release the jobs, dispatch the cores, then
+*               execute the tick.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+* Return(s)   : DEF_YES, if the model can be advanced further.
+*               DEF_NO,  otherwise (see 'p_mp->Err').
+*
+* Note(s)     : (1) Releasing a global resource may let a job of another core, already dispatched for this
+*                   tick, go on.  The cores are dispatched again until none of them changes; every lock or
+*                   unlock happens at most once per job & tick, so this ends unless jobs deadlock.  Under
+*                   global scheduling, every core is dispatched at once by AppMp_GlobalDispatch().
+*
+*               (2) A new job has not run yet, so that it never migrates (see 'app_mp.h  Note #6c').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppMp_Tick (APP_MP  *p_mp)
+{
+    APP_MP_TASK   *p_task;
+    APP_MP_EVENT   event;
+    CPU_BOOLEAN    changed;
+    CPU_INT32U     loop;
+    CPU_INT32U     i;
+    CPU_INT08U     c;
+
+
+    if (p_mp->Err != APP_MP_ERR_NONE) {
+        return (DEF_NO);
+    }
+                                                                /* ---------------- RELEASE THE JOBS ---------------- */
+    for (i = 0u; i < p_mp->TaskNbr; i++) {
+        p_task = &p_mp->Task[i];
+        if ((p_mp->Time < p_task->Para.TaskArriveTime) ||
+            (((p_mp->Time - p_task->Para.TaskArriveTime) % p_task->Para.TaskPeriodic) != 0u)) {
+            continue;
+        }
+        if (p_task->Rdy == DEF_YES) {                           /* Previous job still running : deadline missed.        */
+            Mem_Clr(&event, sizeof(event));
+            event.Event.Kind   = APP_TSB_EVENT_MISS_DEADLINE;
+            event.Event.CurId  = p_task->Para.TaskID;
+            event.Event.CurJob = (CPU_INT16U)p_task->Job;
+            AppMp_EventLog(p_mp, p_task->Core, &event);
+            p_mp->Err = APP_MP_ERR_MISS_DEADLINE;
+            return (DEF_NO);
+        }
+        p_task->Rdy       = DEF_YES;
+        p_task->Release   = p_mp->Time;
+        p_task->Exec      = 0u;
+        p_task->Work      = 0u;
+        p_task->BlkLocal  = 0u;
+        p_task->BlkRemote = 0u;
+        p_task->MigRem    = 0u;
+        if (APP_MP_SCHED_IS_GLOBAL(p_mp->Sched)) {              /* See Note #2.                                         */
+            p_task->Core  = APP_MP_IX_NONE;
+        }
+    }
+                                                                /* ------------ DISPATCH (see Note #1) -------------- */
+    loop = 0u;
+    do {
+        changed = DEF_NO;
+        if (APP_MP_SCHED_IS_GLOBAL(p_mp->Sched)) {
+            changed = AppMp_GlobalDispatch(p_mp);
+        } else {
+            for (c = 0u; c < p_mp->CoreNbr; c++) {
+                if (AppMp_Dispatch(p_mp, c) == DEF_YES) {
+                    changed = DEF_YES;
+                }
+                if (p_mp->Err != APP_MP_ERR_NONE) {             /* Deadlock : the other cores are not dispatched.       */
+                    AppMp_PendFlush(p_mp, APP_MP_IX_NONE, APP_MP_IX_NONE);
+                    return (DEF_NO);
+                }
+            }
+        }
+        if (p_mp->Err != APP_MP_ERR_NONE) {
+            AppMp_PendFlush(p_mp, APP_MP_IX_NONE, APP_MP_IX_NONE);
+            return (DEF_NO);
+        }
+        loop++;
+        if (loop > (p_mp->TaskNbr * APP_MP_RES_NBR * 2u) + 1u) {
+            p_mp->Err = APP_MP_ERR_DEADLOCK;
+            AppMp_PendFlush(p_mp, APP_MP_IX_NONE, APP_MP_IX_NONE);
+            return (DEF_NO);
+        }
+    } while (changed == DEF_YES);
+
+    AppMp_RunUpdate(p_mp);
+    for (c = 0u; c < p_mp->CoreNbr; c++) {
+        AppMp_SwLog(p_mp, c);
+    }
+    AppMp_BlkUpdate(p_mp);
+                                                                /* ------------------- EXECUTION -------------------- */
+    p_mp->Time++;
+    for (c = 0u; c < p_mp->CoreNbr; c++) {
+        AppMp_Exec(p_mp, c);
+    }
+    AppMp_PendFlush(p_mp, APP_MP_IX_NONE, APP_MP_IX_NONE);      /* Releases at completion, before the switch.           */
+    if (p_mp->Time > p_mp->EndTime) {
+        p_mp->Err = APP_MP_ERR_END;
+    }
+
+    return ((p_mp->Err == APP_MP_ERR_NONE) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             AppMp_Run()
+*
+* Description : Advance the model until it stops.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+* Return(s)   : Reason why the model stopped, APP_MP_ERR_xxx.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  AppMp_Run (APP_MP  *p_mp)
+{
+    while (AppMp_Tick(p_mp) == DEF_YES) {
+        ;
+    }
+
+    return (p_mp->Err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppMp_EndTimeGet()
+*
+* Description : Compute the length of a run : one hyperperiod past the last arrival.
+*
+* Argument(s) : p_tasks     Task set.
+*
+*               task_nbr    Number of tasks.
+*
+* Return(s)   : End time, at most APP_MP_END_TIME_MAX.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  AppMp_EndTimeGet (const  task_para_set  *p_tasks,
+                                     CPU_INT32U      task_nbr)
+{
+    CPU_INT32U  hyper;
+    CPU_INT32U  arrive;
+    CPU_INT32U  a;
+    CPU_INT32U  b;
+    CPU_INT32U  t;
+    CPU_INT32U  i;
+
+
+    hyper  = 1u;
+    arrive = 0u;
+    for (i = 0u; i < task_nbr; i++) {
+        a = hyper;                                              /* hyper = lcm(hyper, period).                          */
+        b = p_tasks[i].TaskPeriodic;
+        while (b != 0u) {
+            t = a % b;
+            a = b;
+            b = t;
+        }
+        hyper = (hyper / a) * p_tasks[i].TaskPeriodic;
+        if (hyper > APP_MP_END_TIME_MAX) {
+            return (APP_MP_END_TIME_MAX);
+        }
+        if (p_tasks[i].TaskArriveTime > arrive) {
+            arrive = p_tasks[i].TaskArriveTime;
+        }
+    }
+
+    return (DEF_MIN(arrive + hyper, APP_MP_END_TIME_MAX));
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppMp_RunFile()
+*
+* Description : Run a task set file on several cores & write the per-core log, the timeline & the
+*               statistics to APP_MP_OUTPUT_FILE_NAME, APP_MP_TIMELINE_FILE_NAME & APP_MP_STAT_FILE_NAME.
+*
+* Argument(s) : p_taskset_path  Path of the task set.
+*
+*               core_nbr        Number of cores.
+*
+*               sched           Scheduling mode, APP_MP_SCHED_xxx.
+*
+*               proto           Protocol of the global resources, APP_MP_PROTO_xxx.
+*
+*               end_time        Last tick simulated, or 0 for AppMp_EndTimeGet().
+*
+*               mig_cost        Ticks charged to a job for each migration.
+*
+*               p_ovh           Overhead model, or NULL for none.
+*
+* Return(s)   : DEF_OK,   if the set was partitioned & ran to the end time without missing a deadline.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Each timeline cell is the ID of the task that ran on the core during the tick, suffixed
+*                   with 's' if it spun or 'm' if it paid a migration, or '-' if the core was idle.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppMp_RunFile (const  CPU_CHAR    *p_taskset_path,
+                                   CPU_INT08U   core_nbr,
+                                   CPU_INT08U   sched,
+                                   CPU_INT08U   proto,
+                                   CPU_INT32U   end_time,
+                                   CPU_INT32U   mig_cost,
+                            const  APP_MP_OVH  *p_ovh)
+{
+    task_para_set        tasks[APP_MP_TASK_MAX];
+    APP_MP              *p_mp;
+    const  APP_MP_TASK  *p_task;
+    APP_MP_FILE          file;
+    CPU_INT32U           task_nbr;
+    CPU_INT32U           tick;
+    CPU_INT08U           c;
+    CPU_INT08U           err;
+
+
+    task_nbr = AppTsb_TaskSetRd(p_taskset_path, tasks, APP_MP_TASK_MAX);
+    if (task_nbr == 0u) {
+        printf("FAIL\t%s\tcannot read the task set\n", p_taskset_path);
+        return (DEF_FAIL);
+    }
+    if (end_time == 0u) {
+        end_time = AppMp_EndTimeGet(tasks, task_nbr);
+    }
+    p_mp = (APP_MP *)malloc(sizeof(APP_MP));
+    if (p_mp == (APP_MP *)0) {
+        return (DEF_FAIL);
+    }
+    if (fopen_s(&file.OutputPtr, APP_MP_OUTPUT_FILE_NAME, "w") != 0) {
+        file.OutputPtr = (FILE *)0;
+    }
+    if (fopen_s(&file.TimelinePtr, APP_MP_TIMELINE_FILE_NAME, "w") != 0) {
+        file.TimelinePtr = (FILE *)0;
+    }
+
+    if (AppMp_Init(p_mp, tasks, task_nbr, core_nbr, sched, proto, mig_cost, p_ovh, end_time, AppMp_EventWr, &file) != DEF_OK) {
+        err = p_mp->Err;
+    } else {
+        if (file.TimelinePtr != (FILE *)0) {
+            fprintf(file.TimelinePtr, "tick");
+            for (c = 0u; c < core_nbr; c++) {
+                fprintf(file.TimelinePtr, ",C%u", (unsigned)c);
+            }
+            fprintf(file.TimelinePtr, "\n");
+        }
+        do {                                                    /* See Note #1.                                         */
+            tick = p_mp->Time;
+            if (AppMp_Tick(p_mp) == DEF_NO) {
+                if (p_mp->Time == tick) {                       /* Stopped before the tick ran.                         */
+                    break;
+                }
+            }
+            if (file.TimelinePtr != (FILE *)0) {
+                fprintf(file.TimelinePtr, "%u", (unsigned)tick);
+                for (c = 0u; c < core_nbr; c++) {
+                    if (p_mp->Core[c].PrevIx == APP_MP_IX_NONE) {
+                        fprintf(file.TimelinePtr, ",-");
+                    } else {
+                        p_task = &p_mp->Task[p_mp->Core[c].PrevIx];
+                        fprintf(file.TimelinePtr, ",%u%s", (unsigned)p_task->Para.TaskID,
+                                (p_task->Spin             == DEF_YES) ? "s" :
+                                (p_mp->Core[c].PrevMig    == DEF_YES) ? "m" : "");
+                    }
+                }
+                fprintf(file.TimelinePtr, "\n");
+            }
+        } while (p_mp->Err == APP_MP_ERR_NONE);
+        err = p_mp->Err;
+    }
+
+    if (file.OutputPtr != (FILE *)0) {
+        fclose(file.OutputPtr);
+    }
+    if (file.TimelinePtr != (FILE *)0) {
+        fclose(file.TimelinePtr);
+    }
+
+    printf("%s\t%s\t%u core(s), %s, %s, %u tick(s)",
+           ((err == APP_MP_ERR_END) ? "PASS" : "FAIL"), p_taskset_path, (unsigned)core_nbr,
+           AppMp_SchedNameTbl[sched], AppMp_ProtoNameTbl[proto], (unsigned)p_mp->Time);
+    if (APP_MP_SCHED_IS_GLOBAL(sched)) {
+        printf(", %u tick(s) per migration", (unsigned)mig_cost);
+    }
+    AppMp_OvhCfgWr(&p_mp->Ovh);
+    printf("\n");
+    if (err == APP_MP_ERR_PART) {
+        printf("\tthe task set does not fit on %u core(s)\n", (unsigned)core_nbr);
+    } else if (err == APP_MP_ERR_OVH) {
+        printf("\tthe tick ISR takes the whole tick\n");
+    } else if (err != APP_MP_ERR_TASK_NBR) {
+        if (err != APP_MP_ERR_END) {
+            printf("\tstopped : %s\n", AppMp_ErrNameTbl[err]);
+        }
+        AppMp_RptWr(p_mp, APP_MP_STAT_FILE_NAME);
+    }
+    free(p_mp);
+
+    return ((err == APP_MP_ERR_END) ? DEF_OK : DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppMp_SchedParse()
+*
+* Description : Get the scheduling mode named on the command line.
+*
+* Argument(s) : p_name      Name : "ffd", "wfd", "grm" or "gedf".
+*
+* Return(s)   : Scheduling mode, APP_MP_SCHED_xxx; APP_MP_SCHED_FFD if the name is unknown.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  AppMp_SchedParse (const  CPU_CHAR  *p_name)
+{
+    CPU_INT08U  sched;
+
+
+    for (sched = 0u; sched < APP_MP_SCHED_NBR; sched++) {
+        if (Str_Cmp(p_name, AppMp_SchedNameTbl[sched]) == 0) {
+            return (sched);
+        }
+    }
+
+    return (APP_MP_SCHED_FFD);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppMp_OvhParse()
+*
+* Description : Get the overhead model given on the command line.
+*
+* Argument(s) : p_str       Model : "<ctx sw>[-<ctx sw max>][:<tick>[:<lock>[:<unlock>]]]", every cost in
+*                           1/APP_MP_OVH_RES tick; e.g. "50-120:20:10:10".
+*
+*               p_ovh       Pointer to the model to fill.
+*
+* Return(s)   : DEF_OK,   if the model is valid.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Every field starts with a digit, so that e.g. "-5" or "10:" is rejected.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppMp_OvhParse (const  CPU_CHAR    *p_str,
+                                    APP_MP_OVH  *p_ovh)
+{
+    CPU_INT32U  *p_val[3];
+    CPU_CHAR    *p_end;
+    CPU_INT08U   n;
+    CPU_BOOLEAN  ok;
+
+
+    Mem_Clr(p_ovh, sizeof(APP_MP_OVH));
+    p_ovh->Seed     = 1u;
+    ok              = ((*p_str >= '0') && (*p_str <= '9')) ? DEF_OK : DEF_FAIL;
+    p_ovh->CtxSwMin = (CPU_INT32U)strtoul(p_str, &p_end, 10);
+    p_ovh->CtxSwMax = p_ovh->CtxSwMin;
+    if (*p_end == '-') {
+        p_str           = p_end + 1;
+        ok              = ((*p_str >= '0') && (*p_str <= '9')) ? ok : DEF_FAIL;
+        p_ovh->CtxSwMax = (CPU_INT32U)strtoul(p_str, &p_end, 10);
+    }
+    p_val[0] = &p_ovh->Tick;
+    p_val[1] = &p_ovh->Lock;
+    p_val[2] = &p_ovh->Unlock;
+    for (n = 0u; (n < 3u) && (*p_end == ':'); n++) {
+        p_str     = p_end + 1;
+        ok        = ((*p_str >= '0') && (*p_str <= '9')) ? ok : DEF_FAIL;
+       *p_val[n]  = (CPU_INT32U)strtoul(p_str, &p_end, 10);
+    }
+
+    if ((ok == DEF_FAIL) || (*p_end != '\0') ||
+        (p_ovh->CtxSwMax < p_ovh->CtxSwMin) ||
+        (p_ovh->Tick >= APP_MP_OVH_RES)) {
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             AppMp_Cmp()
+*
+* Description : Run a task set under every scheduling mode & global lock protocol, & print one row for
+*               each run.
+*
+* Argument(s) : p_taskset_path  Path of the task set.
+*
+*               core_nbr        Number of cores.
+*
+*               mig_cost        Ticks charged to a job for each migration.
+*
+*               p_ovh           Overhead model, or NULL for none.
+*
+* Return(s)   : DEF_OK,   if at least one run reached the end time without missing a deadline.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Nothing is logged.  'ticks' is the number of ticks run, ticks 0 to 'end_time' for a
+*                   full run, as in the header; 'resp/T' is the worst response time of a task over its
+*                   period; 'mig ovh' the ticks the cores spent paying migrations; 'ovh' the ticks the
+*                   cores spent on context switches, tick ISRs, locks & unlocks (see 'app_mp.h  Note #7').
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppMp_Cmp (const  CPU_CHAR    *p_taskset_path,
+                               CPU_INT08U   core_nbr,
+                               CPU_INT32U   mig_cost,
+                        const  APP_MP_OVH  *p_ovh)
+{
+    task_para_set        tasks[APP_MP_TASK_MAX];
+    APP_MP              *p_mp;
+    const  APP_MP_TASK  *p_task;
+    CPU_INT32U           task_nbr;
+    CPU_INT32U           end_time;
+    CPU_INT32U           resp_pct;
+    CPU_INT32U           preempt;
+    CPU_INT32U           migrate;
+    CPU_INT32U           mig_ovh;
+    CPU_INT32U           ovh;
+    CPU_INT32U           i;
+    CPU_INT08U           sched;
+    CPU_INT08U           proto;
+    CPU_INT08U           c;
+    CPU_INT08U           err;
+    CPU_BOOLEAN          ok;
+
+
+    task_nbr = AppTsb_TaskSetRd(p_taskset_path, tasks, APP_MP_TASK_MAX);
+    if (task_nbr == 0u) {
+        printf("FAIL\t%s\tcannot read the task set\n", p_taskset_path);
+        return (DEF_FAIL);
+    }
+    end_time = AppMp_EndTimeGet(tasks, task_nbr);
+    p_mp     = (APP_MP *)malloc(sizeof(APP_MP));
+    if (p_mp == (APP_MP *)0) {
+        return (DEF_FAIL);
+    }
+
+    printf("%s\t%u core(s), %u tick(s), %u tick(s) per migration",
+           p_taskset_path, (unsigned)core_nbr, (unsigned)(end_time + 1u), (unsigned)mig_cost);
+    if (p_ovh != (const APP_MP_OVH *)0) {
+        AppMp_OvhCfgWr(p_ovh);
+    }
+    printf("\n");
+    printf("\tsched\tproto\tresult\t\tticks\tresp/T\tpreempt\tmigrate\tmig ovh\tovh\n");
+    ok = DEF_FAIL;
+    for (sched = 0u; sched < APP_MP_SCHED_NBR; sched++) {
+        for (proto = 0u; proto < APP_MP_PROTO_NBR; proto++) {
+            if (AppMp_Init(p_mp, tasks, task_nbr, core_nbr, sched, proto, mig_cost, p_ovh, end_time,
+                           (APP_MP_EVENT_FNCT)0, (void *)0) == DEF_OK) {
+                err = AppMp_Run(p_mp);
+            } else {
+                err = p_mp->Err;
+            }
+            resp_pct = 0u;                                      /* See Note #1.                                         */
+            preempt  = 0u;
+            migrate  = 0u;
+            mig_ovh  = 0u;
+            ovh      = 0u;
+            for (i = 0u; i < p_mp->TaskNbr; i++) {
+                p_task   = &p_mp->Task[i];
+                resp_pct = DEF_MAX(resp_pct, (p_task->RespMax * 100u) / p_task->Para.TaskPeriodic);
+                preempt += p_task->PreemptCtr;
+                migrate += p_task->MigrateCtr;
+            }
+            for (c = 0u; c < p_mp->CoreNbr; c++) {
+                mig_ovh += p_mp->Core[c].MigCtr;
+                ovh     += p_mp->Core[c].OvhCtxSw + p_mp->Core[c].OvhTick + p_mp->Core[c].OvhLock;
+            }
+            printf("\t%s\t%s\t%-13s\t%u\t%u%%\t%u\t%u\t%u\t",
+                   AppMp_SchedNameTbl[sched], AppMp_ProtoNameTbl[proto],
+                   (err == APP_MP_ERR_END) ? "PASS" : AppMp_ErrNameTbl[err],
+                   (unsigned)p_mp->Time, (unsigned)resp_pct,
+                   (unsigned)preempt, (unsigned)migrate, (unsigned)mig_ovh);
+            AppMp_OvhWr(stdout, ovh);
+            printf("\n");
+            if (err == APP_MP_ERR_END) {
+                ok = DEF_OK;
+            }
+        }
+    }
+    free(p_mp);
+
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                   PARTITIONING & RESOURCE PLACEMENT
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         AppMp_ResRangeGet()
+*
+* Description : Get the critical section of a task on a resource.
+*
+* Argument(s) : p_para      Task parameters.
+*
+*               res         Resource, APP_MP_RES_xxx.
+*
+*               p_start     Pointer to the executed ticks before the lock.
+*
+*               p_end       Pointer to the executed ticks before the unlock.
+*
+* Return(s)   : DEF_YES, if the task uses the resource ('R_start' != 'R_end', as task() checks).
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppMp_ResRangeGet (const  task_para_set  *p_para,
+                                               CPU_INT08U      res,
+                                               CPU_INT32U     *p_start,
+                                               CPU_INT32U     *p_end)
+{
+    if (res == APP_MP_RES_R1) {
+       *p_start = p_para->R1_start;
+       *p_end   = p_para->R1_end;
+    } else {
+       *p_start = p_para->R2_start;
+       *p_end   = p_para->R2_end;
+    }
+
+    return ((*p_start != *p_end) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppMp_ExecOvhGet()
+*
+* Description : Get the ticks a job of a task takes on its core once the overheads are charged.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               ix          Index of the task.
+*
+* Return(s)   : Ticks; the execution time itself if no overhead is configured.
+*
+* Note(s)     : (1) See 'app_mp.h  Note #7d'.  AppMp_Init() keeps 'Tick' below APP_MP_OVH_RES.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppMp_ExecOvhGet (const  APP_MP      *p_mp,
+                                             CPU_INT32U   ix)
+{
+    const  task_para_set  *p_para;
+    CPU_INT32U             work;
+    CPU_INT32U             avail;
+    CPU_INT32U             start;
+    CPU_INT32U             end;
+    CPU_INT08U             r;
+
+
+    p_para = &p_mp->Task[ix].Para;
+    work   = ((CPU_INT32U)p_para->TaskExecutionTime * APP_MP_OVH_RES) + (2u * p_mp->Ovh.CtxSwMax);
+    for (r = 0u; r < APP_MP_RES_NBR; r++) {
+        if (AppMp_ResRangeGet(p_para, r, &start, &end) == DEF_YES) {
+            work += p_mp->Ovh.Lock + p_mp->Ovh.Unlock;
+        }
+    }
+    avail  = APP_MP_OVH_RES - p_mp->Ovh.Tick;                   /* See Note #1.                                         */
+
+    return ((work + avail - 1u) / avail);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppMp_RtaGet()
+*
+* Description : Compute the response-time bound of a task among the tasks of a core, without blocking.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               ix          Index of the task.
+*
+*               core        Core.
+*
+*               ix_new      Index of a task considered on 'core' as well, or APP_MP_IX_NONE.
+*
+* Return(s)   : Bound, or -1 if the task is not schedulable (R >= T, see AppFuzz_BoundCalc()).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32S  AppMp_RtaGet (const  APP_MP      *p_mp,
+                                         CPU_INT32U   ix,
+                                         CPU_INT08U   core,
+                                         CPU_INT32U   ix_new)
+{
+    const  task_para_set  *p_para;
+    const  task_para_set  *p_hi;
+    CPU_INT32U             exec;
+    CPU_INT32U             resp;
+    CPU_INT32U             resp_next;
+    CPU_INT32U             j;
+
+
+    p_para = &p_mp->Task[ix].Para;
+    exec   = AppMp_ExecOvhGet(p_mp, ix);                        /* See 'app_mp.h  Note #7d'.                            */
+    resp   = exec;
+    for (;;) {
+        resp_next = exec;
+        for (j = 0u; j < ix; j++) {                             /* Tasks are in priority order.                         */
+            if ((p_mp->Task[j].Core != core) && (j != ix_new)) {
+                continue;
+            }
+            p_hi       = &p_mp->Task[j].Para;
+            resp_next += ((resp + p_hi->TaskPeriodic - 1u) / p_hi->TaskPeriodic) * AppMp_ExecOvhGet(p_mp, j);
+        }
+        if ((resp_next == resp) || (resp_next >= p_para->TaskPeriodic)) {
+            break;
+        }
+        resp = resp_next;
+    }
+
+    return ((resp_next < p_para->TaskPeriodic) ? (CPU_INT32S)resp_next : -1);
+}
+
+
+static  CPU_BOOLEAN  AppMp_CoreFits (const  APP_MP      *p_mp,
+                                            CPU_INT08U   core,
+                                            CPU_INT32U   ix_new)
+{
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < p_mp->TaskNbr; i++) {
+        if ((p_mp->Task[i].Core != core) && (i != ix_new)) {
+            continue;
+        }
+        if (AppMp_RtaGet(p_mp, i, core, ix_new) < 0) {
+            return (DEF_NO);
+        }
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppMp_Part()
+*
+* Description : Assign every task to a core, by decreasing utilization.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+* Return(s)   : DEF_OK,   if every task fits on a core.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) First-fit takes the first core the task fits on; worst-fit the least loaded one, so
+*                   that the load, & the slack left to blocking, is spread over the cores.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppMp_Part (APP_MP  *p_mp)
+{
+    const  task_para_set  *p_a;
+    const  task_para_set  *p_b;
+    APP_MP_CORE           *p_core;
+    CPU_INT08U             order[APP_MP_TASK_MAX];
+    CPU_INT08U             tmp;
+    CPU_INT08U             best;
+    CPU_INT08U             c;
+    CPU_INT32U             i;
+    CPU_INT32U             k;
+    CPU_INT32U             ix;
+
+
+    for (i = 0u; i < p_mp->TaskNbr; i++) {
+        order[i] = (CPU_INT08U)i;
+    }
+    for (i = 0u; (i + 1u) < p_mp->TaskNbr; i++) {               /* Stable sort by decreasing C / T.                     */
+        for (k = 0u; k < p_mp->TaskNbr - i - 1u; k++) {
+            p_a = &p_mp->Task[order[k]].Para;
+            p_b = &p_mp->Task[order[k + 1u]].Para;
+            if (((CPU_INT32U)p_a->TaskExecutionTime * p_b->TaskPeriodic) <
+                ((CPU_INT32U)p_b->TaskExecutionTime * p_a->TaskPeriodic)) {
+                tmp            = order[k];
+                order[k]       = order[k + 1u];
+                order[k + 1u]  = tmp;
+            }
+        }
+    }
+
+    for (i = 0u; i < p_mp->TaskNbr; i++) {                      /* See Note #1.                                         */
+        ix   = order[i];
+        best = APP_MP_IX_NONE;
+        for (c = 0u; c < p_mp->CoreNbr; c++) {
+            if (AppMp_CoreFits(p_mp, c, ix) == DEF_NO) {
+                continue;
+            }
+            if ((best == APP_MP_IX_NONE) ||
+                (p_mp->Core[c].UtilPermil < p_mp->Core[best].UtilPermil)) {
+                best = c;
+            }
+            if (p_mp->Sched == APP_MP_SCHED_FFD) {
+                break;
+            }
+        }
+        if (best == APP_MP_IX_NONE) {
+            return (DEF_FAIL);
+        }
+        p_core                  = &p_mp->Core[best];
+        p_mp->Task[ix].Core     = best;
+        p_core->TaskNbr++;
+        p_core->UtilPermil     += (p_mp->Task[ix].Para.TaskExecutionTime * 1000u) / p_mp->Task[ix].Para.TaskPeriodic;
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppMp_GrmRtaGet()
+*
+* Description : Compute the response-time bound of a task under global RM (see 'app_mp.h  Note #6d').
+*
+* Argument(s) : p_mp        Pointer to the model instance, with the bounds of the higher priority tasks.
+*
+*               ix          Index of the task.
+*
+* Return(s)   : Bound, or -1 if the task, or a higher priority task, is not schedulable (R >= T).
+*
+* Note(s)     : (1) R = C + floor(sum(min(W_i(R), R - C + 1)) / M) over the higher priority tasks i,
+*                   where W_i(L) = N * C_i + min(C_i, L + R_i - C_i - N * T_i), with
+*                   N = floor((L + R_i - C_i) / T_i), bounds the work of task i in a window of L ticks.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32S  AppMp_GrmRtaGet (const  APP_MP      *p_mp,
+                                            CPU_INT32U   ix)
+{
+    const  task_para_set  *p_para;
+    const  task_para_set  *p_hi;
+    CPU_INT32U             exec;
+    CPU_INT32U             exec_hi;
+    CPU_INT32U             resp;
+    CPU_INT32U             resp_next;
+    CPU_INT32U             intf;
+    CPU_INT32U             win;
+    CPU_INT32U             jobs;
+    CPU_INT32U             work;
+    CPU_INT32U             j;
+
+
+    for (j = 0u; j < ix; j++) {
+        if (p_mp->Task[j].Rta < 0) {
+            return (-1);
+        }
+    }
+    p_para = &p_mp->Task[ix].Para;
+    exec   = AppMp_ExecOvhGet(p_mp, ix);                        /* See 'app_mp.h  Note #7d'.                            */
+    resp   = exec;
+    for (;;) {
+        intf = 0u;
+        for (j = 0u; j < ix; j++) {                             /* See Note #1.                                         */
+            p_hi    = &p_mp->Task[j].Para;
+            exec_hi = AppMp_ExecOvhGet(p_mp, j);
+            win     = resp + (CPU_INT32U)p_mp->Task[j].Rta - exec_hi;
+            jobs    = win / p_hi->TaskPeriodic;
+            work    = (jobs * exec_hi)
+                    + DEF_MIN(exec_hi, win - (jobs * p_hi->TaskPeriodic));
+            intf   += DEF_MIN(work, resp - exec + 1u);
+        }
+        resp_next = exec + (intf / p_mp->CoreNbr);
+        if ((resp_next == resp) || (resp_next >= p_para->TaskPeriodic)) {
+            break;
+        }
+        resp = resp_next;
+    }
+
+    return ((resp_next < p_para->TaskPeriodic) ? (CPU_INT32S)resp_next : -1);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppMp_ResInit()
+*
+* Description : Classify the resources as local or global & compute the priority of their critical
+*               sections on each core.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Local ceilings are computed as InputFile() computes R1_ceiling & R2_ceiling : the
+*                   priority of the highest user minus R1_PRIO or R2_PRIO.
+*
+*               (2) Under MPCP, the critical sections of a core run at the ceiling of the users of the
+*                   OTHER cores, shifted above every task priority by APP_MP_PRIO_GCS.
+*
+*               (3) Under global scheduling, every resource used is global & its users are counted as
+*                   those of core 0; MPCP critical sections run at the ceiling of all of them.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_ResInit (APP_MP  *p_mp)
+{
+    APP_MP_RES    *p_res;
+    APP_MP_TASK   *p_task;
+    CPU_INT32S     ceil;
+    CPU_INT32S     ceil_core[APP_MP_CORE_MAX];
+    CPU_INT32U     start;
+    CPU_INT32U     end;
+    CPU_INT32U     i;
+    CPU_INT08U     r;
+    CPU_INT08U     c;
+    CPU_INT08U     c_first;
+    CPU_BOOLEAN    global;
+
+
+    global = APP_MP_SCHED_IS_GLOBAL(p_mp->Sched);
+    for (r = 0u; r < APP_MP_RES_NBR; r++) {
+        p_res          = &p_mp->Res[r];
+        p_res->OwnerIx = APP_MP_IX_NONE;
+        c_first        = APP_MP_IX_NONE;
+        for (c = 0u; c < APP_MP_CORE_MAX; c++) {
+            ceil_core[c] = DEF_INT_32S_MAX_VAL;
+        }
+        for (i = 0u; i < p_mp->TaskNbr; i++) {                  /* Highest user of each core (see Note #1).             */
+            p_task = &p_mp->Task[i];
+            if (AppMp_ResRangeGet(&p_task->Para, r, &start, &end) == DEF_NO) {
+                continue;
+            }
+            c    = (global == DEF_YES) ? 0u : p_task->Core;     /* See Note #3.                                         */
+            ceil = (CPU_INT32S)p_task->Para.TaskPriority - ((r == APP_MP_RES_R1) ? R1_PRIO : R2_PRIO);
+            ceil_core[c] = DEF_MIN(ceil_core[c], ceil);
+            if (c_first == APP_MP_IX_NONE) {
+                c_first = c;
+            } else if (c_first != c) {
+                p_res->Global = DEF_YES;
+            }
+            p_res->Used = DEF_YES;
+        }
+        if ((global == DEF_YES) && (p_res->Used == DEF_YES)) {
+            p_res->Global = DEF_YES;
+        }
+
+        for (c = 0u; c < p_mp->CoreNbr; c++) {
+            if (p_res->Global == DEF_NO) {
+                p_res->Ceiling[c] = ceil_core[c];
+            } else if (p_mp->Proto == APP_MP_PROTO_MSRP) {
+                p_res->Ceiling[c] = APP_MP_PRIO_NP;
+            } else {                                            /* See Note #2.                                         */
+                ceil = DEF_INT_32S_MAX_VAL;
+                for (i = 0u; i < p_mp->CoreNbr; i++) {
+                    if ((i != c) || (global == DEF_YES)) {
+                        ceil = DEF_MIN(ceil, ceil_core[i]);
+                    }
+                }
+                p_res->Ceiling[c] = ceil - APP_MP_PRIO_GCS;
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             SCHEDULING
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           AppMp_PrioGet()
+*
+* Description : Compute the effective priority of a task : its RM priority, raised to the ceiling of the
+*                 resources it holds, & made non-preemptive while it spins.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               ix          Index of the task.
+*
+* Return(s)   : Effective priority; the lower the value, the higher the priority.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32S  AppMp_PrioGet (const  APP_MP      *p_mp,
+                                          CPU_INT32U   ix)
+{
+    const  APP_MP_TASK  *p_task;
+    CPU_INT32S           prio;
+    CPU_INT08U           r;
+    CPU_INT08U           core;
+
+
+    p_task = &p_mp->Task[ix];
+    prio   = (CPU_INT32S)p_task->Para.TaskPriority;
+    core   = APP_MP_SCHED_IS_GLOBAL(p_mp->Sched) ? 0u : p_task->Core;
+    for (r = 0u; r < APP_MP_RES_NBR; r++) {
+        if (DEF_BIT_IS_SET(p_task->Held, DEF_BIT(r)) == DEF_YES) {
+            prio = DEF_MIN(prio, p_mp->Res[r].Ceiling[core]);
+        }
+    }
+    if (p_task->Spin == DEF_YES) {
+        prio = APP_MP_PRIO_NP;
+    }
+
+    return (prio);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppMp_Before()
+*
+* Description : Compare two tasks in the order of global scheduling.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               ix_a        Index of the first task.
+*
+*               ix_b        Index of the second task.
+*
+*               base        DEF_YES, to compare the jobs as released, ignoring the critical sections.
+*
+* Return(s)   : DEF_YES, if the job of 'ix_a' goes first.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : (1) Jobs in a global critical section go first, by effective priority; the others by RM
+*                   priority (APP_MP_SCHED_GRM) or absolute deadline (APP_MP_SCHED_GEDF).  Ties are
+*                   resolved by the RM priority.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppMp_Before (const  APP_MP       *p_mp,
+                                          CPU_INT32U    ix_a,
+                                          CPU_INT32U    ix_b,
+                                          CPU_BOOLEAN   base)
+{
+    const  APP_MP_TASK  *p_task;
+    CPU_INT32S           key[2];
+    CPU_INT32U           ix[2];
+    CPU_INT08U           k;
+
+
+    ix[0] = ix_a;
+    ix[1] = ix_b;
+    for (k = 0u; k < 2u; k++) {                                 /* See Note #1.                                         */
+        p_task = &p_mp->Task[ix[k]];
+        if ((base == DEF_NO) && (p_task->PrioCur < 0)) {
+            key[k] = p_task->PrioCur;
+        } else if (p_mp->Sched == APP_MP_SCHED_GEDF) {
+            key[k] = (CPU_INT32S)(p_task->Release + p_task->Para.TaskPeriodic);
+        } else {
+            key[k] = (CPU_INT32S)p_task->Para.TaskPriority;
+        }
+    }
+
+    return (((key[0] < key[1]) || ((key[0] == key[1]) && (ix_a < ix_b))) ? DEF_YES : DEF_NO);
+}
+
+
+static  void  AppMp_EventLog (APP_MP        *p_mp,
+                              CPU_INT08U     core,
+                              APP_MP_EVENT  *p_event)
+{
+    p_event->Event.Tick = p_mp->Time;
+    p_event->Core       = core;
+    if (p_mp->EventFnct != (APP_MP_EVENT_FNCT)0) {
+        p_mp->EventFnct(p_mp->EventArg, p_event);
+    }
+}
+
+
+static  void  AppMp_EventPend (APP_MP        *p_mp,            /* Hold a row until AppMp_PendFlush().                  */
+                               CPU_INT08U     core,
+                               APP_MP_EVENT  *p_event)
+{
+    if (p_mp->PendNbr >= APP_MP_PEND_MAX) {                     /* Cannot happen (see APP_MP_PEND_MAX) : log it now.    */
+        AppMp_EventLog(p_mp, core, p_event);
+        return;
+    }
+    p_event->Event.Tick          = p_mp->Time;
+    p_event->Core                = core;
+    p_mp->Pend[p_mp->PendNbr++]  = *p_event;
+}
+
+
+static  void  AppMp_PendFlush (APP_MP      *p_mp,              /* Log the rows held for a core (or all if NONE), ...   */
+                               CPU_INT08U   core,              /* ... of one task (or all if NONE).                    */
+                               CPU_INT08U   ix)
+{
+    CPU_INT32U  i;
+    CPU_INT32U  kept;
+
+
+    kept = 0u;
+    for (i = 0u; i < p_mp->PendNbr; i++) {
+        if (((core != APP_MP_IX_NONE) && (p_mp->Pend[i].Core != core)) ||
+            ((ix != APP_MP_IX_NONE) && (p_mp->Pend[i].Event.CurId != p_mp->Task[ix].Para.TaskID))) {
+            p_mp->Pend[kept++] = p_mp->Pend[i];
+        } else if (p_mp->EventFnct != (APP_MP_EVENT_FNCT)0) {
+            p_mp->EventFnct(p_mp->EventArg, &p_mp->Pend[i]);
+        }
+    }
+    p_mp->PendNbr = kept;
+}
+
+
+static  void  AppMp_ResLog (APP_MP      *p_mp,
+                            CPU_INT32U   ix,
+                            CPU_INT08U   res,
+                            CPU_INT08U   kind,
+                            CPU_INT32S   prio_from)
+{
+    APP_MP_TASK   *p_task;
+    APP_MP_EVENT   event;
+
+
+    p_task = &p_mp->Task[ix];
+    Mem_Clr(&event, sizeof(event));
+    event.Event.Kind   = kind;
+    event.Event.Res    = (CPU_INT08U)(res + 1u);
+    event.Event.CurId  = p_task->Para.TaskID;
+    event.Event.CurJob = (CPU_INT16U)p_task->Job;
+    event.PrioFrom     = prio_from;
+    event.PrioTo       = p_task->PrioCur;
+    AppMp_EventPend(p_mp, (p_task->RunCore != APP_MP_IX_NONE) ? p_task->RunCore : p_task->Core, &event);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppMp_Lock()
+*
+* Description : Lock a resource, or wait for it.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               ix          Index of the task.
+*
+*               res         Resource, APP_MP_RES_xxx.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Jobs spinning for a global resource (MSRP) are queued in FIFO order; suspended jobs
+*                   (MPCP, & local resources) in priority order.
+*
+*               (2) The chain of owners is followed to detect a deadlock, e.g. two jobs of different cores
+*                   nesting R1 & R2 in opposite orders.  The chain may also lead into a cycle that does not
+*                   contain the job, e.g. a third job waiting behind such a pair : it is followed for at
+*                   most 'TaskNbr' owners, past which it is a cycle as well.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_Lock (APP_MP      *p_mp,
+                          CPU_INT32U   ix,
+                          CPU_INT08U   res)
+{
+    APP_MP_TASK  *p_task;
+    APP_MP_RES   *p_res;
+    CPU_INT32S    prio_from;
+    CPU_INT32U    pos;
+    CPU_INT32U    k;
+    CPU_INT32U    hop;
+    CPU_INT08U    owner;
+
+
+    p_task    = &p_mp->Task[ix];
+    p_res     = &p_mp->Res[res];
+    prio_from = p_task->PrioCur;
+
+    if (p_res->OwnerIx == APP_MP_IX_NONE) {
+        p_res->OwnerIx = (CPU_INT08U)ix;
+        p_res->LockCtr++;
+        DEF_BIT_SET(p_task->Held, DEF_BIT(res));
+        p_task->PrioCur = AppMp_PrioGet(p_mp, ix);
+        AppMp_ResLog(p_mp, ix, res, APP_TSB_EVENT_LOCK, prio_from);
+        return;
+    }
+
+    p_res->ContendCtr++;
+    p_task->WaitRes = res;
+    p_task->Spin    = ((p_res->Global == DEF_YES) && (p_mp->Proto == APP_MP_PROTO_MSRP)) ? DEF_YES : DEF_NO;
+    p_task->PrioCur = AppMp_PrioGet(p_mp, ix);
+
+    pos = p_res->WaitNbr;                                       /* See Note #1.                                         */
+    if (p_task->Spin == DEF_NO) {
+        while ((pos > 0u) && (p_mp->Task[p_res->WaitIx[pos - 1u]].Para.TaskPriority > p_task->Para.TaskPriority)) {
+            pos--;
+        }
+    }
+    for (k = p_res->WaitNbr; k > pos; k--) {
+        p_res->WaitIx[k] = p_res->WaitIx[k - 1u];
+    }
+    p_res->WaitIx[pos] = (CPU_INT08U)ix;
+    p_res->WaitNbr++;
+
+    owner = p_res->OwnerIx;                                     /* See Note #2.                                         */
+    for (hop = 0u; owner != APP_MP_IX_NONE; hop++) {
+        if ((owner == ix) || (hop >= p_mp->TaskNbr)) {
+            p_mp->Err = APP_MP_ERR_DEADLOCK;
+            return;
+        }
+        if (p_mp->Task[owner].WaitRes == APP_MP_RES_NONE) {
+            break;
+        }
+        owner = p_mp->Res[p_mp->Task[owner].WaitRes].OwnerIx;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppMp_Unlock()
+*
+* Description : Unlock a resource & hand it to the first job waiting for it, if any.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               ix          Index of the task.
+*
+*               res         Resource, APP_MP_RES_xxx.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_Unlock (APP_MP      *p_mp,
+                            CPU_INT32U   ix,
+                            CPU_INT08U   res)
+{
+    APP_MP_TASK  *p_task;
+    APP_MP_RES   *p_res;
+    CPU_INT32S    prio_from;
+    CPU_INT32U    k;
+    CPU_INT08U    next;
+
+
+    p_task    = &p_mp->Task[ix];
+    p_res     = &p_mp->Res[res];
+    prio_from = p_task->PrioCur;
+    DEF_BIT_CLR(p_task->Held, DEF_BIT(res));
+    p_res->OwnerIx  = APP_MP_IX_NONE;
+    p_task->PrioCur = AppMp_PrioGet(p_mp, ix);
+    AppMp_ResLog(p_mp, ix, res, APP_TSB_EVENT_UNLOCK, prio_from);
+
+    if (p_res->WaitNbr == 0u) {
+        return;
+    }
+    next = p_res->WaitIx[0];
+    p_res->WaitNbr--;
+    for (k = 0u; k < p_res->WaitNbr; k++) {
+        p_res->WaitIx[k] = p_res->WaitIx[k + 1u];
+    }
+    p_task          = &p_mp->Task[next];
+    prio_from       = p_task->PrioCur;
+    p_task->WaitRes = APP_MP_RES_NONE;
+    p_task->Spin    = DEF_NO;
+    p_res->OwnerIx  = next;
+    p_res->LockCtr++;
+    DEF_BIT_SET(p_task->Held, DEF_BIT(res));
+    p_task->PrioCur = AppMp_PrioGet(p_mp, next);
+    AppMp_ResLog(p_mp, next, res, APP_TSB_EVENT_LOCK, prio_from);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppMp_CtxSwCostGet()
+*
+* Description : Draw the cost of a context switch (see 'app_mp.h  Note #7a').
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+* Return(s)   : Cost, in 1/APP_MP_OVH_RES tick.
+*
+* Note(s)     : (1) The draw is xorshift32 seeded by 'Ovh.Seed', so that a run is reproducible.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppMp_CtxSwCostGet (APP_MP  *p_mp)
+{
+    CPU_INT32U  x;
+
+
+    if (p_mp->Ovh.CtxSwMax == p_mp->Ovh.CtxSwMin) {
+        return (p_mp->Ovh.CtxSwMin);
+    }
+    x              = p_mp->OvhRand;                             /* See Note #1.                                         */
+    x             ^= x << 13u;
+    x             ^= x >> 17u;
+    x             ^= x <<  5u;
+    p_mp->OvhRand  = x;
+
+    return (p_mp->Ovh.CtxSwMin + (x % (p_mp->Ovh.CtxSwMax - p_mp->Ovh.CtxSwMin + 1u)));
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppMp_OvhLockCharge()
+*
+* Description : Charge the cost of a lock or an unlock to the calling job (see 'app_mp.h  Note #7a').
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               ix          Index of the task.
+*
+*               cost        Cost, in 1/APP_MP_OVH_RES tick.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_OvhLockCharge (APP_MP      *p_mp,
+                                   CPU_INT32U   ix,
+                                   CPU_INT32U   cost)
+{
+    APP_MP_TASK  *p_task;
+    CPU_INT08U    core;
+
+
+    p_task           = &p_mp->Task[ix];
+    p_task->OvhDebt += cost;
+    p_task->OvhLock += cost;
+    core             = (p_task->RunCore != APP_MP_IX_NONE) ? p_task->RunCore : p_task->Core;
+    if (core != APP_MP_IX_NONE) {
+        p_mp->Core[core].OvhLock += cost;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppMp_Step()
+*
+* Description : Unlock, then lock, the resources a job reaches before executing its next tick, as task()
+*               does.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               ix          Index of the task given the CPU.
+*
+* Return(s)   : DEF_YES, if a resource was locked, unlocked or waited for.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppMp_Step (APP_MP      *p_mp,
+                                 CPU_INT32U   ix)
+{
+    APP_MP_TASK  *p_task;
+    CPU_BOOLEAN   changed;
+    CPU_INT32U    start;
+    CPU_INT32U    end;
+    CPU_INT08U    r;
+
+
+    p_task  = &p_mp->Task[ix];
+    changed = DEF_NO;
+    if (p_task->WaitRes != APP_MP_RES_NONE) {                   /* Still spinning.                                      */
+        return (DEF_NO);
+    }
+    for (r = 0u; r < APP_MP_RES_NBR; r++) {
+        if ((AppMp_ResRangeGet(&p_task->Para, r, &start, &end) == DEF_YES) &&
+            (p_task->Exec == end) &&
+            (DEF_BIT_IS_SET(p_task->Held, DEF_BIT(r)) == DEF_YES)) {
+            AppMp_Unlock(p_mp, ix, r);
+            AppMp_OvhLockCharge(p_mp, ix, p_mp->Ovh.Unlock);
+            changed = DEF_YES;
+        }
+    }
+    for (r = 0u; r < APP_MP_RES_NBR; r++) {
+        if ((AppMp_ResRangeGet(&p_task->Para, r, &start, &end) == DEF_YES) &&
+            (p_task->Exec == start) &&
+            (DEF_BIT_IS_CLR(p_task->Held, DEF_BIT(r)) == DEF_YES)) {
+            AppMp_Lock(p_mp, ix, r);
+            AppMp_OvhLockCharge(p_mp, ix, p_mp->Ovh.Lock);
+            changed = DEF_YES;
+            if (p_task->WaitRes != APP_MP_RES_NONE) {
+                break;
+            }
+        }
+    }
+
+    return (changed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppMp_Dispatch()
+*
+* Description : Give the CPU of a core to its highest priority job that is not suspended.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               core        Core.
+*
+* Return(s)   : DEF_YES, if a resource was locked, unlocked or waited for.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : (1) Equal effective priorities are resolved by the RM priority.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppMp_Dispatch (APP_MP      *p_mp,
+                                     CPU_INT08U   core)
+{
+    const  APP_MP_TASK  *p_task;
+    CPU_BOOLEAN          changed;
+    CPU_INT32U           i;
+    CPU_INT08U           best;
+
+
+    changed = DEF_NO;
+    for (;;) {
+        best = APP_MP_IX_NONE;
+        for (i = 0u; i < p_mp->TaskNbr; i++) {                  /* See Note #1.                                         */
+            p_task = &p_mp->Task[i];
+            if ((p_task->Core != core) || (p_task->Rdy == DEF_NO) ||
+                ((p_task->WaitRes != APP_MP_RES_NONE) && (p_task->Spin == DEF_NO))) {
+                continue;
+            }
+            if ((best == APP_MP_IX_NONE) || (p_task->PrioCur < p_mp->Task[best].PrioCur)) {
+                best = (CPU_INT08U)i;
+            }
+        }
+        p_mp->Core[core].CurIx = best;
+        if ((best == APP_MP_IX_NONE) || (AppMp_Step(p_mp, best) == DEF_NO)) {
+            break;
+        }
+        changed = DEF_YES;
+        if (p_mp->Err != APP_MP_ERR_NONE) {
+            break;
+        }
+    }
+
+    return (changed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppMp_GlobalDispatch()
+*
+* Description : Give the cores to the highest priority jobs that are not suspended, whatever their core
+*               (see 'app_mp.h  Note #6').
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+* Return(s)   : DEF_YES, if a resource was locked, unlocked or waited for.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : (1) The jobs are inserted in 'sel[]', kept sorted by AppMp_Before(); a job that would
+*                   land past the last core is dropped, so that the pass costs O(N * M).
+*
+*               (2) A job keeps the core it ran on during the previous tick, then takes the core its job
+*                   last ran on if it is still free, then the first free core.
+*
+*               (3) Locking or unlocking changes the order of the jobs : they are selected again.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppMp_GlobalDispatch (APP_MP  *p_mp)
+{
+    APP_MP_TASK  *p_task;
+    CPU_BOOLEAN   changed;
+    CPU_BOOLEAN   stepped;
+    CPU_INT08U    sel[APP_MP_CORE_MAX];
+    CPU_INT08U    sel_nbr;
+    CPU_INT08U    pos;
+    CPU_INT08U    pass;
+    CPU_INT08U    c;
+    CPU_INT08U    k;
+    CPU_INT32U    i;
+
+
+    changed = DEF_NO;
+    for (;;) {
+        sel_nbr = 0u;                                           /* See Note #1.                                         */
+        for (i = 0u; i < p_mp->TaskNbr; i++) {
+            p_task          = &p_mp->Task[i];
+            p_task->RunCore = APP_MP_IX_NONE;
+            if ((p_task->Rdy == DEF_NO) ||
+                ((p_task->WaitRes != APP_MP_RES_NONE) && (p_task->Spin == DEF_NO))) {
+                continue;
+            }
+            pos = sel_nbr;
+            while ((pos > 0u) && (AppMp_Before(p_mp, i, sel[pos - 1u], DEF_NO) == DEF_YES)) {
+                pos--;
+            }
+            if (pos >= p_mp->CoreNbr) {
+                continue;
+            }
+            if (sel_nbr < p_mp->CoreNbr) {
+                sel_nbr++;
+            }
+            for (k = sel_nbr - 1u; k > pos; k--) {
+                sel[k] = sel[k - 1u];
+            }
+            sel[pos] = (CPU_INT08U)i;
+        }
+
+        for (c = 0u; c < p_mp->CoreNbr; c++) {
+            p_mp->Core[c].CurIx = APP_MP_IX_NONE;
+        }
+        for (pass = 0u; pass < 3u; pass++) {                    /* See Note #2.                                         */
+            for (k = 0u; k < sel_nbr; k++) {
+                p_task = &p_mp->Task[sel[k]];
+                c      = p_task->Core;
+                if (p_task->RunCore != APP_MP_IX_NONE) {
+                    continue;
+                }
+                if (pass == 0u) {
+                    if ((c == APP_MP_IX_NONE) || (p_mp->Core[c].PrevIx != sel[k])) {
+                        continue;
+                    }
+                } else if (pass == 1u) {
+                    if ((c == APP_MP_IX_NONE) || (p_mp->Core[c].CurIx != APP_MP_IX_NONE)) {
+                        continue;
+                    }
+                } else {
+                    c = 0u;
+                    while (p_mp->Core[c].CurIx != APP_MP_IX_NONE) {
+                        c++;
+                    }
+                }
+                p_mp->Core[c].CurIx = sel[k];
+                p_task->RunCore     = c;
+            }
+        }
+
+        stepped = DEF_NO;                                       /* See Note #3.                                         */
+        for (k = 0u; k < sel_nbr; k++) {
+            if (AppMp_Step(p_mp, sel[k]) == DEF_YES) {
+                stepped = DEF_YES;
+                break;
+            }
+        }
+        if (stepped == DEF_NO) {
+            break;
+        }
+        changed = DEF_YES;
+        if (p_mp->Err != APP_MP_ERR_NONE) {
+            break;
+        }
+    }
+
+    return (changed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppMp_RunUpdate()
+*
+* Description : Record the core running each job this tick & count the preemptions & migrations (see
+*               'app_mp.h  Note #6c').
+*
+* Argument(s) : p_mp        Pointer to the model instance, dispatched.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A job that ran the previous tick & now waits for a resource is blocked, not
+*                   preempted.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_RunUpdate (APP_MP  *p_mp)
+{
+    APP_MP_TASK  *p_task;
+    APP_MP_CORE  *p_core;
+    CPU_INT32U    i;
+    CPU_INT08U    c;
+
+
+    for (i = 0u; i < p_mp->TaskNbr; i++) {
+        p_mp->Task[i].RunCore = APP_MP_IX_NONE;
+    }
+    for (c = 0u; c < p_mp->CoreNbr; c++) {
+        if (p_mp->Core[c].CurIx != APP_MP_IX_NONE) {
+            p_mp->Task[p_mp->Core[c].CurIx].RunCore = c;
+        }
+    }
+    for (c = 0u; c < p_mp->CoreNbr; c++) {                      /* See Note #1.                                         */
+        p_core = &p_mp->Core[c];
+        if ((p_core->PrevIx == APP_MP_IX_NONE) || (p_core->PrevDone == DEF_YES)) {
+            continue;
+        }
+        p_task = &p_mp->Task[p_core->PrevIx];
+        if ((p_task->RunCore == APP_MP_IX_NONE) && (p_task->WaitRes == APP_MP_RES_NONE)) {
+            p_task->PreemptCtr++;
+        }
+    }
+
+    if (APP_MP_SCHED_IS_GLOBAL(p_mp->Sched) == DEF_NO) {
+        return;
+    }
+    for (i = 0u; i < p_mp->TaskNbr; i++) {
+        p_task = &p_mp->Task[i];
+        if (p_task->RunCore == APP_MP_IX_NONE) {
+            continue;
+        }
+        if ((p_task->Core != APP_MP_IX_NONE) && (p_task->Core != p_task->RunCore)) {
+            p_task->MigrateCtr++;
+            p_task->MigRem += p_mp->MigCost;
+        }
+        p_task->Core = p_task->RunCore;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppMp_SwLog()
+*
+* Description : Log the context switch of a core, as App_TaskSwHook() does.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               core        Core.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A job that completes & is released again on the same tick keeps the CPU; the kernel
+*                   still logs its completion.
+*
+*               (2) The lock & unlock rows of the job leaving the CPU precede the switch, those of the job
+*                   given the CPU follow it, & the switch of OSStart() is not logged (see 'app_mp.h
+*                   Note #2').
+*********************************************************************************************************
+*/
+
+static  void  AppMp_SwLog (APP_MP      *p_mp,
+                           CPU_INT08U   core)
+{
+    APP_MP_CORE   *p_core;
+    APP_MP_TASK   *p_task;
+    APP_MP_EVENT   event;
+    CPU_INT32U     cost;
+
+
+    p_core = &p_mp->Core[core];
+    if ((p_core->CurIx == p_core->PrevIx) && (p_core->PrevDone == DEF_NO)) {
+        AppMp_PendFlush(p_mp, core, APP_MP_IX_NONE);            /* See Note #2.                                         */
+        return;
+    }
+    if (p_core->CurIx != p_core->PrevIx) {                      /* See Note #1.                                         */
+        p_core->CtxSwCtr++;
+        cost              = AppMp_CtxSwCostGet(p_mp);           /* See 'app_mp.h  Note #7a'.                            */
+        p_core->OvhCtxSw += cost;
+        if (p_core->CurIx == APP_MP_IX_NONE) {
+            p_core->OvhIdle  += cost;
+        } else {
+            p_task            = &p_mp->Task[p_core->CurIx];
+            p_task->OvhDebt  += cost;
+            p_task->OvhCtxSw += cost;
+        }
+    }
+
+    Mem_Clr(&event, sizeof(event));
+    if (p_core->PrevIx == APP_MP_IX_NONE) {
+        event.Event.CurId  = APP_TSB_TASK_IDLE;
+        event.Event.CurJob = OS_TASK_IDLE_PRIO;
+    } else {
+        event.Event.CurId  = p_mp->Task[p_core->PrevIx].Para.TaskID;
+        event.Event.CurJob = (CPU_INT16U)p_core->PrevJob;
+    }
+    if (p_core->CurIx == APP_MP_IX_NONE) {
+        event.Event.NextId  = APP_TSB_TASK_IDLE;
+        event.Event.NextJob = OS_TASK_IDLE_PRIO;
+    } else {
+        event.Event.NextId  = p_mp->Task[p_core->CurIx].Para.TaskID;
+        event.Event.NextJob = (CPU_INT16U)p_mp->Task[p_core->CurIx].Job;
+    }
+    if (p_core->PrevDone == DEF_YES) {
+        event.Event.Kind = APP_TSB_EVENT_COMPLETION;
+        event.Event.Resp = (CPU_INT16U)p_core->PrevResp;
+        event.Event.Blk  = (CPU_INT16U)p_core->PrevBlk;
+        event.Event.Pre  = (CPU_INT16S)((CPU_INT32S)p_core->PrevResp
+                                      - (CPU_INT32S)p_mp->Task[p_core->PrevIx].Para.TaskExecutionTime
+                                      - (CPU_INT32S)p_core->PrevBlk);
+    } else {
+        event.Event.Kind = APP_TSB_EVENT_PREEMPTION;
+    }
+    if (p_core->PrevIx != APP_MP_IX_NONE) {                     /* See Note #2.                                         */
+        AppMp_PendFlush(p_mp, core, p_core->PrevIx);
+    }
+    if (p_mp->Time != 0u) {
+        AppMp_EventLog(p_mp, core, &event);
+    }
+    AppMp_PendFlush(p_mp, core, APP_MP_IX_NONE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppMp_BlkUpdate()
+*
+* Description : Charge the tick to the blocking of the jobs that do not execute (see 'app_mp.h  Note #3').
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_BlkUpdate (APP_MP  *p_mp)
+{
+    APP_MP_TASK  *p_task;
+    CPU_INT08U    cur;
+    CPU_INT08U    c;
+    CPU_INT32U    i;
+
+
+    for (i = 0u; i < p_mp->TaskNbr; i++) {
+        p_task = &p_mp->Task[i];
+        if (p_task->Rdy == DEF_NO) {
+            continue;
+        }
+        if (p_task->WaitRes != APP_MP_RES_NONE) {               /* Suspended or spinning.                               */
+            if (p_mp->Res[p_task->WaitRes].Global == DEF_YES) {
+                p_task->BlkRemote++;
+                p_task->BlkRemoteTot++;
+            } else {
+                p_task->BlkLocal++;
+            }
+            if (p_task->Spin == DEF_YES) {
+                p_task->SpinTot++;
+            }
+        } else if (APP_MP_SCHED_IS_GLOBAL(p_mp->Sched)) {
+            if (p_task->RunCore != APP_MP_IX_NONE) {
+                continue;
+            }
+            for (c = 0u; c < p_mp->CoreNbr; c++) {
+                cur = p_mp->Core[c].CurIx;
+                if ((cur != APP_MP_IX_NONE) && (AppMp_Before(p_mp, i, cur, DEF_YES) == DEF_YES)) {
+                    p_task->BlkLocal++;
+                    break;
+                }
+            }
+        } else {
+            cur = p_mp->Core[p_task->Core].CurIx;
+            if ((cur != i) && (cur != APP_MP_IX_NONE) &&
+                (p_mp->Task[cur].Para.TaskPriority > p_task->Para.TaskPriority)) {
+                p_task->BlkLocal++;
+            }
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppMp_Exec()
+*
+* Description : Execute the tick on a core; 'p_mp->Time' is already the end of the tick.
+*
+* Argument(s) : p_mp        Pointer to the model instance.
+*
+*               core        Core.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The tick ISR runs first (see 'app_mp.h  Note #7b'); the job pays what it owes from the
+*                   rest of the tick & works with what is left (see 'app_mp.h  Note #7a & #7c').  Without
+*                   overhead, 'Exec' grows by one tick.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_Exec (APP_MP      *p_mp,
+                          CPU_INT08U   core)
+{
+    APP_MP_CORE  *p_core;
+    APP_MP_TASK  *p_task;
+    CPU_INT32U    avail;
+    CPU_INT32U    paid;
+    CPU_INT32U    resp;
+    CPU_INT32U    blk;
+    CPU_INT08U    r;
+
+
+    p_core           = &p_mp->Core[core];
+    p_core->PrevIx   = p_core->CurIx;
+    p_core->PrevDone = DEF_NO;
+    p_core->PrevMig  = DEF_NO;
+    p_core->OvhTick += p_mp->Ovh.Tick;                          /* See Note #1.                                         */
+    if (p_core->CurIx == APP_MP_IX_NONE) {
+        p_core->IdleCtr++;
+        p_core->OvhIdle += p_mp->Ovh.Tick;
+        return;
+    }
+    p_task           = &p_mp->Task[p_core->CurIx];
+    p_core->PrevJob  = p_task->Job;
+    p_task->OvhTick += p_mp->Ovh.Tick;
+    if (p_task->Spin == DEF_YES) {
+        p_core->SpinCtr++;
+        return;
+    }
+    if (p_task->MigRem > 0u) {                                  /* See 'app_mp.h  Note #6c'.                            */
+        p_task->MigRem--;
+        p_core->MigCtr++;
+        p_core->PrevMig = DEF_YES;
+        return;
+    }
+    p_core->BusyCtr++;
+    avail            = APP_MP_OVH_RES - p_mp->Ovh.Tick;
+    paid             = DEF_MIN(avail, p_task->OvhDebt);
+    p_task->OvhDebt -= paid;
+    p_task->Work    += avail - paid;
+    p_task->Exec     = p_task->Work / APP_MP_OVH_RES;
+    if (p_task->Exec < p_task->Para.TaskExecutionTime) {
+        return;
+    }
+                                                                /* ----------------- JOB COMPLETED ------------------ */
+    for (r = 0u; r < APP_MP_RES_NBR; r++) {
+        if (DEF_BIT_IS_SET(p_task->Held, DEF_BIT(r)) == DEF_YES) {
+            AppMp_Unlock(p_mp, p_core->CurIx, r);
+        }
+    }
+    resp                 = p_mp->Time - p_task->Release;
+    blk                  = p_task->BlkLocal + p_task->BlkRemote;
+    p_task->RespMax      = DEF_MAX(p_task->RespMax,      resp);
+    p_task->BlkLocalMax  = DEF_MAX(p_task->BlkLocalMax,  p_task->BlkLocal);
+    p_task->BlkRemoteMax = DEF_MAX(p_task->BlkRemoteMax, p_task->BlkRemote);
+    p_task->JobNbr++;
+    p_task->Job++;
+    p_task->Rdy          = DEF_NO;
+    p_core->PrevDone     = DEF_YES;
+    p_core->PrevResp     = resp;
+    p_core->PrevBlk      = blk;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                              REPORTING
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void  AppMp_PrioWr (FILE        *p_fp,
+                            CPU_INT32S   prio)
+{
+    if (prio <= APP_MP_PRIO_NP) {
+        fprintf(p_fp, "NP");
+    } else if (prio < 0) {
+        fprintf(p_fp, "G%d", (int)(prio + APP_MP_PRIO_GCS));
+    } else {
+        fprintf(p_fp, "%d", (int)prio);
+    }
+}
+
+
+static  CPU_BOOLEAN  AppMp_OvhIsSet (const  APP_MP_OVH  *p_ovh)
+{
+    return (((p_ovh->CtxSwMax | p_ovh->Tick | p_ovh->Lock | p_ovh->Unlock) != 0u) ? DEF_YES : DEF_NO);
+}
+
+
+static  void  AppMp_OvhWr (FILE        *p_fp,                   /* Overhead units, printed in ticks.                    */
+                           CPU_INT32U   val)
+{
+    fprintf(p_fp, "%u.%03u", (unsigned)(val / APP_MP_OVH_RES),
+            (unsigned)(((val % APP_MP_OVH_RES) * 1000u) / APP_MP_OVH_RES));
+}
+
+
+static  void  AppMp_OvhCfgWr (const  APP_MP_OVH  *p_ovh)
+{
+    if (AppMp_OvhIsSet(p_ovh) == DEF_NO) {
+        return;
+    }
+    printf(", overhead ctx sw ");
+    AppMp_OvhWr(stdout, p_ovh->CtxSwMin);
+    printf("-");
+    AppMp_OvhWr(stdout, DEF_MAX(p_ovh->CtxSwMax, p_ovh->CtxSwMin));
+    printf(", tick ");
+    AppMp_OvhWr(stdout, p_ovh->Tick);
+    printf(", lock ");
+    AppMp_OvhWr(stdout, p_ovh->Lock);
+    printf(", unlock ");
+    AppMp_OvhWr(stdout, p_ovh->Unlock);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppMp_EventWr()
+*
+* Description : Print one row of the log (see 'app_mp.h  Note #2').
+*
+* Argument(s) : p_arg       Pointer to the files of the run (see APP_MP_FILE).
+*
+*               p_event     Pointer to the event.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_EventWr (       void          *p_arg,
+                             const  APP_MP_EVENT  *p_event)
+{
+    FILE  *p_fp;
+
+
+    p_fp = ((APP_MP_FILE *)p_arg)->OutputPtr;
+    if (p_fp == (FILE *)0) {
+        return;
+    }
+    if (p_event->Core == APP_MP_IX_NONE) {                      /* Job missed its deadline before running.              */
+        fprintf(p_fp, "C-\t");
+    } else {
+        fprintf(p_fp, "C%u\t", (unsigned)p_event->Core);
+    }
+    if ((p_event->Event.Kind == APP_TSB_EVENT_LOCK) ||
+        (p_event->Event.Kind == APP_TSB_EVENT_UNLOCK)) {
+        fprintf(p_fp, "%d\t%s\ttask( %d)( %d)\tR%d ",
+                (int)p_event->Event.Tick,
+                (p_event->Event.Kind == APP_TSB_EVENT_LOCK) ? "LockResource" : "UnlockResource",
+                p_event->Event.CurId, p_event->Event.CurJob, p_event->Event.Res);
+        AppMp_PrioWr(p_fp, p_event->PrioFrom);
+        fprintf(p_fp, " to ");
+        AppMp_PrioWr(p_fp, p_event->PrioTo);
+        fprintf(p_fp, "\n");
+    } else {
+        AppTsb_EventWr(p_fp, &p_event->Event);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppMp_RptWr()
+*
+* Description : Print the partition, the cores & the resources, & write the statistics of every task.
+*
+* Argument(s) : p_mp        Pointer to the model instance, once stopped.
+*
+*               p_stat_path Path of the CSV file, overwritten.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Remote blocking is the time spent waiting for global resources held from other cores,
+*                   suspended (MPCP) or spinning (MSRP); 'spin' is the part of it spent spinning.
+*
+*               (2) Under global scheduling, 'core' is the core the last job ran on, or -1.
+*********************************************************************************************************
+*/
+
+static  void  AppMp_RptWr (const  APP_MP    *p_mp,
+                           const  CPU_CHAR  *p_stat_path)
+{
+    const  APP_MP_TASK  *p_task;
+    const  APP_MP_CORE  *p_core;
+    const  APP_MP_RES   *p_res;
+    FILE                *p_fp;
+    CPU_INT32U           preempt;
+    CPU_INT32U           migrate;
+    CPU_INT32U           i;
+    CPU_INT08U           c;
+    CPU_INT08U           r;
+
+
+    for (c = 0u; c < p_mp->CoreNbr; c++) {
+        p_core = &p_mp->Core[c];
+        printf("\tC%u", (unsigned)c);
+        if (APP_MP_SCHED_IS_GLOBAL(p_mp->Sched) == DEF_NO) {
+            printf("\tutil %3u.%u%%\ttasks",
+                   (unsigned)(p_core->UtilPermil / 10u), (unsigned)(p_core->UtilPermil % 10u));
+            for (i = 0u; i < p_mp->TaskNbr; i++) {
+                if (p_mp->Task[i].Core == c) {
+                    printf(" %u", (unsigned)p_mp->Task[i].Para.TaskID);
+                }
+            }
+        }
+        printf("\n\t\tbusy %u, spin %u, migrate %u, idle %u, %u context switch(es)\n",
+               (unsigned)p_core->BusyCtr, (unsigned)p_core->SpinCtr, (unsigned)p_core->MigCtr,
+               (unsigned)p_core->IdleCtr, (unsigned)p_core->CtxSwCtr);
+        if (AppMp_OvhIsSet(&p_mp->Ovh) == DEF_YES) {            /* Overheads in ticks (see 'app_mp.h  Note #7').        */
+            printf("\t\toverhead : ctx sw ");
+            AppMp_OvhWr(stdout, p_core->OvhCtxSw);
+            printf(", tick ");
+            AppMp_OvhWr(stdout, p_core->OvhTick);
+            printf(", lock ");
+            AppMp_OvhWr(stdout, p_core->OvhLock);
+            printf(", of which idle ");
+            AppMp_OvhWr(stdout, p_core->OvhIdle);
+            printf("\n");
+        }
+    }
+    preempt = 0u;
+    migrate = 0u;
+    for (i = 0u; i < p_mp->TaskNbr; i++) {
+        preempt += p_mp->Task[i].PreemptCtr;
+        migrate += p_mp->Task[i].MigrateCtr;
+    }
+    printf("\t%u preemption(s), %u migration(s)\n", (unsigned)preempt, (unsigned)migrate);
+    for (r = 0u; r < APP_MP_RES_NBR; r++) {
+        p_res = &p_mp->Res[r];
+        if (p_res->Used == DEF_NO) {
+            continue;
+        }
+        printf("\tR%u\t%s\t%u lock(s), %u contended\n", (unsigned)(r + 1u),
+               (p_res->Global == DEF_YES) ? AppMp_ProtoNameTbl[p_mp->Proto] : "cpp",
+               (unsigned)p_res->LockCtr, (unsigned)p_res->ContendCtr);
+    }
+
+    if (fopen_s(&p_fp, p_stat_path, "w") != 0) {
+        return;
+    }
+    fprintf(p_fp, "task,core,prio,period,exec,rta,jobs,resp_max,blk_local_max,blk_remote_max,blk_remote_tot,spin_tot,preempt,migrate,ovh_ctxsw,ovh_tick,ovh_lock\n");
+    for (i = 0u; i < p_mp->TaskNbr; i++) {                      /* See Note #1 & #2.                                    */
+        p_task = &p_mp->Task[i];
+        fprintf(p_fp, "%u,%d,%u,%u,%u,%d,%u,%u,%u,%u,%u,%u,%u,%u,",
+                (unsigned)p_task->Para.TaskID,           (p_task->Core == APP_MP_IX_NONE) ? -1 : (int)p_task->Core,
+                (unsigned)p_task->Para.TaskPriority,     (unsigned)p_task->Para.TaskPeriodic,
+                (unsigned)p_task->Para.TaskExecutionTime, (int)p_task->Rta,
+                (unsigned)p_task->JobNbr,                (unsigned)p_task->RespMax,
+                (unsigned)p_task->BlkLocalMax,           (unsigned)p_task->BlkRemoteMax,
+                (unsigned)p_task->BlkRemoteTot,          (unsigned)p_task->SpinTot,
+                (unsigned)p_task->PreemptCtr,            (unsigned)p_task->MigrateCtr);
+        AppMp_OvhWr(p_fp, p_task->OvhCtxSw);
+        fprintf(p_fp, ",");
+        AppMp_OvhWr(p_fp, p_task->OvhTick);
+        fprintf(p_fp, ",");
+        AppMp_OvhWr(p_fp, p_task->OvhLock);
+        fprintf(p_fp, "\n");
+    }
+    fclose(p_fp);
+}
@@ -0,0 +1,346 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                   MULTIPROCESSOR SCHEDULING MODEL
+*
+* Filename : app_mp.h
+*
+* Note(s)  : (1) The model runs a task set of the 'TaskSet.txt' format on APP_MP_CORE_MAX cores at most,
+*                one tick at a time & without threads, as the virtual-time model of app_sim.h does for
+*                one core.  Unlike app_sim.c, it follows the task model rather than the kernel code :
+*
+*                (a) Priorities are assigned by Rate Monotonic over the whole set, as InputFile() does.
+*
+*                (b) Partitioned scheduling : tasks are assigned by decreasing utilization, either
+*                    first-fit (APP_MP_SCHED_FFD) or worst-fit (APP_MP_SCHED_WFD); a task fits on a core
+*                    if every task of the core passes the response-time test (R < T) without blocking.
+*                    Each core then schedules its own tasks by priority.
+*
+*                (c) Global scheduling : the 'CoreNbr' highest priority ready jobs run, whatever their
+*                    core, by RM priority (APP_MP_SCHED_GRM) or earliest deadline (APP_MP_SCHED_GEDF).
+*                    See Note #6.
+*
+*                (d) A resource only used by the tasks of one core is local & locked with the Priority
+*                    Ceiling Protocol, as OSMutexPend() does.  A resource used from several cores, or any
+*                    resource under global scheduling, is global & locked with :
+*
+*                        APP_MP_PROTO_MPCP    Multiprocessor PCP : a job that finds the resource busy
+*                                             is suspended in priority order; the critical section runs
+*                                             above every task of its core, at the highest priority of
+*                                             the tasks of the other cores that use the resource.
+*
+*                        APP_MP_PROTO_MSRP    Multiprocessor SRP : a job that finds the resource busy
+*                                             spins non-preemptively in FIFO order; the critical section
+*                                             runs non-preemptively.
+*
+*                (e) A job locks or unlocks a resource when it is given the CPU with 'R_start' or 'R_end'
+*                    ticks executed; a job still holding a resource when it completes releases it.
+*
+*            (2) Every core logs the rows the kernel prints to 'Output.txt', prefixed with the core
+*                number, or 'C-' for a globally scheduled job that missed its deadline before running.
+*                Priorities of global critical sections are printed 'G<prio>' (MPCP) & 'NP' (MSRP,
+*                non-preemptive).  As in the kernel, a switch is logged after the lock & unlock rows of the
+*                job leaving the CPU & before those of the job given the CPU, & the first switch
+*                (OSStart()) is not logged : on one core, the rows are those of 'Output.txt' (see
+*                'app_golden.h  Note #3').
+*
+*            (3) A job is blocked for a tick if it is ready but a lower priority job runs on its core, or
+*                on any core under global scheduling (local blocking, e.g. a critical section), &
+*                remotely blocked for a tick if it waits for a global resource (suspended or spinning).
+*
+*            (4) As in the kernel, the run stops at the first 'MissDeadline'.
+*
+*            (5) All state lives in an APP_MP instance; several instances may run concurrently.
+*
+*            (6) Under global scheduling :
+*
+*                (a) The jobs to run are the first 'CoreNbr' of the ready jobs ordered as OS_SchedNew()
+*                    would pick them one after the other; they are selected in one pass over the ready
+*                    jobs, keeping a sorted array of 'CoreNbr' entries.
+*
+*                (b) A selected job keeps the core it ran on during the previous tick; the other ones
+*                    take the core their job last ran on if it is free, else the first free core.
+*
+*                (c) A job is preempted when it is ready but not selected after running the previous
+*                    tick, & migrates when it resumes on another core than the one it last ran on; a
+*                    new job never migrates.  A migration costs 'MigCost' ticks to the migrating job,
+*                    spent before it resumes its own work.  Partitioned jobs never migrate.
+*
+*                (d) The response-time bound of G-RM is the sufficient test of Bertogna & Cirinei
+*                    ("Response-Time Analysis for Globally Scheduled Symmetric Multiprocessor Platforms",
+*                    RTSS 2007); G-EDF has no bound.
+*
+*            (7) Kernel overheads (see APP_MP_OVH) are charged in 1/APP_MP_OVH_RES of a tick :
+*
+*                (a) A context switch costs between 'CtxSwMin' & 'CtxSwMax', uniformly distributed, to
+*                    the job switched to, or to the idle time of the core.  A lock or unlock costs 'Lock'
+*                    or 'Unlock' to the job that calls it.  Costs owed by a job are paid out of its next
+*                    ticks before it progresses.
+*
+*                (b) The tick ISR takes 'Tick' out of every tick of every core, from the job running or
+*                    from the idle time.
+*
+*                (c) A job completes at the end of the tick its work reaches its execution time; the
+*                    rest of that tick is lost.  Without overheads, a job progresses one tick per tick.
+*
+*                (d) The response-time bounds use, for every task, the ticks a job needs to execute
+*                    itself, 2 context switches at 'CtxSwMax' & its locks & unlocks, with 'Tick' taken out
+*                    of each tick.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_MP_H
+#define  APP_MP_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "app_tsb.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_MP_TASK_MAX                     OS_MAX_TASKS
+#define  APP_MP_CORE_MAX                                8u
+#define  APP_MP_CORE_NBR_DFLT                           4u
+#define  APP_MP_END_TIME_MAX                        10000u      /* Cap on the simulated length of a run.                */
+#define  APP_MP_OVH_RES                              1000u      /* Overhead units per tick (see Note #7).              */
+
+#define  APP_MP_OUTPUT_FILE_NAME          "./MpOutput.txt"      /* See Note #2.                                         */
+#define  APP_MP_TIMELINE_FILE_NAME        "./MpTimeline.csv"    /* One row per tick, one column per core.               */
+#define  APP_MP_STAT_FILE_NAME            "./MpStat.csv"        /* One row per task.                                    */
+
+#define  APP_MP_IX_NONE                              0xFFu      /* No task, e.g. an idle core.                          */
+
+                                                                /* ------------------- SCHEDULING ------------------- */
+#define  APP_MP_SCHED_FFD                               0u      /* Partitioned, first-fit decreasing.                   */
+#define  APP_MP_SCHED_WFD                               1u      /* Partitioned, worst-fit decreasing.                   */
+#define  APP_MP_SCHED_GRM                               2u      /* Global, RM priorities.                               */
+#define  APP_MP_SCHED_GEDF                              3u      /* Global, earliest deadline first.                     */
+#define  APP_MP_SCHED_NBR                               4u
+
+#define  APP_MP_SCHED_IS_GLOBAL(sched)        ((sched) >= APP_MP_SCHED_GRM)
+
+                                                                /* ------------- GLOBAL LOCK PROTOCOLS -------------- */
+#define  APP_MP_PROTO_MPCP                              0u
+#define  APP_MP_PROTO_MSRP                              1u
+#define  APP_MP_PROTO_NBR                               2u
+
+                                                                /* ------------------- RESOURCES -------------------- */
+#define  APP_MP_RES_R1                                  0u
+#define  APP_MP_RES_R2                                  1u
+#define  APP_MP_RES_NBR                                 2u
+#define  APP_MP_RES_NONE                             0xFFu
+                                                                /* Lock & unlock rows of one dispatch (see Note #2).    */
+#define  APP_MP_PEND_MAX                  (APP_MP_TASK_MAX * APP_MP_RES_NBR * 2u)
+
+                                                                /* -------------- EFFECTIVE PRIORITIES -------------- */
+#define  APP_MP_PRIO_GCS                              256       /* Offset of MPCP global critical sections.             */
+#define  APP_MP_PRIO_NP                            (-1024)      /* MSRP spinning & global critical sections.            */
+
+                                                                /* ------------------ MODEL ERRORS ------------------ */
+#define  APP_MP_ERR_NONE                                0u
+#define  APP_MP_ERR_END                                 1u      /* Time went past the end time (normal exit).           */
+#define  APP_MP_ERR_MISS_DEADLINE                       2u      /* A 'MissDeadline' row was logged (normal exit).       */
+#define  APP_MP_ERR_PART                                3u      /* A task fits on no core.                              */
+#define  APP_MP_ERR_DEADLOCK                            4u      /* Jobs wait for each other's resources.                */
+#define  APP_MP_ERR_TASK_NBR                            5u      /* Too many tasks or cores.                             */
+#define  APP_MP_ERR_OVH                                 6u      /* The tick ISR takes the whole tick.                   */
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_mp_event {
+    APP_TSB_EVENT  Event;                                       /* Row as printed to 'Output.txt' ...                   */
+    CPU_INT08U     Core;                                        /* ... & the core that printed it.                      */
+    CPU_INT32S     PrioFrom;                                    /* Lock/unlock only; may be a global priority.          */
+    CPU_INT32S     PrioTo;
+} APP_MP_EVENT;
+
+
+typedef  void  (*APP_MP_EVENT_FNCT)(void                *p_arg,
+                                    const  APP_MP_EVENT  *p_event);
+
+
+typedef  struct  app_mp_ovh {                                   /* Overhead model, see Note #7.                         */
+    CPU_INT32U     CtxSwMin;                                    /* Context switch, fixed if 'CtxSwMin' == 'CtxSwMax'.   */
+    CPU_INT32U     CtxSwMax;
+    CPU_INT32U     Tick;                                        /* Tick ISR.                                            */
+    CPU_INT32U     Lock;
+    CPU_INT32U     Unlock;
+    CPU_INT32U     Seed;                                        /* Seed of the context switch costs.                    */
+} APP_MP_OVH;
+
+
+typedef  struct  app_mp_task {
+    task_para_set  Para;                                        /* RM priority in 'TaskPriority'.                       */
+    CPU_INT08U     Core;                                        /* Core assigned, or last run on by the job (global).   */
+    CPU_INT32S     Rta;                                         /* Response-time bound without blocking, -1 if none.    */
+
+    CPU_BOOLEAN    Rdy;                                         /* Job 'Job' is released & not completed.               */
+    CPU_INT32U     Job;
+    CPU_INT32U     Release;
+    CPU_INT32U     Exec;                                        /* Ticks executed by the current job.                   */
+    CPU_INT32U     Work;                                        /* Work of the current job, in overhead units.          */
+    CPU_INT32U     OvhDebt;                                     /* Overhead owed by the task (see Note #7a).            */
+    CPU_INT08U     Held;                                        /* Bit 'r' set if resource 'r' is held.                 */
+    CPU_INT08U     WaitRes;                                     /* Resource waited for, or APP_MP_RES_NONE.             */
+    CPU_BOOLEAN    Spin;                                        /* Waits by spinning (MSRP).                            */
+    CPU_INT32S     PrioCur;                                     /* Effective priority, see AppMp_PrioGet().             */
+    CPU_INT32U     BlkLocal;                                    /* Blocking of the current job (see Note #3).           */
+    CPU_INT32U     BlkRemote;
+    CPU_INT08U     RunCore;                                     /* Core running the job this tick, or APP_MP_IX_NONE.   */
+    CPU_INT32U     MigRem;                                      /* Migration cost left to the job (see Note #6c).       */
+
+    CPU_INT32U     JobNbr;                                      /* Statistics over the completed jobs.                  */
+    CPU_INT32U     RespMax;
+    CPU_INT32U     BlkLocalMax;
+    CPU_INT32U     BlkRemoteMax;
+    CPU_INT32U     BlkRemoteTot;
+    CPU_INT32U     SpinTot;
+    CPU_INT32U     PreemptCtr;
+    CPU_INT32U     MigrateCtr;
+    CPU_INT32U     OvhCtxSw;                                    /* Overheads charged to the task, in overhead units.    */
+    CPU_INT32U     OvhTick;
+    CPU_INT32U     OvhLock;
+} APP_MP_TASK;
+
+
+typedef  struct  app_mp_res {
+    CPU_BOOLEAN    Used;
+    CPU_BOOLEAN    Global;
+    CPU_INT32S     Ceiling[APP_MP_CORE_MAX];                    /* Priority of a critical section, per core.            */
+    CPU_INT08U     OwnerIx;
+    CPU_INT08U     WaitIx[APP_MP_TASK_MAX];                     /* Priority (suspension) or FIFO (spinning) order.      */
+    CPU_INT08U     WaitNbr;
+
+    CPU_INT32U     LockCtr;
+    CPU_INT32U     ContendCtr;                                  /* Locks that found the resource busy.                  */
+} APP_MP_RES;
+
+
+typedef  struct  app_mp_core {
+    CPU_INT08U     CurIx;                                       /* Task running this tick, or APP_MP_IX_NONE.           */
+    CPU_INT08U     PrevIx;                                      /* Task that ran the previous tick.                     */
+    CPU_INT32U     PrevJob;
+    CPU_BOOLEAN    PrevDone;                                    /* The job of 'PrevIx' completed at the end of it, ...  */
+    CPU_INT32U     PrevResp;                                    /* ... with this response & blocking time.              */
+    CPU_INT32U     PrevBlk;
+    CPU_BOOLEAN    PrevMig;                                     /* 'PrevIx' paid a migration during the previous tick.  */
+    CPU_INT32U     TaskNbr;
+    CPU_INT32U     UtilPermil;                                  /* Utilization of the tasks assigned, in 1/1000.        */
+
+    CPU_INT32U     BusyCtr;                                     /* Ticks executing, spinning, migrating & idle.         */
+    CPU_INT32U     SpinCtr;
+    CPU_INT32U     MigCtr;
+    CPU_INT32U     IdleCtr;
+    CPU_INT32U     CtxSwCtr;
+
+    CPU_INT32U     OvhCtxSw;                                    /* Overheads of the core, in overhead units, ...        */
+    CPU_INT32U     OvhTick;
+    CPU_INT32U     OvhLock;
+    CPU_INT32U     OvhIdle;                                     /* ... of which taken out of the idle time.             */
+} APP_MP_CORE;
+
+
+typedef  struct  app_mp {
+    APP_MP_TASK        Task[APP_MP_TASK_MAX];                   /* In priority order.                                   */
+    CPU_INT32U         TaskNbr;
+    APP_MP_RES         Res[APP_MP_RES_NBR];
+    APP_MP_CORE        Core[APP_MP_CORE_MAX];
+    CPU_INT08U         CoreNbr;
+    CPU_INT08U         Sched;                                   /* APP_MP_SCHED_xxx.                                    */
+    CPU_INT08U         Proto;                                   /* APP_MP_PROTO_xxx.                                    */
+    CPU_INT32U         MigCost;                                 /* Ticks charged per migration (see Note #6c).          */
+    APP_MP_OVH         Ovh;
+    CPU_INT32U         OvhRand;                                 /* State of the context switch costs.                   */
+
+    CPU_INT32U         Time;
+    CPU_INT32U         EndTime;
+    CPU_INT08U         Err;
+
+    APP_MP_EVENT_FNCT  EventFnct;                               /* Called for every row logged.                         */
+    void              *EventArg;
+    APP_MP_EVENT       Pend[APP_MP_PEND_MAX];                   /* Rows held until the switch is logged (see Note #2).  */
+    CPU_INT32U         PendNbr;
+} APP_MP;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppMp_Init    (       APP_MP             *p_mp,
+                            const  task_para_set      *p_tasks,
+                                   CPU_INT32U          task_nbr,
+                                   CPU_INT08U          core_nbr,
+                                   CPU_INT08U          sched,
+                                   CPU_INT08U          proto,
+                                   CPU_INT32U          mig_cost,
+                            const  APP_MP_OVH         *p_ovh,
+                                   CPU_INT32U          end_time,
+                                   APP_MP_EVENT_FNCT   event_fnct,
+                                   void               *p_event_arg);
+
+CPU_BOOLEAN  AppMp_Tick    (       APP_MP             *p_mp);
+
+CPU_INT08U   AppMp_Run     (       APP_MP             *p_mp);
+
+CPU_INT32U   AppMp_EndTimeGet(const  task_para_set    *p_tasks,
+                                   CPU_INT32U          task_nbr);
+
+CPU_BOOLEAN  AppMp_RunFile (const  CPU_CHAR           *p_taskset_path,
+                                   CPU_INT08U          core_nbr,
+                                   CPU_INT08U          sched,
+                                   CPU_INT08U          proto,
+                                   CPU_INT32U          end_time,
+                                   CPU_INT32U          mig_cost,
+                            const  APP_MP_OVH         *p_ovh);
+
+CPU_INT08U   AppMp_SchedParse(const  CPU_CHAR         *p_name);
+
+CPU_BOOLEAN  AppMp_OvhParse(const  CPU_CHAR           *p_str,
+                                   APP_MP_OVH         *p_ovh);
+
+CPU_BOOLEAN  AppMp_Cmp     (const  CPU_CHAR           *p_taskset_path,
+                                   CPU_INT08U          core_nbr,
+                                   CPU_INT32U          mig_cost,
+                            const  APP_MP_OVH         *p_ovh);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
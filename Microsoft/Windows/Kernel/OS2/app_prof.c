@@ -0,0 +1,178 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                        PER-TASK CPU LOAD REPORT
+*
+* Filename : app_prof.c
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu_core.h>
+#include  <os.h>
+
+#include  "app_prof.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_PROF_TASK_NBR_MAX           (OS_MAX_TASKS + OS_N_SYS_TASKS)
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_prof_task {                                /* Snapshot of the profiling fields of one TCB.         */
+    INT8U       Prio;                                           /* Priority the task was created at.                    */
+    INT16U      Id;
+    INT32U      CtxSwCtr;
+    INT64U      Cycles;
+    INT32U      Jobs;                                           /* Completed jobs, 0 if not a task of the task set.     */
+} APP_PROF_TASK;
+
+
+/*
+*********************************************************************************************************
+*                                           AppProf_LoadRpt()
+*
+* Description : Print the CPU time & load of every task since it was created.
+*
+* Argument(s) : p_file      File the report is also written to, or NULL.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The slice of the running (or last running) task is counted up to now.
+*
+*               (2) Tasks of the task set are shown with their ID from 'TaskSet.txt' & the mean number of
+*                   cycles per completed job.
+*********************************************************************************************************
+*/
+
+void  AppProf_LoadRpt (FILE  *p_file)
+{
+    APP_PROF_TASK  tasks[APP_PROF_TASK_NBR_MAX];
+    OS_TCB        *p_tcb;
+    INT64U         cycles_tot;
+    INT64U         ts;
+    CPU_INT32U     task_nbr;
+    CPU_INT32U     i;
+    CPU_INT32U     ix;
+    CPU_CHAR       name[16];
+    CPU_CHAR       line[128];
+#if OS_CRITICAL_METHOD == 3u
+    OS_CPU_SR      cpu_sr = 0u;
+#endif
+
+
+    task_nbr   = 0u;
+    cycles_tot = 0u;
+    OS_ENTER_CRITICAL();
+    ts    = OS_TS_GET();
+    p_tcb = OSTCBList;
+    while ((p_tcb != (OS_TCB *)0) && (task_nbr < APP_PROF_TASK_NBR_MAX)) {
+        tasks[task_nbr].Prio     = p_tcb->OSTCBOriPrio;
+        tasks[task_nbr].Id       = p_tcb->OSTCBId;
+        tasks[task_nbr].CtxSwCtr = p_tcb->OSTCBCtxSwCtr;
+        tasks[task_nbr].Cycles   = p_tcb->OSTCBCyclesTot;
+        tasks[task_nbr].Jobs     = 0u;
+        if ((p_tcb == OSTCBCur) && (p_tcb->OSTCBCyclesStart != 0u)) {   /* See Note #1.                                 */
+            tasks[task_nbr].Cycles += ts - p_tcb->OSTCBCyclesStart;
+        }
+        ix = (CPU_INT32U)(p_tcb->OSTCBOriPrio / T_start);
+        if ((p_tcb->OSTCBOriPrio != OS_TASK_IDLE_PRIO) &&
+            (ix >= 1u) && (ix <= (CPU_INT32U)TASK_NUMBER)) {    /* See Note #2.                                         */
+            tasks[task_nbr].Id   = TaskParameter[ix - 1u].TaskID;
+            tasks[task_nbr].Jobs = TaskParameter[ix - 1u].TaskNumber;
+        }
+        cycles_tot += tasks[task_nbr].Cycles;
+        task_nbr++;
+        p_tcb = p_tcb->OSTCBNext;
+    }
+    OS_EXIT_CRITICAL();
+
+    (void)snprintf(line, sizeof(line), "%-10s %5s %8s %16s %12s %8s %6s %14s\n",
+                   "Task", "Prio", "CtxSw", "Cycles", "Time(us)", "Load(%)", "Jobs", "Cycles/job");
+    printf("%s", line);
+    if (p_file != (FILE *)0) {
+        fprintf(p_file, "%s", line);
+    }
+
+    for (i = 0u; i < task_nbr; i++) {
+        if (tasks[i].Prio == OS_TASK_IDLE_PRIO) {
+            (void)snprintf(name, sizeof(name), "idle");
+        } else {
+            (void)snprintf(name, sizeof(name), "task(%2u)", (unsigned)tasks[i].Id);
+        }
+        (void)snprintf(line, sizeof(line), "%-10s %5u %8u %16llu %12llu %8.2f %6u %14llu\n",
+                       name,
+                       (unsigned)tasks[i].Prio,
+                       (unsigned)tasks[i].CtxSwCtr,
+                       (unsigned long long)tasks[i].Cycles,
+                       (unsigned long long)CPU_TS64_to_uSec(tasks[i].Cycles),
+                       (cycles_tot != 0u) ? ((double)tasks[i].Cycles * 100.0 / (double)cycles_tot) : 0.0,
+                       (unsigned)tasks[i].Jobs,
+                       (tasks[i].Jobs != 0u) ? (unsigned long long)(tasks[i].Cycles / tasks[i].Jobs) : 0uLL);
+        printf("%s", line);
+        if (p_file != (FILE *)0) {
+            fprintf(p_file, "%s", line);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppProf_LoadRptExit()
+*
+* Description : Write the load report to APP_PROF_LOAD_FILE_NAME when the run ends.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Registered with atexit() by main(), since the run ends with exit() from the kernel
+*                   (see 'os_core.c  OSTimeTick()').  The thread calling exit() already holds the critical
+*                   section, which is recursive on this port.
+*********************************************************************************************************
+*/
+
+void  AppProf_LoadRptExit (void)
+{
+    FILE  *p_file;
+
+
+    if (fopen_s(&p_file, APP_PROF_LOAD_FILE_NAME, "w") != 0) {
+        p_file = (FILE *)0;
+    }
+    AppProf_LoadRpt(p_file);
+    if (p_file != (FILE *)0) {
+        fclose(p_file);
+    }
+}
@@ -0,0 +1,71 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                        PER-TASK CPU LOAD REPORT
+*
+* Filename : app_prof.h
+*
+* Note(s)  : (1) 'OSTCBCyclesTot' is accumulated by OSTaskSwHook() from OS_TS_GET(), i.e. from the CPU
+*                timestamp timer of 'bsp_cpu.c'.  On the Win32 port a task is charged the wall-clock time
+*                its thread held the kernel, including the tick ISRs that interrupted it; the idle task
+*                is charged the time spent in Sleep().
+*********************************************************************************************************
+*/
+
+#ifndef  APP_PROF_H
+#define  APP_PROF_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+
+#include  <cpu.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_PROF_LOAD_FILE_NAME               "./Load.txt"     /* Written by AppProf_LoadRptExit().                    */
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  AppProf_LoadRpt     (FILE  *p_file);
+
+void  AppProf_LoadRptExit (void);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -0,0 +1,1136 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                    VIRTUAL-TIME SCHEDULER MODEL
+*
+* Filename : app_sim.c
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "app_sim.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+                                                                /* ------------- task() RESUME POINTS -------------- */
+#define  APP_SIM_PC_ENTRY                               0u      /* Top of the 'while (1)' loop.                         */
+#define  APP_SIM_PC_LOOP                                1u      /* Spinning until OSTime changes.                       */
+#define  APP_SIM_PC_UNLOCK_R1                           2u
+#define  APP_SIM_PC_UNLOCK_R1_DONE                      3u
+#define  APP_SIM_PC_UNLOCK_R2                           4u
+#define  APP_SIM_PC_UNLOCK_R2_DONE                      5u
+#define  APP_SIM_PC_LOCK_R1                             6u
+#define  APP_SIM_PC_LOCK_R1_DONE                        7u
+#define  APP_SIM_PC_LOCK_R2                             8u
+#define  APP_SIM_PC_LOCK_R2_DONE                        9u
+#define  APP_SIM_PC_TICK_SAVE                          10u      /* 'cur_tick = OSTime'.                                 */
+#define  APP_SIM_PC_DONE                               11u      /* Job done, delay until the next period.               */
+
+#define  APP_SIM_SW_PER_TICK_MAX                       64u      /* Switches per task & per tick before a livelock.      */
+#define  APP_SIM_STEP_PER_TICK_MAX                   1024u      /* Resume points per switch before a livelock.          */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  APP_SIM_TCB    *AppSim_TcbGet      (APP_SIM      *p_sim,
+                                            CPU_INT08U    prio);
+
+static  task_para_set  *AppSim_ParaGet     (APP_SIM      *p_sim,
+                                            CPU_INT08U    ori_prio);
+
+static  void            AppSim_PrioSet     (APP_SIM_TCB  *p_tcb,
+                                            CPU_INT08U    prio);
+
+static  void            AppSim_RdySet      (APP_SIM      *p_sim,
+                                            APP_SIM_TCB  *p_tcb);
+
+static  void            AppSim_RdyClr      (APP_SIM      *p_sim,
+                                            APP_SIM_TCB  *p_tcb);
+
+static  void            AppSim_SchedNew    (APP_SIM      *p_sim);
+
+static  CPU_BOOLEAN     AppSim_Sched       (APP_SIM      *p_sim);
+
+static  void            AppSim_CtxSw       (APP_SIM      *p_sim);
+
+static  void            AppSim_IntExit     (APP_SIM      *p_sim);
+
+static  CPU_BOOLEAN     AppSim_DeadlineChk (APP_SIM      *p_sim);
+
+static  void            AppSim_TaskSwHook  (APP_SIM      *p_sim);
+
+static  CPU_BOOLEAN     AppSim_MutexPend   (APP_SIM      *p_sim,
+                                            CPU_INT08U    mutex_ix);
+
+static  CPU_BOOLEAN     AppSim_MutexPost   (APP_SIM      *p_sim,
+                                            CPU_INT08U    mutex_ix);
+
+static  CPU_BOOLEAN     AppSim_TaskStep    (APP_SIM      *p_sim);
+
+static  void            AppSim_TaskRun     (APP_SIM      *p_sim);
+
+static  void            AppSim_ResEmit     (APP_SIM      *p_sim,
+                                            APP_SIM_TCB  *p_tcb,
+                                            CPU_INT08U    kind,
+                                            CPU_INT08U    mutex_ix);
+
+static  void            AppSim_EventEmit   (APP_SIM      *p_sim,
+                                            APP_TSB_EVENT *p_event);
+
+
+/*
+*********************************************************************************************************
+*                                            AppSim_Init()
+*
+* Description : Load a task set & bring the model to the point where OSStart() returns to the first task.
+*
+* Argument(s) : p_sim           Pointer to the model instance.
+*
+*               p_tasks         Task set, in file order (see AppTsb_TaskSetRd()).
+*
+*               task_nbr        Number of tasks.
+*
+*               end_time        Last tick to simulate (see SYSTEM_END_TIME).
+*
+*               event_fnct      Function called for each row the kernel would print, or NULL.
+*
+*               p_event_arg     Argument passed to 'event_fnct'.
+*
+* Return(s)   : DEF_OK,   if the task set could be loaded.
+*               DEF_FAIL, otherwise (see 'p_sim->Err').
+*
+* Note(s)     : (1) Tasks are sorted & given priorities & ceilings as InputFile() does, then created &
+*                   delayed to their arrival time as main() does.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppSim_Init (       APP_SIM             *p_sim,
+                          const  task_para_set       *p_tasks,
+                                 CPU_INT32U           task_nbr,
+                                 CPU_INT32U           end_time,
+                                 APP_SIM_EVENT_FNCT   event_fnct,
+                                 void                *p_event_arg)
+{
+    APP_SIM_TCB    *p_tcb;
+    APP_SIM_MUTEX  *p_mutex;
+    task_para_set   tmp;
+    CPU_INT32U      i;
+    CPU_INT32U      k;
+
+
+    Mem_Clr(p_sim, sizeof(APP_SIM));
+    Mem_Set(p_sim->PrioTbl, APP_SIM_TCB_NONE, sizeof(p_sim->PrioTbl));
+    p_sim->EndTime   = end_time;
+    p_sim->EventFnct = event_fnct;
+    p_sim->EventArg  = p_event_arg;
+
+    if ((task_nbr > APP_SIM_TASK_MAX) ||
+        (task_nbr * T_start >= OS_TASK_IDLE_PRIO)) {
+        p_sim->Err = APP_SIM_ERR_TASK_NBR;
+        return (DEF_FAIL);
+    }
+                                                                /* ------------------ InputFile() ------------------- */
+    p_sim->TaskNbr = task_nbr;
+    for (i = 0u; i < task_nbr; i++) {
+        p_tcb                               = &p_sim->Tcb[i];
+        p_tcb->Para                         = p_tasks[i];
+        p_tcb->Para.TaskNumber              = 0u;
+        p_tcb->Para.Task_need_ExecutionTime = p_tasks[i].TaskExecutionTime;
+        p_tcb->Para.Blocking_T              = 0u;
+    }
+    for (i = 0u; (i + 1u) < task_nbr; i++) {                    /* Same bubble sort, so that equal periods keep order.  */
+        for (k = 0u; k < task_nbr - i - 1u; k++) {
+            if (p_sim->Tcb[k].Para.TaskPeriodic > p_sim->Tcb[k + 1u].Para.TaskPeriodic) {
+                tmp                     = p_sim->Tcb[k].Para;
+                p_sim->Tcb[k].Para      = p_sim->Tcb[k + 1u].Para;
+                p_sim->Tcb[k + 1u].Para = tmp;
+            }
+        }
+    }
+    for (i = 0u; i < task_nbr; i++) {
+        p_sim->Tcb[i].Para.TaskPriority     = (INT16U)((i + 1u) * T_start);
+        p_sim->Tcb[i].Para.Now_TaskPriority = (INT16U)((i + 1u) * T_start);
+    }
+    for (i = 0u; i < task_nbr; i++) {
+        if (p_sim->Tcb[i].Para.R1_start != p_sim->Tcb[i].Para.R1_end) {
+            p_sim->Ceiling[APP_SIM_MUTEX_R1] = p_sim->Tcb[i].Para.TaskPriority - R1_PRIO;
+            break;
+        }
+    }
+    for (i = 0u; i < task_nbr; i++) {
+        if (p_sim->Tcb[i].Para.R2_start != p_sim->Tcb[i].Para.R2_end) {
+            p_sim->Ceiling[APP_SIM_MUTEX_R2] = p_sim->Tcb[i].Para.TaskPriority - R2_PRIO;
+            break;
+        }
+    }
+                                                                /* -------------------- OSInit() -------------------- */
+    p_tcb          = &p_sim->Tcb[APP_SIM_IDLE_IX];
+    p_tcb->Id      = OS_TASK_IDLE_ID;
+    p_tcb->OriPrio = OS_TASK_IDLE_PRIO;
+    p_tcb->MutexIx = APP_SIM_MUTEX_NONE;
+    AppSim_PrioSet(p_tcb, OS_TASK_IDLE_PRIO);
+    AppSim_RdySet(p_sim, p_tcb);
+    p_sim->PrioTbl[OS_TASK_IDLE_PRIO] = APP_SIM_IDLE_IX;
+                                                                /* ----------------- OSMutexCreate() ---------------- */
+    for (i = 0u; i < APP_SIM_MUTEX_NBR; i++) {
+        p_mutex = &p_sim->Mutex[i];
+        if (p_sim->PrioTbl[p_sim->Ceiling[i]] == APP_SIM_TCB_NONE) {
+            p_mutex->Created = DEF_YES;
+            p_mutex->Cnt     = (CPU_INT16U)((p_sim->Ceiling[i] << 8u) | APP_SIM_MUTEX_AVAILABLE);
+            p_mutex->OwnerIx = APP_SIM_TCB_NONE;
+            p_sim->PrioTbl[p_sim->Ceiling[i]] = APP_SIM_TCB_RESERVED;
+        }
+    }
+                                                                /* ---------------- OSTaskCreateExt() --------------- */
+    for (i = 0u; i < task_nbr; i++) {
+        p_tcb          = &p_sim->Tcb[i];
+        p_tcb->Id      = p_tcb->Para.TaskID;
+        p_tcb->OriPrio = (CPU_INT08U)p_tcb->Para.TaskPriority;
+        p_tcb->MutexIx = APP_SIM_MUTEX_NONE;
+        p_tcb->Pc      = APP_SIM_PC_ENTRY;
+        p_tcb->Err     = OS_ERR_NONE;
+        AppSim_PrioSet(p_tcb, p_tcb->OriPrio);
+        AppSim_RdySet(p_sim, p_tcb);
+        p_sim->PrioTbl[p_tcb->Prio] = (CPU_INT08U)i;
+    }
+    for (i = 0u; i < task_nbr; i++) {                           /* Delay each task until its arrival time.              */
+        p_tcb = &p_sim->Tcb[i];
+        if (p_tcb->Para.TaskArriveTime != 0u) {
+            AppSim_RdyClr(p_sim, p_tcb);
+            p_tcb->Dly = p_tcb->Para.TaskArriveTime;
+        }
+    }
+                                                                /* -------------------- OSStart() ------------------- */
+    AppSim_SchedNew(p_sim);
+    p_sim->PrioCur = p_sim->PrioHighRdy;
+    p_sim->CurIx   = p_sim->PrioTbl[p_sim->PrioHighRdy];
+    AppSim_TaskSwHook(p_sim);
+    AppSim_TaskRun(p_sim);
+
+    return ((p_sim->Err == APP_SIM_ERR_NONE) ? DEF_OK : DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppSim_Tick()
+*
+* Description : Advance the model by one tick : OSTimeTick(), OSIntExit(), then let the running task(s)
+*               execute until one of them spins waiting for the next tick.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : DEF_YES, if the model can be advanced further.
+*               DEF_NO,  otherwise (see 'p_sim->Err').
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppSim_Tick (APP_SIM  *p_sim)
+{
+    APP_SIM_TCB  *p_tcb;
+    CPU_INT32U    i;
+
+
+    if (p_sim->Err != APP_SIM_ERR_NONE) {
+        return (DEF_NO);
+    }
+                                                                /* ------------------ OSTimeTick() ------------------ */
+    p_sim->Time++;
+    if (p_sim->PrioCur != OS_TASK_IDLE_PRIO) {
+        p_tcb = AppSim_TcbGet(p_sim, p_sim->PrioCur);
+        if (p_tcb == (APP_SIM_TCB *)0) {
+            return (DEF_NO);
+        }
+        AppSim_ParaGet(p_sim, p_tcb->OriPrio)->Task_need_ExecutionTime--;
+    }
+
+    if (p_sim->Time > p_sim->EndTime) {
+        p_sim->Err = APP_SIM_ERR_END;
+        return (DEF_NO);
+    }
+
+    for (i = 0u; i < p_sim->TaskNbr; i++) {
+        p_tcb = &p_sim->Tcb[i];
+        if (p_tcb->Dly != 0u) {
+            p_tcb->Dly--;
+            if (p_tcb->Dly == 0u) {
+                if ((p_tcb->Stat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
+                    p_tcb->Stat     &= (CPU_INT08U)~(CPU_INT08U)OS_STAT_PEND_ANY;
+                    p_tcb->StatPend  = OS_STAT_PEND_TO;
+                } else {
+                    p_tcb->StatPend  = OS_STAT_PEND_OK;
+                }
+                if ((p_tcb->Stat & OS_STAT_SUSPEND) == OS_STAT_RDY) {
+                    AppSim_RdySet(p_sim, p_tcb);
+                }
+            }
+        }
+    }
+
+    AppSim_IntExit(p_sim);
+    AppSim_TaskRun(p_sim);
+
+    return ((p_sim->Err == APP_SIM_ERR_NONE) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             AppSim_Run()
+*
+* Description : Advance the model until it stops.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : Reason why the model stopped, APP_SIM_ERR_xxx.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT08U  AppSim_Run (APP_SIM  *p_sim)
+{
+    while (AppSim_Tick(p_sim) == DEF_YES) {
+        ;
+    }
+
+    return (p_sim->Err);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        KERNEL (os_core.c, os_time.c)
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           AppSim_TcbGet()
+*
+* Description : Dereference a priority table entry, like 'OSTCBPrioTbl[prio]->...' does.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+*               prio        Priority.
+*
+* Return(s)   : Pointer to the TCB, or NULL if the kernel would dereference a NULL or reserved entry; the
+*               model is then stopped with APP_SIM_ERR_TCB_INVALID.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  APP_SIM_TCB  *AppSim_TcbGet (APP_SIM     *p_sim,
+                                     CPU_INT08U   prio)
+{
+    CPU_INT08U  ix;
+
+
+    ix = p_sim->PrioTbl[prio];
+    if ((ix == APP_SIM_TCB_NONE) || (ix == APP_SIM_TCB_RESERVED)) {
+        p_sim->Err = APP_SIM_ERR_TCB_INVALID;
+        return ((APP_SIM_TCB *)0);
+    }
+
+    return (&p_sim->Tcb[ix]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppSim_ParaGet()
+*
+* Description : Get 'TaskParameter[ori_prio / T_start - 1]'.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+*               ori_prio    Original priority of a user task.
+*
+* Return(s)   : Pointer to the task parameters.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  task_para_set  *AppSim_ParaGet (APP_SIM     *p_sim,
+                                        CPU_INT08U   ori_prio)
+{
+    return (&p_sim->Tcb[ori_prio / T_start - 1u].Para);
+}
+
+
+static  void  AppSim_PrioSet (APP_SIM_TCB  *p_tcb,
+                              CPU_INT08U    prio)
+{
+    p_tcb->Prio = prio;
+    p_tcb->Y    = (CPU_INT08U)(prio >> 3u);
+    p_tcb->X    = (CPU_INT08U)(prio & 0x07u);
+    p_tcb->BitY = (OS_PRIO)(1uL << p_tcb->Y);
+    p_tcb->BitX = (OS_PRIO)(1uL << p_tcb->X);
+}
+
+
+static  void  AppSim_RdySet (APP_SIM      *p_sim,
+                             APP_SIM_TCB  *p_tcb)
+{
+    p_sim->RdyGrp           |= p_tcb->BitY;
+    p_sim->RdyTbl[p_tcb->Y] |= p_tcb->BitX;
+}
+
+
+static  void  AppSim_RdyClr (APP_SIM      *p_sim,
+                             APP_SIM_TCB  *p_tcb)
+{
+    p_sim->RdyTbl[p_tcb->Y] &= (OS_PRIO)~p_tcb->BitX;
+    if (p_sim->RdyTbl[p_tcb->Y] == 0u) {
+        p_sim->RdyGrp &= (OS_PRIO)~p_tcb->BitY;
+    }
+}
+
+
+static  void  AppSim_SchedNew (APP_SIM  *p_sim)
+{
+    CPU_INT08U  y;
+
+
+    y                  = OSUnMapTbl[p_sim->RdyGrp];
+    p_sim->PrioHighRdy = (CPU_INT08U)((y << 3u) + OSUnMapTbl[p_sim->RdyTbl[y]]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppSim_Sched()
+*
+* Description : Mirror of OS_Sched().
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : DEF_YES, if the CPU was given to another task.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : (1) Like the kernel, tasks are compared by ID since a task holding a mutex is reachable
+*                   from both its original & its ceiling priority.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppSim_Sched (APP_SIM  *p_sim)
+{
+    APP_SIM_TCB  *p_high;
+    APP_SIM_TCB  *p_cur;
+
+
+    AppSim_SchedNew(p_sim);
+    p_high = AppSim_TcbGet(p_sim, p_sim->PrioHighRdy);
+    p_cur  = AppSim_TcbGet(p_sim, p_sim->PrioCur);
+    if ((p_high == (APP_SIM_TCB *)0) || (p_cur == (APP_SIM_TCB *)0)) {
+        return (DEF_NO);
+    }
+    if (p_high->Id == p_cur->Id) {
+        return (DEF_NO);
+    }
+    AppSim_CtxSw(p_sim);
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppSim_CtxSw()
+*
+* Description : Mirror of OSCtxSw() & OSIntCtxSw() : call the hook, then make the highest priority task
+*               ready to run the current one.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  AppSim_CtxSw (APP_SIM  *p_sim)
+{
+    p_sim->CtxSwCtr++;
+    AppSim_TaskSwHook(p_sim);
+    if (p_sim->Err != APP_SIM_ERR_NONE) {
+        return;
+    }
+    p_sim->CurIx   = p_sim->PrioTbl[p_sim->PrioHighRdy];
+    p_sim->PrioCur = p_sim->PrioHighRdy;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppSim_IntExit()
+*
+* Description : Mirror of OSIntExit().
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A task whose job is complete is never preempted here; it switches out itself through
+*                   OSTimeDly() so that App_TaskSwHook() reports a 'Completion'.
+*
+*               (2) When no switch is needed, OSIntExit() looks up 'TaskParameter[OSPrioCur - T_start]';
+*                   the same index is used here.  Entries past TASK_NUMBER are all zero.
+*********************************************************************************************************
+*/
+
+static  void  AppSim_IntExit (APP_SIM  *p_sim)
+{
+    APP_SIM_TCB  *p_high;
+    APP_SIM_TCB  *p_cur;
+    CPU_INT32S    ix;
+
+
+    AppSim_SchedNew(p_sim);
+    p_high = AppSim_TcbGet(p_sim, p_sim->PrioHighRdy);
+    p_cur  = AppSim_TcbGet(p_sim, p_sim->PrioCur);
+    if ((p_high == (APP_SIM_TCB *)0) || (p_cur == (APP_SIM_TCB *)0)) {
+        return;
+    }
+
+    if (p_high->Id != p_cur->Id) {
+        if ((p_sim->PrioCur != OS_TASK_IDLE_PRIO) &&            /* See Note #1.                                         */
+            (AppSim_ParaGet(p_sim, p_cur->OriPrio)->Task_need_ExecutionTime == 0u)) {
+            p_sim->PrioHighRdy = p_sim->PrioCur;
+        } else {
+            if (AppSim_DeadlineChk(p_sim) == DEF_YES) {
+                return;
+            }
+            AppSim_CtxSw(p_sim);
+        }
+    } else {
+        ix = (CPU_INT32S)p_sim->PrioCur - (CPU_INT32S)T_start;  /* See Note #2.                                         */
+        if ((ix >= 0) && ((CPU_INT32U)ix < p_sim->TaskNbr) &&
+            (p_sim->Tcb[ix].Para.Task_need_ExecutionTime != 0u)) {
+            (void)AppSim_DeadlineChk(p_sim);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppSim_DeadlineChk()
+*
+* Description : Check every task for a missed deadline, as OSIntExit() does before a switch.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : DEF_YES, if a deadline was missed; the model is then stopped.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppSim_DeadlineChk (APP_SIM  *p_sim)
+{
+    task_para_set  *p_para;
+    APP_TSB_EVENT   event;
+    CPU_INT32S      response_time;
+    CPU_INT32U      i;
+
+
+    for (i = 0u; i < p_sim->TaskNbr; i++) {
+        p_para        = &p_sim->Tcb[i].Para;
+        response_time = (CPU_INT32S)(p_sim->Time - (CPU_INT32U)p_para->TaskNumber * p_para->TaskPeriodic - p_para->TaskArriveTime);
+        if ((CPU_INT32S)p_para->TaskPeriodic - response_time <= 0) {
+            Mem_Clr(&event, sizeof(event));
+            event.Tick   = p_sim->Time;
+            event.Kind   = APP_TSB_EVENT_MISS_DEADLINE;
+            event.CurId  = p_para->TaskID;
+            event.CurJob = p_para->TaskNumber;
+            AppSim_EventEmit(p_sim, &event);
+            p_sim->Err   = APP_SIM_ERR_MISS_DEADLINE;
+            return (DEF_YES);
+        }
+    }
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       APPLICATION (app_hooks.c)
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         AppSim_TaskSwHook()
+*
+* Description : Mirror of App_TaskSwHook() : blocking-time accounting & 'Preemption'/'Completion' rows.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  AppSim_TaskSwHook (APP_SIM  *p_sim)
+{
+    APP_SIM_TCB    *p_cur;
+    APP_SIM_TCB    *p_high;
+    task_para_set  *p_para;
+    task_para_set  *p_cur_para;
+    task_para_set  *p_high_para;
+    APP_TSB_EVENT   event;
+    CPU_INT32U      arrival_time;
+    CPU_INT32S      response_time;
+    CPU_INT32S      preemption_time;
+    CPU_INT08U      cur_prio;
+    CPU_INT08U      high_prio;
+    CPU_INT32U      i;
+
+
+    p_cur = AppSim_TcbGet(p_sim, p_sim->PrioCur);
+    if (p_cur == (APP_SIM_TCB *)0) {
+        return;
+    }
+    cur_prio = p_cur->OriPrio;
+    if (cur_prio != OS_TASK_IDLE_PRIO) {
+        for (i = 0u; i < p_sim->TaskNbr; i++) {
+            p_para = &p_sim->Tcb[i].Para;
+            if (cur_prio > p_para->TaskPriority) {
+                arrival_time = p_para->TaskArriveTime + (CPU_INT32U)p_para->TaskNumber * p_para->TaskPeriodic;
+                if (p_sim->Time > arrival_time) {
+                    p_para->Blocking_T += (INT16U)(p_sim->Time - arrival_time);
+                }
+            }
+        }
+    }
+
+    if (p_sim->Time == 0u) {
+        return;
+    }
+
+    p_high = AppSim_TcbGet(p_sim, p_sim->PrioHighRdy);
+    if (p_high == (APP_SIM_TCB *)0) {
+        return;
+    }
+    high_prio   = p_high->OriPrio;
+    p_cur_para  = (cur_prio  != OS_TASK_IDLE_PRIO) ? AppSim_ParaGet(p_sim, cur_prio)  : (task_para_set *)0;
+    p_high_para = (high_prio != OS_TASK_IDLE_PRIO) ? AppSim_ParaGet(p_sim, high_prio) : (task_para_set *)0;
+
+    Mem_Clr(&event, sizeof(event));
+    event.Tick = p_sim->Time;
+    if ((p_cur_para != (task_para_set *)0) && (p_cur_para->Task_need_ExecutionTime == 0u)) {
+        event.Kind = APP_TSB_EVENT_COMPLETION;
+    } else {
+        event.Kind = APP_TSB_EVENT_PREEMPTION;
+    }
+
+    if (p_cur_para == (task_para_set *)0) {
+        event.CurId  = APP_TSB_TASK_IDLE;
+        event.CurJob = cur_prio;
+    } else {
+        event.CurId  = p_cur_para->TaskID;
+        event.CurJob = p_cur_para->TaskNumber;
+    }
+    if (p_high_para == (task_para_set *)0) {
+        event.NextId  = APP_TSB_TASK_IDLE;
+        event.NextJob = high_prio;
+    } else {
+        event.NextId  = p_high_para->TaskID;
+        event.NextJob = p_high_para->TaskNumber;
+        if (cur_prio == high_prio) {                            /* Same task, next job (see task()'s OSTaskSwHook()).   */
+            event.NextJob++;
+        }
+    }
+
+    if (event.Kind != APP_TSB_EVENT_COMPLETION) {
+        AppSim_EventEmit(p_sim, &event);
+        return;
+    }
+
+    response_time   = (CPU_INT32S)(p_sim->Time - (CPU_INT32U)p_cur_para->TaskNumber * p_cur_para->TaskPeriodic - p_cur_para->TaskArriveTime);
+    preemption_time = response_time - (CPU_INT32S)p_cur_para->TaskExecutionTime;
+    event.Resp      = (CPU_INT16U)response_time;
+    event.Blk       = p_cur_para->Blocking_T;
+    event.Pre       = (CPU_INT16S)(preemption_time - (CPU_INT32S)p_cur_para->Blocking_T);
+    AppSim_EventEmit(p_sim, &event);
+
+    p_cur_para->TaskNumber++;
+    p_cur_para->Task_need_ExecutionTime = p_cur_para->TaskExecutionTime;
+    p_cur_para->Blocking_T              = 0u;
+    if (p_cur_para->Task_need_ExecutionTime != 0u) {
+        (void)AppSim_DeadlineChk(p_sim);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            MUTEX (os_mutex.c)
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         AppSim_MutexPend()
+*
+* Description : Mirror of OSMutexPend() (no timeout) for the running task.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+*               mutex_ix    APP_SIM_MUTEX_R1 or APP_SIM_MUTEX_R2.
+*
+* Return(s)   : DEF_YES, if the CPU was given to another task.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : (1) A free mutex moves its new owner to the ceiling priority, whether or not that is
+*                   higher than the owner's current priority.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppSim_MutexPend (APP_SIM     *p_sim,
+                                       CPU_INT08U   mutex_ix)
+{
+    APP_SIM_MUTEX  *p_mutex;
+    APP_SIM_TCB    *p_cur;
+    APP_SIM_TCB    *p_owner;
+    APP_SIM_MUTEX  *p_mutex2;
+    CPU_INT08U      pcp;
+    CPU_INT08U      mprio;
+    CPU_BOOLEAN     rdy;
+
+
+    p_mutex = &p_sim->Mutex[mutex_ix];
+    p_cur   = &p_sim->Tcb[p_sim->CurIx];
+    if (p_mutex->Created == DEF_NO) {
+        p_cur->Err = OS_ERR_PEVENT_NULL;
+        return (DEF_NO);
+    }
+
+    pcp = (CPU_INT08U)(p_mutex->Cnt >> 8u);
+    if ((p_mutex->Cnt & 0x00FFu) == APP_SIM_MUTEX_AVAILABLE) {  /* See Note #1.                                         */
+        p_mutex->Cnt     = (CPU_INT16U)((p_mutex->Cnt & 0xFF00u) | p_cur->OriPrio);
+        p_mutex->OwnerIx = p_sim->CurIx;
+        p_cur->Err       = OS_ERR_NONE;
+        AppSim_RdyClr(p_sim, p_cur);
+        AppSim_ParaGet(p_sim, p_cur->OriPrio)->Now_TaskPriority = pcp;
+        AppSim_PrioSet(p_cur, pcp);
+        AppSim_RdySet(p_sim, p_cur);
+        p_sim->PrioTbl[pcp] = p_sim->CurIx;
+        return (AppSim_Sched(p_sim));
+    }
+
+    if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
+        mprio   = (CPU_INT08U)(p_mutex->Cnt & 0x00FFu);
+        p_owner = &p_sim->Tcb[p_mutex->OwnerIx];
+        if ((p_owner->Prio > pcp) && (mprio > p_cur->Prio)) {
+            p_mutex2 = (p_owner->MutexIx != APP_SIM_MUTEX_NONE) ? &p_sim->Mutex[p_owner->MutexIx] : (APP_SIM_MUTEX *)0;
+            if ((p_sim->RdyTbl[p_owner->Y] & p_owner->BitX) != 0u) {
+                AppSim_RdyClr(p_sim, p_owner);
+                rdy = DEF_YES;
+            } else {
+                if (p_mutex2 != (APP_SIM_MUTEX *)0) {
+                    p_mutex2->Tbl[p_owner->Y] &= (OS_PRIO)~p_owner->BitX;
+                    if (p_mutex2->Tbl[p_owner->Y] == 0u) {
+                        p_mutex2->Grp &= (OS_PRIO)~p_owner->BitY;
+                    }
+                }
+                rdy = DEF_NO;
+            }
+            AppSim_PrioSet(p_owner, pcp);
+            if (rdy == DEF_YES) {
+                AppSim_RdySet(p_sim, p_owner);
+            } else if (p_mutex2 != (APP_SIM_MUTEX *)0) {
+                p_mutex2->Grp             |= p_owner->BitY;
+                p_mutex2->Tbl[p_owner->Y] |= p_owner->BitX;
+            }
+            p_sim->PrioTbl[pcp] = p_mutex->OwnerIx;
+        }
+    }
+                                                                /* Mutex not available, pend current task.              */
+    p_cur->Stat            |= OS_STAT_MUTEX;
+    p_cur->StatPend         = OS_STAT_PEND_OK;
+    p_cur->Dly              = 0u;
+    p_cur->MutexIx          = mutex_ix;
+    p_cur->Err              = OS_ERR_NONE;                      /* Only a post can wake the task up.                    */
+    p_mutex->Grp           |= p_cur->BitY;
+    p_mutex->Tbl[p_cur->Y] |= p_cur->BitX;
+    AppSim_RdyClr(p_sim, p_cur);
+
+    return (AppSim_Sched(p_sim));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppSim_MutexPost()
+*
+* Description : Mirror of OSMutexPost() for the running task.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+*               mutex_ix    APP_SIM_MUTEX_R1 or APP_SIM_MUTEX_R2.
+*
+* Return(s)   : DEF_YES, if the CPU was given to another task.
+*               DEF_NO,  otherwise.
+*
+* Note(s)     : (1) The original priority is only restored if the task still runs at this mutex's
+*                   ceiling, as OSMutex_RdyAtPrio() would.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppSim_MutexPost (APP_SIM     *p_sim,
+                                       CPU_INT08U   mutex_ix)
+{
+    APP_SIM_MUTEX  *p_mutex;
+    APP_SIM_TCB    *p_cur;
+    APP_SIM_TCB    *p_wait;
+    CPU_INT08U      pcp;
+    CPU_INT08U      prio;
+    CPU_INT08U      y;
+
+
+    p_mutex = &p_sim->Mutex[mutex_ix];
+    p_cur   = &p_sim->Tcb[p_sim->CurIx];
+    if ((p_mutex->Created == DEF_NO) ||
+        (p_mutex->OwnerIx != p_sim->CurIx)) {
+        return (DEF_NO);
+    }
+
+    pcp  = (CPU_INT08U)(p_mutex->Cnt >> 8u);
+    prio = (CPU_INT08U)(p_mutex->Cnt & 0x00FFu);
+    if (pcp != OS_PRIO_MUTEX_CEIL_DIS) {
+        if (p_cur->Prio == pcp) {                               /* See Note #1.                                         */
+            AppSim_RdyClr(p_sim, p_cur);
+            AppSim_PrioSet(p_cur, prio);
+            p_sim->PrioCur = prio;
+            AppSim_RdySet(p_sim, p_cur);
+            p_sim->PrioTbl[prio] = p_sim->CurIx;
+        }
+        p_sim->PrioTbl[pcp] = APP_SIM_TCB_RESERVED;
+    }
+
+    if (p_mutex->Grp != 0u) {                                   /* Make the HPT waiting for the mutex its owner.        */
+        y      = OSUnMapTbl[p_mutex->Grp];
+        prio   = (CPU_INT08U)((y << 3u) + OSUnMapTbl[p_mutex->Tbl[y]]);
+        p_wait = AppSim_TcbGet(p_sim, prio);
+        if (p_wait == (APP_SIM_TCB *)0) {
+            return (DEF_NO);
+        }
+        p_wait->Dly       = 0u;
+        p_wait->Stat     &= (CPU_INT08U)~(CPU_INT08U)OS_STAT_MUTEX;
+        p_wait->StatPend  = OS_STAT_PEND_OK;
+        if ((p_wait->Stat & OS_STAT_SUSPEND) == OS_STAT_RDY) {
+            p_sim->RdyGrp    |= p_wait->BitY;
+            p_sim->RdyTbl[y] |= p_wait->BitX;
+        }
+        p_mutex->Tbl[p_wait->Y] &= (OS_PRIO)~p_wait->BitX;
+        if (p_mutex->Tbl[p_wait->Y] == 0u) {
+            p_mutex->Grp &= (OS_PRIO)~p_wait->BitY;
+        }
+        p_wait->MutexIx  = APP_SIM_MUTEX_NONE;
+        p_mutex->Cnt     = (CPU_INT16U)((p_mutex->Cnt & 0xFF00u) | prio);
+        p_mutex->OwnerIx = p_sim->PrioTbl[prio];
+        return (AppSim_Sched(p_sim));
+    }
+
+    p_mutex->Cnt    |= APP_SIM_MUTEX_AVAILABLE;
+    p_mutex->OwnerIx = APP_SIM_TCB_NONE;
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                              TASK (main.c)
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          AppSim_TaskStep()
+*
+* Description : Resume task() for the running task.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : DEF_YES, if the task gave the CPU to another task.
+*               DEF_NO,  if the task now spins waiting for the next tick.
+*
+* Note(s)     : (1) Every call that may switch tasks is a resume point.  Like the real task, a resumed task
+*                   prints its pending row with the tick at which it resumes.
+*
+*               (2) Locks & unlocks are only checked once per tick, after the tick that changed the number
+*                   of executed ticks; a lock or unlock at the very last tick of a job is never reached.
+*
+*               (3) A task that keeps looping without switching nor waiting for a tick would hang the
+*                   kernel; the model stops with APP_SIM_ERR_LIVELOCK instead.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppSim_TaskStep (APP_SIM  *p_sim)
+{
+    APP_SIM_TCB    *p_tcb;
+    task_para_set  *p_para;
+    CPU_INT32S      executed;
+    CPU_INT32U      step_ctr;
+
+
+    p_tcb    = &p_sim->Tcb[p_sim->CurIx];
+    p_para   = &p_tcb->Para;
+    step_ctr = 0u;
+
+    while (p_sim->Err == APP_SIM_ERR_NONE) {
+        step_ctr++;
+        if (step_ctr > APP_SIM_STEP_PER_TICK_MAX) {             /* See Note #3.                                         */
+            p_sim->Err = APP_SIM_ERR_LIVELOCK;
+            break;
+        }
+        executed = (CPU_INT32S)p_para->TaskExecutionTime - (CPU_INT32S)p_para->Task_need_ExecutionTime;
+
+        switch (p_tcb->Pc) {
+            case APP_SIM_PC_ENTRY:
+                 p_tcb->NextPeriod = (CPU_INT32U)p_para->TaskPeriodic * (p_para->TaskNumber + 1u) + p_para->TaskArriveTime;
+                 p_tcb->CurTick    = p_sim->Time;
+                 p_tcb->Pc         = APP_SIM_PC_LOOP;
+                 break;
+
+            case APP_SIM_PC_LOOP:                               /* See Note #2.                                         */
+                 if (p_para->Task_need_ExecutionTime == 0u) {
+                     p_tcb->Pc = APP_SIM_PC_DONE;
+                 } else if (p_tcb->CurTick != p_sim->Time) {
+                     p_tcb->Pc = APP_SIM_PC_UNLOCK_R1;
+                 } else {
+                     return (DEF_NO);
+                 }
+                 break;
+
+            case APP_SIM_PC_UNLOCK_R1:
+                 p_tcb->Pc = APP_SIM_PC_UNLOCK_R2;
+                 if ((p_para->R1_start != p_para->R1_end) && (executed == p_para->R1_end)) {
+                     p_tcb->BeforePrio = p_para->Now_TaskPriority;
+                     p_tcb->Pc         = APP_SIM_PC_UNLOCK_R1_DONE;
+                     if (AppSim_MutexPost(p_sim, APP_SIM_MUTEX_R1) == DEF_YES) {
+                         return (DEF_YES);
+                     }
+                 }
+                 break;
+
+            case APP_SIM_PC_UNLOCK_R1_DONE:
+                 p_para->Now_TaskPriority = ((p_sim->Mutex[APP_SIM_MUTEX_R2].Cnt & 0x00FFu) == p_para->TaskPriority)
+                                          ? p_sim->Ceiling[APP_SIM_MUTEX_R2]
+                                          : p_para->TaskPriority;
+                 AppSim_ResEmit(p_sim, p_tcb, APP_TSB_EVENT_UNLOCK, APP_SIM_MUTEX_R1);
+                 p_tcb->Pc = APP_SIM_PC_UNLOCK_R2;
+                 if (AppSim_Sched(p_sim) == DEF_YES) {
+                     return (DEF_YES);
+                 }
+                 break;
+
+            case APP_SIM_PC_UNLOCK_R2:
+                 p_tcb->Pc = APP_SIM_PC_LOCK_R1;
+                 if ((p_para->R2_start != p_para->R2_end) && (executed == p_para->R2_end)) {
+                     p_tcb->BeforePrio = p_para->Now_TaskPriority;
+                     p_tcb->Pc         = APP_SIM_PC_UNLOCK_R2_DONE;
+                     if (AppSim_MutexPost(p_sim, APP_SIM_MUTEX_R2) == DEF_YES) {
+                         return (DEF_YES);
+                     }
+                 }
+                 break;
+
+            case APP_SIM_PC_UNLOCK_R2_DONE:
+                 p_para->Now_TaskPriority = ((p_sim->Mutex[APP_SIM_MUTEX_R1].Cnt & 0x00FFu) == p_para->TaskPriority)
+                                          ? p_sim->Ceiling[APP_SIM_MUTEX_R1]
+                                          : p_para->TaskPriority;
+                 AppSim_ResEmit(p_sim, p_tcb, APP_TSB_EVENT_UNLOCK, APP_SIM_MUTEX_R2);
+                 p_tcb->Pc = APP_SIM_PC_LOCK_R1;
+                 if (AppSim_Sched(p_sim) == DEF_YES) {
+                     return (DEF_YES);
+                 }
+                 break;
+
+            case APP_SIM_PC_LOCK_R1:
+                 p_tcb->Pc = APP_SIM_PC_LOCK_R2;
+                 if ((p_para->R1_start != p_para->R1_end) && (executed == p_para->R1_start)) {
+                     p_tcb->BeforePrio = p_para->Now_TaskPriority;
+                     p_tcb->Pc         = APP_SIM_PC_LOCK_R1_DONE;
+                     if (AppSim_MutexPend(p_sim, APP_SIM_MUTEX_R1) == DEF_YES) {
+                         return (DEF_YES);
+                     }
+                 }
+                 break;
+
+            case APP_SIM_PC_LOCK_R1_DONE:
+                 AppSim_ResEmit(p_sim, p_tcb, APP_TSB_EVENT_LOCK, APP_SIM_MUTEX_R1);
+                 p_tcb->Pc = APP_SIM_PC_LOCK_R2;
+                 break;
+
+            case APP_SIM_PC_LOCK_R2:
+                 p_tcb->Pc = APP_SIM_PC_TICK_SAVE;
+                 if ((p_para->R2_start != p_para->R2_end) && (executed == p_para->R2_start)) {
+                     p_tcb->BeforePrio = p_para->Now_TaskPriority;
+                     p_tcb->Pc         = APP_SIM_PC_LOCK_R2_DONE;
+                     if (AppSim_MutexPend(p_sim, APP_SIM_MUTEX_R2) == DEF_YES) {
+                         return (DEF_YES);
+                     }
+                 }
+                 break;
+
+            case APP_SIM_PC_LOCK_R2_DONE:
+                 AppSim_ResEmit(p_sim, p_tcb, APP_TSB_EVENT_LOCK, APP_SIM_MUTEX_R2);
+                 p_tcb->Pc = APP_SIM_PC_TICK_SAVE;
+                 break;
+
+            case APP_SIM_PC_TICK_SAVE:
+                 p_tcb->CurTick = p_sim->Time;
+                 p_tcb->Pc      = APP_SIM_PC_LOOP;
+                 break;
+
+            case APP_SIM_PC_DONE:
+            default:
+                 p_tcb->Pc = APP_SIM_PC_ENTRY;
+                 if (p_tcb->NextPeriod - p_sim->Time > 0u) {       /* OSTimeDly().                                         */
+                     AppSim_RdyClr(p_sim, p_tcb);
+                     p_tcb->Dly = p_tcb->NextPeriod - p_sim->Time;
+                     if (AppSim_Sched(p_sim) == DEF_YES) {
+                         return (DEF_YES);
+                     }
+                 } else {
+                     AppSim_TaskSwHook(p_sim);
+                 }
+                 break;
+        }
+    }
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppSim_TaskRun()
+*
+* Description : Let tasks run until the running one spins waiting for the next tick.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The idle task never calls the kernel, so nothing more happens until the next tick.
+*********************************************************************************************************
+*/
+
+static  void  AppSim_TaskRun (APP_SIM  *p_sim)
+{
+    CPU_INT32U  sw_ctr;
+
+
+    sw_ctr = 0u;
+    while ((p_sim->Err   == APP_SIM_ERR_NONE) &&
+           (p_sim->CurIx != APP_SIM_IDLE_IX)) {                 /* See Note #1.                                         */
+        if (AppSim_TaskStep(p_sim) == DEF_NO) {
+            break;
+        }
+        sw_ctr++;
+        if (sw_ctr > APP_SIM_SW_PER_TICK_MAX * (p_sim->TaskNbr + 1u)) {
+            p_sim->Err = APP_SIM_ERR_LIVELOCK;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppSim_ResEmit()
+*
+* Description : Report a 'LockResource' or 'UnlockResource' row, as task() prints it.
+*
+* Argument(s) : p_sim       Pointer to the model instance.
+*
+*               p_tcb       Pointer to the running task.
+*
+*               kind        APP_TSB_EVENT_LOCK or APP_TSB_EVENT_UNLOCK.
+*
+*               mutex_ix    APP_SIM_MUTEX_R1 or APP_SIM_MUTEX_R2.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) task() only prints when the last OSMutexPend() succeeded, unlocks included.
+*********************************************************************************************************
+*/
+
+static  void  AppSim_ResEmit (APP_SIM      *p_sim,
+                              APP_SIM_TCB  *p_tcb,
+                              CPU_INT08U    kind,
+                              CPU_INT08U    mutex_ix)
+{
+    APP_TSB_EVENT  event;
+
+
+    if (p_tcb->Err != OS_ERR_NONE) {                            /* See Note #1.                                         */
+        return;
+    }
+    Mem_Clr(&event, sizeof(event));
+    event.Tick     = p_sim->Time;
+    event.Kind     = kind;
+    event.Res      = (CPU_INT08U)(mutex_ix + 1u);
+    event.PrioFrom = (CPU_INT08U)p_tcb->BeforePrio;
+    event.PrioTo   = (CPU_INT08U)p_tcb->Para.Now_TaskPriority;
+    event.CurId    = p_tcb->Para.TaskID;
+    event.CurJob   = p_tcb->Para.TaskNumber;
+    AppSim_EventEmit(p_sim, &event);
+}
+
+
+static  void  AppSim_EventEmit (APP_SIM        *p_sim,
+                                APP_TSB_EVENT  *p_event)
+{
+    if (p_sim->EventFnct != (APP_SIM_EVENT_FNCT)0) {
+        p_sim->EventFnct(p_sim->EventArg, p_event);
+    }
+}
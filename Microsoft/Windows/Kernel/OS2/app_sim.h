@@ -0,0 +1,170 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                    VIRTUAL-TIME SCHEDULER MODEL
+*
+* Filename : app_sim.h
+*
+* Note(s)  : (1) The model replays, one tick at a time & without threads, the parts of the kernel & of
+*                the application that decide the CPP/RM schedule :
+*
+*                    OSStart(), OSTimeTick(), OSIntExit(), OS_Sched(), OSTimeDly()    (os_core.c, os_time.c)
+*                    OSMutexCreate(), OSMutexPend(), OSMutexPost()                    (os_mutex.c)
+*                    InputFile(), App_TaskSwHook()                                    (app_hooks.c)
+*                    main(), task()                                                   (main.c)
+*
+*                Each of these is mirrored statement for statement, including the ready table, the
+*                priority table & the mutex wait lists, so that the model prints the same rows as the
+*                kernel does to 'Output.txt'.  Any change to those functions MUST be mirrored here.
+*
+*            (2) All state lives in an APP_SIM instance; several instances may run concurrently.
+*
+*            (3) Only OS_LOWEST_PRIO <= 63 (8-bit ready groups) is modelled.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_SIM_H
+#define  APP_SIM_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "app_tsb.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_SIM_TASK_MAX                    OS_MAX_TASKS       /* Max nbr of user tasks; the idle task is extra.       */
+#define  APP_SIM_IDLE_IX                 APP_SIM_TASK_MAX       /* TCB index of the idle task.                          */
+
+#define  APP_SIM_TCB_NONE                            0xFFu      /* Priority table entries (see OSTCBPrioTbl[]).         */
+#define  APP_SIM_TCB_RESERVED                        0xFEu      /* OS_TCB_RESERVED.                                     */
+
+#define  APP_SIM_MUTEX_R1                               0u
+#define  APP_SIM_MUTEX_R2                               1u
+#define  APP_SIM_MUTEX_NBR                              2u
+#define  APP_SIM_MUTEX_NONE                          0xFFu
+#define  APP_SIM_MUTEX_AVAILABLE                   0x00FFu      /* Same as OS_MUTEX_AVAILABLE in os_mutex.c.            */
+
+                                                                /* ------------------ SIMULATION ERRORS ------------- */
+#define  APP_SIM_ERR_NONE                               0u
+#define  APP_SIM_ERR_END                                1u      /* OSTime went past the end time (normal exit).         */
+#define  APP_SIM_ERR_MISS_DEADLINE                      2u      /* A 'MissDeadline' row was printed (normal exit).      */
+#define  APP_SIM_ERR_TCB_INVALID                        3u      /* The kernel would dereference a NULL/reserved TCB.    */
+#define  APP_SIM_ERR_LIVELOCK                           4u      /* Tasks keep switching without a tick going by.        */
+#define  APP_SIM_ERR_TASK_NBR                           5u      /* Too many tasks for the priority range.               */
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  void  (*APP_SIM_EVENT_FNCT)(void                 *p_arg,
+                                     const  APP_TSB_EVENT  *p_event);
+
+
+typedef  struct  app_sim_tcb {
+    task_para_set  Para;                                        /* TaskParameter[] entry of the task.                   */
+
+    CPU_INT16U     Id;                                          /* OS_TCB fields.                                       */
+    CPU_INT08U     Prio;
+    CPU_INT08U     OriPrio;
+    CPU_INT08U     Y;
+    CPU_INT08U     X;
+    OS_PRIO        BitY;
+    OS_PRIO        BitX;
+    CPU_INT32U     Dly;
+    CPU_INT08U     Stat;
+    CPU_INT08U     StatPend;
+    CPU_INT08U     MutexIx;                                     /* OSTCBEventPtr, as an index in APP_SIM.Mutex[].       */
+
+    CPU_INT08U     Pc;                                          /* task() resume point & locals.                        */
+    CPU_INT08U     Err;
+    CPU_INT16U     BeforePrio;
+    CPU_INT32U     NextPeriod;
+    CPU_INT32U     CurTick;
+} APP_SIM_TCB;
+
+
+typedef  struct  app_sim_mutex {
+    CPU_BOOLEAN    Created;
+    CPU_INT16U     Cnt;                                         /* OSEventCnt : PCP << 8 | owner priority.              */
+    CPU_INT08U     OwnerIx;                                     /* OSEventPtr, as a TCB index.                          */
+    OS_PRIO        Grp;                                         /* OSEventGrp & OSEventTbl[].                           */
+    OS_PRIO        Tbl[OS_EVENT_TBL_SIZE];
+} APP_SIM_MUTEX;
+
+
+typedef  struct  app_sim {
+    APP_SIM_TCB         Tcb[APP_SIM_TASK_MAX + 1u];             /* In priority order; the idle task is last.            */
+    CPU_INT32U          TaskNbr;                                /* TASK_NUMBER.                                         */
+    APP_SIM_MUTEX       Mutex[APP_SIM_MUTEX_NBR];
+    CPU_INT16U          Ceiling[APP_SIM_MUTEX_NBR];             /* R1_ceiling & R2_ceiling.                             */
+
+    OS_PRIO             RdyGrp;
+    OS_PRIO             RdyTbl[OS_RDY_TBL_SIZE];
+    CPU_INT08U          PrioTbl[OS_LOWEST_PRIO + 1u];           /* TCB index, APP_SIM_TCB_NONE or APP_SIM_TCB_RESERVED. */
+    CPU_INT08U          PrioCur;
+    CPU_INT08U          PrioHighRdy;
+    CPU_INT08U          CurIx;
+
+    CPU_INT32U          Time;
+    CPU_INT32U          EndTime;
+    CPU_INT32U          CtxSwCtr;
+    CPU_INT08U          Err;
+
+    APP_SIM_EVENT_FNCT  EventFnct;                              /* Called for every row the kernel would print.         */
+    void               *EventArg;
+} APP_SIM;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppSim_Init (       APP_SIM             *p_sim,
+                          const  task_para_set       *p_tasks,
+                                 CPU_INT32U           task_nbr,
+                                 CPU_INT32U           end_time,
+                                 APP_SIM_EVENT_FNCT   event_fnct,
+                                 void                *p_event_arg);
+
+CPU_BOOLEAN  AppSim_Tick (       APP_SIM             *p_sim);
+
+CPU_INT08U   AppSim_Run  (       APP_SIM             *p_sim);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
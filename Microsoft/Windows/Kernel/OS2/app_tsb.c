@@ -0,0 +1,1121 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                  BINARY TASK-SET / RESULT CONTAINER
+*
+* Filename : app_tsb.c
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "app_tsb.h"
+
+#ifdef   _WIN32
+#define   WIN32_LEAN_AND_MEAN
+#include  <windows.h>
+#else
+#include  <fcntl.h>
+#include  <sys/mman.h>
+#include  <sys/stat.h>
+#include  <unistd.h>
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_TSB_ALIGN_UP(val)          ((((val) + (APP_TSB_ALIGN - 1u)) / APP_TSB_ALIGN) * APP_TSB_ALIGN)
+#define  APP_TSB_LINE_MAX                       128u
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT08U  AppTsb_ColSizeTbl[APP_TSB_COL_NBR] = {
+    4u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 2u
+};
+
+static  const  CPU_CHAR   *AppTsb_KindNameTbl[APP_TSB_EVENT_KIND_NBR] = {
+    "Preemption",
+    "Completion",
+    "MissDeadline",
+    "LockResource",
+    "UnlockResource"
+};
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U   AppTsb_ColOffGet (CPU_INT32U   event_off,
+                                       CPU_INT32U   event_nbr,
+                                       CPU_INT08U   col);
+
+static  CPU_BOOLEAN  AppTsb_TaskTokParse(const CPU_CHAR    *p_tok,
+                                               CPU_INT16U  *p_id,
+                                               CPU_INT16U  *p_job);
+
+static  void         AppTsb_TaskTokWr (FILE        *p_fp,
+                                       CPU_INT16U   id,
+                                       CPU_INT16U   job);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          MAPPING & ITERATION
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          AppTsb_FileOpen()
+*
+* Description : Map an archive read-only into the address space.
+*
+* Argument(s) : p_file      Pointer to the archive descriptor to fill.
+*
+*               p_path      Path of the archive.
+*
+* Return(s)   : DEF_OK,   if the archive was mapped & its first container is valid.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Nothing is copied; every accessor of this module reads straight from the mapping.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppTsb_FileOpen (      APP_TSB_FILE  *p_file,
+                              const CPU_CHAR      *p_path)
+{
+#ifdef  _WIN32
+    HANDLE         h_file;
+    HANDLE         h_map;
+    LARGE_INTEGER  size;
+
+
+    p_file->BasePtr = (CPU_INT08U *)0;
+    h_file = CreateFileA(p_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                         FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (h_file == INVALID_HANDLE_VALUE) {
+        return (DEF_FAIL);
+    }
+    if ((GetFileSizeEx(h_file, &size) == 0) || (size.QuadPart < APP_TSB_HDR_SIZE)) {
+        CloseHandle(h_file);
+        return (DEF_FAIL);
+    }
+    h_map = CreateFileMappingA(h_file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (h_map == NULL) {
+        CloseHandle(h_file);
+        return (DEF_FAIL);
+    }
+    p_file->BasePtr    = (CPU_INT08U *)MapViewOfFile(h_map, FILE_MAP_READ, 0, 0, 0);
+    p_file->FileHandle = (void *)h_file;
+    p_file->MapHandle  = (void *)h_map;
+    p_file->Size       = (CPU_INT64U)size.QuadPart;
+#else
+    int          fd;
+    struct stat  st;
+    void        *p_map;
+
+
+    p_file->BasePtr = (CPU_INT08U *)0;
+    fd = open(p_path, O_RDONLY);
+    if (fd < 0) {
+        return (DEF_FAIL);
+    }
+    if ((fstat(fd, &st) != 0) || (st.st_size < APP_TSB_HDR_SIZE)) {
+        close(fd);
+        return (DEF_FAIL);
+    }
+    p_map = mmap((void *)0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p_map == MAP_FAILED) {
+        return (DEF_FAIL);
+    }
+    p_file->BasePtr    = (CPU_INT08U *)p_map;
+    p_file->FileHandle = (void *)0;
+    p_file->MapHandle  = (void *)0;
+    p_file->Size       = (CPU_INT64U)st.st_size;
+#endif
+
+    if (p_file->BasePtr == (CPU_INT08U *)0) {
+        AppTsb_FileClose(p_file);
+        return (DEF_FAIL);
+    }
+    if (AppTsb_Validate(p_file->BasePtr, p_file->Size) != DEF_OK) {
+        AppTsb_FileClose(p_file);
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppTsb_FileClose()
+*
+* Description : Unmap an archive opened by AppTsb_FileOpen().
+*
+* Argument(s) : p_file      Pointer to the archive descriptor.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  AppTsb_FileClose (APP_TSB_FILE  *p_file)
+{
+#ifdef  _WIN32
+    if (p_file->BasePtr != (CPU_INT08U *)0) {
+        UnmapViewOfFile(p_file->BasePtr);
+    }
+    if (p_file->MapHandle != (void *)0) {
+        CloseHandle((HANDLE)p_file->MapHandle);
+    }
+    if (p_file->FileHandle != (void *)0) {
+        CloseHandle((HANDLE)p_file->FileHandle);
+    }
+#else
+    if (p_file->BasePtr != (CPU_INT08U *)0) {
+        munmap(p_file->BasePtr, (size_t)p_file->Size);
+    }
+#endif
+    p_file->BasePtr    = (CPU_INT08U *)0;
+    p_file->FileHandle = (void *)0;
+    p_file->MapHandle  = (void *)0;
+    p_file->Size       = 0u;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppTsb_Next()
+*
+* Description : Step to the next container of an archive.
+*
+* Argument(s) : p_file      Pointer to the mapped archive.
+*
+*               p_hdr       Pointer to the current container, or NULL to get the first one.
+*
+* Return(s)   : Pointer to the next valid container, or NULL at the end of the archive.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+const  CPU_INT08U  *AppTsb_Next (const  APP_TSB_FILE  *p_file,
+                                 const  CPU_INT08U    *p_hdr)
+{
+    CPU_INT64U  off;
+
+
+    if (p_hdr == (const CPU_INT08U *)0) {
+        off = 0u;
+    } else {
+        off = (CPU_INT64U)(p_hdr - p_file->BasePtr) + APP_TSB_HDR_SIZE_GET(p_hdr);
+    }
+    if (off + APP_TSB_HDR_SIZE > p_file->Size) {
+        return ((const CPU_INT08U *)0);
+    }
+    p_hdr = p_file->BasePtr + off;
+    if (AppTsb_Validate(p_hdr, p_file->Size - off) != DEF_OK) {
+        return ((const CPU_INT08U *)0);
+    }
+
+    return (p_hdr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppTsb_Validate()
+*
+* Description : Check that a container header is consistent & fits in the bytes that remain.
+*
+* Argument(s) : p_hdr       Pointer to the container header.
+*
+*               rem         Number of octets available from 'p_hdr' onwards.
+*
+* Return(s)   : DEF_OK,   if the container can be iterated safely.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Containers written by a newer MINOR version remain readable; a different MAJOR
+*                   version is rejected.
+*
+*               (2) Every field used as a count, an offset or an index is checked, so that a corrupt
+*                   container can neither stall AppTsb_Next() (a size below the header) nor make its
+*                   readers step outside the mapping :
+*
+*                   (a) The task, resource, event & job tables lie inside the container; sizes are
+*                       computed on 64 bits so that huge counts cannot wrap.
+*                   (b) The resources of each task lie inside the resource table.
+*                   (c) Each event kind indexes AppTsb_KindNameTbl[].
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppTsb_Validate (const  CPU_INT08U  *p_hdr,
+                                     CPU_INT64U   rem)
+{
+    CPU_INT32U          size;
+    CPU_INT32U          task_nbr;
+    CPU_INT32U          res_nbr;
+    CPU_INT32U          event_nbr;
+    CPU_INT32U          job_nbr;
+    CPU_INT32U          i;
+    const  CPU_INT08U  *p_task;
+    const  CPU_INT08U  *p_kind;
+
+
+    if (rem < APP_TSB_HDR_SIZE) {
+        return (DEF_FAIL);
+    }
+    if ((APP_TSB_GET32(p_hdr, APP_TSB_HDR_OFF_MAGIC)     != APP_TSB_MAGIC) ||
+        (APP_TSB_GET16(p_hdr, APP_TSB_HDR_OFF_VER_MAJOR) != APP_TSB_VER_MAJOR)) {
+        return (DEF_FAIL);
+    }
+    size      = APP_TSB_HDR_SIZE_GET(p_hdr);
+    task_nbr  = APP_TSB_HDR_TASK_NBR(p_hdr);
+    res_nbr   = APP_TSB_HDR_RES_NBR(p_hdr);
+    event_nbr = APP_TSB_HDR_EVENT_NBR(p_hdr);
+    job_nbr   = APP_TSB_HDR_JOB_NBR(p_hdr);
+    if ((size < APP_TSB_HDR_SIZE) || (size > rem) || (job_nbr > event_nbr)) {
+        return (DEF_FAIL);
+    }
+                                                                /* See Note #2a.                                        */
+    if ((APP_TSB_GET32(p_hdr, APP_TSB_HDR_OFF_TASK_OFF)  + (CPU_INT64U)task_nbr * APP_TSB_TASK_SIZE > size) ||
+        (APP_TSB_GET32(p_hdr, APP_TSB_HDR_OFF_RES_OFF)   + (CPU_INT64U)res_nbr  * APP_TSB_RES_SIZE  > size) ||
+        (AppTsb_ColOffGet(APP_TSB_GET32(p_hdr, APP_TSB_HDR_OFF_EVENT_OFF), event_nbr, APP_TSB_COL_NBR) >
+         APP_TSB_GET32(p_hdr, APP_TSB_HDR_OFF_JOB_OFF)) ||
+        (APP_TSB_GET32(p_hdr, APP_TSB_HDR_OFF_JOB_OFF) + (CPU_INT64U)APP_TSB_JOB_COL_NBR * APP_TSB_ALIGN_UP((CPU_INT64U)job_nbr * 2u) > size)) {
+        return (DEF_FAIL);
+    }
+    for (i = 0u; i < task_nbr; i++) {                           /* See Note #2b.                                        */
+        p_task = APP_TSB_TASK_PTR(p_hdr, i);
+        if ((CPU_INT32U)APP_TSB_GET16(p_task, APP_TSB_TASK_OFF_RES_IX) +
+                        APP_TSB_GET16(p_task, APP_TSB_TASK_OFF_RES_NBR) > res_nbr) {
+            return (DEF_FAIL);
+        }
+    }
+    p_kind = AppTsb_ColGet(p_hdr, APP_TSB_COL_KIND);            /* See Note #2c.                                        */
+    for (i = 0u; i < event_nbr; i++) {
+        if (p_kind[i] >= APP_TSB_EVENT_KIND_NBR) {
+            return (DEF_FAIL);
+        }
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppTsb_ColGet()
+*
+* Description : Get a pointer to one event column of a container.
+*
+* Argument(s) : p_hdr       Pointer to the container header.
+*
+*               col         Column, APP_TSB_COL_xxx.
+*
+* Return(s)   : Pointer to the first element of the column.
+*
+* Note(s)     : (1) Element 'i' of a column of width 'w' is at '&p_col[i * w]'; a scan over a single
+*                   field therefore touches only the octets of that field.
+*********************************************************************************************************
+*/
+
+const  CPU_INT08U  *AppTsb_ColGet (const  CPU_INT08U  *p_hdr,
+                                          CPU_INT08U   col)
+{
+    return (p_hdr + (CPU_SIZE_T)AppTsb_ColOffGet(APP_TSB_GET32(p_hdr, APP_TSB_HDR_OFF_EVENT_OFF),
+                                                 APP_TSB_HDR_EVENT_NBR(p_hdr),
+                                                 col));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppTsb_JobColGet()
+*
+* Description : Get a pointer to one job column of a container.
+*
+* Argument(s) : p_hdr       Pointer to the container header.
+*
+*               col         Column, APP_TSB_JOB_COL_xxx.
+*
+* Return(s)   : Pointer to the first element of the column; every element is 2 octets wide.
+*
+* Note(s)     : (1) Entry 'k' of the job columns belongs to the k-th 'Completion' event.
+*********************************************************************************************************
+*/
+
+const  CPU_INT08U  *AppTsb_JobColGet (const  CPU_INT08U  *p_hdr,
+                                             CPU_INT08U   col)
+{
+    return (p_hdr + APP_TSB_GET32(p_hdr, APP_TSB_HDR_OFF_JOB_OFF)
+                  + (CPU_INT32U)col * APP_TSB_ALIGN_UP(APP_TSB_HDR_JOB_NBR(p_hdr) * 2u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppTsb_EventGet()
+*
+* Description : Unpack one event of a container.
+*
+* Argument(s) : p_hdr       Pointer to the container header.
+*
+*               ix          Event index.
+*
+*               p_event     Pointer to the event to fill.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The job index of a completion is found by counting the completions before it; callers
+*                   that walk a whole container should read the columns directly instead.
+*********************************************************************************************************
+*/
+
+void  AppTsb_EventGet (const  CPU_INT08U     *p_hdr,
+                              CPU_INT32U      ix,
+                              APP_TSB_EVENT  *p_event)
+{
+    const  CPU_INT08U  *p_kind;
+           CPU_INT32U   job_ix;
+           CPU_INT32U   i;
+
+
+    p_kind            = AppTsb_ColGet(p_hdr, APP_TSB_COL_KIND);
+    p_event->Tick     = APP_TSB_GET32(AppTsb_ColGet(p_hdr, APP_TSB_COL_TICK),     ix * 4u);
+    p_event->Kind     = p_kind[ix];
+    p_event->Res      = AppTsb_ColGet(p_hdr, APP_TSB_COL_RES)[ix];
+    p_event->PrioFrom = AppTsb_ColGet(p_hdr, APP_TSB_COL_PRIO_FROM)[ix];
+    p_event->PrioTo   = AppTsb_ColGet(p_hdr, APP_TSB_COL_PRIO_TO)[ix];
+    p_event->CurId    = APP_TSB_GET16(AppTsb_ColGet(p_hdr, APP_TSB_COL_CUR_ID),   ix * 2u);
+    p_event->CurJob   = APP_TSB_GET16(AppTsb_ColGet(p_hdr, APP_TSB_COL_CUR_JOB),  ix * 2u);
+    p_event->NextId   = APP_TSB_GET16(AppTsb_ColGet(p_hdr, APP_TSB_COL_NEXT_ID),  ix * 2u);
+    p_event->NextJob  = APP_TSB_GET16(AppTsb_ColGet(p_hdr, APP_TSB_COL_NEXT_JOB), ix * 2u);
+    p_event->Resp     = 0u;
+    p_event->Blk      = 0u;
+    p_event->Pre      = 0;
+
+    if (p_event->Kind == APP_TSB_EVENT_COMPLETION) {
+        job_ix = 0u;
+        for (i = 0u; i < ix; i++) {
+            if (p_kind[i] == APP_TSB_EVENT_COMPLETION) {
+                job_ix++;
+            }
+        }
+        p_event->Resp = APP_TSB_GET16(AppTsb_JobColGet(p_hdr, APP_TSB_JOB_COL_RESP), job_ix * 2u);
+        p_event->Blk  = APP_TSB_GET16(AppTsb_JobColGet(p_hdr, APP_TSB_JOB_COL_BLK),  job_ix * 2u);
+        p_event->Pre  = (CPU_INT16S)APP_TSB_GET16(AppTsb_JobColGet(p_hdr, APP_TSB_JOB_COL_PRE), job_ix * 2u);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               BUILDING
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           AppTsb_Build()
+*
+* Description : Serialize a task set & its event stream into one container.
+*
+* Argument(s) : p_buf       Pointer to the destination buffer, or NULL to only compute the size.
+*
+*               buf_size    Size of 'p_buf', in octets.
+*
+*               p_tasks     Task set, in file order (see 'AppTsb_TaskSetRd()').
+*
+*               task_nbr    Number of tasks.
+*
+*               p_events    Event stream, or NULL.
+*
+*               event_nbr   Number of events.
+*
+* Return(s)   : Size of the container, in octets, or 0 if 'p_buf' is too small.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  AppTsb_Build (       CPU_INT08U     *p_buf,
+                                 CPU_INT32U      buf_size,
+                          const  task_para_set  *p_tasks,
+                                 CPU_INT32U      task_nbr,
+                          const  APP_TSB_EVENT  *p_events,
+                                 CPU_INT32U      event_nbr)
+{
+    CPU_INT32U   res_nbr;
+    CPU_INT32U   job_nbr;
+    CPU_INT32U   task_off;
+    CPU_INT32U   res_off;
+    CPU_INT32U   event_off;
+    CPU_INT32U   job_off;
+    CPU_INT32U   size;
+    CPU_INT32U   i;
+    CPU_INT32U   k;
+    CPU_INT32U   res_ix;
+    CPU_INT08U  *p_rec;
+    CPU_INT08U  *p_col[APP_TSB_COL_NBR];
+    CPU_INT08U  *p_job[APP_TSB_JOB_COL_NBR];
+
+
+    res_nbr = 0u;
+    for (i = 0u; i < task_nbr; i++) {
+        if (p_tasks[i].R1_start != p_tasks[i].R1_end) {
+            res_nbr++;
+        }
+        if (p_tasks[i].R2_start != p_tasks[i].R2_end) {
+            res_nbr++;
+        }
+    }
+    job_nbr = 0u;
+    for (i = 0u; i < event_nbr; i++) {
+        if (p_events[i].Kind == APP_TSB_EVENT_COMPLETION) {
+            job_nbr++;
+        }
+    }
+
+    task_off  = APP_TSB_HDR_SIZE;
+    res_off   = APP_TSB_ALIGN_UP(task_off + task_nbr * APP_TSB_TASK_SIZE);
+    event_off = APP_TSB_ALIGN_UP(res_off  + res_nbr  * APP_TSB_RES_SIZE);
+    job_off   = (CPU_INT32U)AppTsb_ColOffGet(event_off, event_nbr, APP_TSB_COL_NBR);
+    size      = job_off + APP_TSB_JOB_COL_NBR * APP_TSB_ALIGN_UP(job_nbr * 2u);
+
+    if (p_buf == (CPU_INT08U *)0) {
+        return (size);
+    }
+    if (buf_size < size) {
+        return (0u);
+    }
+
+    Mem_Clr(p_buf, size);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_MAGIC,     APP_TSB_MAGIC);
+    MEM_VAL_SET_INT16U_LITTLE(p_buf + APP_TSB_HDR_OFF_VER_MAJOR, APP_TSB_VER_MAJOR);
+    MEM_VAL_SET_INT16U_LITTLE(p_buf + APP_TSB_HDR_OFF_VER_MINOR, APP_TSB_VER_MINOR);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_HDR_SIZE,  APP_TSB_HDR_SIZE);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_SIZE,      size);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_TASK_NBR,  task_nbr);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_RES_NBR,   res_nbr);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_EVENT_NBR, event_nbr);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_JOB_NBR,   job_nbr);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_TASK_OFF,  task_off);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_RES_OFF,   res_off);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_EVENT_OFF, event_off);
+    MEM_VAL_SET_INT32U_LITTLE(p_buf + APP_TSB_HDR_OFF_JOB_OFF,   job_off);
+
+    res_ix = 0u;                                                /* ---------- TASK RECORDS & RESOURCE TABLE --------- */
+    for (i = 0u; i < task_nbr; i++) {
+        p_rec = p_buf + task_off + i * APP_TSB_TASK_SIZE;
+        MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_TASK_OFF_ID,     p_tasks[i].TaskID);
+        MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_TASK_OFF_ARRIVE, p_tasks[i].TaskArriveTime);
+        MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_TASK_OFF_EXEC,   p_tasks[i].TaskExecutionTime);
+        MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_TASK_OFF_PERIOD, p_tasks[i].TaskPeriodic);
+        MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_TASK_OFF_RES_IX, res_ix);
+        k = 0u;
+        if (p_tasks[i].R1_start != p_tasks[i].R1_end) {
+            p_rec = p_buf + res_off + (res_ix + k) * APP_TSB_RES_SIZE;
+            p_rec[APP_TSB_RES_OFF_ID] = 1u;
+            MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_RES_OFF_TASK_IX, i);
+            MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_RES_OFF_LOCK,    p_tasks[i].R1_start);
+            MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_RES_OFF_UNLOCK,  p_tasks[i].R1_end);
+            k++;
+        }
+        if (p_tasks[i].R2_start != p_tasks[i].R2_end) {
+            p_rec = p_buf + res_off + (res_ix + k) * APP_TSB_RES_SIZE;
+            p_rec[APP_TSB_RES_OFF_ID] = 2u;
+            MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_RES_OFF_TASK_IX, i);
+            MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_RES_OFF_LOCK,    p_tasks[i].R2_start);
+            MEM_VAL_SET_INT16U_LITTLE(p_rec + APP_TSB_RES_OFF_UNLOCK,  p_tasks[i].R2_end);
+            k++;
+        }
+        MEM_VAL_SET_INT16U_LITTLE(p_buf + task_off + i * APP_TSB_TASK_SIZE + APP_TSB_TASK_OFF_RES_NBR, k);
+        res_ix += k;
+    }
+
+    for (i = 0u; i < APP_TSB_COL_NBR; i++) {                    /* ------------ EVENT & JOB COLUMNS ----------------- */
+        p_col[i] = p_buf + (CPU_SIZE_T)AppTsb_ColOffGet(event_off, event_nbr, (CPU_INT08U)i);
+    }
+    for (i = 0u; i < APP_TSB_JOB_COL_NBR; i++) {
+        p_job[i] = p_buf + job_off + i * APP_TSB_ALIGN_UP(job_nbr * 2u);
+    }
+    k = 0u;
+    for (i = 0u; i < event_nbr; i++) {
+        MEM_VAL_SET_INT32U_LITTLE(p_col[APP_TSB_COL_TICK]     + i * 4u, p_events[i].Tick);
+        p_col[APP_TSB_COL_KIND][i]      = p_events[i].Kind;
+        p_col[APP_TSB_COL_RES][i]       = p_events[i].Res;
+        p_col[APP_TSB_COL_PRIO_FROM][i] = p_events[i].PrioFrom;
+        p_col[APP_TSB_COL_PRIO_TO][i]   = p_events[i].PrioTo;
+        MEM_VAL_SET_INT16U_LITTLE(p_col[APP_TSB_COL_CUR_ID]   + i * 2u, p_events[i].CurId);
+        MEM_VAL_SET_INT16U_LITTLE(p_col[APP_TSB_COL_CUR_JOB]  + i * 2u, p_events[i].CurJob);
+        MEM_VAL_SET_INT16U_LITTLE(p_col[APP_TSB_COL_NEXT_ID]  + i * 2u, p_events[i].NextId);
+        MEM_VAL_SET_INT16U_LITTLE(p_col[APP_TSB_COL_NEXT_JOB] + i * 2u, p_events[i].NextJob);
+        if (p_events[i].Kind == APP_TSB_EVENT_COMPLETION) {
+            MEM_VAL_SET_INT16U_LITTLE(p_job[APP_TSB_JOB_COL_RESP] + k * 2u, p_events[i].Resp);
+            MEM_VAL_SET_INT16U_LITTLE(p_job[APP_TSB_JOB_COL_BLK]  + k * 2u, p_events[i].Blk);
+            MEM_VAL_SET_INT16U_LITTLE(p_job[APP_TSB_JOB_COL_PRE]  + k * 2u, (CPU_INT16U)p_events[i].Pre);
+            k++;
+        }
+    }
+
+    return (size);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             TEXT FORMATS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          AppTsb_TaskSetRd()
+*
+* Description : Read a 'TaskSet.txt' file in file order.
+*
+* Argument(s) : p_path      Path of the task set.
+*
+*               p_tasks     Array to fill.
+*
+*               task_max    Number of entries in 'p_tasks'.
+*
+* Return(s)   : Number of tasks read.
+*
+* Note(s)     : (1) Unlike InputFile(), the tasks are neither sorted nor given a priority, so that a task
+*                   set written back by AppTsb_ToText() is identical to the original.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  AppTsb_TaskSetRd (const  CPU_CHAR       *p_path,
+                                     task_para_set  *p_tasks,
+                                     CPU_INT32U      task_max)
+{
+    FILE        *p_fp;
+    CPU_CHAR     str[APP_TSB_LINE_MAX];
+    CPU_CHAR    *p_tok;
+    CPU_CHAR    *p_ctx;
+    int          info[INFO];
+    CPU_INT32U   nbr;
+    CPU_INT32U   i;
+
+
+    if (fopen_s(&p_fp, p_path, "r") != 0) {
+        return (0u);
+    }
+
+    nbr = 0u;
+    while ((nbr < task_max) && (fgets(str, sizeof(str), p_fp) != NULL)) {
+        Mem_Clr(info, sizeof(info));
+        p_ctx = NULL;
+        p_tok = strtok_s(str, " \t\r\n", &p_ctx);
+        for (i = 0u; (i < INFO) && (p_tok != NULL); i++) {
+            info[i] = atoi(p_tok);
+            p_tok   = strtok_s(NULL, " \t\r\n", &p_ctx);
+        }
+        if (i < 4u) {                                           /* Skip blank lines.                                    */
+            continue;
+        }
+        Mem_Clr(&p_tasks[nbr], sizeof(task_para_set));
+        p_tasks[nbr].TaskID                  = (INT16U)info[0];
+        p_tasks[nbr].TaskArriveTime          = (INT16U)info[1];
+        p_tasks[nbr].TaskExecutionTime       = (INT16U)info[2];
+        p_tasks[nbr].TaskPeriodic            = (INT16U)info[3];
+        p_tasks[nbr].R1_start                = (INT8U) info[4];
+        p_tasks[nbr].R1_end                  = (INT8U) info[5];
+        p_tasks[nbr].R2_start                = (INT8U) info[6];
+        p_tasks[nbr].R2_end                  = (INT8U) info[7];
+        p_tasks[nbr].Task_need_ExecutionTime = (INT16U)info[2];
+        nbr++;
+    }
+    fclose(p_fp);
+
+    return (nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppTsb_EventParse()
+*
+* Description : Parse one line of 'Output.txt'.
+*
+* Argument(s) : p_line      Line to parse.
+*
+*               p_event     Pointer to the event to fill.
+*
+* Return(s)   : DEF_OK,   if the line is a known event.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Columns are separated by one or more TABs.  The idle task is printed as 'task(63)'
+*                   without a job number.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppTsb_EventParse (const  CPU_CHAR       *p_line,
+                                       APP_TSB_EVENT  *p_event)
+{
+    CPU_CHAR     str[APP_TSB_LINE_MAX];
+    CPU_CHAR    *p_tok[8];
+    CPU_CHAR    *p_ctx;
+    CPU_INT32U   tok_nbr;
+    CPU_INT08U   kind;
+    unsigned     res;
+    unsigned     prio_from;
+    unsigned     prio_to;
+
+
+    Str_Copy_N(str, p_line, sizeof(str) - 1u);
+    str[sizeof(str) - 1u] = '\0';
+    p_ctx   = NULL;
+    tok_nbr = 0u;
+    p_tok[0] = strtok_s(str, "\t\r\n", &p_ctx);
+    while ((p_tok[tok_nbr] != NULL) && (tok_nbr < 7u)) {
+        tok_nbr++;
+        p_tok[tok_nbr] = strtok_s(NULL, "\t\r\n", &p_ctx);
+    }
+    if (tok_nbr < 3u) {
+        return (DEF_FAIL);
+    }
+
+    for (kind = 0u; kind < APP_TSB_EVENT_KIND_NBR; kind++) {
+        if (Str_Cmp(p_tok[1], AppTsb_KindNameTbl[kind]) == 0) {
+            break;
+        }
+    }
+    if (kind >= APP_TSB_EVENT_KIND_NBR) {
+        return (DEF_FAIL);
+    }
+
+    Mem_Clr(p_event, sizeof(APP_TSB_EVENT));
+    p_event->Tick   = (CPU_INT32U)atol(p_tok[0]);
+    p_event->Kind   = kind;
+    if (AppTsb_TaskTokParse(p_tok[2], &p_event->CurId, &p_event->CurJob) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+
+    switch (kind) {
+        case APP_TSB_EVENT_LOCK:
+        case APP_TSB_EVENT_UNLOCK:
+             if ((tok_nbr < 4u) ||
+                 (sscanf(p_tok[3], "R%u %u to %u", &res, &prio_from, &prio_to) != 3)) {
+                 return (DEF_FAIL);
+             }
+             p_event->Res      = (CPU_INT08U)res;
+             p_event->PrioFrom = (CPU_INT08U)prio_from;
+             p_event->PrioTo   = (CPU_INT08U)prio_to;
+             break;
+
+        case APP_TSB_EVENT_COMPLETION:
+        case APP_TSB_EVENT_PREEMPTION:
+             if ((tok_nbr < 4u) ||
+                 (AppTsb_TaskTokParse(p_tok[3], &p_event->NextId, &p_event->NextJob) != DEF_OK)) {
+                 return (DEF_FAIL);
+             }
+             if (kind == APP_TSB_EVENT_COMPLETION) {
+                 if (tok_nbr < 7u) {
+                     return (DEF_FAIL);
+                 }
+                 p_event->Resp = (CPU_INT16U)atoi(p_tok[4]);
+                 p_event->Blk  = (CPU_INT16U)atoi(p_tok[5]);
+                 p_event->Pre  = (CPU_INT16S)atoi(p_tok[6]);
+             }
+             break;
+
+        case APP_TSB_EVENT_MISS_DEADLINE:
+        default:
+             break;
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppTsb_EventWr()
+*
+* Description : Print one event exactly as the scheduler prints it to 'Output.txt'.
+*
+* Argument(s) : p_fp        File to print to.
+*
+*               p_event     Pointer to the event.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The formats mirror App_TaskSwHook(), OSIntExit() & task() so that a text -> binary
+*                   -> text round trip is byte-identical.
+*********************************************************************************************************
+*/
+
+void  AppTsb_EventWr (       FILE           *p_fp,
+                      const  APP_TSB_EVENT  *p_event)
+{
+    switch (p_event->Kind) {
+        case APP_TSB_EVENT_LOCK:
+        case APP_TSB_EVENT_UNLOCK:
+             fprintf(p_fp, "%d\t%s\ttask( %d)( %d)\tR%d %d to %d\n",
+                     (int)p_event->Tick, AppTsb_KindNameTbl[p_event->Kind],
+                     p_event->CurId, p_event->CurJob, p_event->Res, p_event->PrioFrom, p_event->PrioTo);
+             break;
+
+        case APP_TSB_EVENT_MISS_DEADLINE:
+             fprintf(p_fp, "%d\tMissDeadline\ttask( %d)( %d)\t\t----------------- \n",
+                     (int)p_event->Tick, p_event->CurId, p_event->CurJob);
+             break;
+
+        case APP_TSB_EVENT_PREEMPTION:
+        case APP_TSB_EVENT_COMPLETION:
+        default:
+             fprintf(p_fp, "%d\t%s\t", (int)p_event->Tick, AppTsb_KindNameTbl[p_event->Kind]);
+             AppTsb_TaskTokWr(p_fp, p_event->CurId, p_event->CurJob);
+             fprintf(p_fp, "\t");
+             AppTsb_TaskTokWr(p_fp, p_event->NextId, p_event->NextJob);
+             if (p_event->Kind == APP_TSB_EVENT_COMPLETION) {
+                 fprintf(p_fp, "\t%d\t\t%d\t\t\t%d", p_event->Resp, p_event->Blk, p_event->Pre);
+             }
+             fprintf(p_fp, "\n");
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppTsb_FromText()
+*
+* Description : Append one container built from a task set & (optionally) its 'Output.txt' to an archive.
+*
+* Argument(s) : p_taskset_path  Path of the task set.
+*
+*               p_output_path   Path of the event log, or NULL.
+*
+*               p_tsb_path      Path of the archive; created if it does not exist.
+*
+* Return(s)   : DEF_OK,   if the container was appended.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppTsb_FromText (const  CPU_CHAR  *p_taskset_path,
+                              const  CPU_CHAR  *p_output_path,
+                              const  CPU_CHAR  *p_tsb_path)
+{
+    task_para_set   tasks[OS_MAX_TASKS];
+    APP_TSB_EVENT  *p_events;
+    APP_TSB_EVENT   event;
+    CPU_INT32U      task_nbr;
+    CPU_INT32U      event_nbr;
+    CPU_INT32U      event_max;
+    CPU_INT32U      size;
+    CPU_INT08U     *p_buf;
+    CPU_CHAR        str[APP_TSB_LINE_MAX];
+    FILE           *p_fp;
+    CPU_BOOLEAN     ok;
+
+
+    task_nbr = AppTsb_TaskSetRd(p_taskset_path, tasks, OS_MAX_TASKS);
+    if (task_nbr == 0u) {
+        return (DEF_FAIL);
+    }
+
+    p_events  = (APP_TSB_EVENT *)0;
+    event_nbr = 0u;
+    event_max = 0u;
+    if ((p_output_path != (const CPU_CHAR *)0) &&
+        (fopen_s(&p_fp, p_output_path, "r") == 0)) {
+        while (fgets(str, sizeof(str), p_fp) != NULL) {
+            if (AppTsb_EventParse(str, &event) != DEF_OK) {
+                continue;
+            }
+            if (event_nbr == event_max) {
+                event_max = (event_max == 0u) ? 256u : (event_max * 2u);
+                p_events  = (APP_TSB_EVENT *)realloc(p_events, event_max * sizeof(APP_TSB_EVENT));
+                if (p_events == (APP_TSB_EVENT *)0) {
+                    fclose(p_fp);
+                    return (DEF_FAIL);
+                }
+            }
+            p_events[event_nbr++] = event;
+        }
+        fclose(p_fp);
+    }
+
+    size  = AppTsb_Build((CPU_INT08U *)0, 0u, tasks, task_nbr, p_events, event_nbr);
+    p_buf = (CPU_INT08U *)malloc(size);
+    ok    = DEF_FAIL;
+    if ((p_buf != (CPU_INT08U *)0) &&
+        (AppTsb_Build(p_buf, size, tasks, task_nbr, p_events, event_nbr) == size) &&
+        (fopen_s(&p_fp, p_tsb_path, "ab") == 0)) {
+        ok = (fwrite(p_buf, 1u, size, p_fp) == size) ? DEF_OK : DEF_FAIL;
+        fclose(p_fp);
+    }
+    free(p_buf);
+    free(p_events);
+
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppTsb_ToText()
+*
+* Description : Write one container of an archive back to the text formats.
+*
+* Argument(s) : p_tsb_path      Path of the archive.
+*
+*               container_ix    Index of the container in the archive.
+*
+*               p_taskset_path  Path of the task set to write.
+*
+*               p_output_path   Path of the event log to write, or NULL.
+*
+* Return(s)   : DEF_OK,   if both files were written.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Like the checked-in task sets, the last task line is not newline-terminated.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppTsb_ToText (const  CPU_CHAR    *p_tsb_path,
+                                   CPU_INT32U   container_ix,
+                            const  CPU_CHAR    *p_taskset_path,
+                            const  CPU_CHAR    *p_output_path)
+{
+           APP_TSB_FILE    file;
+    const  CPU_INT08U     *p_hdr;
+    const  CPU_INT08U     *p_task;
+    const  CPU_INT08U     *p_res;
+           APP_TSB_EVENT   event;
+           CPU_INT16U      rsrc[2][2];
+           CPU_INT32U      i;
+           CPU_INT32U      k;
+           CPU_INT32U      job_ix;
+           FILE           *p_fp;
+
+
+    if (AppTsb_FileOpen(&file, p_tsb_path) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+    p_hdr = AppTsb_Next(&file, (const CPU_INT08U *)0);
+    for (i = 0u; (i < container_ix) && (p_hdr != (const CPU_INT08U *)0); i++) {
+        p_hdr = AppTsb_Next(&file, p_hdr);
+    }
+    if ((p_hdr == (const CPU_INT08U *)0) ||
+        (fopen_s(&p_fp, p_taskset_path, "w") != 0)) {
+        AppTsb_FileClose(&file);
+        return (DEF_FAIL);
+    }
+
+    for (i = 0u; i < APP_TSB_HDR_TASK_NBR(p_hdr); i++) {
+        p_task = APP_TSB_TASK_PTR(p_hdr, i);
+        Mem_Clr(rsrc, sizeof(rsrc));
+        for (k = 0u; k < APP_TSB_GET16(p_task, APP_TSB_TASK_OFF_RES_NBR); k++) {
+            p_res = APP_TSB_RES_PTR(p_hdr, APP_TSB_GET16(p_task, APP_TSB_TASK_OFF_RES_IX) + k);
+            if ((p_res[APP_TSB_RES_OFF_ID] == 1u) || (p_res[APP_TSB_RES_OFF_ID] == 2u)) {
+                rsrc[p_res[APP_TSB_RES_OFF_ID] - 1u][0] = APP_TSB_GET16(p_res, APP_TSB_RES_OFF_LOCK);
+                rsrc[p_res[APP_TSB_RES_OFF_ID] - 1u][1] = APP_TSB_GET16(p_res, APP_TSB_RES_OFF_UNLOCK);
+            }
+        }
+        fprintf(p_fp, "%s%d %d %d %d %d %d %d %d",
+                (i == 0u) ? "" : "\n",
+                APP_TSB_GET16(p_task, APP_TSB_TASK_OFF_ID),
+                APP_TSB_GET16(p_task, APP_TSB_TASK_OFF_ARRIVE),
+                APP_TSB_GET16(p_task, APP_TSB_TASK_OFF_EXEC),
+                APP_TSB_GET16(p_task, APP_TSB_TASK_OFF_PERIOD),
+                rsrc[0][0], rsrc[0][1], rsrc[1][0], rsrc[1][1]);
+    }
+    fclose(p_fp);
+
+    if (p_output_path != (const CPU_CHAR *)0) {
+        if (fopen_s(&p_fp, p_output_path, "w") != 0) {
+            AppTsb_FileClose(&file);
+            return (DEF_FAIL);
+        }
+        job_ix = 0u;                                            /* Walk the columns once instead of AppTsb_EventGet().  */
+        for (i = 0u; i < APP_TSB_HDR_EVENT_NBR(p_hdr); i++) {
+            event.Tick     = APP_TSB_GET32(AppTsb_ColGet(p_hdr, APP_TSB_COL_TICK),     i * 4u);
+            event.Kind     = AppTsb_ColGet(p_hdr, APP_TSB_COL_KIND)[i];
+            event.Res      = AppTsb_ColGet(p_hdr, APP_TSB_COL_RES)[i];
+            event.PrioFrom = AppTsb_ColGet(p_hdr, APP_TSB_COL_PRIO_FROM)[i];
+            event.PrioTo   = AppTsb_ColGet(p_hdr, APP_TSB_COL_PRIO_TO)[i];
+            event.CurId    = APP_TSB_GET16(AppTsb_ColGet(p_hdr, APP_TSB_COL_CUR_ID),   i * 2u);
+            event.CurJob   = APP_TSB_GET16(AppTsb_ColGet(p_hdr, APP_TSB_COL_CUR_JOB),  i * 2u);
+            event.NextId   = APP_TSB_GET16(AppTsb_ColGet(p_hdr, APP_TSB_COL_NEXT_ID),  i * 2u);
+            event.NextJob  = APP_TSB_GET16(AppTsb_ColGet(p_hdr, APP_TSB_COL_NEXT_JOB), i * 2u);
+            if (event.Kind == APP_TSB_EVENT_COMPLETION) {
+                event.Resp = APP_TSB_GET16(AppTsb_JobColGet(p_hdr, APP_TSB_JOB_COL_RESP), job_ix * 2u);
+                event.Blk  = APP_TSB_GET16(AppTsb_JobColGet(p_hdr, APP_TSB_JOB_COL_BLK),  job_ix * 2u);
+                event.Pre  = (CPU_INT16S)APP_TSB_GET16(AppTsb_JobColGet(p_hdr, APP_TSB_JOB_COL_PRE), job_ix * 2u);
+                job_ix++;
+            }
+            AppTsb_EventWr(p_fp, &event);
+        }
+        fclose(p_fp);
+    }
+    AppTsb_FileClose(&file);
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          AppTsb_ColOffGet()
+*
+* Description : Compute the offset of an event column.
+*
+* Argument(s) : event_off   Offset of the event block.
+*
+*               event_nbr   Number of events.
+*
+*               col         Column, APP_TSB_COL_xxx; APP_TSB_COL_NBR gives the end of the block.
+*
+* Return(s)   : Offset of the column, relative to the container header.
+*
+* Note(s)     : (1) The offset is computed on 64 bits so that AppTsb_Validate() can compare the event
+*                   counts of a corrupt header against its size without wrapping.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  AppTsb_ColOffGet (CPU_INT32U  event_off,
+                                      CPU_INT32U  event_nbr,
+                                      CPU_INT08U  col)
+{
+    CPU_INT64U  off;
+    CPU_INT08U  i;
+
+
+    off = event_off;
+    for (i = 0u; i < col; i++) {
+        off += APP_TSB_ALIGN_UP((CPU_INT64U)event_nbr * AppTsb_ColSizeTbl[i]);
+    }
+
+    return (off);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppTsb_TaskTokParse()
+*
+* Description : Parse a 'task( id)( job)' or 'task(prio)' column.
+*
+* Argument(s) : p_tok       Column text.
+*
+*               p_id        Pointer to the task ID to fill; APP_TSB_TASK_IDLE for the idle task.
+*
+*               p_job       Pointer to the job number to fill; the printed priority for the idle task.
+*
+* Return(s)   : DEF_OK,   if the column could be parsed.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppTsb_TaskTokParse (const  CPU_CHAR    *p_tok,
+                                                 CPU_INT16U  *p_id,
+                                                 CPU_INT16U  *p_job)
+{
+    unsigned  id;
+    unsigned  job;
+
+
+    switch (sscanf(p_tok, "task(%u)(%u)", &id, &job)) {
+        case 2:
+             *p_id  = (CPU_INT16U)id;
+             *p_job = (CPU_INT16U)job;
+             return (DEF_OK);
+
+        case 1:
+             *p_id  = APP_TSB_TASK_IDLE;
+             *p_job = (CPU_INT16U)id;
+             return (DEF_OK);
+
+        default:
+             return (DEF_FAIL);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppTsb_TaskTokWr()
+*
+* Description : Print a 'task(id)(job)' or 'task(prio)' column the way App_TaskSwHook() does.
+*
+* Argument(s) : p_fp        File to print to.
+*
+*               id          Task ID, or APP_TSB_TASK_IDLE.
+*
+*               job         Job number, or the priority of the idle task.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  AppTsb_TaskTokWr (FILE        *p_fp,
+                                CPU_INT16U   id,
+                                CPU_INT16U   job)
+{
+    if (id == APP_TSB_TASK_IDLE) {
+        fprintf(p_fp, "task(%2d)", job);
+    } else {
+        fprintf(p_fp, "task(%2d)(%2d)", id, job);
+    }
+}
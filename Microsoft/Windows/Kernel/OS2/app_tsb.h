@@ -0,0 +1,250 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              uC/OS-II
+*                                  BINARY TASK-SET / RESULT CONTAINER
+*
+* Filename : app_tsb.h
+*
+* Note(s)  : (1) A container holds one task set and, optionally, the event stream produced by running
+*                it.  All fields are little-endian & fixed-width so that a container can be mapped into
+*                memory & iterated in place :
+*
+*                    +----------------+  offset 0
+*                    |     Header     |  APP_TSB_HDR_SIZE octets
+*                    +----------------+  APP_TSB_HDR_OFF_TASK_OFF
+*                    |  Task records  |  APP_TSB_TASK_SIZE octets each
+*                    +----------------+  APP_TSB_HDR_OFF_RES_OFF
+*                    | Resource table |  APP_TSB_RES_SIZE  octets each
+*                    +----------------+  APP_TSB_HDR_OFF_EVENT_OFF
+*                    |  Event columns |  one array per column (see APP_TSB_COL_xxx)
+*                    +----------------+  APP_TSB_HDR_OFF_JOB_OFF
+*                    |   Job columns  |  one entry per 'Completion' event
+*                    +----------------+  APP_TSB_HDR_OFF_SIZE
+*
+*            (2) Every section & every column starts on an APP_TSB_ALIGN boundary.
+*
+*            (3) An archive is a plain concatenation of containers; 'APP_TSB_HDR_OFF_SIZE' links one
+*                container to the next.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_TSB_H
+#define  APP_TSB_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <lib_def.h>
+#include  <lib_mem.h>
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_TSB_MAGIC                          0x31425354u     /* "TSB1" read as a little-endian word.                 */
+#define  APP_TSB_VER_MAJOR                              1u      /* Incompatible layout changes bump the major version.  */
+#define  APP_TSB_VER_MINOR                              0u
+
+#define  APP_TSB_ALIGN                                  8u
+
+                                                                /* ----------------- HEADER LAYOUT ------------------ */
+#define  APP_TSB_HDR_SIZE                              64u
+#define  APP_TSB_HDR_OFF_MAGIC                          0u      /* CPU_INT32U                                           */
+#define  APP_TSB_HDR_OFF_VER_MAJOR                      4u      /* CPU_INT16U                                           */
+#define  APP_TSB_HDR_OFF_VER_MINOR                      6u      /* CPU_INT16U                                           */
+#define  APP_TSB_HDR_OFF_HDR_SIZE                       8u      /* CPU_INT32U                                           */
+#define  APP_TSB_HDR_OFF_SIZE                          12u      /* CPU_INT32U  Container size, header included.         */
+#define  APP_TSB_HDR_OFF_TASK_NBR                      16u      /* CPU_INT32U                                           */
+#define  APP_TSB_HDR_OFF_RES_NBR                       20u      /* CPU_INT32U                                           */
+#define  APP_TSB_HDR_OFF_EVENT_NBR                     24u      /* CPU_INT32U                                           */
+#define  APP_TSB_HDR_OFF_JOB_NBR                       28u      /* CPU_INT32U                                           */
+#define  APP_TSB_HDR_OFF_TASK_OFF                      32u      /* CPU_INT32U  Offsets are relative to the header.      */
+#define  APP_TSB_HDR_OFF_RES_OFF                       36u      /* CPU_INT32U                                           */
+#define  APP_TSB_HDR_OFF_EVENT_OFF                     40u      /* CPU_INT32U                                           */
+#define  APP_TSB_HDR_OFF_JOB_OFF                       44u      /* CPU_INT32U                                           */
+
+                                                                /* ------------------ TASK RECORD ------------------- */
+#define  APP_TSB_TASK_SIZE                             16u
+#define  APP_TSB_TASK_OFF_ID                            0u      /* CPU_INT16U                                           */
+#define  APP_TSB_TASK_OFF_ARRIVE                        2u      /* CPU_INT16U                                           */
+#define  APP_TSB_TASK_OFF_EXEC                          4u      /* CPU_INT16U                                           */
+#define  APP_TSB_TASK_OFF_PERIOD                        6u      /* CPU_INT16U                                           */
+#define  APP_TSB_TASK_OFF_RES_IX                        8u      /* CPU_INT16U  First entry in the resource table.       */
+#define  APP_TSB_TASK_OFF_RES_NBR                      10u      /* CPU_INT16U                                           */
+
+                                                                /* ---------------- RESOURCE RECORD ----------------- */
+#define  APP_TSB_RES_SIZE                               8u
+#define  APP_TSB_RES_OFF_ID                             0u      /* CPU_INT08U  1 == R1, 2 == R2.                        */
+#define  APP_TSB_RES_OFF_TASK_IX                        2u      /* CPU_INT16U                                           */
+#define  APP_TSB_RES_OFF_LOCK                           4u      /* CPU_INT16U  Executed ticks before lock.              */
+#define  APP_TSB_RES_OFF_UNLOCK                         6u      /* CPU_INT16U  Executed ticks before unlock.            */
+
+                                                                /* ----------------- EVENT COLUMNS ------------------ */
+#define  APP_TSB_COL_TICK                               0u      /* CPU_INT32U                                           */
+#define  APP_TSB_COL_KIND                               1u      /* CPU_INT08U  APP_TSB_EVENT_xxx                        */
+#define  APP_TSB_COL_RES                                2u      /* CPU_INT08U  Lock/unlock only.                        */
+#define  APP_TSB_COL_PRIO_FROM                          3u      /* CPU_INT08U  Lock/unlock only.                        */
+#define  APP_TSB_COL_PRIO_TO                            4u      /* CPU_INT08U  Lock/unlock only.                        */
+#define  APP_TSB_COL_CUR_ID                             5u      /* CPU_INT16U                                           */
+#define  APP_TSB_COL_CUR_JOB                            6u      /* CPU_INT16U                                           */
+#define  APP_TSB_COL_NEXT_ID                            7u      /* CPU_INT16U                                           */
+#define  APP_TSB_COL_NEXT_JOB                           8u      /* CPU_INT16U                                           */
+#define  APP_TSB_COL_NBR                                9u
+
+                                                                /* ------------------ JOB COLUMNS ------------------- */
+#define  APP_TSB_JOB_COL_RESP                           0u      /* CPU_INT16U                                           */
+#define  APP_TSB_JOB_COL_BLK                            1u      /* CPU_INT16U                                           */
+#define  APP_TSB_JOB_COL_PRE                            2u      /* CPU_INT16S                                           */
+#define  APP_TSB_JOB_COL_NBR                            3u
+
+                                                                /* ------------------ EVENT KINDS ------------------- */
+#define  APP_TSB_EVENT_PREEMPTION                       0u
+#define  APP_TSB_EVENT_COMPLETION                       1u
+#define  APP_TSB_EVENT_MISS_DEADLINE                    2u
+#define  APP_TSB_EVENT_LOCK                             3u
+#define  APP_TSB_EVENT_UNLOCK                           4u
+#define  APP_TSB_EVENT_KIND_NBR                         5u
+
+#define  APP_TSB_TASK_IDLE                         0xFFFFu      /* Task ID of the idle task; its job field holds prio.  */
+
+
+/*
+*********************************************************************************************************
+*                                        FIELD ACCESS MACRO'S
+*
+* Note(s) : (1) All accessors read through the uC-LIB little-endian macros, so a mapped container may be
+*               read in place on any host regardless of 'CPU_CFG_ENDIAN_TYPE' or alignment.
+*********************************************************************************************************
+*/
+
+#define  APP_TSB_GET16(p_base, off)            MEM_VAL_GET_INT16U_LITTLE((const CPU_INT08U *)(p_base) + (off))
+#define  APP_TSB_GET32(p_base, off)            MEM_VAL_GET_INT32U_LITTLE((const CPU_INT08U *)(p_base) + (off))
+
+#define  APP_TSB_HDR_TASK_NBR(p_hdr)           APP_TSB_GET32((p_hdr), APP_TSB_HDR_OFF_TASK_NBR)
+#define  APP_TSB_HDR_RES_NBR(p_hdr)            APP_TSB_GET32((p_hdr), APP_TSB_HDR_OFF_RES_NBR)
+#define  APP_TSB_HDR_EVENT_NBR(p_hdr)          APP_TSB_GET32((p_hdr), APP_TSB_HDR_OFF_EVENT_NBR)
+#define  APP_TSB_HDR_JOB_NBR(p_hdr)            APP_TSB_GET32((p_hdr), APP_TSB_HDR_OFF_JOB_NBR)
+#define  APP_TSB_HDR_SIZE_GET(p_hdr)           APP_TSB_GET32((p_hdr), APP_TSB_HDR_OFF_SIZE)
+
+#define  APP_TSB_TASK_PTR(p_hdr, ix)           ((const CPU_INT08U *)(p_hdr) + APP_TSB_GET32((p_hdr), APP_TSB_HDR_OFF_TASK_OFF) + ((ix) * APP_TSB_TASK_SIZE))
+#define  APP_TSB_RES_PTR(p_hdr, ix)            ((const CPU_INT08U *)(p_hdr) + APP_TSB_GET32((p_hdr), APP_TSB_HDR_OFF_RES_OFF)  + ((ix) * APP_TSB_RES_SIZE))
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_tsb_event {                                /* Unpacked event, as printed to 'Output.txt'.          */
+    CPU_INT32U   Tick;
+    CPU_INT08U   Kind;
+    CPU_INT08U   Res;
+    CPU_INT08U   PrioFrom;
+    CPU_INT08U   PrioTo;
+    CPU_INT16U   CurId;
+    CPU_INT16U   CurJob;
+    CPU_INT16U   NextId;
+    CPU_INT16U   NextJob;
+    CPU_INT16U   Resp;                                          /* Completion only.                                     */
+    CPU_INT16U   Blk;
+    CPU_INT16S   Pre;
+} APP_TSB_EVENT;
+
+
+typedef  struct  app_tsb_file {                                 /* A mapped archive of one or more containers.          */
+    void        *FileHandle;
+    void        *MapHandle;
+    CPU_INT08U  *BasePtr;
+    CPU_INT64U   Size;
+} APP_TSB_FILE;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+                                                                /* -------------- MAPPING & ITERATION --------------- */
+CPU_BOOLEAN         AppTsb_FileOpen     (      APP_TSB_FILE   *p_file,
+                                         const CPU_CHAR       *p_path);
+
+void                AppTsb_FileClose    (      APP_TSB_FILE   *p_file);
+
+const CPU_INT08U   *AppTsb_Next         (const APP_TSB_FILE   *p_file,
+                                         const CPU_INT08U     *p_hdr);
+
+CPU_BOOLEAN         AppTsb_Validate     (const CPU_INT08U     *p_hdr,
+                                               CPU_INT64U      rem);
+
+const CPU_INT08U   *AppTsb_ColGet       (const CPU_INT08U     *p_hdr,
+                                               CPU_INT08U      col);
+
+const CPU_INT08U   *AppTsb_JobColGet    (const CPU_INT08U     *p_hdr,
+                                               CPU_INT08U      col);
+
+void                AppTsb_EventGet     (const CPU_INT08U     *p_hdr,
+                                               CPU_INT32U      ix,
+                                               APP_TSB_EVENT  *p_event);
+
+                                                                /* -------------------- BUILDING -------------------- */
+CPU_INT32U          AppTsb_Build        (      CPU_INT08U     *p_buf,
+                                               CPU_INT32U      buf_size,
+                                         const task_para_set  *p_tasks,
+                                               CPU_INT32U      task_nbr,
+                                         const APP_TSB_EVENT  *p_events,
+                                               CPU_INT32U      event_nbr);
+
+                                                                /* ------------------ TEXT FORMATS ------------------ */
+CPU_INT32U          AppTsb_TaskSetRd    (const CPU_CHAR       *p_path,
+                                               task_para_set  *p_tasks,
+                                               CPU_INT32U      task_max);
+
+CPU_BOOLEAN         AppTsb_EventParse   (const CPU_CHAR       *p_line,
+                                               APP_TSB_EVENT  *p_event);
+
+void                AppTsb_EventWr      (      FILE           *p_fp,
+                                         const APP_TSB_EVENT  *p_event);
+
+CPU_BOOLEAN         AppTsb_FromText     (const CPU_CHAR       *p_taskset_path,
+                                         const CPU_CHAR       *p_output_path,
+                                         const CPU_CHAR       *p_tsb_path);
+
+CPU_BOOLEAN         AppTsb_ToText       (const CPU_CHAR       *p_tsb_path,
+                                               CPU_INT32U      container_ix,
+                                         const CPU_CHAR       *p_taskset_path,
+                                         const CPU_CHAR       *p_output_path);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -38,7 +38,15 @@
 #include  <lib_mem.h>
 #include  <os.h>
 
+#include  "app_bench.h"
 #include  "app_cfg.h"
+#include  "app_check.h"
+#include  "app_fuzz.h"
+#include  "app_golden.h"
+#include  "app_mp.h"
+#include  "app_prof.h"
+#include  "app_tsb.h"
+#include  "../app_cmp.h"
 
 
 /*
@@ -64,6 +72,7 @@ static  OS_STK  StartupTaskStk[APP_CFG_STARTUP_TASK_STK_SIZE];
 
 static  void  StartupTask (void  *p_arg);
 static  void  task(void* p_arg);
+static  int   App_CmdRun (int  argc, char  *argv[]);
 /*
 *********************************************************************************************************
 *                                                main()
@@ -71,11 +80,18 @@ static  void  task(void* p_arg);
 * Description : This is the standard entry point for C code.  It is assumed that your code will call
 *               main() once you have performed all necessary initialization.
 *
-* Arguments   : none
+* Arguments   : argc        Number of command line arguments.
+*
+*               argv        Command line arguments; see App_CmdRun() for the offline commands.
 *
 * Returns     : none
 *
-* Notes       : none
+* Notes       : (1) Without a command the task set in INPUT_FILE_NAME is scheduled as usual, & the CPU load
+*                   of every task is written to APP_PROF_LOAD_FILE_NAME when the run ends.  The row of the
+*                   run is also appended to APP_CMP_FILE_NAME, for the comparison with the OS3 project.
+*
+*               (2) The task set does not use timers : the timer task is deleted before the task set is
+*                   loaded, so that it neither takes one of the OS_MAX_TASKS TCBs nor shows in the trace.
 *********************************************************************************************************
 */
 int count1 = 0;
@@ -87,11 +103,12 @@ OS_EVENT* R1;
 OS_EVENT* R2;
 OS_MUTEX_DATA R1_status;
 OS_MUTEX_DATA R2_status;
-int  main (void)
+int  main (int  argc, char  *argv[])
 {
 #if OS_TASK_NAME_EN > 0u
     CPU_INT08U  os_err;
 #endif
+    int         cmd_ret;
 
 
 
@@ -101,7 +118,15 @@ int  main (void)
     CPU_IntDis();                                               /* Disable all Interrupts                               */
     CPU_Init();                                                 /* Initialize the uC/CPU services                       */
 
+    cmd_ret = App_CmdRun(argc, argv);                           /* Offline commands, see App_CmdRun().                  */
+    if (cmd_ret >= 0) {
+        return (cmd_ret);
+    }
+
     OSInit();
+#if (OS_TMR_EN > 0u)
+    (void)OSTaskDel(OS_TASK_TMR_PRIO);                          /* See Note #2.                                         */
+#endif
     OutFileInit();
 
 
@@ -159,6 +184,9 @@ int  main (void)
     printf("Tick\tEvent\t\tCurrentTaskID\t\tNextTask ID\tResponse Time\tBlocking Time\tPreemption Time\n");
     
 	fclose(Output_fp);
+    (void)atexit(AppProf_LoadRptExit);                          /* Per-task CPU load once the run ends.                 */
+    AppCmp_Init("uC/OS-II", INPUT_FILE_NAME, OUTPUT_FILE_NAME, &OSCtxSwCtr);
+    (void)atexit(AppCmp_RptExit);                               /* Kernel comparison row, see app_cmp.h.                */
     OSStart();
                                                /* Start multitasking (i.e. give control to uC/OS-II)   */
 
@@ -223,20 +251,25 @@ void task(void* p_arg) {
 
     INT32U next_period = 0;
 	INT16U before_Prio = 0;
+    APP_CMP_MARK mark;
     while (1) {
 		next_period = task_data->TaskPeriodic * (task_data->TaskNumber+1) + task_data->TaskArriveTime;
  /*       OSMutexQuery(R1, &R1_status);
         OSMutexQuery(R2, &R2_status);*/
         
+        AppCmp_TickSeen();
         int cur_tick = OSTime;
         while (task_data->Task_need_ExecutionTime != 0) {
 			if (cur_tick != OSTime) {
+                AppCmp_TickSeen();
 				//R1 check Unlock
                 if (task_data->R1_start != task_data->R1_end) { //避免鎖了又解鎖 && R2_status.OSValue == OS_TRUE
                     if (task_data->TaskExecutionTime - task_data->Task_need_ExecutionTime == task_data->R1_end) { //&& R2_status.OSValue == OS_FALSE
                         //OS_EXIT_CRITICAL();
                         before_Prio = task_data->Now_TaskPriority;
+                        AppCmp_OvhStart(&mark);
                         OSMutexPost(R1);
+                        AppCmp_OvhStop(APP_CMP_OVH_UNLOCK, &mark);
                         task_data->Now_TaskPriority = ((INT8U)(R2->OSEventCnt & 0x00FF) == task_data->TaskPriority) ? R2_ceiling : task_data->TaskPriority;
                         
                         if (err == OS_ERR_NONE && (Output_err = fopen_s(&Output_fp, "./Output.txt", "a")) == 0) {
@@ -253,7 +286,9 @@ void task(void* p_arg) {
                     if (task_data->TaskExecutionTime - task_data->Task_need_ExecutionTime == task_data->R2_end) { //&& R2_status.OSValue == OS_FALSE
                         //OS_EXIT_CRITICAL();
                         before_Prio = task_data->Now_TaskPriority;
+                        AppCmp_OvhStart(&mark);
                         OSMutexPost(R2);
+                        AppCmp_OvhStop(APP_CMP_OVH_UNLOCK, &mark);
                         task_data->Now_TaskPriority = ((INT8U)(R1->OSEventCnt & 0x00FF) == task_data->TaskPriority) ? R1_ceiling : task_data->TaskPriority;
                         if (err == OS_ERR_NONE && (Output_err = fopen_s(&Output_fp, "./Output.txt", "a")) == 0) {
                             printf("%d\tUnlockResource\ttask( %d)( %d)\tR2 %d to %d\n", OSTime, task_data->TaskID, task_data->TaskNumber, before_Prio, task_data->Now_TaskPriority);
@@ -268,7 +303,9 @@ void task(void* p_arg) {
                 if (task_data->R1_start != task_data->R1_end) { //避免鎖了又解鎖 && R2_status.OSValue == OS_TRUE
                     if (task_data->TaskExecutionTime - task_data->Task_need_ExecutionTime == task_data->R1_start) { //該任務做了多少tick後需要lock
 						before_Prio = task_data->Now_TaskPriority;
+                        AppCmp_OvhStart(&mark);
                         OSMutexPend(R1, 0, &err);
+                        AppCmp_OvhStop(APP_CMP_OVH_LOCK, &mark);
                         //OSMutexPend(R2, 0, &err);
                         //OS_ENTER_CRITICAL();
                         if (err == OS_ERR_NONE && (Output_err = fopen_s(&Output_fp, "./Output.txt", "a")) == 0) {
@@ -284,7 +321,9 @@ void task(void* p_arg) {
                 if (task_data->R2_start != task_data->R2_end) { //避免鎖了又解鎖 && R2_status.OSValue == OS_TRUE
                     if (task_data->TaskExecutionTime - task_data->Task_need_ExecutionTime == task_data->R2_start ) { //該任務做了多少tick後需要lock
                         before_Prio = task_data->Now_TaskPriority;
+                        AppCmp_OvhStart(&mark);
                         OSMutexPend(R2, 0, &err);
+                        AppCmp_OvhStop(APP_CMP_OVH_LOCK, &mark);
                         //OSMutexPend(R2, 0, &err);
                         //OS_ENTER_CRITICAL();
                         if (err == OS_ERR_NONE) {
@@ -315,3 +354,163 @@ void task(void* p_arg) {
         
     }
 }
+
+
+/*
+*********************************************************************************************************
+*                                            App_CmdRun()
+*
+* Description : Run an offline command given on the command line instead of the scheduler.
+*
+* Arguments   : argc        Number of command line arguments.
+*
+*               argv        Command line arguments :
+*
+*                               tsb-pack   <taskset.txt> <archive.tsb> [output.txt]
+*                                   Append a binary container built from a task set & its event log.
+*
+*                               tsb-unpack <archive.tsb> <index> <taskset.txt> [output.txt]
+*                                   Write one container of an archive back to the text formats.
+*
+*                               golden [<taskset.txt> <golden.txt>]
+*                                   Compare the schedule of every task set (or of one) with its golden file,
+*                                   then run the multicore cases (see app_golden.h).
+*
+*                               golden-update
+*                                   Rewrite the golden files from the current schedule.
+*
+*                               golden-diff <expected.txt> <actual.txt>
+*                                   Compare two event logs, e.g. a golden file & the 'Output.txt' of a run.
+*
+*                               fuzz [<cases> [<seed> [<threads>]]]
+*                                   Check random task sets against the CPP & RTA bounds, on every core.
+*
+*                               fuzz-check <taskset.txt>
+*                                   Check one task set, e.g. a reproducer written by 'fuzz'.
+*
+*                               bench [<iterations> [<bench.csv> [<label>]]]
+*                                   Time the kernel services & append the results to a CSV file.
+*
+*                               check [<seed>]
+*                                   Check kernel services against what they are expected to do (see
+*                                   app_check.h).
+*
+*                               check-mag [<threads> [<seed>]]
+*                                   Check the magazines of a uC/LIB dynamic memory pool from several threads.
+*
+*                               bench-mem [<samples> [<bench_mem.csv> [<label>]]]
+*                                   Time the uC/LIB memory functions for every SIMD level, 1 B to 1 MB.
+*
+*                               compare [<compare.csv>]
+*                                   Print the uC/OS-II & uC/OS-III rows of each task set, then compare the
+*                                   event logs of the last run of both projects.
+*
+*                               mp <taskset.txt> [<cores> [ffd | wfd | grm | gedf [mpcp | msrp [<end time> [<mig cost> [<overhead>]]]]]]
+*                                   Run a task set on several cores, partitioned or globally scheduled (see
+*                                   app_mp.h).  The overhead model is "<ctx sw>[-<ctx sw max>][:<tick>[:<lock>
+*                                   [:<unlock>]]]", in 1/1000 tick (see AppMp_OvhParse()).
+*
+*                               mp-cmp <taskset.txt> [<cores> [<mig cost> [<overhead>]]]
+*                                   Run a task set under every scheduling mode & lock protocol & compare them.
+*
+* Returns     : Process exit code of the command, or -1 if no command was given.
+*
+* Notes       : (1) 'bench' & 'check' start the kernel themselves & do not return (see AppBench_Run() &
+*                   AppCheck_Run()).
+*********************************************************************************************************
+*/
+
+static  int  App_CmdRun (int  argc, char  *argv[])
+{
+    APP_MP_OVH   ovh;
+    CPU_BOOLEAN  ok;
+
+
+    if (argc < 2) {
+        return (-1);
+    }
+
+    if ((Str_Cmp(argv[1], "tsb-pack") == 0) && (argc >= 4)) {
+        ok = AppTsb_FromText(argv[2], (argc >= 5) ? argv[4] : (CPU_CHAR *)0, argv[3]);
+
+    } else if ((Str_Cmp(argv[1], "tsb-unpack") == 0) && (argc >= 5)) {
+        ok = AppTsb_ToText(argv[2], (CPU_INT32U)atoi(argv[3]), argv[4], (argc >= 6) ? argv[5] : (CPU_CHAR *)0);
+
+    } else if ((Str_Cmp(argv[1], "golden") == 0) && (argc >= 4)) {
+        ok = AppGolden_Case(argv[2], argv[3], DEF_NO);
+
+    } else if (Str_Cmp(argv[1], "golden") == 0) {
+        ok = (AppGolden_RunAll(DEF_NO) == 0u) ? DEF_OK : DEF_FAIL;
+
+    } else if (Str_Cmp(argv[1], "golden-update") == 0) {
+        ok = (AppGolden_RunAll(DEF_YES) == 0u) ? DEF_OK : DEF_FAIL;
+
+    } else if ((Str_Cmp(argv[1], "golden-diff") == 0) && (argc >= 4)) {
+        ok = AppGolden_DiffFiles(argv[2], argv[3]);
+
+    } else if (Str_Cmp(argv[1], "fuzz") == 0) {
+        ok = (AppFuzz_Run((argc >= 3) ? (CPU_INT32U)strtoul(argv[2], (char **)0, 0) : APP_FUZZ_CASE_NBR_DFLT,
+                          (argc >= 4) ? (CPU_INT32U)strtoul(argv[3], (char **)0, 0) : 1u,
+                          (argc >= 5) ? (CPU_INT32U)strtoul(argv[4], (char **)0, 0) : 0u) == 0u) ? DEF_OK : DEF_FAIL;
+
+    } else if ((Str_Cmp(argv[1], "fuzz-check") == 0) && (argc >= 3)) {
+        ok = AppFuzz_CheckFile(argv[2]);
+
+    } else if (Str_Cmp(argv[1], "bench") == 0) {                /* See Note #1.                                         */
+        AppBench_Run((argc >= 3) ? (CPU_INT32U)strtoul(argv[2], (char **)0, 0) : APP_BENCH_ITER_DFLT,
+                     (argc >= 4) ? argv[3] : APP_BENCH_OUTPUT_FILE_NAME,
+                     (argc >= 5) ? argv[4] : APP_BENCH_LABEL_DFLT);
+        ok = DEF_FAIL;
+
+    } else if (Str_Cmp(argv[1], "check") == 0) {                /* See Note #1.                                         */
+        AppCheck_Run((argc >= 3) ? (CPU_INT32U)strtoul(argv[2], (char **)0, 0) : APP_CHECK_SEED_DFLT);
+        ok = DEF_FAIL;
+
+    } else if (Str_Cmp(argv[1], "check-mag") == 0) {
+        ok = AppCheck_MagRun((argc >= 3) ? (CPU_INT32U)strtoul(argv[2], (char **)0, 0) : APP_CHECK_MAG_THREAD_NBR_DFLT,
+                             (argc >= 4) ? (CPU_INT32U)strtoul(argv[3], (char **)0, 0) : APP_CHECK_SEED_DFLT);
+
+    } else if (Str_Cmp(argv[1], "bench-mem") == 0) {
+        ok = AppBench_MemRun((argc >= 3) ? (CPU_INT32U)strtoul(argv[2], (char **)0, 0) : APP_BENCH_ITER_DFLT,
+                             (argc >= 4) ? argv[3] : APP_BENCH_MEM_OUTPUT_FILE_NAME,
+                             (argc >= 5) ? argv[4] : APP_BENCH_LABEL_DFLT);
+
+    } else if (Str_Cmp(argv[1], "compare") == 0) {
+        ok = AppCmp_RptPrint((argc >= 3) ? argv[2] : APP_CMP_FILE_NAME);
+        if (ok == DEF_OK) {
+            ok = AppGolden_DiffFiles(APP_CMP_OS2_LOG_FILE_NAME, APP_CMP_OS3_LOG_FILE_NAME);
+        }
+
+    } else if ((Str_Cmp(argv[1], "mp") == 0) && (argc >= 3) &&
+               (AppMp_OvhParse((argc >= 9) ? argv[8] : "0", &ovh) == DEF_OK)) {
+        ok = AppMp_RunFile(argv[2],
+                           (argc >= 4) ? (CPU_INT08U)strtoul(argv[3], (char **)0, 0) : APP_MP_CORE_NBR_DFLT,
+                           (argc >= 5) ? AppMp_SchedParse(argv[4]) : APP_MP_SCHED_FFD,
+                           ((argc >= 6) && (Str_Cmp(argv[5], "msrp") == 0)) ? APP_MP_PROTO_MSRP : APP_MP_PROTO_MPCP,
+                           (argc >= 7) ? (CPU_INT32U)strtoul(argv[6], (char **)0, 0) : 0u,
+                           (argc >= 8) ? (CPU_INT32U)strtoul(argv[7], (char **)0, 0) : 0u,
+                           &ovh);
+
+    } else if ((Str_Cmp(argv[1], "mp-cmp") == 0) && (argc >= 3) &&
+               (AppMp_OvhParse((argc >= 6) ? argv[5] : "0", &ovh) == DEF_OK)) {
+        ok = AppMp_Cmp(argv[2],
+                       (argc >= 4) ? (CPU_INT08U)strtoul(argv[3], (char **)0, 0) : APP_MP_CORE_NBR_DFLT,
+                       (argc >= 5) ? (CPU_INT32U)strtoul(argv[4], (char **)0, 0) : 0u,
+                       &ovh);
+
+    } else {
+        printf("usage: %s [tsb-pack <taskset.txt> <archive.tsb> [output.txt]]\n", argv[0]);
+        printf("       %s [tsb-unpack <archive.tsb> <index> <taskset.txt> [output.txt]]\n", argv[0]);
+        printf("       %s [golden [<taskset.txt> <golden.txt>] | golden-update | golden-diff <expected.txt> <actual.txt>]\n", argv[0]);
+        printf("       %s [fuzz [<cases> [<seed> [<threads>]]] | fuzz-check <taskset.txt>]\n", argv[0]);
+        printf("       %s [bench [<iterations> [<bench.csv> [<label>]]]]\n", argv[0]);
+        printf("       %s [check [<seed>] | check-mag [<threads> [<seed>]]]\n", argv[0]);
+        printf("       %s [bench-mem [<samples> [<bench_mem.csv> [<label>]]]]\n", argv[0]);
+        printf("       %s [compare [<compare.csv>]]\n", argv[0]);
+        printf("       %s [mp <taskset.txt> [<cores> [ffd | wfd | grm | gedf [mpcp | msrp [<end time> [<mig cost> [<overhead>]]]]]]]\n", argv[0]);
+        printf("       %s [mp-cmp <taskset.txt> [<cores> [<mig cost> [<overhead>]]]]\n", argv[0]);
+        return (2);
+    }
+
+    return ((ok == DEF_OK) ? 0 : 1);
+}
@@ -35,13 +35,14 @@
 
 #define OS_EVENT_MULTI_EN         1u   /* Include code for OSEventPendMulti()                          */
 #define OS_EVENT_NAME_EN          1u   /* Enable names for Sem, Mutex, Mbox and Q                      */
+#define OS_EVENT_SET_EN           1u   /* Include code for event sets (OSEventSetPend())               */
 
 #define OS_LOWEST_PRIO           63u   /* Defines the lowest priority that can be assigned ...         */
                                        /* ... MUST NEVER be higher than 254!                           */
 
 #define OS_MAX_EVENTS            10u   /* Max. number of event control blocks in your application      */
 #define OS_MAX_FLAGS              5u   /* Max. number of Event Flag Groups    in your application      */
-#define OS_MAX_MEM_PART           5u   /* Max. number of memory partitions                             */
+#define OS_MAX_MEM_PART          16u   /* Max. number of memory partitions                             */
 #define OS_MAX_QS                 4u   /* Max. number of queue control blocks in your application      */
 #define OS_MAX_TASKS             20u   /* Max. number of tasks in your application, MUST be >= 2       */
 
@@ -70,6 +71,9 @@
 #define OS_TASK_REG_TBL_SIZE      1u   /*     Size of task variables array (#of INT32U entries)        */
 #define OS_TASK_STAT_EN           0u   /*     Enable (1) or Disable(0) the statistics task             */
 #define OS_TASK_STAT_STK_CHK_EN   1u   /*     Check task stacks from statistic task                    */
+#define OS_TASK_STK_CLR_PAGE_SIZE 256u /*     Stack entries cleared at a time, 0 to clear whole stack  */
+#define OS_TASK_STK_CHK_INCR_EN   1u   /*     Probe stacks from the last high-water mark only          */
+#define OS_TASK_STK_CHK_INCR_GAP  8u   /*     Zero entries in a row that end a probe                   */
 #define OS_TASK_SUSPEND_EN        1u   /*     Include code for OSTaskSuspend() and OSTaskResume()      */
 #define OS_TASK_SW_HOOK_EN        1u   /*     Include code for OSTaskSwHook()                          */
 
@@ -81,6 +85,7 @@
 #define OS_FLAG_NAME_EN           1u   /*     Enable names for event flag group                        */
 #define OS_FLAG_QUERY_EN          1u   /*     Include code for OSFlagQuery()                           */
 #define OS_FLAG_WAIT_CLR_EN       1u   /* Include code for Wait on Clear EVENT FLAGS                   */
+#define OS_FLAG_WAIT_IX_EN        1u   /* Index waiters by flag bit to speed up OSFlagPost()           */
 #define OS_FLAGS_NBITS           16u   /* Size in #bits of OS_FLAGS data type (8, 16 or 32)            */
 
 
@@ -98,6 +103,10 @@
 #define OS_MEM_EN                 1u   /* Enable (1) or Disable (0) code generation for MEMORY MANAGER */
 #define OS_MEM_NAME_EN            1u   /*     Enable memory partition names                            */
 #define OS_MEM_QUERY_EN           1u   /*     Include code for OSMemQuery()                            */
+#define OS_MEM_SLAB_EN            1u   /*     Include code for the size-class allocator, OSMemSlab*()  */
+#define OS_MEM_SLAB_SHIFT_MIN     5u   /*     Smallest class is 2^5 bytes                              */
+#define OS_MEM_SLAB_SHIFT_MAX    12u   /*     Largest  class is 2^12 bytes                             */
+#define OS_MEM_SLAB_SUB_BITS      2u   /*     2^n classes per power of two (0: x2, 2: x1.25 ...)       */
 
 
                                        /* ---------------- MUTUAL EXCLUSION SEMAPHORES --------------- */
@@ -113,10 +122,13 @@
 #define OS_Q_DEL_EN               1u   /*     Include code for OSQDel()                                */
 #define OS_Q_FLUSH_EN             1u   /*     Include code for OSQFlush()                              */
 #define OS_Q_PEND_ABORT_EN        1u   /*     Include code for OSQPendAbort()                          */
+#define OS_Q_PEND_N_EN            1u   /*     Include code for OSQPendN()                              */
 #define OS_Q_POST_EN              1u   /*     Include code for OSQPost()                               */
+#define OS_Q_POST_N_EN            1u   /*     Include code for OSQPostN()                              */
 #define OS_Q_POST_FRONT_EN        1u   /*     Include code for OSQPostFront()                          */
 #define OS_Q_POST_OPT_EN          1u   /*     Include code for OSQPostOpt()                            */
 #define OS_Q_QUERY_EN             1u   /*     Include code for OSQQuery()                              */
+#define OS_Q_BUF_EN               1u   /*     Include code for zero-copy messages, OSQBuf*()            */
 
 
                                        /* ------------------------ SEMAPHORES ------------------------ */
@@ -124,6 +136,7 @@
 #define OS_SEM_ACCEPT_EN          1u   /*    Include code for OSSemAccept()                            */
 #define OS_SEM_DEL_EN             1u   /*    Include code for OSSemDel()                               */
 #define OS_SEM_PEND_ABORT_EN      1u   /*    Include code for OSSemPendAbort()                         */
+#define OS_SEM_POST_N_EN          1u   /*    Include code for OSSemPostN()                             */
 #define OS_SEM_QUERY_EN           1u   /*    Include code for OSSemQuery()                             */
 #define OS_SEM_SET_EN             1u   /*    Include code for OSSemSet()                               */
 
@@ -136,10 +149,12 @@
 
 
                                        /* --------------------- TIMER MANAGEMENT --------------------- */
-#define OS_TMR_EN                 0u   /* Enable (1) or Disable (0) code generation for TIMERS         */
+#define OS_TMR_EN                 1u   /* Enable (1) or Disable (0) code generation for TIMERS         */
 #define OS_TMR_CFG_MAX           16u   /*     Maximum number of timers                                 */
 #define OS_TMR_CFG_NAME_EN        1u   /*     Determine timer names                                    */
 #define OS_TMR_CFG_WHEEL_SIZE     7u   /*     Size of timer wheel (#Spokes)                            */
+#define OS_TMR_CFG_WHEEL_HIER_EN  1u   /*     Use a hierarchical timer wheel instead (O(1) start/stop) */
+#define OS_TMR_CFG_WHEEL_BITS     6u   /*     Hierarchical wheel: 2^n spokes per level                 */
 #define OS_TMR_CFG_TICKS_PER_SEC 10u   /*     Rate at which timer management task runs (Hz)            */
 
 
@@ -0,0 +1,1118 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                             uC/OS-III
+*                                        KERNEL SERVICE CHECKS
+*
+* Filename : app_check.c
+*
+* Note(s)  : (1) The application hooks of the task set are not set & no task set is loaded : the kernel
+*                only runs its own tasks & the check task, which is above every task but the tick task.
+*
+*            (2) The tick task is above the check task, so that each OSTimeTick() of the check task updates
+*                the tick lists before it returns.  The ticks of the port may update them as well; the
+*                model therefore follows OSTickCtr rather than counting the ticks it gives.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+#include  <stdlib.h>
+
+#include  <cpu.h>
+#include  <lib_mem.h>
+#include  <os.h>
+
+#include  "app_check.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CHECK_PRIO_MAIN      (OS_CFG_TICK_TASK_PRIO + 1u)  /* Check task, below the tick task (see Note #2).       */
+
+#define  APP_CHECK_RES_PASS                             0u
+#define  APP_CHECK_RES_FAIL                             1u
+#define  APP_CHECK_RES_SKIP                             2u      /* Services of the case disabled in 'os_cfg.h'.         */
+
+#define  APP_CHECK_TICK_CTR_INIT              0xFFFFF000u       /* OSTickCtr at OSStart(), 4096 ticks from the wrap.    */
+
+                                                                /* -------------------- OSTickList ------------------- */
+#define  APP_CHECK_TICK_LIST_DLY                        0u      /* Tick lists, by index.                                */
+#define  APP_CHECK_TICK_LIST_TIMEOUT                    1u
+#define  APP_CHECK_TICK_LIST_NBR                        2u
+#define  APP_CHECK_TICK_LIST_NONE                    0xFFu
+#define  APP_CHECK_TICK_LIST_DLY_BITS_MAX              12u      /* Delays up to 2^12 ticks.                             */
+#define  APP_CHECK_TICK_LIST_OP_MAX                     4u      /* Inserts & removes between two ticks, at most.        */
+
+                                                                /* -------------------- OSMsgQuota ------------------- */
+#if ((OS_CFG_MSG_POOL_SHARD_EN == DEF_ENABLED) && (OS_CFG_Q_EN      == DEF_ENABLED) &&                             \
+     (OS_CFG_Q_DEL_EN          == DEF_ENABLED) && (OS_CFG_TASK_Q_EN == DEF_ENABLED))
+#define  APP_CHECK_MSG_QUOTA_EN                  DEF_ENABLED
+#else
+#define  APP_CHECK_MSG_QUOTA_EN                  DEF_DISABLED
+#endif
+#define  APP_CHECK_MSG_QUOTA_Q_A                        0u      /* Queues, by index : two OS_Qs with a quota,           */
+#define  APP_CHECK_MSG_QUOTA_Q_B                        1u
+#define  APP_CHECK_MSG_QUOTA_Q_TASK                     2u      /* ... the queue of the check task, with a quota,       */
+#define  APP_CHECK_MSG_QUOTA_Q_DRAIN                    3u      /* ... & an OS_Q without quota.                         */
+#define  APP_CHECK_MSG_QUOTA_Q_NBR                      4u
+                                                                /* Size of the OS_Q without quota, above the pool.      */
+#define  APP_CHECK_MSG_QUOTA_DRAIN_SIZE  (OS_CFG_MSG_POOL_SIZE + APP_CHECK_MSG_QUOTA_EXT_NBR)
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT08U  (*APP_CHECK_FNCT)(void);
+
+typedef  struct  app_check_case {
+    const  CPU_CHAR        *NamePtr;
+           APP_CHECK_FNCT   Fnct;
+} APP_CHECK_CASE;
+
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+typedef  struct  app_check_tick {                               /* Control block in the tick lists & its model.         */
+    OS_TCB        TCB;                                          /* Never created, see AppCheck_TickList().              */
+    CPU_INT08U    List;                                         /* List expected, APP_CHECK_TICK_LIST_...               */
+    OS_TICK       Match;                                        /* Value of OSTickCtr at which it expires.              */
+} APP_CHECK_TICK;
+#endif
+
+
+#if (APP_CHECK_MSG_QUOTA_EN == DEF_ENABLED)
+typedef  struct  app_check_msg_q {                              /* Queue of the quota case & its model.                 */
+    OS_MSG_Q     *MsgQPtr;                                      /* Messages & cache of the queue.                       */
+    OS_MSG_QTY    Size;
+    OS_MSG_QTY    Quota;                                        /* Quota expected.                                      */
+    CPU_INT32U    TagTbl[APP_CHECK_MSG_QUOTA_DRAIN_SIZE];       /* Messages expected, oldest at '.TagOut'.              */
+    CPU_INT32U    TagOut;
+    CPU_INT32U    TagNbr;
+} APP_CHECK_MSG_Q;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void         AppCheck_Task         (void         *p_arg);
+
+static  CPU_INT08U   AppCheck_TickList     (void);
+
+static  CPU_INT08U   AppCheck_MsgQuota     (void);
+
+static  CPU_BOOLEAN  AppCheck_Eq           (const  CPU_CHAR  *p_what,
+                                                   CPU_INT32U   val,
+                                                   CPU_INT32U   val_exp);
+
+static  void         AppCheck_Fail         (const  CPU_CHAR  *p_what,
+                                                   CPU_INT32U   val,
+                                                   CPU_INT32U   val_exp);
+
+static  CPU_INT32U   AppCheck_Rand         (void);
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+static  void         AppCheck_TickInsert   (CPU_INT32U    ix);
+
+static  CPU_BOOLEAN  AppCheck_TickRemove   (CPU_INT32U    ix);
+
+static  CPU_BOOLEAN  AppCheck_TickCmp      (void);
+
+static  OS_TICK      AppCheck_TickRemainGet(OS_TCB       *p_tcb);
+#endif
+
+#if (APP_CHECK_MSG_QUOTA_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MsgQuotaPost (CPU_INT32U    ix);
+
+static  CPU_BOOLEAN  AppCheck_MsgQuotaGet  (CPU_INT32U    ix);
+
+static  CPU_BOOLEAN  AppCheck_MsgQuotaSet  (CPU_INT32U    ix,
+                                            OS_MSG_QTY    quota);
+
+static  CPU_BOOLEAN  AppCheck_MsgQuotaCmp  (void);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  APP_CHECK_CASE  AppCheck_CaseTbl[] = {
+    { "OSTickList",   AppCheck_TickList },
+    { "OSMsgQuota",   AppCheck_MsgQuota }
+};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB                 AppCheck_TCB;
+static  CPU_STK                AppCheck_Stk[APP_CHECK_STK_SIZE];
+
+static  CPU_INT32U             AppCheck_Seed;
+static  CPU_INT32U             AppCheck_RandState;
+static  CPU_INT32U             AppCheck_ChkNbr;                 /* Comparisons made by the current case.                */
+static  const  CPU_CHAR       *AppCheck_FailWhatPtr;            /* First failure of the current case.                   */
+static  CPU_INT32U             AppCheck_FailVal;
+static  CPU_INT32U             AppCheck_FailValExp;
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+static  APP_CHECK_TICK         AppCheck_TickTbl[APP_CHECK_TICK_LIST_TCB_NBR];
+                                                                /* Reference linear lists, sorted by expiration.        */
+static  CPU_INT08U             AppCheck_TickOrdTbl[APP_CHECK_TICK_LIST_NBR][APP_CHECK_TICK_LIST_TCB_NBR];
+static  CPU_INT32U             AppCheck_TickOrdNbr[APP_CHECK_TICK_LIST_NBR];
+static  OS_TICK                AppCheck_TickBase;               /* OSTickCtr at the last comparison.                    */
+#endif
+
+#if (APP_CHECK_MSG_QUOTA_EN == DEF_ENABLED)
+                                                                /* OS_Qs, APP_CHECK_MSG_QUOTA_Q_TASK not used.          */
+static  OS_Q                   AppCheck_MsgQuotaQTbl[APP_CHECK_MSG_QUOTA_Q_NBR];
+static  APP_CHECK_MSG_Q        AppCheck_MsgQuotaTbl[APP_CHECK_MSG_QUOTA_Q_NBR];
+static  OS_MSG                 AppCheck_MsgQuotaExtTbl[APP_CHECK_MSG_QUOTA_EXT_NBR];
+static  OS_MSG_QTY             AppCheck_MsgQuotaPoolNbr;        /* OS_MSGs of the pool, free or held by the queues.     */
+static  CPU_INT32U             AppCheck_MsgQuotaTag;            /* Last message posted.                                 */
+static  CPU_INT32U             AppCheck_MsgQuotaResNbr;         /* Posts below a quota while the pool was empty.        */
+static  CPU_INT32U             AppCheck_MsgQuotaRefuseNbr;      /* Quotas refused.                                      */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_Run()
+*
+* Description : Start the kernel with the check task instead of the task set.
+*
+* Argument(s) : seed        Seed of the random choices of the cases, 0 for APP_CHECK_SEED_DFLT.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Replaces the kernel startup sequence of main() & does not return : the process exits
+*                   with 0 if every case passed or was skipped, or with 1 otherwise.
+*
+*               (2) No task is in a tick list yet, so OSTickCtr may be moved.
+*********************************************************************************************************
+*/
+
+void  AppCheck_Run (CPU_INT32U  seed)
+{
+    OS_ERR  os_err;
+
+
+    AppCheck_Seed = (seed != 0u) ? seed : APP_CHECK_SEED_DFLT;
+
+    OSInit(&os_err);                                            /* CPU & uC/LIB are initialized by main().              */
+    if (os_err != OS_ERR_NONE) {
+        printf("OSInit() failed, error %u\n", (unsigned)os_err);
+        exit(1);
+    }
+
+    OSTickCtr = APP_CHECK_TICK_CTR_INIT;                        /* See Note #2.                                         */
+
+    OSTaskCreate(&AppCheck_TCB,
+                 "Check",
+                  AppCheck_Task,
+                  0,
+                  APP_CHECK_PRIO_MAIN,
+                 &AppCheck_Stk[0u],
+                  APP_CHECK_STK_SIZE / 10u,
+                  APP_CHECK_STK_SIZE,
+                  APP_CHECK_MSG_QUOTA_Q_SIZE,                   /* Queue of the OSMsgQuota case.                        */
+                  0u,
+                  0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 &os_err);
+
+    OSStart(&os_err);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_Task()
+*
+* Description : Check task : runs every case & prints one line per case.
+*
+* Argument(s) : p_arg       Argument passed to 'OSTaskCreate()', not used.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Each case draws its random choices from its own seed, so that a case gives the same
+*                   result whatever cases run before it.
+*********************************************************************************************************
+*/
+
+static  void  AppCheck_Task (void  *p_arg)
+{
+    CPU_INT32U  case_nbr;
+    CPU_INT32U  fail_nbr;
+    CPU_INT32U  i;
+    CPU_INT08U  res;
+
+
+    (void)p_arg;
+
+    printf("seed %u\n", (unsigned)AppCheck_Seed);
+
+    case_nbr = 0u;
+    fail_nbr = 0u;
+    for (i = 0u; i < (sizeof(AppCheck_CaseTbl) / sizeof(AppCheck_CaseTbl[0])); i++) {
+        AppCheck_RandState   = (i + 1u) * 0x9E3779B9u;          /* See Note #1.                                         */
+        AppCheck_RandState  ^= AppCheck_Seed;
+        if (AppCheck_RandState == 0u) {
+            AppCheck_RandState = 1u;
+        }
+        AppCheck_ChkNbr      = 0u;
+        AppCheck_FailWhatPtr = (const CPU_CHAR *)0;
+
+        res = AppCheck_CaseTbl[i].Fnct();
+        switch (res) {
+            case APP_CHECK_RES_PASS:
+                 printf("PASS\t%s\t%u check(s)\n", AppCheck_CaseTbl[i].NamePtr, (unsigned)AppCheck_ChkNbr);
+                 break;
+
+            case APP_CHECK_RES_SKIP:
+                 printf("SKIP\t%s\tdisabled in os_cfg.h\n", AppCheck_CaseTbl[i].NamePtr);
+                 break;
+
+            case APP_CHECK_RES_FAIL:
+            default:
+                 printf("FAIL\t%s\tafter %u check(s)\n", AppCheck_CaseTbl[i].NamePtr, (unsigned)AppCheck_ChkNbr);
+                 if (AppCheck_FailWhatPtr != (const CPU_CHAR *)0) {
+                     printf("\t%s : expected %u, got %u\n",
+                            AppCheck_FailWhatPtr,
+                            (unsigned)AppCheck_FailValExp,
+                            (unsigned)AppCheck_FailVal);
+                 }
+                 fail_nbr++;
+                 break;
+        }
+        if (res != APP_CHECK_RES_SKIP) {
+            case_nbr++;
+        }
+    }
+
+    printf("%u case(s), %u failed\n", (unsigned)case_nbr, (unsigned)fail_nbr);
+    exit((fail_nbr == 0u) ? 0 : 1);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_TickList()
+*
+* Description : Check the tick lists against a reference linear list (see 'app_check.h  Note #1').
+*
+* Argument(s) : none.
+*
+* Return(s)   : APP_CHECK_RES_PASS, APP_CHECK_RES_FAIL or APP_CHECK_RES_SKIP.
+*
+* Note(s)     : (1) The control blocks are never given to OSTaskCreate() : they are in the tick lists only,
+*                   in a suspended state, so that the tick task never makes them ready.  An expired block
+*                   is only marked suspended (see 'os_tick.c  OS_TickListUpdateDly()' &
+*                   'OS_TickListUpdateTimeout()'), & has no pend list to be removed from.
+*
+*               (2) Between two ticks, the check task inserts in a random list the blocks that are in no
+*                   list & removes from their list those that are, at most APP_CHECK_TICK_LIST_OP_MAX of
+*                   them.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  AppCheck_TickList (void)
+{
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+    CPU_INT32U   tick;
+    CPU_INT32U   op_nbr;
+    CPU_INT32U   ix;
+    CPU_INT32U   i;
+    CPU_BOOLEAN  ok;
+
+
+    Mem_Clr(&AppCheck_TickTbl[0], sizeof(AppCheck_TickTbl));    /* See Note #1.                                         */
+    for (i = 0u; i < APP_CHECK_TICK_LIST_TCB_NBR; i++) {
+        AppCheck_TickTbl[i].List = APP_CHECK_TICK_LIST_NONE;
+    }
+    AppCheck_TickOrdNbr[APP_CHECK_TICK_LIST_DLY]     = 0u;
+    AppCheck_TickOrdNbr[APP_CHECK_TICK_LIST_TIMEOUT] = 0u;
+    AppCheck_TickBase                                = OSTickCtr;
+
+    ok = DEF_OK;
+    for (tick = 0u; (tick < APP_CHECK_TICK_LIST_TICK_NBR) && (ok == DEF_OK); tick++) {
+        op_nbr = AppCheck_Rand() % (APP_CHECK_TICK_LIST_OP_MAX + 1u);
+        for (i = 0u; (i < op_nbr) && (ok == DEF_OK); i++) {     /* See Note #2.                                         */
+            ix = AppCheck_Rand() % APP_CHECK_TICK_LIST_TCB_NBR;
+            if (AppCheck_TickTbl[ix].List == APP_CHECK_TICK_LIST_NONE) {
+                AppCheck_TickInsert(ix);
+            } else {
+                ok = AppCheck_TickRemove(ix);
+            }
+        }
+        if (ok == DEF_OK) {
+            ok = AppCheck_TickCmp();
+        }
+        if (ok == DEF_OK) {
+            OSTimeTick();                                       /* See 'app_check.c  Note #2'.                          */
+            ok = AppCheck_TickCmp();
+        }
+    }
+
+    for (ix = 0u; ix < APP_CHECK_TICK_LIST_TCB_NBR; ix++) {     /* Leave no block in the tick lists.                    */
+        if (AppCheck_TickTbl[ix].List != APP_CHECK_TICK_LIST_NONE) {
+            (void)AppCheck_TickRemove(ix);
+        }
+    }
+
+    return ((ok == DEF_OK) ? APP_CHECK_RES_PASS : APP_CHECK_RES_FAIL);
+#else
+    return (APP_CHECK_RES_SKIP);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppCheck_TickInsert()
+*
+* Description : Insert a control block of the tick list case in a random tick list, & in the reference list.
+*
+* Argument(s) : ix          Index of the block, in no list.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The reference list is sorted by the ticks from AppCheck_TickBase to the expiration, so
+*                   that blocks which expired at a tick of the port since the last comparison keep their
+*                   place.  A block goes after those that expire at the same tick, as in a delta list.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+static  void  AppCheck_TickInsert (CPU_INT32U  ix)
+{
+    APP_CHECK_TICK  *p_tick;
+    OS_TICK          dly;
+    CPU_INT32U       bits;
+    CPU_INT08U       list;
+    CPU_INT08U      *p_ord;
+    CPU_INT32U       nbr;
+    CPU_INT32U       j;
+    CPU_SR_ALLOC();
+
+
+    p_tick = &AppCheck_TickTbl[ix];
+    list   = (CPU_INT08U)(AppCheck_Rand() % APP_CHECK_TICK_LIST_NBR);
+    bits   = AppCheck_Rand() % (APP_CHECK_TICK_LIST_DLY_BITS_MAX + 1u);
+    dly    = 1u + (AppCheck_Rand() & ((1u << bits) - 1u));
+
+    CPU_CRITICAL_ENTER();
+    if (list == APP_CHECK_TICK_LIST_DLY) {
+        p_tick->TCB.TaskState = OS_TASK_STATE_DLY_SUSPENDED;
+        OS_TickListInsert(&OSTickListDly, &p_tick->TCB, dly);
+    } else {
+        p_tick->TCB.TaskState = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED;
+        OS_TickListInsert(&OSTickListTimeout, &p_tick->TCB, dly);
+    }
+    p_tick->List  = list;
+    p_tick->Match = OSTickCtr + dly;
+    CPU_CRITICAL_EXIT();
+
+    p_ord = &AppCheck_TickOrdTbl[list][0];                      /* See Note #1.                                         */
+    nbr   =  AppCheck_TickOrdNbr[list];
+    j     =  nbr;
+    while ((j > 0u) &&
+           ((OS_TICK)(AppCheck_TickTbl[p_ord[j - 1u]].Match - AppCheck_TickBase) >
+            (OS_TICK)(p_tick->Match                          - AppCheck_TickBase))) {
+        p_ord[j] = p_ord[j - 1u];
+        j--;
+    }
+    p_ord[j]                  = (CPU_INT08U)ix;
+    AppCheck_TickOrdNbr[list] = nbr + 1u;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        AppCheck_TickRemove()
+*
+* Description : Remove a control block of the tick list case from its tick list, & from the reference list.
+*
+* Argument(s) : ix          Index of the block, in a list.
+*
+* Return(s)   : DEF_OK,   if the block was removed as expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) A block which expired at a tick of the port since the last comparison is in no tick list
+*                   any more, & is left to AppCheck_TickCmp().
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_TickRemove (CPU_INT32U  ix)
+{
+    APP_CHECK_TICK  *p_tick;
+    CPU_INT08U      *p_ord;
+    CPU_INT32U       nbr;
+    CPU_INT32U       j;
+    CPU_SR_ALLOC();
+
+
+    p_tick = &AppCheck_TickTbl[ix];
+
+    CPU_CRITICAL_ENTER();
+    if (p_tick->TCB.TickListPtr == (OS_TICK_LIST *)0) {         /* See Note #1.                                         */
+        CPU_CRITICAL_EXIT();
+        return (DEF_OK);
+    }
+    OS_TickListRemove(&p_tick->TCB);
+    p_tick->TCB.TaskState = OS_TASK_STATE_SUSPENDED;
+    CPU_CRITICAL_EXIT();
+
+    p_ord = &AppCheck_TickOrdTbl[p_tick->List][0];
+    nbr   =  AppCheck_TickOrdNbr[p_tick->List];
+    for (j = 0u; p_ord[j] != (CPU_INT08U)ix; j++) {
+        ;
+    }
+    for (; j < (nbr - 1u); j++) {
+        p_ord[j] = p_ord[j + 1u];
+    }
+    AppCheck_TickOrdNbr[p_tick->List] = nbr - 1u;
+    p_tick->List                      = APP_CHECK_TICK_LIST_NONE;
+
+    return (AppCheck_Eq("OS_TickListRemove(), '.TickListPtr' NULL",
+                        (CPU_INT32U)(p_tick->TCB.TickListPtr == (OS_TICK_LIST *)0),
+                        DEF_YES));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_TickCmp()
+*
+* Description : Compare the tick lists with the reference lists at the current value of OSTickCtr.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if the tick lists match the reference lists.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Blocks at the head of a reference list whose expiration was reached must have been
+*                   removed from their tick list & marked suspended by the tick task.  Every other block must
+*                   still be in its tick list, with the ticks remaining to its expiration.
+*
+*               (2) Tasks of the kernel may be in the tick lists as well, so the first task to expire in a
+*                   tick list may expire before the head of the reference list, but never after it.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_TickCmp (void)
+{
+    OS_TICK_LIST    *p_list;
+    APP_CHECK_TICK  *p_tick;
+    CPU_INT08U      *p_ord;
+    OS_TICK          ctr;
+    OS_TICK          remain;
+    CPU_INT32U       nbr;
+    CPU_INT32U       list;
+    CPU_INT32U       j;
+    CPU_INT32U       k;
+    CPU_BOOLEAN      ok;
+    CPU_SR_ALLOC();
+
+
+    ok = DEF_OK;
+    CPU_CRITICAL_ENTER();
+    ctr = OSTickCtr;
+    for (list = 0u; (list < APP_CHECK_TICK_LIST_NBR) && (ok == DEF_OK); list++) {
+        p_list = (list == APP_CHECK_TICK_LIST_DLY) ? &OSTickListDly : &OSTickListTimeout;
+        p_ord  = &AppCheck_TickOrdTbl[list][0];
+        nbr    =  AppCheck_TickOrdNbr[list];
+        j      =  0u;
+        while ((ok == DEF_OK) && (j < nbr)) {                   /* See Note #1.                                         */
+            p_tick = &AppCheck_TickTbl[p_ord[j]];
+            if ((OS_TICK)(p_tick->Match - AppCheck_TickBase) > (OS_TICK)(ctr - AppCheck_TickBase)) {
+                break;
+            }
+            ok = AppCheck_Eq("Expired, '.TickListPtr' NULL",
+                             (CPU_INT32U)(p_tick->TCB.TickListPtr == (OS_TICK_LIST *)0),
+                             DEF_YES);
+            if (ok == DEF_OK) {
+                ok = AppCheck_Eq("Expired, '.TaskState'", p_tick->TCB.TaskState, OS_TASK_STATE_SUSPENDED);
+            }
+            p_tick->List = APP_CHECK_TICK_LIST_NONE;
+            j++;
+        }
+        for (k = j; (k < nbr) && (ok == DEF_OK); k++) {
+            p_tick = &AppCheck_TickTbl[p_ord[k]];
+            ok     =  AppCheck_Eq("Not expired, in its tick list",
+                                  (CPU_INT32U)(p_tick->TCB.TickListPtr == p_list),
+                                  DEF_YES);
+            if (ok == DEF_OK) {
+                ok = AppCheck_Eq("Not expired, ticks remaining",
+                                 AppCheck_TickRemainGet(&p_tick->TCB),
+                                 p_tick->Match - ctr);
+            }
+            p_ord[k - j] = p_ord[k];
+        }
+        nbr                      -= j;
+        AppCheck_TickOrdNbr[list] = nbr;
+
+        if ((ok == DEF_OK) && (nbr > 0u)) {                     /* See Note #2.                                         */
+            ok = AppCheck_Eq("Tick list not empty", (CPU_INT32U)(p_list->TCB_Ptr != (OS_TCB *)0), DEF_YES);
+            if (ok == DEF_OK) {
+                remain = AppCheck_TickRemainGet(p_list->TCB_Ptr);
+                ok     = AppCheck_Eq("First to expire, not after the reference",
+                                     (CPU_INT32U)(remain <= (AppCheck_TickTbl[p_ord[0]].Match - ctr)),
+                                     DEF_YES);
+            }
+        }
+    }
+    AppCheck_TickBase = ctr;
+    CPU_CRITICAL_EXIT();
+
+    return (ok);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      AppCheck_TickRemainGet()
+*
+* Description : Ticks remaining until a task of a tick list expires.
+*
+* Argument(s) : p_tcb       Pointer to the TCB, in a tick list.
+*
+* Return(s)   : Ticks from OSTickCtr to the expiration of the task.
+*
+* Note(s)     : (1) With heaps, '.TickRemain' is the delay given at insertion (see 'os_tick.c
+*                   OS_TickListInsert()  Note #2'); with delta lists, it is the delta from the previous task.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+static  OS_TICK  AppCheck_TickRemainGet (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_TICK_LIST_HEAP_EN == DEF_ENABLED)
+    return (p_tcb->TickMatch - OSTickCtr);
+#else
+    OS_TCB   *p_tcb_list;
+    OS_TICK   remain;
+
+
+    remain     = 0u;
+    p_tcb_list = p_tcb->TickListPtr->TCB_Ptr;
+    while (p_tcb_list != p_tcb) {
+        remain     += p_tcb_list->TickRemain;
+        p_tcb_list  = p_tcb_list->TickNextPtr;
+    }
+
+    return (remain + p_tcb->TickRemain);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         AppCheck_MsgQuota()
+*
+* Description : Check the quotas of the message queues (see 'app_check.h  Note #1').
+*
+* Argument(s) : none.
+*
+* Return(s)   : APP_CHECK_RES_PASS, APP_CHECK_RES_FAIL or APP_CHECK_RES_SKIP.
+*
+* Note(s)     : (1) No other task posts messages : every OS_MSG of the pool is either free or held by a
+*                   queue of the case, as an entry or in its cache.
+*
+*               (2) The queue without quota is posted to more often than it is accepted from, so that it
+*                   keeps the pool empty for most of the case, & its size is above the pool, so that it
+*                   runs out of OS_MSGs before it is full.
+*
+*               (3) The pool is extended half way, once per process : the OS_MSGs given to
+*                   OSMsgPoolExtend() stay in the pool.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  AppCheck_MsgQuota (void)
+{
+#if (APP_CHECK_MSG_QUOTA_EN == DEF_ENABLED)
+    APP_CHECK_MSG_Q  *p_q;
+    OS_MSG_QTY        quota;
+    OS_ERR            os_err;
+    CPU_INT32U        op;
+    CPU_INT32U        ix;
+    CPU_BOOLEAN       ok;
+
+
+    AppCheck_MsgQuotaPoolNbr   = OSCfg_MsgPoolSize;             /* See Note #1.                                         */
+    AppCheck_MsgQuotaTag       = 0u;
+    AppCheck_MsgQuotaResNbr    = 0u;
+    AppCheck_MsgQuotaRefuseNbr = 0u;
+
+    ok = DEF_OK;
+    for (ix = 0u; ix < APP_CHECK_MSG_QUOTA_Q_NBR; ix++) {
+        p_q         = &AppCheck_MsgQuotaTbl[ix];
+        p_q->Quota  =  0u;
+        p_q->TagOut =  0u;
+        p_q->TagNbr =  0u;
+        if (ix == APP_CHECK_MSG_QUOTA_Q_TASK) {
+            p_q->MsgQPtr = &AppCheck_TCB.MsgQ;                  /* Created by AppCheck_Run().                           */
+            p_q->Size    =  APP_CHECK_MSG_QUOTA_Q_SIZE;
+        } else {
+            p_q->MsgQPtr = &AppCheck_MsgQuotaQTbl[ix].MsgQ;
+            p_q->Size    = (ix == APP_CHECK_MSG_QUOTA_Q_DRAIN) ? APP_CHECK_MSG_QUOTA_DRAIN_SIZE
+                                                               : APP_CHECK_MSG_QUOTA_Q_SIZE;
+            OSQCreate(&AppCheck_MsgQuotaQTbl[ix], "Check quota", p_q->Size, &os_err);
+            if (ok == DEF_OK) {
+                ok = AppCheck_Eq("OSQCreate(), error", os_err, OS_ERR_NONE);
+            }
+        }
+    }
+    if (ok == DEF_OK) {
+        ok = AppCheck_MsgQuotaCmp();
+    }
+                                                                /* --------------------- ERRORS ---------------------- */
+    if (ok == DEF_OK) {
+        OSQQuotaSet(&AppCheck_MsgQuotaQTbl[APP_CHECK_MSG_QUOTA_Q_A], APP_CHECK_MSG_QUOTA_Q_SIZE + 1u, &os_err);
+        ok = AppCheck_Eq("OSQQuotaSet() above the size, error", os_err, OS_ERR_Q_SIZE);
+    }
+    if (ok == DEF_OK) {
+        OSMsgPoolExtend(&AppCheck_MsgQuotaExtTbl[0], 0u, &os_err);
+        ok = AppCheck_Eq("OSMsgPoolExtend() of no OS_MSG, error", os_err, OS_ERR_MSG_POOL_EMPTY);
+    }
+    if (ok == DEF_OK) {
+        ok = AppCheck_MsgQuotaCmp();
+    }
+                                                                /* ------------------- RANDOM STEPS ------------------ */
+    for (ix = 0u; (ix <= APP_CHECK_MSG_QUOTA_Q_TASK) && (ok == DEF_OK); ix++) {
+        ok = AppCheck_MsgQuotaSet(ix, APP_CHECK_MSG_QUOTA_Q_SIZE / 2u);
+    }
+    for (op = 0u; (op < APP_CHECK_MSG_QUOTA_OP_NBR) && (ok == DEF_OK); op++) {
+        if (op == (APP_CHECK_MSG_QUOTA_OP_NBR / 2u)) {          /* See Note #3.                                         */
+            OSMsgPoolExtend(&AppCheck_MsgQuotaExtTbl[0], APP_CHECK_MSG_QUOTA_EXT_NBR, &os_err);
+            ok = AppCheck_Eq("OSMsgPoolExtend(), error", os_err, OS_ERR_NONE);
+            AppCheck_MsgQuotaPoolNbr += APP_CHECK_MSG_QUOTA_EXT_NBR;
+        }
+        if (ok == DEF_OK) {
+            if ((AppCheck_Rand() % 16u) == 0u) {                /* Change the quota of a queue, ...                     */
+                ix    =              AppCheck_Rand() % (APP_CHECK_MSG_QUOTA_Q_TASK + 1u);
+                quota = (OS_MSG_QTY)(AppCheck_Rand() % (APP_CHECK_MSG_QUOTA_Q_SIZE + 1u));
+                ok    =  AppCheck_MsgQuotaSet(ix, quota);
+            } else {                                            /* ... or post to or accept from one (see Note #2).     */
+                ix = AppCheck_Rand() % APP_CHECK_MSG_QUOTA_Q_NBR;
+                if ((AppCheck_Rand() % 8u) < ((ix == APP_CHECK_MSG_QUOTA_Q_DRAIN) ? 5u : 4u)) {
+                    ok = AppCheck_MsgQuotaPost(ix);
+                } else {
+                    ok = AppCheck_MsgQuotaGet(ix);
+                }
+            }
+        }
+        if (ok == DEF_OK) {
+            ok = AppCheck_MsgQuotaCmp();
+        }
+    }
+                                                                /* ---------------------- END ------------------------ */
+    for (ix = 0u; (ix < APP_CHECK_MSG_QUOTA_Q_NBR) && (ok == DEF_OK); ix++) {
+        while ((AppCheck_MsgQuotaTbl[ix].TagNbr > 0u) && (ok == DEF_OK)) {
+            ok = AppCheck_MsgQuotaGet(ix);
+        }
+    }
+    for (ix = 0u; (ix <= APP_CHECK_MSG_QUOTA_Q_TASK) && (ok == DEF_OK); ix++) {
+        ok = AppCheck_MsgQuotaSet(ix, 0u);
+    }
+    if (ok == DEF_OK) {                                         /* Every OS_MSG back in the pool.                       */
+        ok = AppCheck_Eq("Pool, OS_MSGs free at the end", OSMsgPool.NbrFree, AppCheck_MsgQuotaPoolNbr);
+    }
+    if (ok == DEF_OK) {
+        ok = AppCheck_Eq("Posts below a quota, with the pool empty",
+                         (CPU_INT32U)(AppCheck_MsgQuotaResNbr > 0u),
+                         DEF_YES);
+    }
+    if (ok == DEF_OK) {
+        ok = AppCheck_Eq("Quotas refused", (CPU_INT32U)(AppCheck_MsgQuotaRefuseNbr > 0u), DEF_YES);
+    }
+
+    for (ix = 0u; ix < APP_CHECK_MSG_QUOTA_Q_NBR; ix++) {       /* Leave no OS_MSG held.                                */
+        if (ix != APP_CHECK_MSG_QUOTA_Q_TASK) {
+            (void)OSQDel(&AppCheck_MsgQuotaQTbl[ix], OS_OPT_DEL_ALWAYS, &os_err);
+        }
+    }
+    OSTaskQQuotaSet((OS_TCB *)0, 0u, &os_err);
+
+    return ((ok == DEF_OK) ? APP_CHECK_RES_PASS : APP_CHECK_RES_FAIL);
+#else
+    return (APP_CHECK_RES_SKIP);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MsgQuotaPost()
+*
+* Description : Post a message to a queue of the quota case, & to its model.
+*
+* Argument(s) : ix          Index of the queue.
+*
+* Return(s)   : DEF_OK,   if the post did what was expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) A queue below its quota must find an OS_MSG whatever the pool holds.  Otherwise, the
+*                   post must fail only when neither the cache of the queue nor the pool has an OS_MSG.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_MSG_QUOTA_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MsgQuotaPost (CPU_INT32U  ix)
+{
+    APP_CHECK_MSG_Q  *p_q;
+    CPU_INT32U        tag;
+    CPU_BOOLEAN       pool_empty;
+    CPU_BOOLEAN       avail;
+    OS_ERR            os_err;
+    CPU_BOOLEAN       ok;
+
+
+    p_q        = &AppCheck_MsgQuotaTbl[ix];
+    pool_empty = (OSMsgPool.NbrFree == 0u) ? DEF_YES : DEF_NO;
+    avail      = ((p_q->MsgQPtr->NbrFree > 0u) || (pool_empty == DEF_NO)) ? DEF_YES : DEF_NO;
+
+    AppCheck_MsgQuotaTag++;
+    tag = AppCheck_MsgQuotaTag;
+    if (ix == APP_CHECK_MSG_QUOTA_Q_TASK) {
+        OSTaskQPost(&AppCheck_TCB, (void *)(CPU_ADDR)tag, (OS_MSG_SIZE)tag, OS_OPT_POST_FIFO, &os_err);
+    } else {
+        OSQPost(&AppCheck_MsgQuotaQTbl[ix], (void *)(CPU_ADDR)tag, (OS_MSG_SIZE)tag, OS_OPT_POST_FIFO, &os_err);
+    }
+
+    if (p_q->TagNbr >= p_q->Size) {
+        ok = AppCheck_Eq("Full queue, post error", os_err, OS_ERR_Q_MAX);
+    } else if (p_q->TagNbr < p_q->Quota) {                      /* See Note #1.                                         */
+        ok = AppCheck_Eq("Below its quota, post error", os_err, OS_ERR_NONE);
+        if (pool_empty == DEF_YES) {
+            AppCheck_MsgQuotaResNbr++;
+        }
+    } else {
+        ok = AppCheck_Eq("Post error", os_err, (avail == DEF_YES) ? OS_ERR_NONE : OS_ERR_MSG_POOL_EMPTY);
+    }
+
+    if ((ok == DEF_OK) && (os_err == OS_ERR_NONE)) {
+        p_q->TagTbl[(p_q->TagOut + p_q->TagNbr) % p_q->Size] = tag;
+        p_q->TagNbr++;
+    }
+
+    return (ok);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MsgQuotaGet()
+*
+* Description : Accept a message from a queue of the quota case, & from its model.
+*
+* Argument(s) : ix          Index of the queue.
+*
+* Return(s)   : DEF_OK,   if the oldest message of the model was received, or none from an empty queue.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_MSG_QUOTA_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MsgQuotaGet (CPU_INT32U  ix)
+{
+    APP_CHECK_MSG_Q  *p_q;
+    void             *p_msg;
+    OS_MSG_SIZE       msg_size;
+    CPU_INT32U        tag;
+    OS_ERR            os_err;
+    CPU_BOOLEAN       ok;
+
+
+    p_q = &AppCheck_MsgQuotaTbl[ix];
+    if (ix == APP_CHECK_MSG_QUOTA_Q_TASK) {
+        p_msg = OSTaskQPend(0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &os_err);
+    } else {
+        p_msg = OSQPend(&AppCheck_MsgQuotaQTbl[ix], 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &os_err);
+    }
+
+    if (p_q->TagNbr == 0u) {
+        return (AppCheck_Eq("Empty queue, accept error", os_err, OS_ERR_PEND_WOULD_BLOCK));
+    }
+
+    tag         =  p_q->TagTbl[p_q->TagOut];
+    p_q->TagOut = (p_q->TagOut + 1u) % p_q->Size;
+    p_q->TagNbr--;
+
+    ok = AppCheck_Eq("Accept error", os_err, OS_ERR_NONE);
+    if (ok == DEF_OK) {
+        ok = AppCheck_Eq("Message accepted", (CPU_INT32U)(CPU_ADDR)p_msg, tag);
+    }
+    if (ok == DEF_OK) {
+        ok = AppCheck_Eq("Size of the message accepted", msg_size, (OS_MSG_SIZE)tag);
+    }
+
+    return (ok);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MsgQuotaSet()
+*
+* Description : Set the quota of a queue of the quota case, & of its model.
+*
+* Argument(s) : ix          Index of the queue, with a quota.
+*
+*               quota       Quota to set, up to the size of the queue.
+*
+* Return(s)   : DEF_OK,   if the quota was set or refused as expected.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The quota must be refused when the pool does not have the OS_MSGs missing to reach it
+*                   (see 'os_msg.c  OS_MsgQQuotaSet()  Note #2').  Once set, the queue holds exactly its
+*                   quota, or its entries if they are above it.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_MSG_QUOTA_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MsgQuotaSet (CPU_INT32U  ix,
+                                           OS_MSG_QTY  quota)
+{
+    APP_CHECK_MSG_Q  *p_q;
+    OS_MSG_Q         *p_msg_q;
+    OS_MSG_QTY        cache;
+    OS_MSG_QTY        held;
+    OS_MSG_QTY        pool_free;
+    OS_ERR            os_err;
+    CPU_BOOLEAN       ok;
+
+
+    p_q       = &AppCheck_MsgQuotaTbl[ix];
+    p_msg_q   =  p_q->MsgQPtr;
+    cache     =  p_msg_q->NbrFree;
+    held      = (OS_MSG_QTY)p_q->TagNbr + cache;
+    pool_free =  OSMsgPool.NbrFree;
+    if (ix == APP_CHECK_MSG_QUOTA_Q_TASK) {
+        OSTaskQQuotaSet((OS_TCB *)0, quota, &os_err);           /* Queue of the calling task.                           */
+    } else {
+        OSQQuotaSet(&AppCheck_MsgQuotaQTbl[ix], quota, &os_err);
+    }
+
+    if ((quota > held) && ((OS_MSG_QTY)(quota - held) > pool_free)) {
+        AppCheck_MsgQuotaRefuseNbr++;                           /* See Note #1.                                         */
+        ok = AppCheck_Eq("Quota refused, error", os_err, OS_ERR_MSG_POOL_EMPTY);
+        if (ok == DEF_OK) {
+            ok = AppCheck_Eq("Quota refused, quota", p_msg_q->NbrQuota, p_q->Quota);
+        }
+        if (ok == DEF_OK) {
+            ok = AppCheck_Eq("Quota refused, OS_MSGs cached", p_msg_q->NbrFree, cache);
+        }
+        if (ok == DEF_OK) {
+            ok = AppCheck_Eq("Quota refused, OS_MSGs free in the pool", OSMsgPool.NbrFree, pool_free);
+        }
+    } else {
+        p_q->Quota = quota;
+        ok = AppCheck_Eq("Quota set, error", os_err, OS_ERR_NONE);
+        if (ok == DEF_OK) {
+            ok = AppCheck_Eq("Quota set, OS_MSGs held",
+                             p_msg_q->NbrEntries + p_msg_q->NbrFree,
+                             DEF_MAX(quota, p_q->TagNbr));
+        }
+    }
+
+    return (ok);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       AppCheck_MsgQuotaCmp()
+*
+* Description : Compare the queues of the quota case & the pool with their model.
+*
+* Argument(s) : none.
+*
+* Return(s)   : DEF_OK,   if the queues & the pool match the model.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) The OS_MSGs held by a queue, its entries & its cache, never go below its quota.
+*********************************************************************************************************
+*/
+
+#if (APP_CHECK_MSG_QUOTA_EN == DEF_ENABLED)
+static  CPU_BOOLEAN  AppCheck_MsgQuotaCmp (void)
+{
+    APP_CHECK_MSG_Q  *p_q;
+    OS_MSG_Q         *p_msg_q;
+    CPU_INT32U        used;
+    CPU_INT32U        ix;
+    CPU_BOOLEAN       ok;
+
+
+    ok   = DEF_OK;
+    used = 0u;
+    for (ix = 0u; (ix < APP_CHECK_MSG_QUOTA_Q_NBR) && (ok == DEF_OK); ix++) {
+        p_q     = &AppCheck_MsgQuotaTbl[ix];
+        p_msg_q =  p_q->MsgQPtr;
+        ok      =  AppCheck_Eq("Entries", p_msg_q->NbrEntries, p_q->TagNbr);
+        if (ok == DEF_OK) {
+            ok = AppCheck_Eq("Quota", p_msg_q->NbrQuota, p_q->Quota);
+        }
+        if (ok == DEF_OK) {                                     /* See Note #1.                                         */
+            ok = AppCheck_Eq("OS_MSGs held, not below the quota",
+                             (CPU_INT32U)((p_msg_q->NbrEntries + p_msg_q->NbrFree) >= p_msg_q->NbrQuota),
+                             DEF_YES);
+        }
+        used += p_msg_q->NbrEntries + p_msg_q->NbrFree;
+    }
+    if (ok == DEF_OK) {                                         /* See 'AppCheck_MsgQuota()  Note #1'.                  */
+        ok = AppCheck_Eq("Pool, OS_MSGs used", OSMsgPool.NbrUsed, used);
+    }
+    if (ok == DEF_OK) {
+        ok = AppCheck_Eq("Pool, OS_MSGs free", OSMsgPool.NbrFree, AppCheck_MsgQuotaPoolNbr - used);
+    }
+
+    return (ok);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           AppCheck_Eq()
+*
+* Description : Count one comparison of the current case & record it if it is the first one to fail.
+*
+* Argument(s) : p_what      What was compared.
+*
+*               val         Value observed.
+*
+*               val_exp     Value expected.
+*
+* Return(s)   : DEF_OK,   if 'val' is equal to 'val_exp'.
+*
+*               DEF_FAIL, otherwise.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppCheck_Eq (const  CPU_CHAR    *p_what,
+                                         CPU_INT32U   val,
+                                         CPU_INT32U   val_exp)
+{
+    AppCheck_ChkNbr++;
+    if (val == val_exp) {
+        return (DEF_OK);
+    }
+    AppCheck_Fail(p_what, val, val_exp);
+
+    return (DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_Fail()
+*
+* Description : Record a failure of the current case, unless one is recorded already.
+*
+* Argument(s) : p_what      What was compared.
+*
+*               val         Value observed.
+*
+*               val_exp     Value expected.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+static  void  AppCheck_Fail (const  CPU_CHAR    *p_what,
+                                    CPU_INT32U   val,
+                                    CPU_INT32U   val_exp)
+{
+    if (AppCheck_FailWhatPtr == (const CPU_CHAR *)0) {
+        AppCheck_FailWhatPtr = p_what;
+        AppCheck_FailVal     = val;
+        AppCheck_FailValExp  = val_exp;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCheck_Rand()
+*
+* Description : Next random number of the current case.
+*
+* Argument(s) : none.
+*
+* Return(s)   : A 32-bit random number.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  AppCheck_Rand (void)
+{
+    CPU_INT32U  x;
+
+
+    x                  = AppCheck_RandState;                    /* xorshift32.                                          */
+    x                 ^= x << 13u;
+    x                 ^= x >> 17u;
+    x                 ^= x <<  5u;
+    AppCheck_RandState = x;
+
+    return (x);
+}
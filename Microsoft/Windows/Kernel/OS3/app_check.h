@@ -0,0 +1,99 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                             uC/OS-III
+*                                        KERNEL SERVICE CHECKS
+*
+* Filename : app_check.h
+*
+* Note(s)  : (1) As in the OS2 project (see '../OS2/app_check.h'), the kernel is started with a check task
+*                instead of the task set, & each case below calls kernel services from the check task &
+*                compares what they do with what is expected :
+*
+*                    OSTickList    Task control blocks that never run, inserted in & removed from the
+*                                  delay & timeout tick lists at random with OS_TickListInsert() &
+*                                  OS_TickListRemove(), while the check task ticks the kernel with
+*                                  OSTimeTick().  The tick lists (pairing heaps with
+*                                  OS_CFG_TICK_LIST_HEAP_EN) must expire each of them at the tick that
+*                                  a reference linear list sorted by expiration gives, never earlier or
+*                                  later, & agree with it on the ticks remaining & the first to expire.
+*                                  OSTickCtr starts close to its wrap-around.
+*
+*                    OSMsgQuota    Two message queues & the queue of the check task with quotas
+*                                  (OS_CFG_MSG_POOL_SHARD_EN), & a queue without quota that drains the
+*                                  pool of OS_MSGs, posted to & accepted from at random while the quotas
+*                                  change.  A post to a queue below its quota must never fail, even with
+*                                  the pool empty; the messages accepted, the OS_MSGs held by each queue
+*                                  & the pool must match a reference model.  A quota the pool cannot
+*                                  cover must be refused without change, & OSMsgPoolExtend() adds
+*                                  OS_MSGs half way.
+*
+*                A case is skipped when the services it checks are disabled in 'os_cfg.h'.
+*
+*            (2) Random choices come from a seed given on the command line, so that a failing run can be
+*                repeated.  A failure prints what was observed & what was expected.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CHECK_H
+#define  APP_CHECK_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CHECK_SEED_DFLT                            1u      /* Seed when none is given.                             */
+#define  APP_CHECK_STK_SIZE                           512u      /* Stack of a task, in CPU_STK.                         */
+
+                                                                /* -------------------- OSTickList ------------------- */
+#define  APP_CHECK_TICK_LIST_TCB_NBR                   64u      /* Control blocks inserted in the tick lists.           */
+#define  APP_CHECK_TICK_LIST_TICK_NBR               20000u      /* Ticks of the case.                                   */
+
+                                                                /* -------------------- OSMsgQuota ------------------- */
+#define  APP_CHECK_MSG_QUOTA_OP_NBR                 20000u      /* Random steps.                                        */
+#define  APP_CHECK_MSG_QUOTA_Q_SIZE                     8u      /* Entries of a queue with a quota.                     */
+#define  APP_CHECK_MSG_QUOTA_EXT_NBR                   16u      /* OS_MSGs given to OSMsgPoolExtend().                  */
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  AppCheck_Run (CPU_INT32U  seed);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
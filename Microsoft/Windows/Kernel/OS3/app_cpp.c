@@ -0,0 +1,879 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                             uC/OS-III
+*                                  CPP/RM TASK SET EXPERIMENT
+*
+* Filename : app_cpp.c
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdarg.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+
+#include  "app_cpp.h"
+#include  "../app_cmp.h"
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static            APP_CPP_TASK   AppCpp_TaskTbl[APP_CPP_TASK_MAX];
+static            CPU_INT32U     AppCpp_TaskNbr;
+
+static            OS_MUTEX       AppCpp_ResTbl[APP_CPP_RES_NBR];
+static            OS_PRIO        AppCpp_ResCeilTbl[APP_CPP_RES_NBR];   /* Logical ceiling of each resource.         */
+
+static  volatile  OS_TICK        AppCpp_Time;                   /* Ticks since OSStart(), i.e. 'OSTime' of the OS2 log. */
+static            APP_CPP_TASK  *AppCpp_CurPtr;                 /* Task set job running, NULL for the idle task.        */
+
+static            FILE          *AppCpp_OutFilePtr;
+
+static  volatile  CPU_BOOLEAN    AppCpp_End;                    /* Run over, see AppCpp_EndChk().                       */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_Task      (void          *p_arg);
+
+static  void  AppCpp_JobWait   (APP_CPP_TASK  *p_task);
+
+static  void  AppCpp_ResChk    (APP_CPP_TASK  *p_task);
+
+static  void  AppCpp_ResLock   (APP_CPP_TASK  *p_task,
+                                CPU_INT08U     res);
+
+static  void  AppCpp_ResUnlock (APP_CPP_TASK  *p_task,
+                                CPU_INT08U     res);
+
+static  void  AppCpp_Dispatch  (APP_CPP_TASK  *p_task);
+
+static  void  AppCpp_LogSw     (APP_CPP_TASK  *p_out,
+                                APP_CPP_TASK  *p_in);
+
+static  void  AppCpp_MissChk   (void);
+
+static  void  AppCpp_EndChk    (void);
+
+static  void  AppCpp_Log       (const  CPU_CHAR  *p_fmt, ...);
+
+
+/*
+*********************************************************************************************************
+*                                            AppCpp_Init()
+*
+* Description : Load a task set & assign the priorities.
+*
+* Argument(s) : p_path      Path of the task set, one task per line :
+*
+*                               id arrive exec period r1_start r1_end r2_start r2_end
+*
+* Return(s)   : DEF_OK,   if the task set was loaded.
+*
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) As in the OS2 project, the tasks are sorted by period (a stable sort keeps the file
+*                   order for equal periods), the task of index 'i' gets the priority
+*                   (i + 1) * APP_CPP_PRIO_STEP, & the ceiling of a resource is the priority of its
+*                   first user minus 1 (R1) or 2 (R2).
+*
+*               (2) The event log is truncated.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppCpp_Init (const  CPU_CHAR  *p_path)
+{
+    FILE          *p_fp;
+    APP_CPP_TASK  *p_task;
+    APP_CPP_TASK   tmp;
+    CPU_CHAR       line[APP_CPP_LINE_MAX];
+    unsigned int   val[8];
+    CPU_INT32U     i;
+    CPU_INT32U     j;
+    CPU_INT08U     res;
+
+
+    p_fp = fopen(p_path, "r");
+    if (p_fp == (FILE *)0) {
+        printf("The file '%s' was not opened\n", p_path);
+        return (DEF_FAIL);
+    }
+
+    AppCpp_TaskNbr = 0u;
+    while ((fgets(line, sizeof(line), p_fp) != (char *)0) &&
+           (AppCpp_TaskNbr < APP_CPP_TASK_MAX)) {
+        if (sscanf(line, "%u %u %u %u %u %u %u %u",
+                   &val[0], &val[1], &val[2], &val[3], &val[4], &val[5], &val[6], &val[7]) != 8) {
+            continue;
+        }
+        p_task = &AppCpp_TaskTbl[AppCpp_TaskNbr];
+        p_task->Id                        = val[0];
+        p_task->Arrive                    = val[1];
+        p_task->Exec                      = val[2];
+        p_task->Period                    = val[3];
+        p_task->ResStart[APP_CPP_RES_R1]  = val[4];
+        p_task->ResEnd[APP_CPP_RES_R1]    = val[5];
+        p_task->ResStart[APP_CPP_RES_R2]  = val[6];
+        p_task->ResEnd[APP_CPP_RES_R2]    = val[7];
+        AppCpp_TaskNbr++;
+    }
+    fclose(p_fp);
+
+    for (i = 1u; i < AppCpp_TaskNbr; i++) {                     /* See Note #1.                                         */
+        tmp = AppCpp_TaskTbl[i];
+        j   = i;
+        while ((j > 0u) && (AppCpp_TaskTbl[j - 1u].Period > tmp.Period)) {
+            AppCpp_TaskTbl[j] = AppCpp_TaskTbl[j - 1u];
+            j--;
+        }
+        AppCpp_TaskTbl[j] = tmp;
+    }
+
+    for (res = 0u; res < APP_CPP_RES_NBR; res++) {
+        AppCpp_ResCeilTbl[res] = 0u;
+    }
+    for (i = 0u; i < AppCpp_TaskNbr; i++) {
+        p_task           = &AppCpp_TaskTbl[i];
+        p_task->Prio     = (OS_PRIO)((i + 1u) * APP_CPP_PRIO_STEP);
+        p_task->PrioCur  = p_task->Prio;
+        p_task->Job      = 0u;
+        p_task->Run      = DEF_NO;
+        p_task->Remain   = 0u;
+        p_task->Blocking = 0u;
+        for (res = 0u; res < APP_CPP_RES_NBR; res++) {
+            p_task->ResHeld[res] = DEF_NO;
+            if ((AppCpp_ResCeilTbl[res] ==                  0u) &&
+                (p_task->ResStart[res]  != p_task->ResEnd[res])) {
+                AppCpp_ResCeilTbl[res] = (OS_PRIO)(p_task->Prio - (res + 1u));
+            }
+        }
+    }
+
+    AppCpp_Time   = 0u;
+    AppCpp_End    = DEF_NO;
+    AppCpp_CurPtr = (APP_CPP_TASK *)0;
+
+    AppCpp_OutFilePtr = fopen(APP_CPP_OUTPUT_FILE_NAME, "w");   /* See Note #2.                                         */
+    if (AppCpp_OutFilePtr == (FILE *)0) {
+        printf("The file '%s' was not opened\n", APP_CPP_OUTPUT_FILE_NAME);
+        return (DEF_FAIL);
+    }
+
+    return ((AppCpp_TaskNbr > 0u) ? DEF_OK : DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppCpp_TaskCreate()
+*
+* Description : Create the resources & the tasks of the task set loaded by AppCpp_Init().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Must be called after OSInit() & before OSStart().
+*********************************************************************************************************
+*/
+
+void  AppCpp_TaskCreate (void)
+{
+    APP_CPP_TASK  *p_task;
+    CPU_INT32U     i;
+    OS_ERR         os_err;
+
+
+    OSMutexCreate(&AppCpp_ResTbl[APP_CPP_RES_R1], "R1", &os_err);
+    OSMutexCreate(&AppCpp_ResTbl[APP_CPP_RES_R2], "R2", &os_err);
+
+    for (i = 0u; i < AppCpp_TaskNbr; i++) {
+        p_task = &AppCpp_TaskTbl[i];
+        OSTaskCreate(&p_task->TCB,
+                     "CPP Task",
+                      AppCpp_Task,
+                      p_task,
+                      APP_CPP_PRIO_OFFSET + p_task->Prio,
+                     &p_task->Stk[0u],
+                      APP_CPP_TASK_STK_SIZE / 10u,
+                      APP_CPP_TASK_STK_SIZE,
+                      0u,
+                      0u,
+                      p_task,                                   /* The switch hook finds the task from '.ExtPtr'.       */
+                     (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                     &os_err);
+    }
+
+    printf("Tick\tEvent\t\tCurrentTaskID\t\tNextTask ID\tResponse Time\tBlocking Time\tPreemption Time\n");
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppCpp_TaskSwHook()
+*
+* Description : Log the switches between the jobs of the task set; called from App_OS_TaskSwHook().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Interrupts are disabled during this call.
+*
+*               (2) A task of the task set that is switched in before its next release only returns to
+*                   its delay (e.g. after a preemption right after its last job completed).  Like the
+*                   kernel tasks, it is transparent.
+*
+*               (3) Nothing is logged or counted once the run is over, until a task exits the process.
+*********************************************************************************************************
+*/
+
+void  AppCpp_TaskSwHook (void)
+{
+    APP_CPP_TASK  *p_in;
+
+
+    if (AppCpp_End == DEF_YES) {                                /* See Note #3.                                         */
+        return;
+    }
+    AppCmp_TaskSw();
+    if (AppCpp_TaskNbr == 0u) {
+        return;
+    }
+
+    if (OSTCBHighRdyPtr == &OSIdleTaskTCB) {
+        AppCpp_Dispatch((APP_CPP_TASK *)0);
+        return;
+    }
+
+    p_in = (APP_CPP_TASK *)OSTCBHighRdyPtr->ExtPtr;
+    if (p_in == (APP_CPP_TASK *)0) {                            /* Kernel task.                                         */
+        return;
+    }
+    if ((p_in->Run == DEF_NO) &&                                /* See Note #2.                                         */
+        (AppCpp_Time < (p_in->Arrive + (p_in->Job * p_in->Period)))) {
+        return;
+    }
+    AppCpp_Dispatch(p_in);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppCpp_TimeTickHook()
+*
+* Description : Account one tick to the running job; called from App_OS_TimeTickHook().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The run ends after APP_CPP_END_TIME ticks, as with the OS2 project.  The hook only
+*                   flags the end; the process exits from a task (see AppCpp_EndChk()).
+*
+*               (2) The deadlines are checked unless the running job has just completed, in which case
+*                   they are checked once its completion is logged.
+*********************************************************************************************************
+*/
+
+void  AppCpp_TimeTickHook (void)
+{
+    APP_CPP_TASK  *p_task;
+    CPU_SR_ALLOC();
+
+
+    if (AppCpp_End == DEF_YES) {
+        return;
+    }
+    AppCmp_TickMark();
+    if (AppCpp_TaskNbr == 0u) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    AppCpp_Time++;
+    if (AppCpp_Time > APP_CPP_END_TIME) {                       /* See Note #1.                                         */
+        AppCpp_End = DEF_YES;
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    p_task = AppCpp_CurPtr;
+    if ((p_task         != (APP_CPP_TASK *)0) &&
+        (p_task->Remain !=                0u)) {
+        p_task->Remain--;
+        if (p_task->Remain == 0u) {                             /* See Note #2.                                         */
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+    }
+    AppCpp_MissChk();
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                        AppCpp_IdleTaskHook()
+*
+* Description : End the run once it is over & no job runs; called from App_OS_IdleTaskHook().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  AppCpp_IdleTaskHook (void)
+{
+    AppCpp_EndChk();
+}
+
+
+/*
+*********************************************************************************************************
+*                                      AppCpp_SchedLockRptExit()
+*
+* Description : Write the scheduler lock time histogram of each task to APP_CPP_SCHED_LOCK_FILE_NAME when
+*               the run ends.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Registered with atexit() by main().  The file is rewritten by each run.
+*
+*               (2) Bucket 'LtN' counts the lock times below N timestamp timer counts, the last bucket the
+*                   times at or above the previous limit (see OS_SchedLockTimeMeasStop()).  Only the
+*                   tasks which locked the scheduler are written.
+*********************************************************************************************************
+*/
+
+void  AppCpp_SchedLockRptExit (void)
+{
+#if (OS_CFG_SCHED_LOCK_TIME_HIST_NBR > 0u) && (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_TCB           *p_tcb;
+    FILE             *p_fp;
+    CPU_TS_TMR_FREQ   freq;
+    CPU_ERR           err;
+    CPU_INT32U        nbr;
+    CPU_INT08U        i;
+
+
+    if (fopen_s(&p_fp, APP_CPP_SCHED_LOCK_FILE_NAME, "w") != 0) {
+        printf("Cannot open '%s'\n", APP_CPP_SCHED_LOCK_FILE_NAME);
+        return;
+    }
+    freq = CPU_TS_TmrFreqGet(&err);
+    if ((err != CPU_ERR_NONE) || (freq == 0u)) {
+        freq = 1u;
+    }
+
+    fprintf(p_fp, "Task,Nbr,MaxUs,TsFreqHz");                   /* See Note #2.                                         */
+    for (i = 0u; i < (OS_CFG_SCHED_LOCK_TIME_HIST_NBR - 1u); i++) {
+        fprintf(p_fp, ",Lt%lu", 1uL << i);
+    }
+    fprintf(p_fp, ",Ge%lu\n", 1uL << (OS_CFG_SCHED_LOCK_TIME_HIST_NBR - 2u));
+
+    for (p_tcb = OSTaskDbgListPtr; p_tcb != (OS_TCB *)0; p_tcb = p_tcb->DbgNextPtr) {
+        nbr = 0u;
+        for (i = 0u; i < OS_CFG_SCHED_LOCK_TIME_HIST_NBR; i++) {
+            nbr += p_tcb->SchedLockTimeHist[i];
+        }
+        if (nbr == 0u) {
+            continue;
+        }
+        fprintf(p_fp, "%s,%u,%.3f,%u",
+                p_tcb->NamePtr,
+                (unsigned)nbr,
+                (double)p_tcb->SchedLockTimeMax * 1e6 / (double)freq,
+                (unsigned)freq);
+        for (i = 0u; i < OS_CFG_SCHED_LOCK_TIME_HIST_NBR; i++) {
+            fprintf(p_fp, ",%u", (unsigned)p_tcb->SchedLockTimeHist[i]);
+        }
+        fprintf(p_fp, "\n");
+    }
+    fclose(p_fp);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppCpp_Task()
+*
+* Description : Periodic task of the task set.
+*
+* Argument(s) : p_arg       Pointer to the APP_CPP_TASK of the task.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The job consumes its execution time by spinning : the tick hook decrements
+*                   '.Remain' while the job runs.  The resources are checked each time the job sees
+*                   a new tick, as in the OS2 project.
+*
+*               (2) A resource still held at the end of the job (i.e. released at its last tick) is
+*                   released before the completion.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_Task (void  *p_arg)
+{
+    APP_CPP_TASK  *p_task;
+    OS_TICK        tick;
+    CPU_INT08U     res;
+
+
+    p_task = (APP_CPP_TASK *)p_arg;
+    AppCpp_JobWait(p_task);
+
+    while (DEF_TRUE) {                                          /* Task body, always written as an infinite loop.       */
+        AppCmp_TickSeen();
+        tick = AppCpp_Time;
+        while (p_task->Remain != 0u) {                          /* See Note #1.                                         */
+            AppCpp_EndChk();
+            if (tick != AppCpp_Time) {
+                AppCmp_TickSeen();
+                AppCpp_ResChk(p_task);
+                tick = AppCpp_Time;
+            }
+        }
+
+        for (res = 0u; res < APP_CPP_RES_NBR; res++) {          /* See Note #2.                                         */
+            if (p_task->ResHeld[res] == DEF_YES) {
+                AppCpp_ResUnlock(p_task, res);
+            }
+        }
+        AppCpp_JobWait(p_task);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCpp_JobWait()
+*
+* Description : Wait for the release of the next job of a task.
+*
+* Argument(s) : p_task      Pointer to the task.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The delay is to the absolute release time (OS_OPT_TIME_MATCH), so that a job that
+*                   completes late does not shift the following releases.  'AppCpp_Time' is never behind
+*                   'OSTickCtr' since the tick hook runs before the tick task.
+*
+*               (2) When the next job is already released, the completion is logged as a switch of
+*                   the task to itself, like the OS2 project does.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_JobWait (APP_CPP_TASK  *p_task)
+{
+    OS_TICK  release;
+    OS_ERR   os_err;
+    CPU_SR_ALLOC();
+
+
+    while (DEF_TRUE) {
+        AppCpp_EndChk();
+        CPU_CRITICAL_ENTER();
+        if ((p_task->Run    == DEF_YES) &&                      /* Job already started by the switch hook.              */
+            (p_task->Remain !=      0u)) {
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+
+        release = p_task->Arrive + (p_task->Job * p_task->Period);
+        if (p_task->Run == DEF_YES) {
+            release += p_task->Period;
+        }
+        if (release <= AppCpp_Time) {
+            if (p_task->Run == DEF_YES) {                       /* See Note #2.                                         */
+                AppCpp_LogSw(p_task, p_task);
+            }
+            AppCpp_Dispatch(p_task);
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+        CPU_CRITICAL_EXIT();
+
+        OSTimeDly(release,                                      /* See Note #1.                                         */
+                  OS_OPT_TIME_MATCH,
+                 &os_err);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppCpp_ResChk()
+*
+* Description : Lock or unlock the resources due at the current execution time of a job.
+*
+* Argument(s) : p_task      Pointer to the task.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Unlocks are done before locks, R1 before R2, as in the OS2 project.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_ResChk (APP_CPP_TASK  *p_task)
+{
+    OS_TICK     exec;
+    CPU_INT08U  res;
+
+
+    exec = p_task->Exec - p_task->Remain;
+    for (res = 0u; res < APP_CPP_RES_NBR; res++) {
+        if ((p_task->ResHeld[res] == DEF_YES) &&
+            (p_task->ResEnd[res]  == exec)) {
+            AppCpp_ResUnlock(p_task, res);
+        }
+    }
+    for (res = 0u; res < APP_CPP_RES_NBR; res++) {
+        if ((p_task->ResHeld[res]  == DEF_NO) &&
+            (p_task->ResStart[res] != p_task->ResEnd[res]) &&
+            (p_task->ResStart[res] == exec)) {
+            AppCpp_ResLock(p_task, res);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCpp_ResLock()
+*
+* Description : Lock a resource & raise the task to its ceiling.
+*
+* Argument(s) : p_task      Pointer to the task.
+*
+*               res         Resource (see APP_CPP_RES_xxx).
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The task takes the ceiling of the resource, even below the ceiling of a resource it
+*                   already holds, as OSMutexPend() of the OS2 project does.
+*
+*               (2) The scheduler is locked from the pend to the raise, so that no task runs between
+*                   the two, as with the atomic OSMutexPend() of the OS2 project.  The mutex is free
+*                   under the ceiling protocol, so the pend never has to block.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_ResLock (APP_CPP_TASK  *p_task,
+                              CPU_INT08U     res)
+{
+    APP_CMP_MARK  mark;
+    OS_PRIO       prio_before;
+    OS_ERR        os_err;
+
+
+    prio_before = p_task->PrioCur;
+    AppCmp_OvhStart(&mark);
+    OSSchedLock(&os_err);                                       /* See Note #2.                                         */
+    OSMutexPend(&AppCpp_ResTbl[res],
+                 0u,
+                 OS_OPT_PEND_BLOCKING,
+                 (CPU_TS *)0,
+                &os_err);
+    if (os_err != OS_ERR_NONE) {
+        OSSchedUnlock(&os_err);
+        return;
+    }
+    OSTaskChangePrio((OS_TCB *)0,                               /* See Note #1.                                         */
+                      APP_CPP_PRIO_OFFSET + AppCpp_ResCeilTbl[res],
+                     &os_err);
+    OSSchedUnlock(&os_err);
+    AppCmp_OvhStop(APP_CMP_OVH_LOCK, &mark);
+
+    p_task->ResHeld[res] = DEF_YES;
+    p_task->PrioCur      = AppCpp_ResCeilTbl[res];
+    AppCpp_Log("%d\tLockResource\ttask( %d)( %d)\tR%d %d to %d\n",
+               (int)AppCpp_Time, (int)p_task->Id, (int)p_task->Job, (int)(res + 1u),
+               (int)prio_before, (int)p_task->PrioCur);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         AppCpp_ResUnlock()
+*
+* Description : Unlock a resource & lower the task to the ceiling of the other resource it holds, or to
+*               its base priority.
+*
+* Argument(s) : p_task      Pointer to the task.
+*
+*               res         Resource (see APP_CPP_RES_xxx).
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The row is logged first, since lowering the priority may switch to a job released
+*                   meanwhile.  No task waits on the mutex under the ceiling protocol, so posting it
+*                   never switches.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_ResUnlock (APP_CPP_TASK  *p_task,
+                                CPU_INT08U     res)
+{
+    APP_CMP_MARK  mark;
+    OS_PRIO       prio_before;
+    OS_PRIO       prio_new;
+    CPU_INT08U    other;
+    OS_ERR        os_err;
+
+
+    prio_before = p_task->PrioCur;
+    other       = (CPU_INT08U)(APP_CPP_RES_NBR - 1u - res);
+    prio_new    = (p_task->ResHeld[other] == DEF_YES) ? AppCpp_ResCeilTbl[other] : p_task->Prio;
+
+    p_task->ResHeld[res] = DEF_NO;
+    p_task->PrioCur      = prio_new;                            /* See Note #1.                                         */
+    AppCpp_Log("%d\tUnlockResource\ttask( %d)( %d)\tR%d %d to %d\n",
+               (int)AppCpp_Time, (int)p_task->Id, (int)p_task->Job, (int)(res + 1u),
+               (int)prio_before, (int)prio_new);
+
+    AppCmp_OvhStart(&mark);
+    OSMutexPost(&AppCpp_ResTbl[res],
+                 OS_OPT_POST_NONE,
+                &os_err);
+    OSTaskChangePrio((OS_TCB *)0,
+                      APP_CPP_PRIO_OFFSET + prio_new,
+                     &os_err);
+    AppCmp_OvhStop(APP_CMP_OVH_UNLOCK, &mark);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCpp_Dispatch()
+*
+* Description : Make a job the running one, logging the switch & starting the job if needed.
+*
+* Argument(s) : p_task      Pointer to the task switched in, NULL for the idle task.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Must be called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_Dispatch (APP_CPP_TASK  *p_task)
+{
+    if (p_task != AppCpp_CurPtr) {
+        AppCpp_LogSw(AppCpp_CurPtr, p_task);
+    }
+    AppCpp_CurPtr = p_task;
+    if ((p_task      != (APP_CPP_TASK *)0) &&
+        (p_task->Run == DEF_NO)) {
+        p_task->Run    = DEF_YES;
+        p_task->Remain = p_task->Exec;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppCpp_LogSw()
+*
+* Description : Log a switch between two jobs in the format of the OS2 project.
+*
+* Argument(s) : p_out       Pointer to the task switched out, NULL for the idle task.
+*
+*               p_in        Pointer to the task switched in,  NULL for the idle task.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Must be called with interrupts disabled.
+*
+*               (2) Each task of higher priority than the task switched out, whose job is released &
+*                   not completed, is charged the time since its release as blocking, as the OS2
+*                   project does.
+*
+*               (3) A switch of a task to itself shows its next job.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_LogSw (APP_CPP_TASK  *p_out,
+                            APP_CPP_TASK  *p_in)
+{
+    APP_CPP_TASK  *p_task;
+    OS_TICK        release;
+    OS_TICK        response;
+    CPU_INT32U     i;
+    CPU_BOOLEAN    done;
+
+
+    if (p_out != (APP_CPP_TASK *)0) {                           /* See Note #2.                                         */
+        for (i = 0u; i < AppCpp_TaskNbr; i++) {
+            p_task  = &AppCpp_TaskTbl[i];
+            release =  p_task->Arrive + (p_task->Job * p_task->Period);
+            if ((p_task->Prio <  p_out->Prio) &&
+                (AppCpp_Time  >  release)) {
+                p_task->Blocking += AppCpp_Time - release;
+            }
+        }
+    }
+
+    if (AppCpp_Time == 0u) {
+        return;
+    }
+
+    done = ((p_out != (APP_CPP_TASK *)0) && (p_out->Remain == 0u)) ? DEF_YES : DEF_NO;
+    AppCpp_Log("%d%s", (int)AppCpp_Time, (done == DEF_YES) ? "\tCompletion\t" : "\tPreemption\t");
+    if (p_out == (APP_CPP_TASK *)0) {
+        AppCpp_Log("task(%2d)\ttask(%2d)(%2d)",
+                   APP_CPP_PRIO_IDLE, (int)p_in->Id, (int)p_in->Job);
+    } else if (p_in == (APP_CPP_TASK *)0) {
+        AppCpp_Log("task(%2d)(%2d)\ttask(%2d)",
+                   (int)p_out->Id, (int)p_out->Job, APP_CPP_PRIO_IDLE);
+    } else {                                                    /* See Note #3.                                         */
+        AppCpp_Log("task(%2d)(%2d)\ttask(%2d)(%2d)",
+                   (int)p_out->Id, (int)p_out->Job,
+                   (int)p_in->Id,  (int)(p_in->Job + ((p_in == p_out) ? 1u : 0u)));
+    }
+
+    if (done == DEF_NO) {
+        AppCpp_Log("\n");
+        return;
+    }
+
+    response = AppCpp_Time - (p_out->Job * p_out->Period) - p_out->Arrive;
+    AppCpp_Log("\t%d\t\t%d\t\t\t%d\n",
+               (int)response, (int)p_out->Blocking,
+               (int)response - (int)p_out->Exec - (int)p_out->Blocking);
+    p_out->Job++;
+    p_out->Run      = DEF_NO;
+    p_out->Blocking = 0u;
+    AppCpp_MissChk();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCpp_MissChk()
+*
+* Description : End the run if a job is past its deadline, i.e. the release of the next job.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Must be called with interrupts disabled.
+*
+*               (2) Called from the hooks : the process exits from a task (see AppCpp_EndChk()).
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_MissChk (void)
+{
+    APP_CPP_TASK  *p_task;
+    CPU_INT32U     i;
+
+
+    for (i = 0u; i < AppCpp_TaskNbr; i++) {
+        p_task = &AppCpp_TaskTbl[i];
+        if (AppCpp_Time >= (p_task->Arrive + ((p_task->Job + 1u) * p_task->Period))) {
+            AppCpp_Log("%d\tMissDeadline\ttask( %d)( %d)\t\t----------------- \n",
+                       (int)AppCpp_Time, (int)p_task->Id, (int)p_task->Job);
+            AppCpp_End = DEF_YES;                               /* See Note #2.                                         */
+            return;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppCpp_EndChk()
+*
+* Description : Exit the process once the end time is reached or a deadline is missed.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none, if the run is not over.
+*
+* Note(s)     : (1) The hooks only flag the end, since they run in the tick ISR or in the scheduler.
+*                   The process exits from the running task, or from the idle task, so that the atexit()
+*                   handlers never run inside a kernel call.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_EndChk (void)
+{
+    if (AppCpp_End == DEF_YES) {                                /* See Note #1.                                         */
+        exit(0);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            AppCpp_Log()
+*
+* Description : Print to the console & to the event log.
+*
+* Argument(s) : p_fmt       Format string, followed by its arguments.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The log is flushed at once, since AppCmp_RptExit() reads it from an atexit() handler,
+*                   before the C library closes the streams.
+*
+*               (2) Nothing is logged once the run is over, as when the OS2 project exits at once.
+*********************************************************************************************************
+*/
+
+static  void  AppCpp_Log (const  CPU_CHAR  *p_fmt, ...)
+{
+    va_list  args;
+
+
+    if (AppCpp_End == DEF_YES) {                                /* See Note #2.                                         */
+        return;
+    }
+
+    va_start(args, p_fmt);
+    vprintf(p_fmt, args);
+    va_end(args);
+
+    if (AppCpp_OutFilePtr != (FILE *)0) {
+        va_start(args, p_fmt);
+        vfprintf(AppCpp_OutFilePtr, p_fmt, args);
+        va_end(args);
+        fflush(AppCpp_OutFilePtr);                              /* See Note #1.                                         */
+    }
+}
@@ -0,0 +1,135 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                             uC/OS-III
+*                                  CPP/RM TASK SET EXPERIMENT
+*
+* Filename : app_cpp.h
+*
+* Note(s)  : (1) This is the uC/OS-III port of the experiment run by the OS2 project : the same task set
+*                file is loaded, priorities are assigned by Rate Monotonic, R1 & R2 are locked with the
+*                Priority Ceiling Protocol & the same rows are written to APP_CPP_OUTPUT_FILE_NAME, so
+*                that both event logs can be compared with 'golden-diff'.
+*
+*            (2) uC/OS-III mutexes only implement priority inheritance.  The ceiling is applied by the
+*                task itself with OSTaskChangePrio() once the mutex is owned, with the scheduler locked
+*                from the pend to the raise, & removed the same way once it is released.
+*
+*            (3) The priorities of the task set (APP_CPP_PRIO_STEP for the shortest period, ceilings
+*                below it) are logical.  They are offset by APP_CPP_PRIO_OFFSET so that the tick task
+*                always preempts the task set, & the log always shows the logical priorities.
+*
+*            (4) The tick, statistic & timer tasks are transparent : a switch to or from one of them
+*                is not logged, & the time they run is not charged to the task set.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CPP_H
+#define  APP_CPP_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CPP_INPUT_FILE_NAME          "../../OS2/VS/TaskSet.txt"
+#define  APP_CPP_OUTPUT_FILE_NAME         "./Output.txt"
+#define  APP_CPP_SCHED_LOCK_FILE_NAME     "./SchedLock.csv"
+
+#define  APP_CPP_END_TIME                               100u    /* Same as SYSTEM_END_TIME of the OS2 project.          */
+#define  APP_CPP_TASK_MAX                                16u
+#define  APP_CPP_TASK_STK_SIZE                          512u
+#define  APP_CPP_LINE_MAX                               128u
+
+#define  APP_CPP_PRIO_STEP                                3u    /* See Note #3.                                         */
+#define  APP_CPP_PRIO_OFFSET          (OS_CFG_TICK_TASK_PRIO)
+#define  APP_CPP_PRIO_IDLE                               63u    /* Logical priority printed for the idle task.          */
+
+#define  APP_CPP_RES_R1                                   0u
+#define  APP_CPP_RES_R2                                   1u
+#define  APP_CPP_RES_NBR                                  2u
+
+#if ((APP_CPP_PRIO_OFFSET + (APP_CPP_TASK_MAX * APP_CPP_PRIO_STEP)) >= (OS_CFG_PRIO_MAX - 3u))
+#error  "APP_CPP.H, the task set priorities overlap the timer, statistic or idle task"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_cpp_task {
+    OS_TCB                TCB;
+    CPU_STK               Stk[APP_CPP_TASK_STK_SIZE];
+
+    CPU_INT32U            Id;                                   /* ID given in the task set file.                       */
+    OS_TICK               Arrive;
+    OS_TICK               Exec;
+    OS_TICK               Period;
+    OS_TICK               ResStart[APP_CPP_RES_NBR];            /* Exec. time at which each resource is locked, ...     */
+    OS_TICK               ResEnd[APP_CPP_RES_NBR];              /* ... & unlocked; equal if the resource is not used.   */
+
+    OS_PRIO               Prio;                                 /* Logical base priority (see Note #3).                 */
+    OS_PRIO               PrioCur;                              /* Logical current priority.                            */
+    CPU_BOOLEAN           ResHeld[APP_CPP_RES_NBR];
+
+    CPU_INT32U            Job;                                  /* Number of jobs completed.                            */
+    CPU_BOOLEAN           Run;                                  /* Job 'Job' is released & not completed.               */
+    volatile  OS_TICK     Remain;                               /* Execution time left to the job.                      */
+    OS_TICK               Blocking;
+} APP_CPP_TASK;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppCpp_Init          (const  CPU_CHAR  *p_path);
+
+void         AppCpp_TaskCreate    (void);
+
+void         AppCpp_TaskSwHook    (void);
+
+void         AppCpp_TimeTickHook  (void);
+
+void         AppCpp_IdleTaskHook  (void);
+
+void         AppCpp_SchedLockRptExit (void);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -1,4 +1,4 @@
-/*
+﻿/*
 *********************************************************************************************************
 *                                            EXAMPLE CODE
 *
@@ -34,38 +34,19 @@
 *********************************************************************************************************
 */
 
+#include  <stdio.h>
+#include  <stdlib.h>
+
 #include  <cpu.h>
 #include  <lib_mem.h>
+#include  <lib_str.h>
 #include  <os.h>
 
 #include  "os_app_hooks.h"
 #include  "app_cfg.h"
-
-
-/*
-*********************************************************************************************************
-*                                            LOCAL DEFINES
-*********************************************************************************************************
-*/
-
-
-/*
-*********************************************************************************************************
-*                                       LOCAL GLOBAL VARIABLES
-*********************************************************************************************************
-*/
-
-static  OS_TCB   StartupTaskTCB;
-static  CPU_STK  StartupTaskStk[APP_CFG_STARTUP_TASK_STK_SIZE];
-
-
-/*
-*********************************************************************************************************
-*                                         FUNCTION PROTOTYPES
-*********************************************************************************************************
-*/
-
-static  void  StartupTask (void  *p_arg);
+#include  "app_cpp.h"
+#include  "app_check.h"
+#include  "../app_cmp.h"
 
 
 /*
@@ -75,97 +56,63 @@ static  void  StartupTask (void  *p_arg);
 * Description : This is the standard entry point for C code.  It is assumed that your code will call
 *               main() once you have performed all necessary initialization.
 *
-* Arguments   : none
+* Arguments   : argc        Number of command line arguments.
+*
+*               argv        Command line arguments : an optional task set path, APP_CPP_INPUT_FILE_NAME
+*                           by default, or :
+*
+*                               check [<seed>]
+*                                   Check kernel services against what they are expected to do (see
+*                                   app_check.h).
 *
 * Returns     : none
 *
-* Notes       : none
+* Notes       : (1) The task set is scheduled as by the OS2 project (see app_cpp.h), & the row of the run
+*                   is appended to APP_CMP_FILE_NAME when the run ends, together with the critical section
+*                   & scheduler lock histograms of the run.
+*
+*               (2) 'check' starts the kernel itself & does not return (see AppCheck_Run()).
 *********************************************************************************************************
 */
 
-int  main (void)
+int  main (int  argc, char  *argv[])
 {
-    OS_ERR  os_err;
+    const  CPU_CHAR  *p_path;
+           OS_ERR     os_err;
 
 
+    p_path = (argc >= 2) ? argv[1] : APP_CPP_INPUT_FILE_NAME;
+
     CPU_IntInit();
 
     Mem_Init();                                                 /* Initialize Memory Managment Module                   */
     CPU_IntDis();                                               /* Disable all Interrupts                               */
     CPU_Init();                                                 /* Initialize the uC/CPU services                       */
 
-    OSInit(&os_err);                                            /* Initialize uC/OS-III                                 */
-    if (os_err != OS_ERR_NONE) {
-        while (1);
+    if ((argc >= 2) && (Str_Cmp(argv[1], "check") == 0)) {      /* See Note #2.                                         */
+        AppCheck_Run((argc >= 3) ? (CPU_INT32U)strtoul(argv[2], (char **)0, 0) : APP_CHECK_SEED_DFLT);
     }
 
-    App_OS_SetAllHooks();                                       /* Set all applications hooks                           */
-
-    OSTaskCreate(&StartupTaskTCB,                               /* Create the startup task                              */
-                 "Startup Task",
-                  StartupTask,
-                  0u,
-                  APP_CFG_STARTUP_TASK_PRIO,
-                 &StartupTaskStk[0u],
-                  StartupTaskStk[APP_CFG_STARTUP_TASK_STK_SIZE / 10u],
-                  APP_CFG_STARTUP_TASK_STK_SIZE,
-                  0u,
-                  0u,
-                  0u,
-                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
-                 &os_err);
+    OSInit(&os_err);                                            /* Initialize uC/OS-III                                 */
     if (os_err != OS_ERR_NONE) {
         while (1);
     }
 
-    OSStart(&os_err);                                           /* Start multitasking (i.e. give control to uC/OS-III)  */
-
-    while (DEF_ON) {                                            /* Should Never Get Here.                               */
-        ;
+    if (AppCpp_Init(p_path) != DEF_OK) {                        /* Load the task set                                    */
+        return (1);
     }
-}
-
-
-/*
-*********************************************************************************************************
-*                                            STARTUP TASK
-*
-* Description : This is an example of a startup task.  As mentioned in the book's text, you MUST
-*               initialize the ticker only once multitasking has started.
-*
-* Arguments   : p_arg   is the argument passed to 'StartupTask()' by 'OSTaskCreate()'.
-*
-* Returns     : none
-*
-* Notes       : 1) The first line of code is used to prevent a compiler warning because 'p_arg' is not
-*                  used.  The compiler should not generate any code for this statement.
-*********************************************************************************************************
-*/
-
-static  void  StartupTask (void *p_arg)
-{
-    OS_ERR  os_err;
-
 
-   (void)p_arg;
+    App_OS_SetAllHooks();                                       /* Set all applications hooks                           */
 
-    OS_TRACE_INIT();                                            /* Initialize the uC/OS-III Trace recorder              */
+    AppCpp_TaskCreate();                                        /* Create the resources & the tasks of the task set     */
 
-#if OS_CFG_STAT_TASK_EN > 0u
-    OSStatTaskCPUUsageInit(&os_err);                            /* Compute CPU capacity with no task running            */
-#endif
+    AppCmp_Init("uC/OS-III", p_path, APP_CPP_OUTPUT_FILE_NAME, &OSTaskCtxSwCtr);
+    (void)atexit(AppCmp_RptExit);                               /* See Note #1.                                         */
+    (void)atexit(AppCpp_SchedLockRptExit);
 
-#ifdef CPU_CFG_INT_DIS_MEAS_EN
-    CPU_IntDisMeasMaxCurReset();
-#endif
-    
-    APP_TRACE_DBG(("uCOS-III is Running...\n\r"));
+    OSStart(&os_err);                                           /* Start multitasking (i.e. give control to uC/OS-III)  */
 
-    while (DEF_TRUE) {                                          /* Task body, always written as an infinite loop.       */
-        OSTimeDlyHMSM(0u, 0u, 1u, 0u,
-                      OS_OPT_TIME_HMSM_STRICT,
-                      &os_err);
-        APP_TRACE_DBG(("Time: %d\n\r", OSTimeGet(&os_err)));
+    while (DEF_ON) {                                            /* Should Never Get Here.                               */
+        ;
     }
 }
-
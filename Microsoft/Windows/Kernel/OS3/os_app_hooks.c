@@ -35,6 +35,7 @@
 #define   MICRIUM_SOURCE
 #include  <os.h>
 #include  "os_app_hooks.h"
+#include  "app_cpp.h"
 
 
 /*
@@ -133,7 +134,7 @@ void  App_OS_ClrAllHooks (void)
 
 void  App_OS_IdleTaskHook (void)
 {
-
+    AppCpp_IdleTaskHook();
 }
 
 /*
@@ -248,7 +249,7 @@ void  App_OS_TaskReturnHook (OS_TCB  *p_tcb)
 
 void  App_OS_TaskSwHook (void)
 {
-
+    AppCpp_TaskSwHook();
 }
 
 
@@ -266,6 +267,6 @@ void  App_OS_TaskSwHook (void)
 
 void  App_OS_TimeTickHook (void)
 {
-
+    AppCpp_TimeTickHook();
 }
 
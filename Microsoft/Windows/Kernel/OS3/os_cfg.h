@@ -39,15 +39,16 @@
 #define OS_CFG_APP_HOOKS_EN             DEF_ENABLED             /* Enable (DEF_ENABLED) application specific hooks                       */
 #define OS_CFG_ARG_CHK_EN               DEF_ENABLED             /* Enable (DEF_ENABLED) argument checking                                */
 #define OS_CFG_CALLED_FROM_ISR_CHK_EN   DEF_ENABLED             /* Enable (DEF_ENABLED) check for called from ISR                        */
-#define OS_CFG_DBG_EN                   DEF_DISABLED            /* Enable (DEF_ENABLED) debug code/variables                             */
+#define OS_CFG_DBG_EN                   DEF_ENABLED             /* Enable (DEF_ENABLED) debug code/variables                             */
 #define OS_CFG_DYN_TICK_EN              DEF_DISABLED            /* Enable (DEF_ENABLED) the Dynamic Tick                                 */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN  DEF_ENABLED             /* Enable (DEF_ENABLED) checks for invalid kernel calls                  */
 #define OS_CFG_OBJ_TYPE_CHK_EN          DEF_ENABLED             /* Enable (DEF_ENABLED) object type checking                             */
-#define OS_CFG_TS_EN                    DEF_DISABLED            /* Enable (DEF_ENABLED) time stamping                                    */
+#define OS_CFG_TS_EN                    DEF_ENABLED             /* Enable (DEF_ENABLED) time stamping                                    */
 
 #define OS_CFG_PRIO_MAX                 64u                     /* Defines the maximum number of task priorities (see OS_PRIO data type) */
 
-#define OS_CFG_SCHED_LOCK_TIME_MEAS_EN  DEF_DISABLED            /* Include (DEF_ENABLED) code to measure scheduler lock time             */
+#define OS_CFG_SCHED_LOCK_TIME_MEAS_EN  DEF_ENABLED             /* Include (DEF_ENABLED) code to measure scheduler lock time             */
+#define OS_CFG_SCHED_LOCK_TIME_HIST_NBR 16u                     /*     Nbr of buckets of the per-task lock time histogram, 0 = none      */
 #define OS_CFG_SCHED_ROUND_ROBIN_EN     DEF_ENABLED             /* Include (DEF_ENABLED) code for Round-Robin scheduling                 */
 
 #define OS_CFG_STK_SIZE_MIN             64u                     /* Minimum allowable task stack size                                     */
@@ -75,6 +76,8 @@
 #define OS_CFG_Q_DEL_EN                 DEF_ENABLED             /*     Include (DEF_ENABLED) code for OSQDel()                           */
 #define OS_CFG_Q_FLUSH_EN               DEF_ENABLED             /*     Include (DEF_ENABLED) code for OSQFlush()                         */
 #define OS_CFG_Q_PEND_ABORT_EN          DEF_ENABLED             /*     Include (DEF_ENABLED) code for OSQPendAbort()                     */
+#define OS_CFG_MSG_POOL_SHARD_EN        DEF_ENABLED             /* Give each queue its own cache of OS_MSGs (DEF_ENABLED)                */
+#define OS_CFG_MSG_POOL_BATCH           4u                      /*     Number of OS_MSGs a cache takes from the global pool at once      */
 
 
                                                                 /* ---------------------------- SEMAPHORES ----------------------------- */
@@ -87,6 +90,8 @@
                                                                 /* -------------------------- TASK MANAGEMENT -------------------------- */
 #define OS_CFG_STAT_TASK_EN             DEF_ENABLED             /* Enable (DEF_ENABLED) the statistics task                              */
 #define OS_CFG_STAT_TASK_STK_CHK_EN     DEF_ENABLED             /*     Check task stacks (DEF_ENABLED) from the statistic task           */
+#define OS_CFG_STAT_TASK_TS_EN          DEF_ENABLED             /*     Compute CPU usage from timestamps (DEF_ENABLED), no calibration   */
+#define OS_CFG_STAT_TASK_AVG_SHIFT      3u                      /*     Weight of the last window in the moving averages, 1/2^n           */
 
 #define OS_CFG_TASK_CHANGE_PRIO_EN      DEF_ENABLED             /* Include (DEF_ENABLED) code for OSTaskChangePrio()                     */
 #define OS_CFG_TASK_DEL_EN              DEF_ENABLED             /* Include (DEF_ENABLED) code for OSTaskDel()                            */
@@ -109,6 +114,7 @@
                                                                 /* ------------------------- TIME MANAGEMENT --------------------------  */
 #define OS_CFG_TIME_DLY_HMSM_EN         DEF_ENABLED             /* Include (DEF_ENABLED) code for OSTimeDlyHMSM()                        */
 #define OS_CFG_TIME_DLY_RESUME_EN       DEF_ENABLED             /* Include (DEF_ENABLED) code for OSTimeDlyResume()                      */
+#define OS_CFG_TICK_LIST_HEAP_EN        DEF_ENABLED             /* Keep tick lists in pairing heaps (DEF_ENABLED) instead of delta lists */
 
 
                                                                 /* ------------------------- TIMER MANAGEMENT -------------------------- */
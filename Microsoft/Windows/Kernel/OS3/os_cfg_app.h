@@ -54,19 +54,19 @@
 
                                                                 /* ------------------ STATISTIC TASK ------------------ */
 #define  OS_CFG_STAT_TASK_PRIO  ((OS_PRIO)(OS_CFG_PRIO_MAX-2u)) /* Priority                                             */
-#define  OS_CFG_STAT_TASK_RATE_HZ                     10u       /* Rate of execution (1 to 10 Hz)                       */
+#define  OS_CFG_STAT_TASK_RATE_HZ                      1u       /* Rate of execution (below the tick rate)              */
 #define  OS_CFG_STAT_TASK_STK_SIZE                   100u       /* Stack size (number of CPU_STK elements)              */
 
 
                                                                 /* ---------------------- TICKS ----------------------- */
-#define  OS_CFG_TICK_RATE_HZ                        1000u       /* Tick rate in Hertz (10 to 1000 Hz)                   */
+#define  OS_CFG_TICK_RATE_HZ                           5u       /* Tick rate in Hertz, same as the OS2 project          */
 #define  OS_CFG_TICK_TASK_PRIO                        10u       /* Priority                                             */
 #define  OS_CFG_TICK_TASK_STK_SIZE                   100u       /* Stack size (number of CPU_STK elements)              */
 
 
                                                                 /* --------------------- TIMERS ----------------------- */
 #define  OS_CFG_TMR_TASK_PRIO   ((OS_PRIO)(OS_CFG_PRIO_MAX-3u)) /* Priority of 'Timer Task'                             */
-#define  OS_CFG_TMR_TASK_RATE_HZ                      10u       /* Rate for timers (10 Hz Typ.)                         */
+#define  OS_CFG_TMR_TASK_RATE_HZ                       5u       /* Rate for timers (at most the tick rate)              */
 #define  OS_CFG_TMR_TASK_STK_SIZE                    100u       /* Stack size (number of CPU_STK elements)              */
 
 #endif
@@ -0,0 +1,709 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                        uC/OS-II & uC/OS-III
+*                                     KERNEL COMPARISON REPORT
+*
+* Filename : app_cmp.c
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdlib.h>
+#include  <string.h>
+
+#include  <lib_str.h>
+
+#include  "app_cmp.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CMP_LINE_MAX                             256u
+#define  APP_CMP_NAME_MAX                              64u
+#define  APP_CMP_ROW_MAX                               32u
+
+#define  APP_CMP_EVENT_PREEMPT                          0u      /* Event kinds counted in a log.                        */
+#define  APP_CMP_EVENT_COMPLETE                         1u
+#define  APP_CMP_EVENT_LOCK                             2u
+#define  APP_CMP_EVENT_UNLOCK                           3u
+#define  APP_CMP_EVENT_MISS                             4u
+#define  APP_CMP_EVENT_NBR                              5u
+
+#define  APP_CMP_FNV_OFFSET                    0x811C9DC5u      /* 32-bit FNV-1a.                                       */
+#define  APP_CMP_FNV_PRIME                     0x01000193u
+
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_cmp_row {                                  /* One row of APP_CMP_FILE_NAME.                        */
+    CPU_CHAR    Kernel[APP_CMP_NAME_MAX];
+    CPU_CHAR    TaskSet[APP_CMP_NAME_MAX];
+    CPU_INT32U  Ticks;
+    CPU_INT32U  Rows;
+    CPU_INT32U  Events[APP_CMP_EVENT_NBR];
+    CPU_INT32U  Hash;
+    CPU_INT32U  CtxSw;
+    CPU_INT32U  OvhNbr[APP_CMP_OVH_NBR];
+    double      OvhAvg[APP_CMP_OVH_NBR];                        /* In us.                                               */
+    double      OvhMax[APP_CMP_OVH_NBR];
+} APP_CMP_ROW;
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_CHAR  *AppCmp_EventNameTbl[APP_CMP_EVENT_NBR] = {
+    "Preemption", "Completion", "LockResource", "UnlockResource", "MissDeadline"
+};
+
+static  const  CPU_CHAR  *AppCmp_OvhNameTbl[APP_CMP_OVH_NBR] = {
+    "Tick", "Lock", "Unlock"
+};
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  const  CPU_CHAR    *AppCmp_KernelPtr;
+static  const  CPU_CHAR    *AppCmp_TaskSetPathPtr;
+static  const  CPU_CHAR    *AppCmp_LogPathPtr;
+static  const  CPU_INT32U  *AppCmp_CtxSwCtrPtr;
+
+static  APP_CMP_STAT        AppCmp_OvhTbl[APP_CMP_OVH_NBR];
+static  CPU_INT32U          AppCmp_SwCtr;                       /* Context switches seen by the switch hook.            */
+static  CPU_INT32U          AppCmp_TickCtr;
+static  CPU_TS_TMR          AppCmp_TickTs;                      /* Timestamp of the last tick ...                       */
+static  CPU_BOOLEAN         AppCmp_TickPend;                    /* ... not yet seen by a task.                          */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void             AppCmp_StatAdd  (       CPU_INT08U   ovh,
+                                                 CPU_TS_TMR   cycles);
+
+static  CPU_BOOLEAN      AppCmp_LogScan  (const  CPU_CHAR    *p_path,
+                                                 APP_CMP_ROW *p_row);
+
+static  const CPU_CHAR  *AppCmp_BaseName (const  CPU_CHAR    *p_path);
+
+static  CPU_BOOLEAN      AppCmp_RowParse (const  CPU_CHAR    *p_line,
+                                                 APP_CMP_ROW *p_row);
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+static  void             AppCmp_IntDisRpt(       CPU_TS_TMR_FREQ  freq);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            AppCmp_Init()
+*
+* Description : Start the measurements of a run.
+*
+* Argument(s) : p_kernel        Name of the kernel, e.g. "uC/OS-II".
+*
+*               p_taskset_path  Path of the task set being run.
+*
+*               p_log_path      Path of the event log of the run.
+*
+*               p_ctx_sw_ctr    Pointer to the context switch counter of the kernel.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Must be called before the kernel is started; the strings must remain valid until
+*                   AppCmp_RptExit().
+*********************************************************************************************************
+*/
+
+void  AppCmp_Init (const  CPU_CHAR    *p_kernel,
+                   const  CPU_CHAR    *p_taskset_path,
+                   const  CPU_CHAR    *p_log_path,
+                   const  CPU_INT32U  *p_ctx_sw_ctr)
+{
+    AppCmp_KernelPtr      = p_kernel;
+    AppCmp_TaskSetPathPtr = p_taskset_path;
+    AppCmp_LogPathPtr     = p_log_path;
+    AppCmp_CtxSwCtrPtr    = p_ctx_sw_ctr;
+
+    memset(AppCmp_OvhTbl, 0, sizeof(AppCmp_OvhTbl));
+    AppCmp_SwCtr    = 0u;
+    AppCmp_TickCtr  = 0u;
+    AppCmp_TickTs   = 0u;
+    AppCmp_TickPend = DEF_NO;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_TickMark()
+*
+* Description : Record the timestamp of a tick; called from the tick hook of the kernel.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) A tick not seen by any task, e.g. while the idle task runs, is simply replaced.
+*********************************************************************************************************
+*/
+
+void  AppCmp_TickMark (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    AppCmp_TickTs   = CPU_TS_TmrRd();
+    AppCmp_TickPend = DEF_YES;                                  /* See Note #1.                                         */
+    AppCmp_TickCtr++;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_TickSeen()
+*
+* Description : Close the tick overhead sample; called by a task of the task set when it sees a new tick
+*               or starts a job.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+void  AppCmp_TickSeen (void)
+{
+    CPU_TS_TMR  ts;
+    CPU_SR_ALLOC();
+
+
+    ts = CPU_TS_TmrRd();
+    CPU_CRITICAL_ENTER();
+    if (AppCmp_TickPend == DEF_YES) {
+        AppCmp_TickPend = DEF_NO;
+        AppCmp_StatAdd(APP_CMP_OVH_TICK, ts - AppCmp_TickTs);
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppCmp_TaskSw()
+*
+* Description : Count a context switch; called from the task switch hook of the kernel.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Interrupts are disabled during this call.
+*********************************************************************************************************
+*/
+
+void  AppCmp_TaskSw (void)
+{
+    AppCmp_SwCtr++;
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_OvhStart()
+*
+* Description : Start measuring a kernel call.
+*
+* Argument(s) : p_mark      Pointer to the state to pass to AppCmp_OvhStop().
+*
+* Return(s)   : none.
+*********************************************************************************************************
+*/
+
+void  AppCmp_OvhStart (APP_CMP_MARK  *p_mark)
+{
+    p_mark->SwCtr = AppCmp_SwCtr;
+    p_mark->Ts    = CPU_TS_TmrRd();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_OvhStop()
+*
+* Description : Stop measuring a kernel call & keep the sample.
+*
+* Argument(s) : ovh         Kind of overhead (see APP_CMP_OVH_xxx).
+*
+*               p_mark      Pointer to the state filled by AppCmp_OvhStart().
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The sample is dropped if a context switch happened during the call.
+*********************************************************************************************************
+*/
+
+void  AppCmp_OvhStop (       CPU_INT08U     ovh,
+                      const  APP_CMP_MARK  *p_mark)
+{
+    CPU_TS_TMR  ts;
+    CPU_SR_ALLOC();
+
+
+    ts = CPU_TS_TmrRd();
+    CPU_CRITICAL_ENTER();
+    if (AppCmp_SwCtr == p_mark->SwCtr) {                        /* See Note #1.                                         */
+        AppCmp_StatAdd(ovh, ts - p_mark->Ts);
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*                                           AppCmp_RptExit()
+*
+* Description : Append the row of the run to APP_CMP_FILE_NAME when the run ends.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Registered with atexit() by main(), after AppCmp_Init().
+*
+*               (2) The header is written if the file is new.
+*
+*               (3) See 'app_cmp.h  Note #3'.
+*********************************************************************************************************
+*/
+
+void  AppCmp_RptExit (void)
+{
+    APP_CMP_ROW      row;
+    FILE            *p_fp;
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          err;
+    CPU_INT08U       i;
+    long             size;
+
+
+    if (AppCmp_KernelPtr == (const CPU_CHAR *)0) {
+        return;
+    }
+    memset(&row, 0, sizeof(row));
+    if (AppCmp_LogScan(AppCmp_LogPathPtr, &row) != DEF_OK) {
+        printf("Cannot read '%s'\n", AppCmp_LogPathPtr);
+        return;
+    }
+    freq = CPU_TS_TmrFreqGet(&err);
+    if ((err != CPU_ERR_NONE) || (freq == 0u)) {
+        freq = 1u;
+    }
+
+    if (fopen_s(&p_fp, APP_CMP_FILE_NAME, "a") != 0) {
+        printf("Cannot open '%s'\n", APP_CMP_FILE_NAME);
+        return;
+    }
+    fseek(p_fp, 0L, SEEK_END);
+    size = ftell(p_fp);
+    if (size == 0L) {                                           /* See Note #2.                                         */
+        fprintf(p_fp, "Kernel,TaskSet,Ticks,Rows,Preemption,Completion,LockResource,UnlockResource,MissDeadline,"
+                      "LogHash,CtxSw,TickNbr,TickAvgUs,TickMaxUs,LockNbr,LockAvgUs,LockMaxUs,"
+                      "UnlockNbr,UnlockAvgUs,UnlockMaxUs\n");
+    }
+    fprintf(p_fp, "%s,%s,%u,%u,%u,%u,%u,%u,%u,0x%08X,%u",
+            AppCmp_KernelPtr,
+            AppCmp_BaseName(AppCmp_TaskSetPathPtr),
+            (unsigned)AppCmp_TickCtr,
+            (unsigned)row.Rows,
+            (unsigned)row.Events[APP_CMP_EVENT_PREEMPT],
+            (unsigned)row.Events[APP_CMP_EVENT_COMPLETE],
+            (unsigned)row.Events[APP_CMP_EVENT_LOCK],
+            (unsigned)row.Events[APP_CMP_EVENT_UNLOCK],
+            (unsigned)row.Events[APP_CMP_EVENT_MISS],
+            (unsigned)row.Hash,
+            (AppCmp_CtxSwCtrPtr != (const CPU_INT32U *)0) ? (unsigned)*AppCmp_CtxSwCtrPtr : 0u);
+    for (i = 0u; i < APP_CMP_OVH_NBR; i++) {
+        fprintf(p_fp, ",%u,%.3f,%.3f",
+                (unsigned)AppCmp_OvhTbl[i].Nbr,
+                (AppCmp_OvhTbl[i].Nbr != 0u) ? ((double)AppCmp_OvhTbl[i].Tot * 1e6 / (double)freq / (double)AppCmp_OvhTbl[i].Nbr) : 0.0,
+                (double)AppCmp_OvhTbl[i].Max * 1e6 / (double)freq);
+    }
+    fprintf(p_fp, "\n");
+    fclose(p_fp);
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+    AppCmp_IntDisRpt(freq);                                     /* See Note #3.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_RptPrint()
+*
+* Description : Print the runs of APP_CMP_FILE_NAME side by side, one block per task set.
+*
+* Argument(s) : p_path      Path of the file.
+*
+* Return(s)   : DEF_OK,   if the file could be read.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Only the last run of each kernel & task set is shown.  Task sets are matched by file
+*                   name since each project reaches them with its own relative path.
+*
+*               (2) The schedule of a run is the same as the one of the first kernel of the block when the
+*                   hashes of their event logs are equal.  'golden-diff' shows the first diverging row.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  AppCmp_RptPrint (const  CPU_CHAR  *p_path)
+{
+    APP_CMP_ROW  *p_rows;
+    APP_CMP_ROW   row;
+    FILE         *p_fp;
+    CPU_CHAR      line[APP_CMP_LINE_MAX];
+    CPU_INT32U    row_nbr;
+    CPU_INT32U    i;
+    CPU_INT32U    j;
+    CPU_INT32U    first;
+    CPU_BOOLEAN   done[APP_CMP_ROW_MAX];
+    CPU_INT08U    k;
+
+
+    if (fopen_s(&p_fp, p_path, "r") != 0) {
+        printf("Cannot open '%s'\n", p_path);
+        return (DEF_FAIL);
+    }
+    p_rows = (APP_CMP_ROW *)calloc(APP_CMP_ROW_MAX, sizeof(APP_CMP_ROW));
+    if (p_rows == (APP_CMP_ROW *)0) {
+        fclose(p_fp);
+        return (DEF_FAIL);
+    }
+    row_nbr = 0u;
+    while (fgets(line, sizeof(line), p_fp) != NULL) {
+        if (AppCmp_RowParse(line, &row) != DEF_OK) {            /* Skip the header.                                     */
+            continue;
+        }
+        for (i = 0u; i < row_nbr; i++) {                        /* See Note #1.                                         */
+            if ((Str_Cmp(p_rows[i].Kernel,  row.Kernel)  == 0) &&
+                (Str_Cmp(p_rows[i].TaskSet, row.TaskSet) == 0)) {
+                break;
+            }
+        }
+        if (i < row_nbr) {
+            p_rows[i] = row;
+        } else if (row_nbr < APP_CMP_ROW_MAX) {
+            p_rows[row_nbr++] = row;
+        }
+    }
+    fclose(p_fp);
+
+    memset(done, 0, sizeof(done));
+    for (first = 0u; first < row_nbr; first++) {
+        if (done[first] == DEF_YES) {
+            continue;
+        }
+        printf("\nTask set %s\n", p_rows[first].TaskSet);
+        printf("%-20s %6s %6s %6s %6s %6s %6s %6s %10s %-9s %8s",
+               "Kernel", "Ticks", "Rows", "Preemp", "Compl", "Lock", "Unlock", "Miss", "LogHash", "Schedule", "CtxSw");
+        for (k = 0u; k < APP_CMP_OVH_NBR; k++) {
+            printf(" %8s %8s %8s", AppCmp_OvhNameTbl[k], "avg(us)", "max(us)");
+        }
+        printf("\n");
+        for (j = first; j < row_nbr; j++) {
+            if (Str_Cmp(p_rows[j].TaskSet, p_rows[first].TaskSet) != 0) {
+                continue;
+            }
+            done[j] = DEF_YES;
+            printf("%-20s %6u %6u %6u %6u %6u %6u %6u 0x%08X %-9s %8u",
+                   p_rows[j].Kernel,
+                   (unsigned)p_rows[j].Ticks,
+                   (unsigned)p_rows[j].Rows,
+                   (unsigned)p_rows[j].Events[APP_CMP_EVENT_PREEMPT],
+                   (unsigned)p_rows[j].Events[APP_CMP_EVENT_COMPLETE],
+                   (unsigned)p_rows[j].Events[APP_CMP_EVENT_LOCK],
+                   (unsigned)p_rows[j].Events[APP_CMP_EVENT_UNLOCK],
+                   (unsigned)p_rows[j].Events[APP_CMP_EVENT_MISS],
+                   (unsigned)p_rows[j].Hash,
+                   (j == first) ? "ref" : ((p_rows[j].Hash == p_rows[first].Hash) ? "same" : "DIFFERS"),   /* See Note #2. */
+                   (unsigned)p_rows[j].CtxSw);
+            for (k = 0u; k < APP_CMP_OVH_NBR; k++) {
+                printf(" %8u %8.3f %8.3f", (unsigned)p_rows[j].OvhNbr[k], p_rows[j].OvhAvg[k], p_rows[j].OvhMax[k]);
+            }
+            printf("\n");
+        }
+    }
+    free(p_rows);
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_StatAdd()
+*
+* Description : Add a sample to an overhead.
+*
+* Argument(s) : ovh         Kind of overhead (see APP_CMP_OVH_xxx).
+*
+*               cycles      Duration of the sample, in TS cycles.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+static  void  AppCmp_StatAdd (CPU_INT08U  ovh,
+                              CPU_TS_TMR  cycles)
+{
+    APP_CMP_STAT  *p_stat;
+
+
+    p_stat = &AppCmp_OvhTbl[ovh];
+    p_stat->Nbr++;
+    p_stat->Tot += (CPU_INT64U)cycles;
+    if ((CPU_INT64U)cycles > p_stat->Max) {
+        p_stat->Max = (CPU_INT64U)cycles;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_LogScan()
+*
+* Description : Count the rows of an event log by kind & hash them.
+*
+* Argument(s) : p_path      Path of the log, in the 'Output.txt' format.
+*
+*               p_row       Pointer to the row to fill ('.Rows', '.Events[]' & '.Hash').
+*
+* Return(s)   : DEF_OK,   if the log could be read.
+*               DEF_FAIL, otherwise.
+*
+* Note(s)     : (1) Only lines that start with a tick are rows.  The hash covers their text, so that two
+*                   runs with the same hash printed the same schedule.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppCmp_LogScan (const  CPU_CHAR     *p_path,
+                                            APP_CMP_ROW  *p_row)
+{
+    FILE        *p_fp;
+    CPU_CHAR     line[APP_CMP_LINE_MAX];
+    CPU_CHAR    *p_event;
+    CPU_CHAR    *p_char;
+    CPU_INT32U   hash;
+    CPU_INT08U   i;
+
+
+    if (fopen_s(&p_fp, p_path, "r") != 0) {
+        return (DEF_FAIL);
+    }
+    hash = APP_CMP_FNV_OFFSET;
+    while (fgets(line, sizeof(line), p_fp) != NULL) {
+        if ((line[0] < '0') || (line[0] > '9')) {               /* See Note #1.                                         */
+            continue;
+        }
+        p_row->Rows++;
+        for (p_char = line; *p_char != '\0'; p_char++) {
+            hash ^= (CPU_INT32U)(CPU_INT08U)*p_char;
+            hash *= APP_CMP_FNV_PRIME;
+        }
+        p_event = strchr(line, '\t');
+        if (p_event == (CPU_CHAR *)0) {
+            continue;
+        }
+        p_event++;
+        for (i = 0u; i < APP_CMP_EVENT_NBR; i++) {
+            if (Str_Cmp_N(p_event, AppCmp_EventNameTbl[i], Str_Len(AppCmp_EventNameTbl[i])) == 0) {
+                p_row->Events[i]++;
+                break;
+            }
+        }
+    }
+    fclose(p_fp);
+    p_row->Hash = hash;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_BaseName()
+*
+* Description : Get the file name of a path.
+*
+* Argument(s) : p_path      Path, with '/' or '\' separators.
+*
+* Return(s)   : Pointer to the file name within 'p_path'.
+*********************************************************************************************************
+*/
+
+static  const  CPU_CHAR  *AppCmp_BaseName (const  CPU_CHAR  *p_path)
+{
+    const  CPU_CHAR  *p_name;
+
+
+    p_name = p_path;
+    for (; *p_path != '\0'; p_path++) {
+        if ((*p_path == '/') || (*p_path == '\\')) {
+            p_name = p_path + 1;
+        }
+    }
+    return (p_name);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_RowParse()
+*
+* Description : Parse a line of APP_CMP_FILE_NAME.
+*
+* Argument(s) : p_line      Line to parse.
+*
+*               p_row       Pointer to the row to fill.
+*
+* Return(s)   : DEF_OK,   if the line is a row.
+*               DEF_FAIL, otherwise (e.g. the header).
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  AppCmp_RowParse (const  CPU_CHAR     *p_line,
+                                             APP_CMP_ROW  *p_row)
+{
+    unsigned    val[12];
+    double      us[6];
+    int         nbr;
+    CPU_INT08U  i;
+
+
+    memset(p_row, 0, sizeof(APP_CMP_ROW));
+    nbr = sscanf(p_line, "%63[^,],%63[^,],%u,%u,%u,%u,%u,%u,%u,%x,%u,%u,%lf,%lf,%u,%lf,%lf,%u,%lf,%lf",
+                 p_row->Kernel,
+                 p_row->TaskSet,
+                 &val[0], &val[1], &val[2], &val[3], &val[4], &val[5], &val[6], &val[7], &val[8],
+                 &val[9],  &us[0], &us[1],
+                 &val[10], &us[2], &us[3],
+                 &val[11], &us[4], &us[5]);
+    if ((nbr != 20) || (Str_Cmp(p_row->Kernel, "Kernel") == 0)) {
+        return (DEF_FAIL);
+    }
+    p_row->Ticks = val[0];
+    p_row->Rows  = val[1];
+    for (i = 0u; i < APP_CMP_EVENT_NBR; i++) {
+        p_row->Events[i] = val[2u + i];
+    }
+    p_row->Hash  = val[7];
+    p_row->CtxSw = val[8];
+    for (i = 0u; i < APP_CMP_OVH_NBR; i++) {
+        p_row->OvhNbr[i] = val[9u + i];
+        p_row->OvhAvg[i] = us[2u * i];
+        p_row->OvhMax[i] = us[(2u * i) + 1u];
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          AppCmp_IntDisRpt()
+*
+* Description : Write the interrupts disabled time histograms of the critical section sites to
+*               APP_CMP_INT_DIS_FILE_NAME.
+*
+* Argument(s) : freq        Frequency of the timestamp timer, in Hz.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) The file is rewritten by each run.  Bucket 'LtN' counts the times below N counts, the
+*                   last bucket the times at or above the previous limit.
+*
+*               (2) Entry 0 of the site table holds the critical sections entered without a site & the
+*                   ones which found the table full.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_HIST_EN
+static  void  AppCmp_IntDisRpt (CPU_TS_TMR_FREQ  freq)
+{
+    CPU_INT_DIS_MEAS_SITE   site;
+    FILE                   *p_fp;
+    CPU_INT16U              i;
+    CPU_INT08U              j;
+
+
+    if (fopen_s(&p_fp, APP_CMP_INT_DIS_FILE_NAME, "w") != 0) {
+        printf("Cannot open '%s'\n", APP_CMP_INT_DIS_FILE_NAME);
+        return;
+    }
+    fprintf(p_fp, "Kernel,File,Line,Nbr,MaxUs,TsFreqHz");       /* See Note #1.                                         */
+    for (j = 0u; j < (CPU_CFG_INT_DIS_MEAS_HIST_NBR - 1u); j++) {
+        fprintf(p_fp, ",Lt%lu", 1uL << j);
+    }
+    fprintf(p_fp, ",Ge%lu\n", 1uL << (CPU_CFG_INT_DIS_MEAS_HIST_NBR - 2u));
+
+    for (i = 0u; i < CPU_CFG_INT_DIS_MEAS_SITE_NBR; i++) {     /* See Note #2.                                         */
+        if (CPU_IntDisMeasSiteGet(i, &site) != DEF_YES) {
+            continue;
+        }
+        fprintf(p_fp, "%s,%s,%u,%u,%.3f,%u",
+                AppCmp_KernelPtr,
+                (site.FilePtr != (const CPU_CHAR *)0) ? AppCmp_BaseName(site.FilePtr) : "(other)",
+                (unsigned)site.Line,
+                (unsigned)site.Ctr,
+                (double)site.Max_cnts * 1e6 / (double)freq,
+                (unsigned)freq);
+        for (j = 0u; j < CPU_CFG_INT_DIS_MEAS_HIST_NBR; j++) {
+            fprintf(p_fp, ",%u", (unsigned)site.Hist[j]);
+        }
+        fprintf(p_fp, "\n");
+    }
+    fclose(p_fp);
+}
+#endif
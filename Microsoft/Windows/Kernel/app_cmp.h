@@ -0,0 +1,137 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                        uC/OS-II & uC/OS-III
+*                                     KERNEL COMPARISON REPORT
+*
+* Filename : app_cmp.h
+*
+* Note(s)  : (1) Both the OS2 & the OS3 projects run the CPP/RM task set with the same event log.  At
+*                the end of a run, each appends one row to APP_CMP_FILE_NAME with the event counts & a
+*                hash of its log, the kernel's context switch counter & the kernel overhead measured
+*                by the application.  The file sits in the 'Kernel' directory, so that both projects
+*                reach it with the same relative path from their 'VS' directory.
+*
+*            (2) The overhead is measured with the CPU timestamp timer of 'bsp_cpu.c' :
+*
+*                (a) APP_CMP_OVH_TICK   : from the tick hook to the first task of the task set that
+*                                         resumes its work, i.e. the tick ISR & (uC/OS-III) the tick
+*                                         task plus the context switches around them.
+*
+*                (b) APP_CMP_OVH_LOCK   : acquiring a resource, i.e. OSMutexPend() & (uC/OS-III) the
+*                                         priority change to the ceiling.
+*
+*                (c) APP_CMP_OVH_UNLOCK : releasing a resource, i.e. OSMutexPost() & (uC/OS-III) the
+*                                         priority change back.
+*
+*                A sample of (b) or (c) is dropped if a context switch happened during the call, so
+*                that only the cost of the service is kept.
+*
+*            (3) With CPU_CFG_INT_DIS_MEAS_HIST_EN, the histograms of the interrupts disabled time of each
+*                critical section site are also written to APP_CMP_INT_DIS_FILE_NAME, in the 'VS'
+*                directory of the project : one row per site, with the number of critical sections, the
+*                maximum time & the count of each power-of-2 bucket of timestamp timer counts.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CMP_H
+#define  APP_CMP_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <stdio.h>
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+#include  <lib_def.h>
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_CMP_FILE_NAME                "../../Compare.csv"   /* See Note #1.                                         */
+#define  APP_CMP_OS2_LOG_FILE_NAME        "../../OS2/VS/Output.txt"
+#define  APP_CMP_OS3_LOG_FILE_NAME        "../../OS3/VS/Output.txt"
+#define  APP_CMP_INT_DIS_FILE_NAME        "./IntDis.csv"        /* See Note #3.                                         */
+
+#define  APP_CMP_OVH_TICK                                 0u    /* See Note #2.                                         */
+#define  APP_CMP_OVH_LOCK                                 1u
+#define  APP_CMP_OVH_UNLOCK                               2u
+#define  APP_CMP_OVH_NBR                                  3u
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_cmp_stat {                                 /* Samples of one kind of overhead, in TS cycles.       */
+    CPU_INT32U  Nbr;
+    CPU_INT64U  Tot;
+    CPU_INT64U  Max;
+} APP_CMP_STAT;
+
+
+typedef  struct  app_cmp_mark {                                 /* State at the start of a measured kernel call.        */
+    CPU_TS_TMR  Ts;
+    CPU_INT32U  SwCtr;
+} APP_CMP_MARK;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void         AppCmp_Init     (const  CPU_CHAR      *p_kernel,
+                              const  CPU_CHAR      *p_taskset_path,
+                              const  CPU_CHAR      *p_log_path,
+                              const  CPU_INT32U    *p_ctx_sw_ctr);
+
+void         AppCmp_TickMark (void);
+
+void         AppCmp_TickSeen (void);
+
+void         AppCmp_TaskSw   (void);
+
+void         AppCmp_OvhStart (       APP_CMP_MARK  *p_mark);
+
+void         AppCmp_OvhStop  (       CPU_INT08U     ovh,
+                              const  APP_CMP_MARK  *p_mark);
+
+void         AppCmp_RptExit  (void);
+
+CPU_BOOLEAN  AppCmp_RptPrint (const  CPU_CHAR      *p_path);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -100,7 +100,8 @@
 
                                                                 /* Configure CPU timestamp timer word size ...          */
                                                                 /* ... (see Note #2) :                                  */
-#define  CPU_CFG_TS_TMR_SIZE                    CPU_WORD_SIZE_32
+                                                                /* ... 64-bit TSC or perf. counter, see 'bsp_cpu.c'.    */
+#define  CPU_CFG_TS_TMR_SIZE                    CPU_WORD_SIZE_64
 
 
 /*
@@ -120,16 +121,28 @@
 *                   average the interrupts disabled time measurements overhead.
 *
 *                   See also 'cpu_core.c  CPU_IntDisMeasInit()  Note #3a'.
+*
+*               (c) Configure CPU_CFG_INT_DIS_MEAS_HIST_EN to keep a histogram of the interrupts disabled
+*                   times per critical section site, in a table of CPU_CFG_INT_DIS_MEAS_SITE_NBR sites
+*                   with CPU_CFG_INT_DIS_MEAS_HIST_NBR power-of-2 buckets each.
+*
+*                   See also 'cpu_core.h  CPU INTERRUPTS DISABLED TIME HISTOGRAM DATA TYPE'.
 *********************************************************************************************************
 */
 
-#if 0                                                           /* Configure CPU interrupts disabled time ...           */
+#if 1                                                           /* Configure CPU interrupts disabled time ...           */
 #define  CPU_CFG_INT_DIS_MEAS_EN                                /* ... measurements feature (see Note #1a).             */
 #endif
 
                                                                 /* Configure number of interrupts disabled overhead ... */
 #define  CPU_CFG_INT_DIS_MEAS_OVRHD_NBR                    1u   /* ... time measurements (see Note #1b).                */
 
+#if 1                                                           /* Configure per site interrupts disabled time ...      */
+#define  CPU_CFG_INT_DIS_MEAS_HIST_EN                           /* ... histograms (see Note #1c).                       */
+#endif
+#define  CPU_CFG_INT_DIS_MEAS_SITE_NBR                    64u
+#define  CPU_CFG_INT_DIS_MEAS_HIST_NBR                    16u
+
 
 /*
 *********************************************************************************************************
@@ -82,6 +82,43 @@
 #define  LIB_MEM_CFG_OPTIMIZE_ASM_EN    DEF_DISABLED
 
 
+/*
+*********************************************************************************************************
+*                           MEMORY LIBRARY SIMD OPTIMIZATION CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_SIMD_EN to enable/disable the SSE2/AVX2 versions of the memory
+*               functions, selected at run time from the instructions the CPU supports.
+*
+*           (2) Configure LIB_MEM_CFG_SIMD_SIZE_MIN with the smallest buffer size (in octets) handed to the
+*               SIMD versions.  'bench-mem' of the example application measures both versions over a range
+*               of buffer sizes.
+*********************************************************************************************************
+*/
+
+                                                                /* SIMD-optimized function(s).                          */
+                                                                /* Enable/disable SIMD-optimized memory ...             */
+                                                                /* ... function(s). [see Note #1]                       */
+#define  LIB_MEM_CFG_SIMD_EN            DEF_ENABLED
+
+                                                                /* Smallest buffer size (in bytes) [see Note #2].       */
+#define  LIB_MEM_CFG_SIMD_SIZE_MIN               64u
+
+
+/*
+*********************************************************************************************************
+*                            DYNAMIC MEMORY POOL MAGAZINE CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_DYN_POOL_MAG_EN to enable/disable the per-thread caches of free blocks
+*               of dynamic memory pools (see 'lib_mem.h  DYNAMIC MEMORY POOL MAGAZINE DATA TYPE').
+*********************************************************************************************************
+*/
+
+                                                                /* Dynamic memory pool magazines.                       */
+                                                                /* Enable/disable magazines of dynamic memory ...       */
+                                                                /* ... pools. [see Note #1]                             */
+#define  LIB_MEM_CFG_DYN_POOL_MAG_EN    DEF_ENABLED
+
+
 /*
 *********************************************************************************************************
 *                                   MEMORY ALLOCATION CONFIGURATION